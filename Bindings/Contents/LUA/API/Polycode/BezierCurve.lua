@@ -65,25 +65,17 @@ end
 function BezierCurve:getPointAt(a)
 	local retVal = Polycore.BezierCurve_getPointAt(self.__ptr, a)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function BezierCurve:getPointBetween(a, bp1, bp2)
 	local retVal = Polycore.BezierCurve_getPointBetween(self.__ptr, a, bp1.__ptr, bp2.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function BezierCurve:rebuildBuffers()
@@ -9,31 +9,22 @@ function Bone:__index__(name)
 		return Polycore.Bone_get_parentBoneId(self.__ptr)
 	elseif name == "boneMatrix" then
 		retVal = Polycore.Bone_get_boneMatrix(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Matrix4("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "restMatrix" then
 		retVal = Polycore.Bone_get_restMatrix(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Matrix4("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "baseMatrix" then
 		retVal = Polycore.Bone_get_baseMatrix(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Matrix4("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	end
 end
 
@@ -120,13 +111,9 @@ end
 function Bone:getBoneMatrix()
 	local retVal =  Polycore.Bone_getBoneMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:setBoneMatrix(matrix)
@@ -136,49 +123,33 @@ end
 function Bone:getRestMatrix()
 	local retVal =  Polycore.Bone_getRestMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:getFullRestMatrix()
 	local retVal =  Polycore.Bone_getFullRestMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:getParentRestMatrix()
 	local retVal =  Polycore.Bone_getParentRestMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:getFinalMatrix()
 	local retVal =  Polycore.Bone_getFinalMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:setRestMatrix(matrix)
@@ -192,25 +163,17 @@ end
 function Bone:getBaseMatrix()
 	local retVal =  Polycore.Bone_getBaseMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Bone:getFullBaseMatrix()
 	local retVal =  Polycore.Bone_getFullBaseMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 
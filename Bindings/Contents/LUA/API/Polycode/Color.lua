@@ -2,15 +2,17 @@ class "Color"
 
 
 
+local __getters = {
+	r = Polycore.Color_get_r,
+	g = Polycore.Color_get_g,
+	b = Polycore.Color_get_b,
+	a = Polycore.Color_get_a,
+}
+
 function Color:__index__(name)
-	if name == "r" then
-		return Polycore.Color_get_r(self.__ptr)
-	elseif name == "g" then
-		return Polycore.Color_get_g(self.__ptr)
-	elseif name == "b" then
-		return Polycore.Color_get_b(self.__ptr)
-	elseif name == "a" then
-		return Polycore.Color_get_a(self.__ptr)
+	local getter = __getters[name]
+	if getter ~= nil then
+		return getter(self.__ptr)
 	end
 end
 
@@ -43,7 +45,6 @@ function Color:Color(...)
 	end
 	if self.__ptr == nil and arg[1] ~= "__skip_ptr__" then
 		self.__ptr = Polycore.Color(unpack(arg))
-		Polycore.__ptr_lookup[self.__ptr] = self
 	end
 end
 
@@ -86,6 +87,13 @@ function Color:getUint()
 end
 
 
+function Color:__mul(other)
+	local retVal = Polycore.Color__mul(self.__ptr, other.__ptr)
+	local __c = Color("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
 
 function Color:__delete()
 	Polycore.__ptr_lookup[self.__ptr] = nil
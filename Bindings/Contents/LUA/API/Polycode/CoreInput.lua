@@ -34,13 +34,9 @@ end
 function CoreInput:getMousePosition()
 	local retVal =  Polycore.CoreInput_getMousePosition(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function CoreInput:getKeyState(keyCode)
@@ -51,13 +47,9 @@ end
 function CoreInput:getMouseDelta()
 	local retVal =  Polycore.CoreInput_getMouseDelta(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function CoreInput:getMouseButtonState(mouseButton)
@@ -17,13 +17,10 @@ function Entity:__index__(name)
 		return Polycore.Entity_get_renderWireframe(self.__ptr)
 	elseif name == "color" then
 		retVal = Polycore.Entity_get_color(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "enabled" then
 		return Polycore.Entity_get_enabled(self.__ptr)
 	elseif name == "visible" then
@@ -40,13 +37,10 @@ function Entity:__index__(name)
 		return Polycore.Entity_get_depthOnly(self.__ptr)
 	elseif name == "bBox" then
 		retVal = Polycore.Entity_get_bBox(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "ignoreParentMatrix" then
 		return Polycore.Entity_get_ignoreParentMatrix(self.__ptr)
 	elseif name == "isMask" then
@@ -151,37 +145,25 @@ end
 function Entity:getTransformMatrix()
 	local retVal =  Polycore.Entity_getTransformMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getConcatenatedMatrix()
 	local retVal =  Polycore.Entity_getConcatenatedMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getConcatenatedRollMatrix()
 	local retVal =  Polycore.Entity_getConcatenatedRollMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:setTransformByMatrix(matrix)
@@ -195,13 +177,9 @@ end
 function Entity:getLookAtMatrix(loc, upVector)
 	local retVal = Polycore.Entity_getLookAtMatrix(self.__ptr, loc.__ptr, upVector.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:addEntity(newChild)
@@ -235,25 +213,17 @@ end
 function Entity:getPosition()
 	local retVal =  Polycore.Entity_getPosition(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getCombinedPosition()
 	local retVal =  Polycore.Entity_getCombinedPosition(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:setPosition(x, y, z)
@@ -299,25 +269,17 @@ end
 function Entity:getCompoundScale()
 	local retVal =  Polycore.Entity_getCompoundScale(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getScale()
 	local retVal =  Polycore.Entity_getScale(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getCombinedPitch()
@@ -385,13 +347,9 @@ end
 function Entity:getRotationQuat()
 	local retVal =  Polycore.Entity_getRotationQuat(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:lookAt(loc, upVector)
@@ -405,13 +363,9 @@ end
 function Entity:getCombinedColor()
 	local retVal =  Polycore.Entity_getCombinedColor(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Color("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:setColor(r, g, b, a)
@@ -455,13 +409,9 @@ end
 function Entity:getChildCenter()
 	local retVal =  Polycore.Entity_getChildCenter(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:getEntityProp(propName)
@@ -476,13 +426,9 @@ end
 function Entity:buildPositionMatrix()
 	local retVal =  Polycore.Entity_buildPositionMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Entity:adjustMatrixForChildren()
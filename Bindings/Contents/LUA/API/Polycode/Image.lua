@@ -47,13 +47,9 @@ end
 function Image:getPixel(x, y)
 	local retVal = Polycore.Image_getPixel(self.__ptr, x, y)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Color("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Image:swap(v1, v2)
@@ -20,13 +20,10 @@ function InputEvent:__index__(name)
 		return Polycore.InputEvent_get_mouseButton(self.__ptr)
 	elseif name == "mousePosition" then
 		retVal = Polycore.InputEvent_get_mousePosition(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector2("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "key" then
 		retVal = Polycore.InputEvent_get_key(self.__ptr)
 		if Polycore.__ptr_lookup[retVal] ~= nil then
@@ -86,13 +83,9 @@ end
 function InputEvent:getMousePosition()
 	local retVal =  Polycore.InputEvent_getMousePosition(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function InputEvent:getKey()
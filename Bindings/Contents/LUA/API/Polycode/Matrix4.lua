@@ -16,7 +16,6 @@ function Matrix4:Matrix4(...)
 	end
 	if self.__ptr == nil and arg[1] ~= "__skip_ptr__" then
 		self.__ptr = Polycore.Matrix4(unpack(arg))
-		Polycore.__ptr_lookup[self.__ptr] = self
 	end
 end
 
@@ -27,25 +26,17 @@ end
 function Matrix4:rotateVector(v2)
 	local retVal = Polycore.Matrix4_rotateVector(self.__ptr, v2.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Matrix4:getPosition()
 	local retVal =  Polycore.Matrix4_getPosition(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Matrix4:setPosition(x, y, z)
@@ -63,28 +54,35 @@ end
 function Matrix4:inverse()
 	local retVal =  Polycore.Matrix4_inverse(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Matrix4:inverseAffine()
 	local retVal =  Polycore.Matrix4_inverseAffine(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 
+function Matrix4:__add(other)
+	local retVal = Polycore.Matrix4__add(self.__ptr, other.__ptr)
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Matrix4:__mul(other)
+	local retVal = Polycore.Matrix4__mul(self.__ptr, other.__ptr)
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
 
 function Matrix4:__delete()
 	Polycore.__ptr_lookup[self.__ptr] = nil
@@ -99,13 +99,9 @@ end
 function Mesh:recenterMesh()
 	local retVal =  Polycore.Mesh_recenterMesh(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Mesh:useVertexNormals(val)
@@ -149,13 +145,9 @@ end
 function Mesh:calculateBBox()
 	local retVal =  Polycore.Mesh_calculateBBox(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Mesh:hasVertexBuffer()
@@ -7,31 +7,22 @@ MESH_PARTICLE = 1
 function Particle:__index__(name)
 	if name == "velVector" then
 		retVal = Polycore.Particle_get_velVector(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "dirVector" then
 		retVal = Polycore.Particle_get_dirVector(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "deviation" then
 		retVal = Polycore.Particle_get_deviation(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "life" then
 		return Polycore.Particle_get_life(self.__ptr)
 	elseif name == "lifespan" then
@@ -11,31 +11,22 @@ function ParticleEmitter:__index__(name)
 		return Polycore.ParticleEmitter_get_brightnessDeviation(self.__ptr)
 	elseif name == "deviation" then
 		retVal = Polycore.ParticleEmitter_get_deviation(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "dirVector" then
 		retVal = Polycore.ParticleEmitter_get_dirVector(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "gravVector" then
 		retVal = Polycore.ParticleEmitter_get_gravVector(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "lifespan" then
 		return Polycore.ParticleEmitter_get_lifespan(self.__ptr)
 	elseif name == "rotationFollowsPath" then
@@ -203,13 +194,9 @@ end
 function ParticleEmitter:getBaseMatrix()
 	local retVal =  Polycore.ParticleEmitter_getBaseMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function ParticleEmitter:updateEmitter()
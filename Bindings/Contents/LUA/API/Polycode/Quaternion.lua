@@ -2,15 +2,17 @@ class "Quaternion"
 
 
 
+local __getters = {
+	x = Polycore.Quaternion_get_x,
+	y = Polycore.Quaternion_get_y,
+	z = Polycore.Quaternion_get_z,
+	w = Polycore.Quaternion_get_w,
+}
+
 function Quaternion:__index__(name)
-	if name == "x" then
-		return Polycore.Quaternion_get_x(self.__ptr)
-	elseif name == "y" then
-		return Polycore.Quaternion_get_y(self.__ptr)
-	elseif name == "z" then
-		return Polycore.Quaternion_get_z(self.__ptr)
-	elseif name == "w" then
-		return Polycore.Quaternion_get_w(self.__ptr)
+	local getter = __getters[name]
+	if getter ~= nil then
+		return getter(self.__ptr)
 	end
 end
 
@@ -43,7 +45,6 @@ function Quaternion:Quaternion(...)
 	end
 	if self.__ptr == nil and arg[1] ~= "__skip_ptr__" then
 		self.__ptr = Polycore.Quaternion(unpack(arg))
-		Polycore.__ptr_lookup[self.__ptr] = self
 	end
 end
 
@@ -54,13 +55,9 @@ end
 function Quaternion:Slerp(fT, rkP, rkQ, shortestPath)
 	local retVal = Polycore.Quaternion_Slerp(fT, rkP.__ptr, rkQ.__ptr, shortestPath)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:Dot(rkQ)
@@ -71,25 +68,17 @@ end
 function Quaternion:Log()
 	local retVal =  Polycore.Quaternion_Log(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:Exp()
 	local retVal =  Polycore.Quaternion_Exp(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:Norm()
@@ -113,25 +102,17 @@ end
 function Quaternion:Squad(fT, rkP, rkA, rkB, rkQ, shortestPath)
 	local retVal = Polycore.Quaternion_Squad(fT, rkP.__ptr, rkA.__ptr, rkB.__ptr, rkQ.__ptr, shortestPath)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:Inverse()
 	local retVal =  Polycore.Quaternion_Inverse(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:set(w, x, y, z)
@@ -141,13 +122,9 @@ end
 function Quaternion:inverse()
 	local retVal =  Polycore.Quaternion_inverse(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Quaternion:InvSqrt(x)
@@ -174,16 +151,33 @@ end
 function Quaternion:createMatrix()
 	local retVal =  Polycore.Quaternion_createMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Quaternion:__add(other)
+	local retVal = Polycore.Quaternion__add(self.__ptr, other.__ptr)
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Quaternion:__mul(other)
+	local retVal = Polycore.Quaternion__mul(self.__ptr, other.__ptr)
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 
+function Quaternion:__eq(other)
+	local retVal = Polycore.Quaternion__eq(self.__ptr, other.__ptr)
+	return retVal
+end
+
 
 function Quaternion:__delete()
 	Polycore.__ptr_lookup[self.__ptr] = nil
@@ -23,13 +23,9 @@ end
 function QuaternionCurve:interpolate(t, useShortestPath)
 	local retVal = Polycore.QuaternionCurve_interpolate(self.__ptr, t, useShortestPath)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Quaternion("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Quaternion("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function QuaternionCurve:generatePointsFromCurves(wCurve, xCurve, yCurve, zCurve)
@@ -17,33 +17,24 @@ TEX_FILTERING_LINEAR = 1
 function Renderer:__index__(name)
 	if name == "ambientColor" then
 		retVal = Polycore.Renderer_get_ambientColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "clearColor" then
 		retVal = Polycore.Renderer_get_clearColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "exposureLevel" then
 		return Polycore.Renderer_get_exposureLevel(self.__ptr)
 	elseif name == "cameraPosition" then
 		retVal = Polycore.Renderer_get_cameraPosition(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	end
 end
 
@@ -337,13 +328,9 @@ end
 function Renderer:getCameraMatrix()
 	local retVal =  Polycore.Renderer_getCameraMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Renderer:setCameraMatrix(matrix)
@@ -409,25 +396,17 @@ end
 function Renderer:getProjectionMatrix()
 	local retVal =  Polycore.Renderer_getProjectionMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Renderer:getModelviewMatrix()
 	local retVal =  Polycore.Renderer_getModelviewMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Renderer:addShadowMap(texture)
@@ -437,13 +416,9 @@ end
 function Renderer:Unproject(x, y)
 	local retVal = Polycore.Renderer_Unproject(self.__ptr, x, y)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Renderer:sortLights()
@@ -12,33 +12,24 @@ ENTITY_COLLMESH = 4
 function Scene:__index__(name)
 	if name == "clearColor" then
 		retVal = Polycore.Scene_get_clearColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "useClearColor" then
 		return Polycore.Scene_get_useClearColor(self.__ptr)
 	elseif name == "ambientColor" then
 		retVal = Polycore.Scene_get_ambientColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "fogColor" then
 		retVal = Polycore.Scene_get_fogColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "enabled" then
 		return Polycore.Scene_get_enabled(self.__ptr)
 	end
@@ -9,13 +9,10 @@ SPOT_LIGHT = 1
 function SceneLight:__index__(name)
 	if name == "lightColor" then
 		retVal = Polycore.SceneLight_get_lightColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	end
 end
 
@@ -81,13 +78,9 @@ end
 function SceneLight:getLightViewMatrix()
 	local retVal =  Polycore.SceneLight_getLightViewMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function SceneLight:getZBufferTexture()
@@ -71,13 +71,9 @@ end
 function Screen:getScreenOffset()
 	local retVal =  Polycore.Screen_getScreenOffset(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Screen:Shutdown()
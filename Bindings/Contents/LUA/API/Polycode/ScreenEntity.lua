@@ -140,13 +140,9 @@ end
 function ScreenEntity:buildPositionMatrix()
 	local retVal =  Polycore.ScreenEntity_buildPositionMatrix(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Matrix4("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Matrix4("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function ScreenEntity:adjustMatrixForChildren()
@@ -214,13 +210,9 @@ end
 function ScreenEntity:getPosition2D()
 	local retVal =  Polycore.ScreenEntity_getPosition2D(self.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function ScreenEntity:isFocusable()
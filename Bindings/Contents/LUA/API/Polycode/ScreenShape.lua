@@ -12,13 +12,10 @@ function ScreenShape:__index__(name)
 		return Polycore.ScreenShape_get_strokeEnabled(self.__ptr)
 	elseif name == "strokeColor" then
 		retVal = Polycore.ScreenShape_get_strokeColor(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Color("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Color("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "lineSmooth" then
 		return Polycore.ScreenShape_get_lineSmooth(self.__ptr)
 	end
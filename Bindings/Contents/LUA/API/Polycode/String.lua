@@ -3,32 +3,8 @@ class "String"
 
 
 ENCODING_UTF8 = 0
-function String:__index__(name)
-	if name == "contents" then
-		retVal = Polycore.String_get_contents(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = wstring("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
-	elseif name == "s_contents" then
-		retVal = Polycore.String_get_s_contents(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = string("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
-	end
-end
 
 
-function String:__set_callback(name,value)
-	return false
-end
 
 
 function String:String(...)
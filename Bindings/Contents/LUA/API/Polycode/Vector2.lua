@@ -24,7 +24,6 @@ function Vector2:Vector2(...)
 	end
 	if self.__ptr == nil and arg[1] ~= "__skip_ptr__" then
 		self.__ptr = Polycore.Vector2(unpack(arg))
-		Polycore.__ptr_lookup[self.__ptr] = self
 	end
 end
 
@@ -2,13 +2,16 @@ class "Vector3"
 
 
 
+local __getters = {
+	x = Polycore.Vector3_get_x,
+	y = Polycore.Vector3_get_y,
+	z = Polycore.Vector3_get_z,
+}
+
 function Vector3:__index__(name)
-	if name == "x" then
-		return Polycore.Vector3_get_x(self.__ptr)
-	elseif name == "y" then
-		return Polycore.Vector3_get_y(self.__ptr)
-	elseif name == "z" then
-		return Polycore.Vector3_get_z(self.__ptr)
+	local getter = __getters[name]
+	if getter ~= nil then
+		return getter(self.__ptr)
 	end
 end
 
@@ -38,7 +41,6 @@ function Vector3:Vector3(...)
 	end
 	if self.__ptr == nil and arg[1] ~= "__skip_ptr__" then
 		self.__ptr = Polycore.Vector3(unpack(arg))
-		Polycore.__ptr_lookup[self.__ptr] = self
 	end
 end
 
@@ -64,13 +66,9 @@ end
 function Vector3:crossProduct(vec2)
 	local retVal = Polycore.Vector3_crossProduct(self.__ptr, vec2.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function Vector3:Normalize()
@@ -78,6 +76,49 @@ function Vector3:Normalize()
 end
 
 
+function Vector3:__add(other)
+	local retVal = Polycore.Vector3__add(self.__ptr, other.__ptr)
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Vector3:__sub(other)
+	local retVal = Polycore.Vector3__sub(self.__ptr, other.__ptr)
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Vector3:__mul(other)
+	if type(self) == "number" then
+		self, other = other, self
+	end
+	local retVal = Polycore.Vector3__mul(self.__ptr, other)
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Vector3:__div(other)
+	if type(self) == "number" then
+		error("__div: a number cannot be on the left of a Vector3", 2)
+	end
+	local retVal = Polycore.Vector3__div(self.__ptr, other)
+	local __c = Vector3("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
+end
+
+
+function Vector3:__eq(other)
+	local retVal = Polycore.Vector3__eq(self.__ptr, other.__ptr)
+	return retVal
+end
+
 
 function Vector3:__delete()
 	Polycore.__ptr_lookup[self.__ptr] = nil
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Polycode.h>
+#include <new>
 
 extern "C" {
 
@@ -9,6 +10,28 @@ extern "C" {
 #include "lualib.h"
 #include "lauxlib.h"
 
+#ifndef POLYCODE_LUA_VALUE_TYPES
+#define POLYCODE_LUA_VALUE_TYPES
+static inline void luaPolycode_checkpointer(lua_State *L, int idx) {
+	if(!lua_isuserdata(L, idx))
+		luaL_typerror(L, idx, "userdata");
+}
+
+static inline void *luaPolycode_checkvalue(lua_State *L, int idx, const char *metatableName) {
+	// light userdata point at value members of engine objects and carry no type
+	if(lua_islightuserdata(L, idx))
+		return (void*)lua_topointer(L, idx);
+	return luaL_checkudata(L, idx, metatableName);
+}
+
+static inline void *luaPolycode_alloc_value(lua_State *L, size_t size, const char *metatableName) {
+	void *mem = lua_newuserdata(L, size);
+	luaL_getmetatable(L, metatableName);
+	lua_setmetatable(L, -2);
+	return mem;
+}
+#endif
+
 class LuaEventHandler : public EventHandler {
 public:
 	LuaEventHandler() : EventHandler() {}
@@ -24,14 +47,14 @@ public:
 	lua_State *L;
 };
 static int Polycore_OSFILE_get_fileType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFILE *inst = (OSFILE*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->fileType);
 	return 1;
 }
 
 static int Polycore_OSFILE_set_fileType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFILE *inst = (OSFILE*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->fileType = param;
@@ -45,63 +68,63 @@ static int Polycore_OSFILE(lua_State *L) {
 }
 
 static int Polycore_OSFILE_debugDump(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFILE *inst = (OSFILE*)lua_topointer(L, 1);
 	inst->debugDump();
 	return 0;
 }
 
 static int Polycore_delete_OSFILE(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFILE *inst = (OSFILE*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_OSFileEntry_get_name(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->name.c_str());
 	return 1;
 }
 
 static int Polycore_OSFileEntry_get_extension(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->extension.c_str());
 	return 1;
 }
 
 static int Polycore_OSFileEntry_get_nameWithoutExtension(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->nameWithoutExtension.c_str());
 	return 1;
 }
 
 static int Polycore_OSFileEntry_get_basePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->basePath.c_str());
 	return 1;
 }
 
 static int Polycore_OSFileEntry_get_fullPath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->fullPath.c_str());
 	return 1;
 }
 
 static int Polycore_OSFileEntry_get_type(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->type);
 	return 1;
 }
 
 static int Polycore_OSFileEntry_set_name(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->name = param;
@@ -109,7 +132,7 @@ static int Polycore_OSFileEntry_set_name(lua_State *L) {
 }
 
 static int Polycore_OSFileEntry_set_extension(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->extension = param;
@@ -117,7 +140,7 @@ static int Polycore_OSFileEntry_set_extension(lua_State *L) {
 }
 
 static int Polycore_OSFileEntry_set_nameWithoutExtension(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->nameWithoutExtension = param;
@@ -125,7 +148,7 @@ static int Polycore_OSFileEntry_set_nameWithoutExtension(lua_State *L) {
 }
 
 static int Polycore_OSFileEntry_set_basePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->basePath = param;
@@ -133,7 +156,7 @@ static int Polycore_OSFileEntry_set_basePath(lua_State *L) {
 }
 
 static int Polycore_OSFileEntry_set_fullPath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->fullPath = param;
@@ -141,7 +164,7 @@ static int Polycore_OSFileEntry_set_fullPath(lua_State *L) {
 }
 
 static int Polycore_OSFileEntry_set_type(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->type = param;
@@ -155,7 +178,7 @@ static int Polycore_OSFileEntry(lua_State *L) {
 }
 
 static int Polycore_delete_OSFileEntry(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSFileEntry *inst = (OSFileEntry*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -176,42 +199,42 @@ static int Polycore_OSBasics_open(lua_State *L) {
 }
 
 static int Polycore_OSBasics_close(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	OSFILE * file = (OSFILE *)lua_topointer(L, 2);
 	lua_pushinteger(L, OSBasics::close(file));
 	return 1;
 }
 
 static int Polycore_OSBasics_read(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	void * ptr = (void *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t size = *(size_t*)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	size_t count = *(size_t*)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	OSFILE * stream = (OSFILE *)lua_topointer(L, 5);
 	lua_pushinteger(L, OSBasics::read(ptr, size, count, stream));
 	return 1;
 }
 
 static int Polycore_OSBasics_write(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const void * ptr = (const void *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t size = *(size_t*)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	size_t count = *(size_t*)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	OSFILE * stream = (OSFILE *)lua_topointer(L, 5);
 	lua_pushinteger(L, OSBasics::write(ptr, size, count, stream));
 	return 1;
 }
 
 static int Polycore_OSBasics_seek(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	OSFILE * stream = (OSFILE *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	long int offset = *(long int*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	int origin = lua_tointeger(L, 4);
@@ -220,7 +243,7 @@ static int Polycore_OSBasics_seek(lua_State *L) {
 }
 
 static int Polycore_OSBasics_tell(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	OSFILE * stream = (OSFILE *)lua_topointer(L, 2);
 	lua_pushinteger(L, OSBasics::tell(stream));
 	return 1;
@@ -248,7 +271,7 @@ static int Polycore_OSBasics_removeItem(lua_State *L) {
 }
 
 static int Polycore_delete_OSBasics(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	OSBasics *inst = (OSBasics*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -261,7 +284,7 @@ static int Polycore_BezierCurve(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_getControlPoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -275,14 +298,14 @@ static int Polycore_BezierCurve_getControlPoint(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_getNumControlPoints(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumControlPoints());
 	return 1;
 }
 
 static int Polycore_BezierCurve_addControlPoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number p1x = lua_tonumber(L, 2);
@@ -307,7 +330,7 @@ static int Polycore_BezierCurve_addControlPoint(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_addControlPoint3dWithHandles(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number p1x = lua_tonumber(L, 2);
@@ -332,7 +355,7 @@ static int Polycore_BezierCurve_addControlPoint3dWithHandles(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_addControlPoint3d(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -345,7 +368,7 @@ static int Polycore_BezierCurve_addControlPoint3d(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_addControlPoint2dWithHandles(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number p1x = lua_tonumber(L, 2);
@@ -364,7 +387,7 @@ static int Polycore_BezierCurve_addControlPoint2dWithHandles(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_addControlPoint2d(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -375,7 +398,7 @@ static int Polycore_BezierCurve_addControlPoint2d(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_getHeightAt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number a = lua_tonumber(L, 2);
@@ -384,75 +407,73 @@ static int Polycore_BezierCurve_getHeightAt(lua_State *L) {
 }
 
 static int Polycore_BezierCurve_getPointAt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number a = lua_tonumber(L, 2);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getPointAt(a);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_BezierCurve_getPointBetween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number a = lua_tonumber(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	BezierPoint * bp1 = (BezierPoint *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	BezierPoint * bp2 = (BezierPoint *)lua_topointer(L, 4);
-	 Vector3 *retInst = new  Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getPointBetween(a, bp1, bp2);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_BezierCurve_rebuildBuffers(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	inst->rebuildBuffers();
 	return 0;
 }
 
 static int Polycore_delete_BezierCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve *inst = (BezierCurve*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Bone_get_parentBoneId(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->parentBoneId);
 	return 1;
 }
 
 static int Polycore_Bone_get_boneMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->boneMatrix);
 	return 1;
 }
 
 static int Polycore_Bone_get_restMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->restMatrix);
 	return 1;
 }
 
 static int Polycore_Bone_get_baseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->baseMatrix);
 	return 1;
 }
 
 static int Polycore_Bone_set_parentBoneId(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->parentBoneId = param;
@@ -468,7 +489,7 @@ static int Polycore_Bone(lua_State *L) {
 }
 
 static int Polycore_Bone_enableBoneLabel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String labelFont = String(lua_tostring(L, 2));
@@ -476,46 +497,46 @@ static int Polycore_Bone_enableBoneLabel(lua_State *L) {
 	Number size = lua_tonumber(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number scale = lua_tonumber(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Color labelColor = *(Color*)lua_topointer(L, 5);
 	inst->enableBoneLabel(labelFont, size, scale, labelColor);
 	return 0;
 }
 
 static int Polycore_Bone_getName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getName().c_str());
 	return 1;
 }
 
 static int Polycore_Bone_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_Bone_setParentBone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Bone * bone = (Bone *)lua_topointer(L, 2);
 	inst->setParentBone(bone);
 	return 0;
 }
 
 static int Polycore_Bone_addChildBone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Bone * bone = (Bone *)lua_topointer(L, 2);
 	inst->addChildBone(bone);
 	return 0;
 }
 
 static int Polycore_Bone_getParentBone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getParentBone();
 	if(ptrRetVal == NULL) {
@@ -527,14 +548,14 @@ static int Polycore_Bone_getParentBone(lua_State *L) {
 }
 
 static int Polycore_Bone_getNumChildBones(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumChildBones());
 	return 1;
 }
 
 static int Polycore_Bone_getChildBone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -548,104 +569,97 @@ static int Polycore_Bone_getChildBone(lua_State *L) {
 }
 
 static int Polycore_Bone_getBoneMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getBoneMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_setBoneMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setBoneMatrix(matrix);
 	return 0;
 }
 
 static int Polycore_Bone_getRestMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getRestMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_getFullRestMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getFullRestMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_getParentRestMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getParentRestMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_getFinalMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getFinalMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_setRestMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setRestMatrix(matrix);
 	return 0;
 }
 
 static int Polycore_Bone_setBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setBaseMatrix(matrix);
 	return 0;
 }
 
 static int Polycore_Bone_getBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getBaseMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Bone_getFullBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getFullBaseMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_delete_Bone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone *inst = (Bone*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Camera(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene * parentScene = (Scene *)lua_topointer(L, 1);
 	Camera *inst = new Camera(parentScene);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -653,16 +667,16 @@ static int Polycore_Camera(lua_State *L) {
 }
 
 static int Polycore_Camera_buildFrustrumPlanes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	inst->buildFrustrumPlanes();
 	return 0;
 }
 
 static int Polycore_Camera_isSphereInFrustrum(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 pos = *(Vector3*)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fRadius = lua_tonumber(L, 3);
@@ -671,16 +685,16 @@ static int Polycore_Camera_isSphereInFrustrum(lua_State *L) {
 }
 
 static int Polycore_Camera_canSee(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	lua_pushboolean(L, inst->canSee(entity));
 	return 1;
 }
 
 static int Polycore_Camera_setOrthoMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool mode = lua_toboolean(L, 2);
@@ -689,14 +703,14 @@ static int Polycore_Camera_setOrthoMode(lua_State *L) {
 }
 
 static int Polycore_Camera_getOrthoMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->getOrthoMode());
 	return 1;
 }
 
 static int Polycore_Camera_setFOV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number fov = lua_tonumber(L, 2);
@@ -705,53 +719,53 @@ static int Polycore_Camera_setFOV(lua_State *L) {
 }
 
 static int Polycore_Camera_getFOV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getFOV());
 	return 1;
 }
 
 static int Polycore_Camera_setParentScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * parentScene = (Scene *)lua_topointer(L, 2);
 	inst->setParentScene(parentScene);
 	return 0;
 }
 
 static int Polycore_Camera_doCameraTransform(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	inst->doCameraTransform();
 	return 0;
 }
 
 static int Polycore_Camera_setLightDepthTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->setLightDepthTexture(texture);
 	return 0;
 }
 
 static int Polycore_Camera_hasFilterShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->hasFilterShader());
 	return 1;
 }
 
 static int Polycore_Camera_drawFilter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	inst->drawFilter();
 	return 0;
 }
 
 static int Polycore_Camera_setExposureLevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number level = lua_tonumber(L, 2);
@@ -760,23 +774,23 @@ static int Polycore_Camera_setExposureLevel(lua_State *L) {
 }
 
 static int Polycore_Camera_getExposureLevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getExposureLevel());
 	return 1;
 }
 
 static int Polycore_Camera_createPostFilter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Material * shaderMaterial = (Material *)lua_topointer(L, 2);
 	inst->createPostFilter(shaderMaterial);
 	return 0;
 }
 
 static int Polycore_Camera_setPostFilter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String shaderName = String(lua_tostring(L, 2));
@@ -785,49 +799,49 @@ static int Polycore_Camera_setPostFilter(lua_State *L) {
 }
 
 static int Polycore_Camera_removePostFilter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	inst->removePostFilter();
 	return 0;
 }
 
 static int Polycore_delete_Camera(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Camera *inst = (Camera*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Color_get_r(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->r);
 	return 1;
 }
 
 static int Polycore_Color_get_g(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->g);
 	return 1;
 }
 
 static int Polycore_Color_get_b(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->b);
 	return 1;
 }
 
 static int Polycore_Color_get_a(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->a);
 	return 1;
 }
 
 static int Polycore_Color_set_r(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->r = param;
@@ -835,7 +849,7 @@ static int Polycore_Color_set_r(lua_State *L) {
 }
 
 static int Polycore_Color_set_g(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->g = param;
@@ -843,7 +857,7 @@ static int Polycore_Color_set_g(lua_State *L) {
 }
 
 static int Polycore_Color_set_b(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->b = param;
@@ -851,7 +865,7 @@ static int Polycore_Color_set_b(lua_State *L) {
 }
 
 static int Polycore_Color_set_a(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->a = param;
@@ -859,13 +873,12 @@ static int Polycore_Color_set_a(lua_State *L) {
 }
 
 static int Polycore_Color(lua_State *L) {
-	Color *inst = new Color();
-	lua_pushlightuserdata(L, (void*)inst);
+	Color *inst = new (luaPolycode_alloc_value(L, sizeof(Color), "Polycode.Color")) Color();
 	return 1;
 }
 
 static int Polycore_Color_setColorHex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int hex = lua_tointeger(L, 2);
@@ -874,7 +887,7 @@ static int Polycore_Color_setColorHex(lua_State *L) {
 }
 
 static int Polycore_Color_setColorHexRGB(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int hex = lua_tointeger(L, 2);
@@ -883,7 +896,7 @@ static int Polycore_Color_setColorHexRGB(lua_State *L) {
 }
 
 static int Polycore_Color_setColorHSV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number h = lua_tonumber(L, 2);
@@ -896,7 +909,7 @@ static int Polycore_Color_setColorHSV(lua_State *L) {
 }
 
 static int Polycore_Color_setColorRGBA(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int r = lua_tointeger(L, 2);
@@ -911,7 +924,7 @@ static int Polycore_Color_setColorRGBA(lua_State *L) {
 }
 
 static int Polycore_Color_setColorRGB(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int r = lua_tointeger(L, 2);
@@ -924,7 +937,7 @@ static int Polycore_Color_setColorRGB(lua_State *L) {
 }
 
 static int Polycore_Color_setColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -939,33 +952,49 @@ static int Polycore_Color_setColor(lua_State *L) {
 }
 
 static int Polycore_Color_Random(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	inst->Random();
 	return 0;
 }
 
 static int Polycore_Color_getBrightness(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getBrightness());
 	return 1;
 }
 
 static int Polycore_Color_getUint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Color *inst = (Color*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getUint());
 	return 1;
 }
 
 static int Polycore_delete_Color(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	Color *inst = (Color*)lua_topointer(L, 1);
-	delete inst;
+	luaPolycode_checkpointer(L, 1);
+	if(lua_islightuserdata(L, 1)) {
+		Color *inst = (Color*)lua_topointer(L, 1);
+		delete inst;
+	}
+	return 0;
+}
+
+static int Polycore_Color__gc(lua_State *L) {
+	Color *inst = (Color*)lua_touserdata(L, 1);
+	inst->~Color();
 	return 0;
 }
 
+static int Polycore_Color__mul(lua_State *L) {
+	Color lhs = *(Color*)luaPolycode_checkvalue(L, 1, "Polycode.Color");
+	Color rhs = *(Color*)luaPolycode_checkvalue(L, 2, "Polycode.Color");
+	Color *retInst = new (luaPolycode_alloc_value(L, sizeof(Color), "Polycode.Color")) Color();
+	*retInst = lhs * rhs;
+	return 1;
+}
+
 static int Polycore_Config(lua_State *L) {
 	Config *inst = new Config();
 	lua_pushlightuserdata(L, (void*)inst);
@@ -973,7 +1002,7 @@ static int Polycore_Config(lua_State *L) {
 }
 
 static int Polycore_Config_loadConfig(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -984,7 +1013,7 @@ static int Polycore_Config_loadConfig(lua_State *L) {
 }
 
 static int Polycore_Config_saveConfig(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -995,7 +1024,7 @@ static int Polycore_Config_saveConfig(lua_State *L) {
 }
 
 static int Polycore_Config_getEntry(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -1011,7 +1040,7 @@ static int Polycore_Config_getEntry(lua_State *L) {
 }
 
 static int Polycore_Config_setStringValue(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -1024,7 +1053,7 @@ static int Polycore_Config_setStringValue(lua_State *L) {
 }
 
 static int Polycore_Config_setNumericValue(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -1037,7 +1066,7 @@ static int Polycore_Config_setNumericValue(lua_State *L) {
 }
 
 static int Polycore_Config_getNumericValue(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -1048,7 +1077,7 @@ static int Polycore_Config_getNumericValue(lua_State *L) {
 }
 
 static int Polycore_Config_getStringValue(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String configNamespace = String(lua_tostring(L, 2));
@@ -1059,7 +1088,7 @@ static int Polycore_Config_getStringValue(lua_State *L) {
 }
 
 static int Polycore_delete_Config(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Config *inst = (Config*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -1072,21 +1101,21 @@ static int Polycore_PolycodeViewBase(lua_State *L) {
 }
 
 static int Polycore_delete_PolycodeViewBase(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PolycodeViewBase *inst = (PolycodeViewBase*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Core_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->Update());
 	return 1;
 }
 
 static int Polycore_Core_enableMouse(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool newval = lua_toboolean(L, 2);
@@ -1095,7 +1124,7 @@ static int Polycore_Core_enableMouse(lua_State *L) {
 }
 
 static int Polycore_Core_setCursor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int cursorType = lua_tointeger(L, 2);
@@ -1104,34 +1133,34 @@ static int Polycore_Core_setCursor(lua_State *L) {
 }
 
 static int Polycore_Core_createThread(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Threaded * target = (Threaded *)lua_topointer(L, 2);
 	inst->createThread(target);
 	return 0;
 }
 
 static int Polycore_Core_lockMutex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CoreMutex * mutex = (CoreMutex *)lua_topointer(L, 2);
 	inst->lockMutex(mutex);
 	return 0;
 }
 
 static int Polycore_Core_unlockMutex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CoreMutex * mutex = (CoreMutex *)lua_topointer(L, 2);
 	inst->unlockMutex(mutex);
 	return 0;
 }
 
 static int Polycore_Core_createMutex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->createMutex();
 	if(ptrRetVal == NULL) {
@@ -1143,7 +1172,7 @@ static int Polycore_Core_createMutex(lua_State *L) {
 }
 
 static int Polycore_Core_copyStringToClipboard(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String str = String(lua_tostring(L, 2));
@@ -1152,7 +1181,7 @@ static int Polycore_Core_copyStringToClipboard(lua_State *L) {
 }
 
 static int Polycore_Core_getClipboardString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	 String *retInst = new  String();
 	*retInst = inst->getClipboardString();
@@ -1161,7 +1190,7 @@ static int Polycore_Core_getClipboardString(lua_State *L) {
 }
 
 static int Polycore_Core_getServices(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getServices();
 	if(ptrRetVal == NULL) {
@@ -1173,35 +1202,35 @@ static int Polycore_Core_getServices(lua_State *L) {
 }
 
 static int Polycore_Core_getFPS(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getFPS());
 	return 1;
 }
 
 static int Polycore_Core_Shutdown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	inst->Shutdown();
 	return 0;
 }
 
 static int Polycore_Core_isFullscreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isFullscreen());
 	return 1;
 }
 
 static int Polycore_Core_getAALevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getAALevel());
 	return 1;
 }
 
 static int Polycore_Core_getInput(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getInput();
 	if(ptrRetVal == NULL) {
@@ -1213,28 +1242,28 @@ static int Polycore_Core_getInput(lua_State *L) {
 }
 
 static int Polycore_Core_getXRes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getXRes());
 	return 1;
 }
 
 static int Polycore_Core_getYRes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getYRes());
 	return 1;
 }
 
 static int Polycore_Core_getNumVideoModes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumVideoModes());
 	return 1;
 }
 
 static int Polycore_Core_createFolder(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String folderPath = String(lua_tostring(L, 2));
@@ -1243,7 +1272,7 @@ static int Polycore_Core_createFolder(lua_State *L) {
 }
 
 static int Polycore_Core_copyDiskItem(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String itemPath = String(lua_tostring(L, 2));
@@ -1254,7 +1283,7 @@ static int Polycore_Core_copyDiskItem(lua_State *L) {
 }
 
 static int Polycore_Core_moveDiskItem(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String itemPath = String(lua_tostring(L, 2));
@@ -1265,7 +1294,7 @@ static int Polycore_Core_moveDiskItem(lua_State *L) {
 }
 
 static int Polycore_Core_removeDiskItem(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String itemPath = String(lua_tostring(L, 2));
@@ -1274,7 +1303,7 @@ static int Polycore_Core_removeDiskItem(lua_State *L) {
 }
 
 static int Polycore_Core_openFolderPicker(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	 String *retInst = new  String();
 	*retInst = inst->openFolderPicker();
@@ -1283,7 +1312,7 @@ static int Polycore_Core_openFolderPicker(lua_State *L) {
 }
 
 static int Polycore_Core_setVideoModeIndex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -1296,7 +1325,7 @@ static int Polycore_Core_setVideoModeIndex(lua_State *L) {
 }
 
 static int Polycore_Core_setVideoMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int xRes = lua_tointeger(L, 2);
@@ -1311,7 +1340,7 @@ static int Polycore_Core_setVideoMode(lua_State *L) {
 }
 
 static int Polycore_Core_resizeTo(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int xRes = lua_tointeger(L, 2);
@@ -1322,21 +1351,21 @@ static int Polycore_Core_resizeTo(lua_State *L) {
 }
 
 static int Polycore_Core_doSleep(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	inst->doSleep();
 	return 0;
 }
 
 static int Polycore_Core_getElapsed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getElapsed());
 	return 1;
 }
 
 static int Polycore_Core_getTicks(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	 unsigned int *retInst = new  unsigned int();
 	*retInst = inst->getTicks();
@@ -1345,23 +1374,23 @@ static int Polycore_Core_getTicks(lua_State *L) {
 }
 
 static int Polycore_Core_getTicksFloat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getTicksFloat());
 	return 1;
 }
 
 static int Polycore_Core_setUserPointer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	void * ptr = (void *)lua_topointer(L, 2);
 	inst->setUserPointer(ptr);
 	return 0;
 }
 
 static int Polycore_Core_getUserPointer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getUserPointer();
 	if(ptrRetVal == NULL) {
@@ -1373,7 +1402,7 @@ static int Polycore_Core_getUserPointer(lua_State *L) {
 }
 
 static int Polycore_delete_Core(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Core *inst = (Core*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -1386,34 +1415,32 @@ static int Polycore_CoreInput(lua_State *L) {
 }
 
 static int Polycore_CoreInput_getMousePosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getMousePosition();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_CoreInput_getKeyState(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY keyCode = *(PolyKEY*)lua_topointer(L, 2);
 	lua_pushboolean(L, inst->getKeyState(keyCode));
 	return 1;
 }
 
 static int Polycore_CoreInput_getMouseDelta(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getMouseDelta();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_CoreInput_getMouseButtonState(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int mouseButton = lua_tointeger(L, 2);
@@ -1422,7 +1449,7 @@ static int Polycore_CoreInput_getMouseButtonState(lua_State *L) {
 }
 
 static int Polycore_CoreInput_mouseWheelUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int ticks = lua_tointeger(L, 2);
@@ -1431,7 +1458,7 @@ static int Polycore_CoreInput_mouseWheelUp(lua_State *L) {
 }
 
 static int Polycore_CoreInput_mouseWheelDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int ticks = lua_tointeger(L, 2);
@@ -1440,7 +1467,7 @@ static int Polycore_CoreInput_mouseWheelDown(lua_State *L) {
 }
 
 static int Polycore_CoreInput_setMouseButtonState(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int mouseButton = lua_tointeger(L, 2);
@@ -1453,7 +1480,7 @@ static int Polycore_CoreInput_setMouseButtonState(lua_State *L) {
 }
 
 static int Polycore_CoreInput_setMousePosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -1466,11 +1493,11 @@ static int Polycore_CoreInput_setMousePosition(lua_State *L) {
 }
 
 static int Polycore_CoreInput_setKeyState(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY keyCode = *(PolyKEY*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	wchar_t code = *(wchar_t*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TBOOLEAN);
 	bool newState = lua_toboolean(L, 4);
@@ -1481,7 +1508,7 @@ static int Polycore_CoreInput_setKeyState(lua_State *L) {
 }
 
 static int Polycore_CoreInput_setDeltaPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -1492,7 +1519,7 @@ static int Polycore_CoreInput_setDeltaPosition(lua_State *L) {
 }
 
 static int Polycore_CoreInput_createEvent(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Event * event = (Event *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)CoreInput::createEvent(event);
 	if(ptrRetVal == NULL) {
@@ -1504,7 +1531,7 @@ static int Polycore_CoreInput_createEvent(lua_State *L) {
 }
 
 static int Polycore_delete_CoreInput(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreInput *inst = (CoreInput*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -1521,7 +1548,7 @@ static int Polycore_CoreServices_getInstance(lua_State *L) {
 }
 
 static int Polycore_CoreServices_setInstance(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CoreServices * _instance = (CoreServices *)lua_topointer(L, 2);
 	CoreServices::setInstance(_instance);
 	return 0;
@@ -1538,16 +1565,16 @@ static int Polycore_CoreServices_getRenderMutex(lua_State *L) {
 }
 
 static int Polycore_CoreServices_setRenderer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Renderer * r_enderer = (Renderer *)lua_topointer(L, 2);
 	inst->setRenderer(r_enderer);
 	return 0;
 }
 
 static int Polycore_CoreServices_getRenderer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getRenderer();
 	if(ptrRetVal == NULL) {
@@ -1559,7 +1586,7 @@ static int Polycore_CoreServices_getRenderer(lua_State *L) {
 }
 
 static int Polycore_CoreServices_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int elapsed = lua_tointeger(L, 2);
@@ -1568,16 +1595,16 @@ static int Polycore_CoreServices_Update(lua_State *L) {
 }
 
 static int Polycore_CoreServices_setCore(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Core * core = (Core *)lua_topointer(L, 2);
 	inst->setCore(core);
 	return 0;
 }
 
 static int Polycore_CoreServices_getCore(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getCore();
 	if(ptrRetVal == NULL) {
@@ -1589,16 +1616,16 @@ static int Polycore_CoreServices_getCore(lua_State *L) {
 }
 
 static int Polycore_CoreServices_installModule(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolycodeModule * module = (PolycodeModule *)lua_topointer(L, 2);
 	inst->installModule(module);
 	return 0;
 }
 
 static int Polycore_CoreServices_getMaterialManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getMaterialManager();
 	if(ptrRetVal == NULL) {
@@ -1610,7 +1637,7 @@ static int Polycore_CoreServices_getMaterialManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getScreenManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getScreenManager();
 	if(ptrRetVal == NULL) {
@@ -1622,7 +1649,7 @@ static int Polycore_CoreServices_getScreenManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getSceneManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSceneManager();
 	if(ptrRetVal == NULL) {
@@ -1634,7 +1661,7 @@ static int Polycore_CoreServices_getSceneManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getTimerManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTimerManager();
 	if(ptrRetVal == NULL) {
@@ -1646,7 +1673,7 @@ static int Polycore_CoreServices_getTimerManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getTweenManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTweenManager();
 	if(ptrRetVal == NULL) {
@@ -1658,7 +1685,7 @@ static int Polycore_CoreServices_getTweenManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getResourceManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getResourceManager();
 	if(ptrRetVal == NULL) {
@@ -1670,7 +1697,7 @@ static int Polycore_CoreServices_getResourceManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getSoundManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSoundManager();
 	if(ptrRetVal == NULL) {
@@ -1682,7 +1709,7 @@ static int Polycore_CoreServices_getSoundManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getFontManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getFontManager();
 	if(ptrRetVal == NULL) {
@@ -1694,7 +1721,7 @@ static int Polycore_CoreServices_getFontManager(lua_State *L) {
 }
 
 static int Polycore_CoreServices_getConfig(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getConfig();
 	if(ptrRetVal == NULL) {
@@ -1706,24 +1733,24 @@ static int Polycore_CoreServices_getConfig(lua_State *L) {
 }
 
 static int Polycore_delete_CoreServices(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CoreServices *inst = (CoreServices*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Cubemap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture * t0 = (Texture *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * t1 = (Texture *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * t2 = (Texture *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Texture * t3 = (Texture *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Texture * t4 = (Texture *)lua_topointer(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	Texture * t5 = (Texture *)lua_topointer(L, 6);
 	Cubemap *inst = new Cubemap(t0, t1, t2, t3, t4, t5);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -1731,7 +1758,7 @@ static int Polycore_Cubemap(lua_State *L) {
 }
 
 static int Polycore_delete_Cubemap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Cubemap *inst = (Cubemap*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -1744,7 +1771,7 @@ static int Polycore_Data(lua_State *L) {
 }
 
 static int Polycore_Data_loadFromFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -1753,7 +1780,7 @@ static int Polycore_Data_loadFromFile(lua_State *L) {
 }
 
 static int Polycore_Data_getAsString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int encoding = lua_tointeger(L, 2);
@@ -1762,7 +1789,7 @@ static int Polycore_Data_getAsString(lua_State *L) {
 }
 
 static int Polycore_Data_setFromString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String str = String(lua_tostring(L, 2));
@@ -1773,7 +1800,7 @@ static int Polycore_Data_setFromString(lua_State *L) {
 }
 
 static int Polycore_Data_saveToFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -1782,7 +1809,7 @@ static int Polycore_Data_saveToFile(lua_State *L) {
 }
 
 static int Polycore_Data_getData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getData();
 	if(ptrRetVal == NULL) {
@@ -1794,133 +1821,133 @@ static int Polycore_Data_getData(lua_State *L) {
 }
 
 static int Polycore_delete_Data(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Data *inst = (Data*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Entity_get_custEntityType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->custEntityType.c_str());
 	return 1;
 }
 
 static int Polycore_Entity_get_billboardMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->billboardMode);
 	return 1;
 }
 
 static int Polycore_Entity_get_billboardRoll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->billboardRoll);
 	return 1;
 }
 
 static int Polycore_Entity_get_alphaTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->alphaTest);
 	return 1;
 }
 
 static int Polycore_Entity_get_backfaceCulled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->backfaceCulled);
 	return 1;
 }
 
 static int Polycore_Entity_get_renderWireframe(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->renderWireframe);
 	return 1;
 }
 
 static int Polycore_Entity_get_color(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->color);
 	return 1;
 }
 
 static int Polycore_Entity_get_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->enabled);
 	return 1;
 }
 
 static int Polycore_Entity_get_visible(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->visible);
 	return 1;
 }
 
 static int Polycore_Entity_get_depthWrite(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->depthWrite);
 	return 1;
 }
 
 static int Polycore_Entity_get_depthTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->depthTest);
 	return 1;
 }
 
 static int Polycore_Entity_get_blendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->blendingMode);
 	return 1;
 }
 
 static int Polycore_Entity_get_colorAffectsChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->colorAffectsChildren);
 	return 1;
 }
 
 static int Polycore_Entity_get_depthOnly(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->depthOnly);
 	return 1;
 }
 
 static int Polycore_Entity_get_bBox(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->bBox);
 	return 1;
 }
 
 static int Polycore_Entity_get_ignoreParentMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->ignoreParentMatrix);
 	return 1;
 }
 
 static int Polycore_Entity_get_isMask(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isMask);
 	return 1;
 }
 
 static int Polycore_Entity_set_custEntityType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->custEntityType = param;
@@ -1928,7 +1955,7 @@ static int Polycore_Entity_set_custEntityType(lua_State *L) {
 }
 
 static int Polycore_Entity_set_billboardMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->billboardMode = param;
@@ -1936,7 +1963,7 @@ static int Polycore_Entity_set_billboardMode(lua_State *L) {
 }
 
 static int Polycore_Entity_set_billboardRoll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->billboardRoll = param;
@@ -1944,7 +1971,7 @@ static int Polycore_Entity_set_billboardRoll(lua_State *L) {
 }
 
 static int Polycore_Entity_set_alphaTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->alphaTest = param;
@@ -1952,7 +1979,7 @@ static int Polycore_Entity_set_alphaTest(lua_State *L) {
 }
 
 static int Polycore_Entity_set_backfaceCulled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->backfaceCulled = param;
@@ -1960,7 +1987,7 @@ static int Polycore_Entity_set_backfaceCulled(lua_State *L) {
 }
 
 static int Polycore_Entity_set_renderWireframe(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->renderWireframe = param;
@@ -1968,7 +1995,7 @@ static int Polycore_Entity_set_renderWireframe(lua_State *L) {
 }
 
 static int Polycore_Entity_set_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->enabled = param;
@@ -1976,7 +2003,7 @@ static int Polycore_Entity_set_enabled(lua_State *L) {
 }
 
 static int Polycore_Entity_set_visible(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->visible = param;
@@ -1984,7 +2011,7 @@ static int Polycore_Entity_set_visible(lua_State *L) {
 }
 
 static int Polycore_Entity_set_depthWrite(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->depthWrite = param;
@@ -1992,7 +2019,7 @@ static int Polycore_Entity_set_depthWrite(lua_State *L) {
 }
 
 static int Polycore_Entity_set_depthTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->depthTest = param;
@@ -2000,7 +2027,7 @@ static int Polycore_Entity_set_depthTest(lua_State *L) {
 }
 
 static int Polycore_Entity_set_blendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->blendingMode = param;
@@ -2008,7 +2035,7 @@ static int Polycore_Entity_set_blendingMode(lua_State *L) {
 }
 
 static int Polycore_Entity_set_colorAffectsChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->colorAffectsChildren = param;
@@ -2016,7 +2043,7 @@ static int Polycore_Entity_set_colorAffectsChildren(lua_State *L) {
 }
 
 static int Polycore_Entity_set_depthOnly(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->depthOnly = param;
@@ -2024,7 +2051,7 @@ static int Polycore_Entity_set_depthOnly(lua_State *L) {
 }
 
 static int Polycore_Entity_set_ignoreParentMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->ignoreParentMatrix = param;
@@ -2032,7 +2059,7 @@ static int Polycore_Entity_set_ignoreParentMatrix(lua_State *L) {
 }
 
 static int Polycore_Entity_set_isMask(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->isMask = param;
@@ -2046,35 +2073,35 @@ static int Polycore_Entity(lua_State *L) {
 }
 
 static int Polycore_Entity_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_Entity_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_Entity_transformAndRender(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->transformAndRender();
 	return 0;
 }
 
 static int Polycore_Entity_renderChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->renderChildren();
 	return 0;
 }
 
 static int Polycore_Entity_dirtyMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -2083,115 +2110,111 @@ static int Polycore_Entity_dirtyMatrix(lua_State *L) {
 }
 
 static int Polycore_Entity_rebuildTransformMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->rebuildTransformMatrix();
 	return 0;
 }
 
 static int Polycore_Entity_updateEntityMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->updateEntityMatrix();
 	return 0;
 }
 
 static int Polycore_Entity_getTransformMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getTransformMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getConcatenatedMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getConcatenatedMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getConcatenatedRollMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getConcatenatedRollMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_setTransformByMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setTransformByMatrix(matrix);
 	return 0;
 }
 
 static int Polycore_Entity_setTransformByMatrixPure(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setTransformByMatrixPure(matrix);
 	return 0;
 }
 
 static int Polycore_Entity_getLookAtMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & loc = *( Vector3 *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & upVector = *( Vector3 *)lua_topointer(L, 3);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getLookAtMatrix(loc, upVector);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_addEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * newChild = (Entity *)lua_topointer(L, 2);
 	inst->addEntity(newChild);
 	return 0;
 }
 
 static int Polycore_Entity_addChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * newChild = (Entity *)lua_topointer(L, 2);
 	inst->addChild(newChild);
 	return 0;
 }
 
 static int Polycore_Entity_removeChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * entityToRemove = (Entity *)lua_topointer(L, 2);
 	inst->removeChild(entityToRemove);
 	return 0;
 }
 
 static int Polycore_Entity_setParentEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * entity = (Entity *)lua_topointer(L, 2);
 	inst->setParentEntity(entity);
 	return 0;
 }
 
 static int Polycore_Entity_getParentEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getParentEntity();
 	if(ptrRetVal == NULL) {
@@ -2203,25 +2226,23 @@ static int Polycore_Entity_getParentEntity(lua_State *L) {
 }
 
 static int Polycore_Entity_getPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getPosition();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getCombinedPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getCombinedPosition();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_setPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2234,7 +2255,7 @@ static int Polycore_Entity_setPosition(lua_State *L) {
 }
 
 static int Polycore_Entity_setPositionX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2243,7 +2264,7 @@ static int Polycore_Entity_setPositionX(lua_State *L) {
 }
 
 static int Polycore_Entity_setPositionY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number y = lua_tonumber(L, 2);
@@ -2252,7 +2273,7 @@ static int Polycore_Entity_setPositionY(lua_State *L) {
 }
 
 static int Polycore_Entity_Translate(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2265,7 +2286,7 @@ static int Polycore_Entity_Translate(lua_State *L) {
 }
 
 static int Polycore_Entity_setPositionZ(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number z = lua_tonumber(L, 2);
@@ -2274,7 +2295,7 @@ static int Polycore_Entity_setPositionZ(lua_State *L) {
 }
 
 static int Polycore_Entity_setScaleX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2283,7 +2304,7 @@ static int Polycore_Entity_setScaleX(lua_State *L) {
 }
 
 static int Polycore_Entity_setScaleY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number y = lua_tonumber(L, 2);
@@ -2292,7 +2313,7 @@ static int Polycore_Entity_setScaleY(lua_State *L) {
 }
 
 static int Polycore_Entity_setScaleZ(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number z = lua_tonumber(L, 2);
@@ -2301,7 +2322,7 @@ static int Polycore_Entity_setScaleZ(lua_State *L) {
 }
 
 static int Polycore_Entity_Scale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2314,7 +2335,7 @@ static int Polycore_Entity_Scale(lua_State *L) {
 }
 
 static int Polycore_Entity_setScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -2327,53 +2348,51 @@ static int Polycore_Entity_setScale(lua_State *L) {
 }
 
 static int Polycore_Entity_getCompoundScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getCompoundScale();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getScale();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getCombinedPitch(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getCombinedPitch());
 	return 1;
 }
 
 static int Polycore_Entity_getCombinedYaw(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getCombinedYaw());
 	return 1;
 }
 
 static int Polycore_Entity_getCombinedRoll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getCombinedRoll());
 	return 1;
 }
 
 static int Polycore_Entity_rebuildRotation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->rebuildRotation();
 	return 0;
 }
 
 static int Polycore_Entity_setPitch(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number pitch = lua_tonumber(L, 2);
@@ -2382,7 +2401,7 @@ static int Polycore_Entity_setPitch(lua_State *L) {
 }
 
 static int Polycore_Entity_setYaw(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number yaw = lua_tonumber(L, 2);
@@ -2391,7 +2410,7 @@ static int Polycore_Entity_setYaw(lua_State *L) {
 }
 
 static int Polycore_Entity_setRoll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number roll = lua_tonumber(L, 2);
@@ -2400,7 +2419,7 @@ static int Polycore_Entity_setRoll(lua_State *L) {
 }
 
 static int Polycore_Entity_Roll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number roll = lua_tonumber(L, 2);
@@ -2409,7 +2428,7 @@ static int Polycore_Entity_Roll(lua_State *L) {
 }
 
 static int Polycore_Entity_Yaw(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number yaw = lua_tonumber(L, 2);
@@ -2418,7 +2437,7 @@ static int Polycore_Entity_Yaw(lua_State *L) {
 }
 
 static int Polycore_Entity_Pitch(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number pitch = lua_tonumber(L, 2);
@@ -2427,28 +2446,28 @@ static int Polycore_Entity_Pitch(lua_State *L) {
 }
 
 static int Polycore_Entity_getPitch(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getPitch());
 	return 1;
 }
 
 static int Polycore_Entity_getYaw(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getYaw());
 	return 1;
 }
 
 static int Polycore_Entity_getRoll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getRoll());
 	return 1;
 }
 
 static int Polycore_Entity_setRotationQuat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number w = lua_tonumber(L, 2);
@@ -2463,47 +2482,45 @@ static int Polycore_Entity_setRotationQuat(lua_State *L) {
 }
 
 static int Polycore_Entity_getRotationQuat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->getRotationQuat();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_lookAt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & loc = *( Vector3 *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & upVector = *( Vector3 *)lua_topointer(L, 3);
 	inst->lookAt(loc, upVector);
 	return 0;
 }
 
 static int Polycore_Entity_lookAtEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * entity = (Entity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & upVector = *( Vector3 *)lua_topointer(L, 3);
 	inst->lookAtEntity(entity, upVector);
 	return 0;
 }
 
 static int Polycore_Entity_getCombinedColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Color *retInst = new Color();
+	Color *retInst = new (luaPolycode_alloc_value(L, sizeof(Color), "Polycode.Color")) Color();
 	*retInst = inst->getCombinedColor();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_setColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -2518,7 +2535,7 @@ static int Polycore_Entity_setColor(lua_State *L) {
 }
 
 static int Polycore_Entity_setColorInt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int r = lua_tointeger(L, 2);
@@ -2533,28 +2550,28 @@ static int Polycore_Entity_setColorInt(lua_State *L) {
 }
 
 static int Polycore_Entity_recalculateBBox(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->recalculateBBox();
 	return 0;
 }
 
 static int Polycore_Entity_getBBoxRadius(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getBBoxRadius());
 	return 1;
 }
 
 static int Polycore_Entity_getCompoundBBoxRadius(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getCompoundBBoxRadius());
 	return 1;
 }
 
 static int Polycore_Entity_setBBoxRadius(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number rad = lua_tonumber(L, 2);
@@ -2563,23 +2580,23 @@ static int Polycore_Entity_setBBoxRadius(lua_State *L) {
 }
 
 static int Polycore_Entity_setMask(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * mask = (Entity *)lua_topointer(L, 2);
 	inst->setMask(mask);
 	return 0;
 }
 
 static int Polycore_Entity_clearMask(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->clearMask();
 	return 0;
 }
 
 static int Polycore_Entity_setBlendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int newBl_endingMode = lua_tointeger(L, 2);
@@ -2588,16 +2605,15 @@ static int Polycore_Entity_setBlendingMode(lua_State *L) {
 }
 
 static int Polycore_Entity_getChildCenter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getChildCenter();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_getEntityProp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String propName = String(lua_tostring(L, 2));
@@ -2606,39 +2622,38 @@ static int Polycore_Entity_getEntityProp(lua_State *L) {
 }
 
 static int Polycore_Entity_doUpdates(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->doUpdates();
 	return 0;
 }
 
 static int Polycore_Entity_buildPositionMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	 Matrix4 *retInst = new  Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->buildPositionMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Entity_adjustMatrixForChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	inst->adjustMatrixForChildren();
 	return 0;
 }
 
 static int Polycore_Entity_setRenderer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Renderer * r_enderer = (Renderer *)lua_topointer(L, 2);
 	inst->setRenderer(r_enderer);
 	return 0;
 }
 
 static int Polycore_delete_Entity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Entity *inst = (Entity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2651,14 +2666,14 @@ static int Polycore_Event(lua_State *L) {
 }
 
 static int Polycore_Event_getEventCode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getEventCode());
 	return 1;
 }
 
 static int Polycore_Event_getDispatcher(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getDispatcher();
 	if(ptrRetVal == NULL) {
@@ -2670,7 +2685,7 @@ static int Polycore_Event_getDispatcher(lua_State *L) {
 }
 
 static int Polycore_Event_setEventCode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 2);
@@ -2679,23 +2694,23 @@ static int Polycore_Event_setEventCode(lua_State *L) {
 }
 
 static int Polycore_Event_setDispatcher(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	EventDispatcher * dispatcher = (EventDispatcher *)lua_topointer(L, 2);
 	inst->setDispatcher(dispatcher);
 	return 0;
 }
 
 static int Polycore_Event_getEventType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getEventType().c_str());
 	return 1;
 }
 
 static int Polycore_delete_Event(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Event *inst = (Event*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2708,25 +2723,25 @@ static int Polycore_EventDispatcher(lua_State *L) {
 }
 
 static int Polycore_EventDispatcher_removeAllHandlers(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
 	inst->removeAllHandlers();
 	return 0;
 }
 
 static int Polycore_EventDispatcher_removeAllHandlersForListener(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	void * listener = (void *)lua_topointer(L, 2);
 	inst->removeAllHandlersForListener(listener);
 	return 0;
 }
 
 static int Polycore_EventDispatcher_addEventListener(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	EventHandler * handler = (EventHandler *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 3);
@@ -2735,9 +2750,9 @@ static int Polycore_EventDispatcher_addEventListener(lua_State *L) {
 }
 
 static int Polycore_EventDispatcher_removeEventListener(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	EventHandler * handler = (EventHandler *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 3);
@@ -2746,9 +2761,9 @@ static int Polycore_EventDispatcher_removeEventListener(lua_State *L) {
 }
 
 static int Polycore_EventDispatcher___dispatchEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Event * event = (Event *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 3);
@@ -2757,9 +2772,9 @@ static int Polycore_EventDispatcher___dispatchEvent(lua_State *L) {
 }
 
 static int Polycore_EventDispatcher_dispatchEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Event * event = (Event *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 3);
@@ -2768,9 +2783,9 @@ static int Polycore_EventDispatcher_dispatchEvent(lua_State *L) {
 }
 
 static int Polycore_EventDispatcher_dispatchEventNoDelete(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Event * event = (Event *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int eventCode = lua_tointeger(L, 3);
@@ -2779,7 +2794,7 @@ static int Polycore_EventDispatcher_dispatchEventNoDelete(lua_State *L) {
 }
 
 static int Polycore_delete_EventDispatcher(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventDispatcher *inst = (EventDispatcher*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2794,7 +2809,7 @@ static int Polycore_EventHandler(lua_State *L) {
 }
 
 static int Polycore_delete_EventHandler(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	EventHandler *inst = (EventHandler*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2807,7 +2822,7 @@ static int Polycore_FixedShader(lua_State *L) {
 }
 
 static int Polycore_FixedShader_createBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShader *inst = (FixedShader*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->createBinding();
 	if(ptrRetVal == NULL) {
@@ -2819,14 +2834,14 @@ static int Polycore_FixedShader_createBinding(lua_State *L) {
 }
 
 static int Polycore_delete_FixedShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShader *inst = (FixedShader*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_FixedShaderBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShader * shader = (FixedShader *)lua_topointer(L, 1);
 	FixedShaderBinding *inst = new FixedShaderBinding(shader);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -2834,29 +2849,29 @@ static int Polycore_FixedShaderBinding(lua_State *L) {
 }
 
 static int Polycore_FixedShaderBinding_addTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShaderBinding *inst = (FixedShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * texture = (Texture *)lua_topointer(L, 3);
 	inst->addTexture(name, texture);
 	return 0;
 }
 
 static int Polycore_FixedShaderBinding_addCubemap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShaderBinding *inst = (FixedShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Cubemap * cubemap = (Cubemap *)lua_topointer(L, 3);
 	inst->addCubemap(name, cubemap);
 	return 0;
 }
 
 static int Polycore_FixedShaderBinding_addParam(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShaderBinding *inst = (FixedShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String type = String(lua_tostring(L, 2));
@@ -2869,7 +2884,7 @@ static int Polycore_FixedShaderBinding_addParam(lua_State *L) {
 }
 
 static int Polycore_FixedShaderBinding_getDiffuseTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShaderBinding *inst = (FixedShaderBinding*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getDiffuseTexture();
 	if(ptrRetVal == NULL) {
@@ -2881,7 +2896,7 @@ static int Polycore_FixedShaderBinding_getDiffuseTexture(lua_State *L) {
 }
 
 static int Polycore_delete_FixedShaderBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FixedShaderBinding *inst = (FixedShaderBinding*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2896,7 +2911,7 @@ static int Polycore_Font(lua_State *L) {
 }
 
 static int Polycore_Font_getFace(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Font *inst = (Font*)lua_topointer(L, 1);
 	FT_Face *retInst = new FT_Face();
 	*retInst = inst->getFace();
@@ -2905,14 +2920,14 @@ static int Polycore_Font_getFace(lua_State *L) {
 }
 
 static int Polycore_Font_isValid(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Font *inst = (Font*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isValid());
 	return 1;
 }
 
 static int Polycore_delete_Font(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Font *inst = (Font*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2925,7 +2940,7 @@ static int Polycore_FontManager(lua_State *L) {
 }
 
 static int Polycore_FontManager_registerFont(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FontManager *inst = (FontManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fontName = String(lua_tostring(L, 2));
@@ -2936,7 +2951,7 @@ static int Polycore_FontManager_registerFont(lua_State *L) {
 }
 
 static int Polycore_FontManager_getFontByName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FontManager *inst = (FontManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fontName = String(lua_tostring(L, 2));
@@ -2950,7 +2965,7 @@ static int Polycore_FontManager_getFontByName(lua_State *L) {
 }
 
 static int Polycore_delete_FontManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	FontManager *inst = (FontManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -2965,7 +2980,7 @@ static int Polycore_Image(lua_State *L) {
 }
 
 static int Polycore_Image_loadImage(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -2974,7 +2989,7 @@ static int Polycore_Image_loadImage(lua_State *L) {
 }
 
 static int Polycore_Image_loadPNG(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -2983,7 +2998,7 @@ static int Polycore_Image_loadPNG(lua_State *L) {
 }
 
 static int Polycore_Image_createEmpty(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int width = lua_tointeger(L, 2);
@@ -2994,7 +3009,7 @@ static int Polycore_Image_createEmpty(lua_State *L) {
 }
 
 static int Polycore_Image_fill(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -3009,7 +3024,7 @@ static int Polycore_Image_fill(lua_State *L) {
 }
 
 static int Polycore_Image_setPixel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -3028,31 +3043,30 @@ static int Polycore_Image_setPixel(lua_State *L) {
 }
 
 static int Polycore_Image_getPixel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int y = lua_tointeger(L, 3);
-	Color *retInst = new Color();
+	Color *retInst = new (luaPolycode_alloc_value(L, sizeof(Color), "Polycode.Color")) Color();
 	*retInst = inst->getPixel(x, y);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Image_swap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	int * v1 = (int *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	int * v2 = (int *)lua_topointer(L, 3);
 	inst->swap(v1, v2);
 	return 0;
 }
 
 static int Polycore_Image_line(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x0 = lua_tointeger(L, 2);
@@ -3062,14 +3076,14 @@ static int Polycore_Image_line(lua_State *L) {
 	int x1 = lua_tointeger(L, 4);
 	luaL_checktype(L, 5, LUA_TNUMBER);
 	int y1 = lua_tointeger(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	Color col = *(Color*)lua_topointer(L, 6);
 	inst->line(x0, y0, x1, y1, col);
 	return 0;
 }
 
 static int Polycore_Image_moveTo(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -3080,7 +3094,7 @@ static int Polycore_Image_moveTo(lua_State *L) {
 }
 
 static int Polycore_Image_move(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -3091,20 +3105,20 @@ static int Polycore_Image_move(lua_State *L) {
 }
 
 static int Polycore_Image_lineTo(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int y = lua_tointeger(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Color col = *(Color*)lua_topointer(L, 4);
 	inst->lineTo(x, y, col);
 	return 0;
 }
 
 static int Polycore_Image_drawRect(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int x = lua_tointeger(L, 2);
@@ -3114,14 +3128,14 @@ static int Polycore_Image_drawRect(lua_State *L) {
 	int w = lua_tointeger(L, 4);
 	luaL_checktype(L, 5, LUA_TNUMBER);
 	int h = lua_tointeger(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	Color col = *(Color*)lua_topointer(L, 6);
 	inst->drawRect(x, y, w, h, col);
 	return 0;
 }
 
 static int Polycore_Image_perlinNoise(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int seed = lua_tointeger(L, 2);
@@ -3132,7 +3146,7 @@ static int Polycore_Image_perlinNoise(lua_State *L) {
 }
 
 static int Polycore_Image_fastBlur(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int blurSize = lua_tointeger(L, 2);
@@ -3141,7 +3155,7 @@ static int Polycore_Image_fastBlur(lua_State *L) {
 }
 
 static int Polycore_Image_fastBlurVert(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int blurSize = lua_tointeger(L, 2);
@@ -3150,7 +3164,7 @@ static int Polycore_Image_fastBlurVert(lua_State *L) {
 }
 
 static int Polycore_Image_fastBlurHor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int blurSize = lua_tointeger(L, 2);
@@ -3159,7 +3173,7 @@ static int Polycore_Image_fastBlurHor(lua_State *L) {
 }
 
 static int Polycore_Image_darken(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number amt = lua_tonumber(L, 2);
@@ -3172,7 +3186,7 @@ static int Polycore_Image_darken(lua_State *L) {
 }
 
 static int Polycore_Image_lighten(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number amt = lua_tonumber(L, 2);
@@ -3185,7 +3199,7 @@ static int Polycore_Image_lighten(lua_State *L) {
 }
 
 static int Polycore_Image_multiply(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number amt = lua_tonumber(L, 2);
@@ -3198,35 +3212,35 @@ static int Polycore_Image_multiply(lua_State *L) {
 }
 
 static int Polycore_Image_getBrushX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getBrushX());
 	return 1;
 }
 
 static int Polycore_Image_getBrushY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getBrushY());
 	return 1;
 }
 
 static int Polycore_Image_isLoaded(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isLoaded());
 	return 1;
 }
 
 static int Polycore_Image_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Polycore_Image_writeBMP(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3235,21 +3249,21 @@ static int Polycore_Image_writeBMP(lua_State *L) {
 }
 
 static int Polycore_Image_getWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getWidth());
 	return 1;
 }
 
 static int Polycore_Image_getHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getHeight());
 	return 1;
 }
 
 static int Polycore_Image_getPixels(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getPixels();
 	if(ptrRetVal == NULL) {
@@ -3261,49 +3275,49 @@ static int Polycore_Image_getPixels(lua_State *L) {
 }
 
 static int Polycore_delete_Image(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Image *inst = (Image*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_InputEvent_get_mouseButton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->mouseButton);
 	return 1;
 }
 
 static int Polycore_InputEvent_get_mousePosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->mousePosition);
 	return 1;
 }
 
 static int Polycore_InputEvent_get_key(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->key);
 	return 1;
 }
 
 static int Polycore_InputEvent_get_charCode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->charCode);
 	return 1;
 }
 
 static int Polycore_InputEvent_get_timestamp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->timestamp);
 	return 1;
 }
 
 static int Polycore_InputEvent_set_mouseButton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->mouseButton = param;
@@ -3311,7 +3325,7 @@ static int Polycore_InputEvent_set_mouseButton(lua_State *L) {
 }
 
 static int Polycore_InputEvent_set_timestamp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->timestamp = param;
@@ -3319,7 +3333,7 @@ static int Polycore_InputEvent_set_timestamp(lua_State *L) {
 }
 
 static int Polycore_InputEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector2 mousePosition = *(Vector2*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int timestamp = lua_tointeger(L, 2);
@@ -3329,16 +3343,15 @@ static int Polycore_InputEvent(lua_State *L) {
 }
 
 static int Polycore_InputEvent_getMousePosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getMousePosition();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_InputEvent_getKey(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	PolyKEY *retInst = new PolyKEY();
 	*retInst = inst->getKey();
@@ -3347,28 +3360,28 @@ static int Polycore_InputEvent_getKey(lua_State *L) {
 }
 
 static int Polycore_InputEvent_getMouseButton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getMouseButton());
 	return 1;
 }
 
 static int Polycore_InputEvent_keyCode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->keyCode());
 	return 1;
 }
 
 static int Polycore_delete_InputEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	InputEvent *inst = (InputEvent*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Label(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Font * font = (Font *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String text = String(lua_tostring(L, 2));
@@ -3382,7 +3395,7 @@ static int Polycore_Label(lua_State *L) {
 }
 
 static int Polycore_Label_setText(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String text = String(lua_tostring(L, 2));
@@ -3391,16 +3404,16 @@ static int Polycore_Label_setText(lua_State *L) {
 }
 
 static int Polycore_Label_getText(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getText().c_str());
 	return 1;
 }
 
 static int Polycore_Label_getTextWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Font * font = (Font *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TSTRING);
 	String text = String(lua_tostring(L, 3));
@@ -3411,9 +3424,9 @@ static int Polycore_Label_getTextWidth(lua_State *L) {
 }
 
 static int Polycore_Label_getTextHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Font * font = (Font *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TSTRING);
 	String text = String(lua_tostring(L, 3));
@@ -3424,7 +3437,7 @@ static int Polycore_Label_getTextHeight(lua_State *L) {
 }
 
 static int Polycore_Label_getFont(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getFont();
 	if(ptrRetVal == NULL) {
@@ -3436,7 +3449,7 @@ static int Polycore_Label_getFont(lua_State *L) {
 }
 
 static int Polycore_delete_Label(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Label *inst = (Label*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -3449,21 +3462,21 @@ static int Polycore_Logger(lua_State *L) {
 }
 
 static int Polycore_Logger_log(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const char * format = (const char *)lua_topointer(L, 2);
 	Logger::log(format);
 	return 0;
 }
 
 static int Polycore_Logger_logw(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const char * str = (const char *)lua_topointer(L, 2);
 	Logger::logw(str);
 	return 0;
 }
 
 static int Polycore_delete_Logger(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Logger *inst = (Logger*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -3478,41 +3491,41 @@ static int Polycore_Material(lua_State *L) {
 }
 
 static int Polycore_Material_addShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Shader * shader = (Shader *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	ShaderBinding * shaderBinding = (ShaderBinding *)lua_topointer(L, 3);
 	inst->addShader(shader, shaderBinding);
 	return 0;
 }
 
 static int Polycore_Material_getNumShaders(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumShaders());
 	return 1;
 }
 
 static int Polycore_Material_addShaderRenderTarget(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ShaderRenderTarget * newTarget = (ShaderRenderTarget *)lua_topointer(L, 2);
 	inst->addShaderRenderTarget(newTarget);
 	return 0;
 }
 
 static int Polycore_Material_getNumShaderRenderTargets(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumShaderRenderTargets());
 	return 1;
 }
 
 static int Polycore_Material_getShaderRenderTarget(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -3526,14 +3539,14 @@ static int Polycore_Material_getShaderRenderTarget(lua_State *L) {
 }
 
 static int Polycore_Material_getName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getName().c_str());
 	return 1;
 }
 
 static int Polycore_Material_getShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -3547,7 +3560,7 @@ static int Polycore_Material_getShader(lua_State *L) {
 }
 
 static int Polycore_Material_getShaderBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -3561,7 +3574,7 @@ static int Polycore_Material_getShaderBinding(lua_State *L) {
 }
 
 static int Polycore_Material_loadMaterial(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3570,7 +3583,7 @@ static int Polycore_Material_loadMaterial(lua_State *L) {
 }
 
 static int Polycore_delete_Material(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Material *inst = (Material*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -3583,7 +3596,7 @@ static int Polycore_MaterialManager(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int elapsed = lua_tointeger(L, 2);
@@ -3592,7 +3605,7 @@ static int Polycore_MaterialManager_Update(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createFramebufferTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int width = lua_tointeger(L, 2);
@@ -3610,13 +3623,13 @@ static int Polycore_MaterialManager_createFramebufferTexture(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int width = lua_tointeger(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int height = lua_tointeger(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	char * imageData = (char *)lua_topointer(L, 4);
 	bool clamp;
 	if(lua_isboolean(L, 5)) {
@@ -3640,7 +3653,7 @@ static int Polycore_MaterialManager_createTexture(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createNewTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int width = lua_tointeger(L, 2);
@@ -3668,9 +3681,9 @@ static int Polycore_MaterialManager_createNewTexture(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createTextureFromImage(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Image * image = (Image *)lua_topointer(L, 2);
 	bool clamp;
 	if(lua_isboolean(L, 3)) {
@@ -3688,7 +3701,7 @@ static int Polycore_MaterialManager_createTextureFromImage(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createTextureFromFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3708,46 +3721,46 @@ static int Polycore_MaterialManager_createTextureFromFile(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_deleteTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->deleteTexture(texture);
 	return 0;
 }
 
 static int Polycore_MaterialManager_reloadTextures(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	inst->reloadTextures();
 	return 0;
 }
 
 static int Polycore_MaterialManager_reloadProgramsAndTextures(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	inst->reloadProgramsAndTextures();
 	return 0;
 }
 
 static int Polycore_MaterialManager_reloadPrograms(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	inst->reloadPrograms();
 	return 0;
 }
 
 static int Polycore_MaterialManager_addShaderModule(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolycodeShaderModule * module = (PolycodeShaderModule *)lua_topointer(L, 2);
 	inst->addShaderModule(module);
 	return 0;
 }
 
 static int Polycore_MaterialManager_getTextureByResourcePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String resourcePath = String(lua_tostring(L, 2));
@@ -3761,9 +3774,9 @@ static int Polycore_MaterialManager_getTextureByResourcePath(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_cubemapFromXMLNode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	TiXmlNode * node = (TiXmlNode *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->cubemapFromXMLNode(node);
 	if(ptrRetVal == NULL) {
@@ -3775,7 +3788,7 @@ static int Polycore_MaterialManager_cubemapFromXMLNode(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_loadMaterialsFromFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3784,9 +3797,9 @@ static int Polycore_MaterialManager_loadMaterialsFromFile(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_materialFromXMLNode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	TiXmlNode * node = (TiXmlNode *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->materialFromXMLNode(node);
 	if(ptrRetVal == NULL) {
@@ -3798,9 +3811,9 @@ static int Polycore_MaterialManager_materialFromXMLNode(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_setShaderFromXMLNode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	TiXmlNode * node = (TiXmlNode *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->setShaderFromXMLNode(node);
 	if(ptrRetVal == NULL) {
@@ -3812,9 +3825,9 @@ static int Polycore_MaterialManager_setShaderFromXMLNode(lua_State *L) {
 }
 
 static int Polycore_MaterialManager_createShaderFromXMLNode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	TiXmlNode * node = (TiXmlNode *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->createShaderFromXMLNode(node);
 	if(ptrRetVal == NULL) {
@@ -3826,47 +3839,44 @@ static int Polycore_MaterialManager_createShaderFromXMLNode(lua_State *L) {
 }
 
 static int Polycore_delete_MaterialManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	MaterialManager *inst = (MaterialManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Matrix4(lua_State *L) {
-	Matrix4 *inst = new Matrix4();
-	lua_pushlightuserdata(L, (void*)inst);
+	Matrix4 *inst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	return 1;
 }
 
 static int Polycore_Matrix4_identity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
 	inst->identity();
 	return 0;
 }
 
 static int Polycore_Matrix4_rotateVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & v2 = *( Vector3 *)lua_topointer(L, 2);
-	 Vector3 *retInst = new  Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->rotateVector(v2);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Matrix4_getPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	 Vector3 *retInst = new  Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getPosition();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Matrix4_setPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -3879,61 +3889,83 @@ static int Polycore_Matrix4_setPosition(lua_State *L) {
 }
 
 static int Polycore_Matrix4_setScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 scale = *(Vector3*)lua_topointer(L, 2);
 	inst->setScale(scale);
 	return 0;
 }
 
 static int Polycore_Matrix4_getEulerAngles(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Number * ax = (Number *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Number * ay = (Number *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Number * az = (Number *)lua_topointer(L, 4);
 	inst->getEulerAngles(ax, ay, az);
 	return 0;
 }
 
 static int Polycore_Matrix4_inverse(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->inverse();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Matrix4_inverseAffine(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->inverseAffine();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_delete_Matrix4(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
-	delete inst;
+	luaPolycode_checkpointer(L, 1);
+	if(lua_islightuserdata(L, 1)) {
+		Matrix4 *inst = (Matrix4*)lua_topointer(L, 1);
+		delete inst;
+	}
+	return 0;
+}
+
+static int Polycore_Matrix4__gc(lua_State *L) {
+	Matrix4 *inst = (Matrix4*)lua_touserdata(L, 1);
+	inst->~Matrix4();
 	return 0;
 }
 
+static int Polycore_Matrix4__add(lua_State *L) {
+	Matrix4 lhs = *(Matrix4*)luaPolycode_checkvalue(L, 1, "Polycode.Matrix4");
+	Matrix4 rhs = *(Matrix4*)luaPolycode_checkvalue(L, 2, "Polycode.Matrix4");
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
+	*retInst = lhs + rhs;
+	return 1;
+}
+
+static int Polycore_Matrix4__mul(lua_State *L) {
+	Matrix4 lhs = *(Matrix4*)luaPolycode_checkvalue(L, 1, "Polycode.Matrix4");
+	Matrix4 rhs = *(Matrix4*)luaPolycode_checkvalue(L, 2, "Polycode.Matrix4");
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
+	*retInst = lhs * rhs;
+	return 1;
+}
+
 static int Polycore_Mesh_get_useVertexColors(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useVertexColors);
 	return 1;
 }
 
 static int Polycore_Mesh_set_useVertexColors(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useVertexColors = param;
@@ -3949,16 +3981,16 @@ static int Polycore_Mesh(lua_State *L) {
 }
 
 static int Polycore_Mesh_addPolygon(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Polycode::Polygon * newPolygon = (Polycode::Polygon *)lua_topointer(L, 2);
 	inst->addPolygon(newPolygon);
 	return 0;
 }
 
 static int Polycore_Mesh_loadMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3967,7 +3999,7 @@ static int Polycore_Mesh_loadMesh(lua_State *L) {
 }
 
 static int Polycore_Mesh_saveToFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -3976,30 +4008,30 @@ static int Polycore_Mesh_saveToFile(lua_State *L) {
 }
 
 static int Polycore_Mesh_loadFromFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	OSFILE * inFile = (OSFILE *)lua_topointer(L, 2);
 	inst->loadFromFile(inFile);
 	return 0;
 }
 
 static int Polycore_Mesh_getPolygonCount(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getPolygonCount());
 	return 1;
 }
 
 static int Polycore_Mesh_getVertexCount(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getVertexCount());
 	return 1;
 }
 
 static int Polycore_Mesh_getPolygon(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -4013,7 +4045,7 @@ static int Polycore_Mesh_getPolygon(lua_State *L) {
 }
 
 static int Polycore_Mesh_createPlane(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number w = lua_tonumber(L, 2);
@@ -4024,7 +4056,7 @@ static int Polycore_Mesh_createPlane(lua_State *L) {
 }
 
 static int Polycore_Mesh_createBox(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number w = lua_tonumber(L, 2);
@@ -4037,7 +4069,7 @@ static int Polycore_Mesh_createBox(lua_State *L) {
 }
 
 static int Polycore_Mesh_createSphere(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number radius = lua_tonumber(L, 2);
@@ -4050,7 +4082,7 @@ static int Polycore_Mesh_createSphere(lua_State *L) {
 }
 
 static int Polycore_Mesh_createCylinder(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number height = lua_tonumber(L, 2);
@@ -4063,7 +4095,7 @@ static int Polycore_Mesh_createCylinder(lua_State *L) {
 }
 
 static int Polycore_Mesh_createCone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number height = lua_tonumber(L, 2);
@@ -4076,16 +4108,15 @@ static int Polycore_Mesh_createCone(lua_State *L) {
 }
 
 static int Polycore_Mesh_recenterMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->recenterMesh();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Mesh_useVertexNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4094,16 +4125,16 @@ static int Polycore_Mesh_useVertexNormals(lua_State *L) {
 }
 
 static int Polycore_Mesh_setVertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	VertexBuffer * buffer = (VertexBuffer *)lua_topointer(L, 2);
 	inst->setVertexBuffer(buffer);
 	return 0;
 }
 
 static int Polycore_Mesh_getVertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getVertexBuffer();
 	if(ptrRetVal == NULL) {
@@ -4115,28 +4146,28 @@ static int Polycore_Mesh_getVertexBuffer(lua_State *L) {
 }
 
 static int Polycore_Mesh_getRadius(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getRadius());
 	return 1;
 }
 
 static int Polycore_Mesh_calculateNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	inst->calculateNormals();
 	return 0;
 }
 
 static int Polycore_Mesh_getMeshType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getMeshType());
 	return 1;
 }
 
 static int Polycore_Mesh_setMeshType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int newType = lua_tointeger(L, 2);
@@ -4145,44 +4176,43 @@ static int Polycore_Mesh_setMeshType(lua_State *L) {
 }
 
 static int Polycore_Mesh_calculateBBox(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->calculateBBox();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Mesh_hasVertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->hasVertexBuffer());
 	return 1;
 }
 
 static int Polycore_delete_Mesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Mesh *inst = (Mesh*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_VertexBuffer_get_verticesPerFace(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->verticesPerFace);
 	return 1;
 }
 
 static int Polycore_VertexBuffer_get_meshType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->meshType);
 	return 1;
 }
 
 static int Polycore_VertexBuffer_set_verticesPerFace(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->verticesPerFace = param;
@@ -4190,7 +4220,7 @@ static int Polycore_VertexBuffer_set_verticesPerFace(lua_State *L) {
 }
 
 static int Polycore_VertexBuffer_set_meshType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->meshType = param;
@@ -4204,14 +4234,14 @@ static int Polycore_VertexBuffer(lua_State *L) {
 }
 
 static int Polycore_VertexBuffer_getVertexCount(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getVertexCount());
 	return 1;
 }
 
 static int Polycore_delete_VertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	VertexBuffer *inst = (VertexBuffer*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -4224,70 +4254,70 @@ static int Polycore_PolycodeModule(lua_State *L) {
 }
 
 static int Polycore_PolycodeModule_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PolycodeModule *inst = (PolycodeModule*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Polycore_delete_PolycodeModule(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PolycodeModule *inst = (PolycodeModule*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ObjectEntry_get_type(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->type);
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_name(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->name.c_str());
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_NumberVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->NumberVal);
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_intVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->intVal);
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_stringVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->stringVal.c_str());
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_boolVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->boolVal);
 	return 1;
 }
 
 static int Polycore_ObjectEntry_get_length(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->length);
 	return 1;
 }
 
 static int Polycore_ObjectEntry_set_type(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->type = param;
@@ -4295,7 +4325,7 @@ static int Polycore_ObjectEntry_set_type(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_name(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->name = param;
@@ -4303,7 +4333,7 @@ static int Polycore_ObjectEntry_set_name(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_NumberVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->NumberVal = param;
@@ -4311,7 +4341,7 @@ static int Polycore_ObjectEntry_set_NumberVal(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_intVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->intVal = param;
@@ -4319,7 +4349,7 @@ static int Polycore_ObjectEntry_set_intVal(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_stringVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	String param = lua_tostring(L, 2);
 	inst->stringVal = param;
@@ -4327,7 +4357,7 @@ static int Polycore_ObjectEntry_set_stringVal(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_boolVal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->boolVal = param;
@@ -4335,7 +4365,7 @@ static int Polycore_ObjectEntry_set_boolVal(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_set_length(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->length = param;
@@ -4349,7 +4379,7 @@ static int Polycore_ObjectEntry(lua_State *L) {
 }
 
 static int Polycore_ObjectEntry_addChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -4363,77 +4393,77 @@ static int Polycore_ObjectEntry_addChild(lua_State *L) {
 }
 
 static int Polycore_delete_ObjectEntry(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ObjectEntry *inst = (ObjectEntry*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Particle_get_velVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->velVector);
 	return 1;
 }
 
 static int Polycore_Particle_get_dirVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->dirVector);
 	return 1;
 }
 
 static int Polycore_Particle_get_deviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->deviation);
 	return 1;
 }
 
 static int Polycore_Particle_get_life(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->life);
 	return 1;
 }
 
 static int Polycore_Particle_get_lifespan(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->lifespan);
 	return 1;
 }
 
 static int Polycore_Particle_get_brightnessDeviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->brightnessDeviation);
 	return 1;
 }
 
 static int Polycore_Particle_get_perlinPosX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->perlinPosX);
 	return 1;
 }
 
 static int Polycore_Particle_get_perlinPosY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->perlinPosY);
 	return 1;
 }
 
 static int Polycore_Particle_get_perlinPosZ(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->perlinPosZ);
 	return 1;
 }
 
 static int Polycore_Particle_set_life(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->life = param;
@@ -4441,7 +4471,7 @@ static int Polycore_Particle_set_life(lua_State *L) {
 }
 
 static int Polycore_Particle_set_lifespan(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->lifespan = param;
@@ -4449,7 +4479,7 @@ static int Polycore_Particle_set_lifespan(lua_State *L) {
 }
 
 static int Polycore_Particle_set_brightnessDeviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->brightnessDeviation = param;
@@ -4457,7 +4487,7 @@ static int Polycore_Particle_set_brightnessDeviation(lua_State *L) {
 }
 
 static int Polycore_Particle_set_perlinPosX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->perlinPosX = param;
@@ -4465,7 +4495,7 @@ static int Polycore_Particle_set_perlinPosX(lua_State *L) {
 }
 
 static int Polycore_Particle_set_perlinPosY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->perlinPosY = param;
@@ -4473,7 +4503,7 @@ static int Polycore_Particle_set_perlinPosY(lua_State *L) {
 }
 
 static int Polycore_Particle_set_perlinPosZ(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->perlinPosZ = param;
@@ -4485,11 +4515,11 @@ static int Polycore_Particle(lua_State *L) {
 	int particleType = lua_tointeger(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool isScreenParticle = lua_toboolean(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Material * material = (Material *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Texture * texture = (Texture *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Mesh * particleMesh = (Mesh *)lua_topointer(L, 5);
 	Particle *inst = new Particle(particleType, isScreenParticle, material, texture, particleMesh);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -4497,7 +4527,7 @@ static int Polycore_Particle(lua_State *L) {
 }
 
 static int Polycore_Particle_Reset(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool continuious = lua_toboolean(L, 2);
@@ -4506,33 +4536,33 @@ static int Polycore_Particle_Reset(lua_State *L) {
 }
 
 static int Polycore_Particle_createSceneParticle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int particleType = lua_tointeger(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Material * material = (Material *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Mesh * particleMesh = (Mesh *)lua_topointer(L, 4);
 	inst->createSceneParticle(particleType, material, particleMesh);
 	return 0;
 }
 
 static int Polycore_Particle_createScreenParticle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int particleType = lua_tointeger(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * texture = (Texture *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Mesh * particleMesh = (Mesh *)lua_topointer(L, 4);
 	inst->createScreenParticle(particleType, texture, particleMesh);
 	return 0;
 }
 
 static int Polycore_delete_Particle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Particle *inst = (Particle*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -4541,7 +4571,7 @@ static int Polycore_delete_Particle(lua_State *L) {
 static int Polycore_ScreenParticleEmitter(lua_State *L) {
 	luaL_checktype(L, 1, LUA_TSTRING);
 	String imageFile = String(lua_tostring(L, 1));
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Screen * particleParentScreen = (Screen *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int particleType = lua_tointeger(L, 3);
@@ -4551,20 +4581,20 @@ static int Polycore_ScreenParticleEmitter(lua_State *L) {
 	Number lifespan = lua_tonumber(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	unsigned int numParticles = lua_tointeger(L, 6);
-	luaL_checktype(L, 7, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 7);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 7);
-	luaL_checktype(L, 8, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 8);
 	Vector3 gravity = *(Vector3*)lua_topointer(L, 8);
-	luaL_checktype(L, 9, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 9);
 	Vector3 deviation = *(Vector3*)lua_topointer(L, 9);
 	Mesh * particleMesh;
-	if(lua_islightuserdata(L, 10)) {
+	if(lua_isuserdata(L, 10)) {
 		particleMesh = (Mesh *)lua_topointer(L, 10);
 	} else {
 		particleMesh = NULL;
 	}
 	ScreenMesh * emitter;
-	if(lua_islightuserdata(L, 11)) {
+	if(lua_isuserdata(L, 11)) {
 		emitter = (ScreenMesh *)lua_topointer(L, 11);
 	} else {
 		emitter = NULL;
@@ -4575,7 +4605,7 @@ static int Polycore_ScreenParticleEmitter(lua_State *L) {
 }
 
 static int Polycore_ScreenParticleEmitter_getEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenParticleEmitter *inst = (ScreenParticleEmitter*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getEmitter();
 	if(ptrRetVal == NULL) {
@@ -4587,32 +4617,31 @@ static int Polycore_ScreenParticleEmitter_getEmitter(lua_State *L) {
 }
 
 static int Polycore_ScreenParticleEmitter_addParticleBody(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenParticleEmitter *inst = (ScreenParticleEmitter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * particleBody = (Entity *)lua_topointer(L, 2);
 	inst->addParticleBody(particleBody);
 	return 0;
 }
 
 static int Polycore_ScreenParticleEmitter_getBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenParticleEmitter *inst = (ScreenParticleEmitter*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getBaseMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_ScreenParticleEmitter_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenParticleEmitter *inst = (ScreenParticleEmitter*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_ScreenParticleEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenParticleEmitter *inst = (ScreenParticleEmitter*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -4621,7 +4650,7 @@ static int Polycore_delete_ScreenParticleEmitter(lua_State *L) {
 static int Polycore_SceneParticleEmitter(lua_State *L) {
 	luaL_checktype(L, 1, LUA_TSTRING);
 	String imageFile = String(lua_tostring(L, 1));
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * particleParentScene = (Scene *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int particleType = lua_tointeger(L, 3);
@@ -4631,20 +4660,20 @@ static int Polycore_SceneParticleEmitter(lua_State *L) {
 	Number lifespan = lua_tonumber(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	unsigned int numParticles = lua_tointeger(L, 6);
-	luaL_checktype(L, 7, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 7);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 7);
-	luaL_checktype(L, 8, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 8);
 	Vector3 gravity = *(Vector3*)lua_topointer(L, 8);
-	luaL_checktype(L, 9, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 9);
 	Vector3 deviation = *(Vector3*)lua_topointer(L, 9);
 	Mesh * particleMesh;
-	if(lua_islightuserdata(L, 10)) {
+	if(lua_isuserdata(L, 10)) {
 		particleMesh = (Mesh *)lua_topointer(L, 10);
 	} else {
 		particleMesh = NULL;
 	}
 	SceneMesh * emitter;
-	if(lua_islightuserdata(L, 11)) {
+	if(lua_isuserdata(L, 11)) {
 		emitter = (SceneMesh *)lua_topointer(L, 11);
 	} else {
 		emitter = NULL;
@@ -4655,7 +4684,7 @@ static int Polycore_SceneParticleEmitter(lua_State *L) {
 }
 
 static int Polycore_SceneParticleEmitter_getEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneParticleEmitter *inst = (SceneParticleEmitter*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getEmitter();
 	if(ptrRetVal == NULL) {
@@ -4667,137 +4696,136 @@ static int Polycore_SceneParticleEmitter_getEmitter(lua_State *L) {
 }
 
 static int Polycore_SceneParticleEmitter_addParticleBody(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneParticleEmitter *inst = (SceneParticleEmitter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * particleBody = (Entity *)lua_topointer(L, 2);
 	inst->addParticleBody(particleBody);
 	return 0;
 }
 
 static int Polycore_SceneParticleEmitter_getBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneParticleEmitter *inst = (SceneParticleEmitter*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getBaseMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_SceneParticleEmitter_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneParticleEmitter *inst = (SceneParticleEmitter*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_SceneParticleEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneParticleEmitter *inst = (SceneParticleEmitter*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_get_particleSpeedMod(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->particleSpeedMod);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_brightnessDeviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->brightnessDeviation);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_deviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->deviation);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_dirVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->dirVector);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_gravVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->gravVector);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_lifespan(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->lifespan);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_rotationFollowsPath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->rotationFollowsPath);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_scaleCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->scaleCurve);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_colorCurveR(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->colorCurveR);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_colorCurveG(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->colorCurveG);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_colorCurveB(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->colorCurveB);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_colorCurveA(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->colorCurveA);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_useColorCurves(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useColorCurves);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_get_useScaleCurves(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useScaleCurves);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_set_particleSpeedMod(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->particleSpeedMod = param;
@@ -4805,7 +4833,7 @@ static int Polycore_ParticleEmitter_set_particleSpeedMod(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_set_brightnessDeviation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->brightnessDeviation = param;
@@ -4813,7 +4841,7 @@ static int Polycore_ParticleEmitter_set_brightnessDeviation(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_set_lifespan(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->lifespan = param;
@@ -4821,7 +4849,7 @@ static int Polycore_ParticleEmitter_set_lifespan(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_set_rotationFollowsPath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->rotationFollowsPath = param;
@@ -4829,7 +4857,7 @@ static int Polycore_ParticleEmitter_set_rotationFollowsPath(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_set_useColorCurves(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useColorCurves = param;
@@ -4837,7 +4865,7 @@ static int Polycore_ParticleEmitter_set_useColorCurves(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_set_useScaleCurves(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useScaleCurves = param;
@@ -4847,7 +4875,7 @@ static int Polycore_ParticleEmitter_set_useScaleCurves(lua_State *L) {
 static int Polycore_ParticleEmitter(lua_State *L) {
 	luaL_checktype(L, 1, LUA_TSTRING);
 	String imageFile = String(lua_tostring(L, 1));
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Mesh * particleMesh = (Mesh *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int particleType = lua_tointeger(L, 3);
@@ -4857,11 +4885,11 @@ static int Polycore_ParticleEmitter(lua_State *L) {
 	Number lifespan = lua_tonumber(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	unsigned int numParticles = lua_tointeger(L, 6);
-	luaL_checktype(L, 7, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 7);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 7);
-	luaL_checktype(L, 8, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 8);
 	Vector3 gravity = *(Vector3*)lua_topointer(L, 8);
-	luaL_checktype(L, 9, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 9);
 	Vector3 deviation = *(Vector3*)lua_topointer(L, 9);
 	ParticleEmitter *inst = new ParticleEmitter(imageFile, particleMesh, particleType, emitterType, lifespan, numParticles, direction, gravity, deviation);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -4869,14 +4897,14 @@ static int Polycore_ParticleEmitter(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_createParticles(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	inst->createParticles();
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_setRotationSpeed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number speed = lua_tonumber(L, 2);
@@ -4885,7 +4913,7 @@ static int Polycore_ParticleEmitter_setRotationSpeed(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setParticleBlendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int mode = lua_tointeger(L, 2);
@@ -4894,7 +4922,7 @@ static int Polycore_ParticleEmitter_setParticleBlendingMode(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setDepthWrite(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4903,7 +4931,7 @@ static int Polycore_ParticleEmitter_setDepthWrite(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setDepthTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4912,7 +4940,7 @@ static int Polycore_ParticleEmitter_setDepthTest(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setAlphaTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4921,7 +4949,7 @@ static int Polycore_ParticleEmitter_setAlphaTest(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_enablePerlin(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4930,7 +4958,7 @@ static int Polycore_ParticleEmitter_enablePerlin(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setBillboardMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool mode = lua_toboolean(L, 2);
@@ -4939,7 +4967,7 @@ static int Polycore_ParticleEmitter_setBillboardMode(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_enableEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4948,23 +4976,23 @@ static int Polycore_ParticleEmitter_enableEmitter(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_emitterEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->emitterEnabled());
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_setEmitterRadius(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 rad = *(Vector3*)lua_topointer(L, 2);
 	inst->setEmitterRadius(rad);
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_setAllAtOnce(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -4973,23 +5001,23 @@ static int Polycore_ParticleEmitter_setAllAtOnce(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_Trigger(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	inst->Trigger();
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_resetParticle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Particle * particle = (Particle *)lua_topointer(L, 2);
 	inst->resetParticle(particle);
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_setPerlinModSize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number size = lua_tonumber(L, 2);
@@ -4998,7 +5026,7 @@ static int Polycore_ParticleEmitter_setPerlinModSize(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_setParticleCount(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int count = lua_tointeger(L, 2);
@@ -5007,32 +5035,31 @@ static int Polycore_ParticleEmitter_setParticleCount(lua_State *L) {
 }
 
 static int Polycore_ParticleEmitter_addParticleBody(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Entity * particleBody = (Entity *)lua_topointer(L, 2);
 	inst->addParticleBody(particleBody);
 	return 0;
 }
 
 static int Polycore_ParticleEmitter_getBaseMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
-	 Matrix4 *retInst = new  Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getBaseMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_ParticleEmitter_updateEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	inst->updateEmitter();
 	return 0;
 }
 
 static int Polycore_delete_ParticleEmitter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ParticleEmitter *inst = (ParticleEmitter*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -5053,7 +5080,7 @@ static int Polycore_Perlin(lua_State *L) {
 }
 
 static int Polycore_Perlin_Get(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Perlin *inst = (Perlin*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5064,21 +5091,21 @@ static int Polycore_Perlin_Get(lua_State *L) {
 }
 
 static int Polycore_delete_Perlin(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Perlin *inst = (Perlin*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Polygon_get_useVertexNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useVertexNormals);
 	return 1;
 }
 
 static int Polycore_Polygon_set_useVertexNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useVertexNormals = param;
@@ -5092,14 +5119,14 @@ static int Polycore_Polygon(lua_State *L) {
 }
 
 static int Polycore_Polygon_getVertexCount(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getVertexCount());
 	return 1;
 }
 
 static int Polycore_Polygon_getVertex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -5113,7 +5140,7 @@ static int Polycore_Polygon_getVertex(lua_State *L) {
 }
 
 static int Polycore_Polygon_addVertex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5131,7 +5158,7 @@ static int Polycore_Polygon_addVertex(lua_State *L) {
 }
 
 static int Polycore_Polygon_removeVertex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -5140,23 +5167,22 @@ static int Polycore_Polygon_removeVertex(lua_State *L) {
 }
 
 static int Polycore_Polygon_calculateNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	inst->calculateNormal();
 	return 0;
 }
 
 static int Polycore_Polygon_getFaceNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getFaceNormal();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Polygon_getBounds2D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	Polycode::Rectangle *retInst = new Polycode::Rectangle();
 	*retInst = inst->getBounds2D();
@@ -5165,58 +5191,58 @@ static int Polycore_Polygon_getBounds2D(lua_State *L) {
 }
 
 static int Polycore_Polygon_setNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 normal = *(Vector3*)lua_topointer(L, 2);
 	inst->setNormal(normal);
 	return 0;
 }
 
 static int Polycore_Polygon_flipUVY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	inst->flipUVY();
 	return 0;
 }
 
 static int Polycore_delete_Polygon(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Polygon *inst = (Polycode::Polygon*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Quaternion_get_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->x);
 	return 1;
 }
 
 static int Polycore_Quaternion_get_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->y);
 	return 1;
 }
 
 static int Polycore_Quaternion_get_z(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->z);
 	return 1;
 }
 
 static int Polycore_Quaternion_get_w(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->w);
 	return 1;
 }
 
 static int Polycore_Quaternion_set_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->x = param;
@@ -5224,7 +5250,7 @@ static int Polycore_Quaternion_set_x(lua_State *L) {
 }
 
 static int Polycore_Quaternion_set_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->y = param;
@@ -5232,7 +5258,7 @@ static int Polycore_Quaternion_set_y(lua_State *L) {
 }
 
 static int Polycore_Quaternion_set_z(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->z = param;
@@ -5240,7 +5266,7 @@ static int Polycore_Quaternion_set_z(lua_State *L) {
 }
 
 static int Polycore_Quaternion_set_w(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->w = param;
@@ -5256,15 +5282,14 @@ static int Polycore_Quaternion(lua_State *L) {
 	Number y = lua_tonumber(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number z = lua_tonumber(L, 4);
-	Quaternion *inst = new Quaternion(w, x, y, z);
-	lua_pushlightuserdata(L, (void*)inst);
+	Quaternion *inst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion(w, x, y, z);
 	return 1;
 }
 
 static int Polycore_Quaternion_setFromMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Matrix4 & _mat = *( Matrix4 *)lua_topointer(L, 2);
 	inst->setFromMatrix(_mat);
 	return 0;
@@ -5273,9 +5298,9 @@ static int Polycore_Quaternion_setFromMatrix(lua_State *L) {
 static int Polycore_Quaternion_Slerp(lua_State *L) {
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number fT = lua_tonumber(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Quaternion & rkP = *( Quaternion *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	const Quaternion & rkQ = *( Quaternion *)lua_topointer(L, 4);
 	bool shortestPath;
 	if(lua_isboolean(L, 5)) {
@@ -5283,68 +5308,65 @@ static int Polycore_Quaternion_Slerp(lua_State *L) {
 	} else {
 		shortestPath = false;
 	}
-	 Quaternion *retInst = new  Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = Quaternion::Slerp(fT, rkP, rkQ, shortestPath);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_Dot(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Quaternion & rkQ = *( Quaternion *)lua_topointer(L, 2);
 	lua_pushnumber(L, inst->Dot(rkQ));
 	return 1;
 }
 
 static int Polycore_Quaternion_Log(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->Log();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_Exp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->Exp();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_Norm(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->Norm());
 	return 1;
 }
 
 static int Polycore_Quaternion_normalize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->normalize());
 	return 1;
 }
 
 static int Polycore_Quaternion_lookAt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & D = *( Vector3 *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & upVector = *( Vector3 *)lua_topointer(L, 3);
 	inst->lookAt(D, upVector);
 	return 0;
 }
 
 static int Polycore_Quaternion_createFromMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->createFromMatrix(matrix);
 	return 0;
@@ -5353,33 +5375,31 @@ static int Polycore_Quaternion_createFromMatrix(lua_State *L) {
 static int Polycore_Quaternion_Squad(lua_State *L) {
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number fT = lua_tonumber(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Quaternion & rkP = *( Quaternion *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	const Quaternion & rkA = *( Quaternion *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	const Quaternion & rkB = *( Quaternion *)lua_topointer(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	const Quaternion & rkQ = *( Quaternion *)lua_topointer(L, 6);
 	luaL_checktype(L, 7, LUA_TBOOLEAN);
 	bool shortestPath = lua_toboolean(L, 7);
-	 Quaternion *retInst = new  Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = Quaternion::Squad(fT, rkP, rkA, rkB, rkQ, shortestPath);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_Inverse(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->Inverse();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_set(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number w = lua_tonumber(L, 2);
@@ -5394,16 +5414,15 @@ static int Polycore_Quaternion_set(lua_State *L) {
 }
 
 static int Polycore_Quaternion_inverse(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->inverse();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Quaternion_InvSqrt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5412,7 +5431,7 @@ static int Polycore_Quaternion_InvSqrt(lua_State *L) {
 }
 
 static int Polycore_Quaternion_fromAxes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number az = lua_tonumber(L, 2);
@@ -5425,29 +5444,29 @@ static int Polycore_Quaternion_fromAxes(lua_State *L) {
 }
 
 static int Polycore_Quaternion_FromAngleAxis(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Number & rfAngle = *( Number *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & rkAxis = *( Vector3 *)lua_topointer(L, 3);
 	inst->FromAngleAxis(rfAngle, rkAxis);
 	return 0;
 }
 
 static int Polycore_Quaternion_ToAngleAxis(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Number & rfAngle = *(Number *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Vector3 & rkAxis = *(Vector3 *)lua_topointer(L, 3);
 	inst->ToAngleAxis(rfAngle, rkAxis);
 	return 0;
 }
 
 static int Polycore_Quaternion_createFromAxisAngle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5462,29 +5481,59 @@ static int Polycore_Quaternion_createFromAxisAngle(lua_State *L) {
 }
 
 static int Polycore_Quaternion_createMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->createMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_delete_Quaternion(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
-	delete inst;
+	luaPolycode_checkpointer(L, 1);
+	if(lua_islightuserdata(L, 1)) {
+		Quaternion *inst = (Quaternion*)lua_topointer(L, 1);
+		delete inst;
+	}
 	return 0;
 }
 
+static int Polycore_Quaternion__gc(lua_State *L) {
+	Quaternion *inst = (Quaternion*)lua_touserdata(L, 1);
+	inst->~Quaternion();
+	return 0;
+}
+
+static int Polycore_Quaternion__add(lua_State *L) {
+	Quaternion lhs = *(Quaternion*)luaPolycode_checkvalue(L, 1, "Polycode.Quaternion");
+	Quaternion rhs = *(Quaternion*)luaPolycode_checkvalue(L, 2, "Polycode.Quaternion");
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
+	*retInst = lhs + rhs;
+	return 1;
+}
+
+static int Polycore_Quaternion__mul(lua_State *L) {
+	Quaternion lhs = *(Quaternion*)luaPolycode_checkvalue(L, 1, "Polycode.Quaternion");
+	Quaternion rhs = *(Quaternion*)luaPolycode_checkvalue(L, 2, "Polycode.Quaternion");
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
+	*retInst = lhs * rhs;
+	return 1;
+}
+
+static int Polycore_Quaternion__eq(lua_State *L) {
+	Quaternion lhs = *(Quaternion*)luaPolycode_checkvalue(L, 1, "Polycode.Quaternion");
+	Quaternion rhs = *(Quaternion*)luaPolycode_checkvalue(L, 2, "Polycode.Quaternion");
+	lua_pushboolean(L, lhs == rhs);
+	return 1;
+}
+
 static int Polycore_QuaternionCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve * wCurve = (BezierCurve *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	BezierCurve * xCurve = (BezierCurve *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	BezierCurve * yCurve = (BezierCurve *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	BezierCurve * zCurve = (BezierCurve *)lua_topointer(L, 4);
 	QuaternionCurve *inst = new QuaternionCurve(wCurve, xCurve, yCurve, zCurve);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -5492,77 +5541,76 @@ static int Polycore_QuaternionCurve(lua_State *L) {
 }
 
 static int Polycore_QuaternionCurve_interpolate(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionCurve *inst = (QuaternionCurve*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number t = lua_tonumber(L, 2);
 	luaL_checktype(L, 3, LUA_TBOOLEAN);
 	bool useShortestPath = lua_toboolean(L, 3);
-	Quaternion *retInst = new Quaternion();
+	Quaternion *retInst = new (luaPolycode_alloc_value(L, sizeof(Quaternion), "Polycode.Quaternion")) Quaternion();
 	*retInst = inst->interpolate(t, useShortestPath);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_QuaternionCurve_generatePointsFromCurves(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionCurve *inst = (QuaternionCurve*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	BezierCurve * wCurve = (BezierCurve *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	BezierCurve * xCurve = (BezierCurve *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	BezierCurve * yCurve = (BezierCurve *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	BezierCurve * zCurve = (BezierCurve *)lua_topointer(L, 5);
 	inst->generatePointsFromCurves(wCurve, xCurve, yCurve, zCurve);
 	return 0;
 }
 
 static int Polycore_QuaternionCurve_recalcTangents(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionCurve *inst = (QuaternionCurve*)lua_topointer(L, 1);
 	inst->recalcTangents();
 	return 0;
 }
 
 static int Polycore_delete_QuaternionCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionCurve *inst = (QuaternionCurve*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Rectangle_get_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->x);
 	return 1;
 }
 
 static int Polycore_Rectangle_get_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->y);
 	return 1;
 }
 
 static int Polycore_Rectangle_get_w(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->w);
 	return 1;
 }
 
 static int Polycore_Rectangle_get_h(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->h);
 	return 1;
 }
 
 static int Polycore_Rectangle_set_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->x = param;
@@ -5570,7 +5618,7 @@ static int Polycore_Rectangle_set_x(lua_State *L) {
 }
 
 static int Polycore_Rectangle_set_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->y = param;
@@ -5578,7 +5626,7 @@ static int Polycore_Rectangle_set_y(lua_State *L) {
 }
 
 static int Polycore_Rectangle_set_w(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->w = param;
@@ -5586,7 +5634,7 @@ static int Polycore_Rectangle_set_w(lua_State *L) {
 }
 
 static int Polycore_Rectangle_set_h(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->h = param;
@@ -5600,7 +5648,7 @@ static int Polycore_Rectangle(lua_State *L) {
 }
 
 static int Polycore_Rectangle_setRect(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5615,42 +5663,42 @@ static int Polycore_Rectangle_setRect(lua_State *L) {
 }
 
 static int Polycore_delete_Rectangle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Polycode::Rectangle *inst = (Polycode::Rectangle*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Renderer_get_ambientColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->ambientColor);
 	return 1;
 }
 
 static int Polycore_Renderer_get_clearColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->clearColor);
 	return 1;
 }
 
 static int Polycore_Renderer_get_exposureLevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->exposureLevel);
 	return 1;
 }
 
 static int Polycore_Renderer_get_cameraPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->cameraPosition);
 	return 1;
 }
 
 static int Polycore_Renderer_set_exposureLevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->exposureLevel = param;
@@ -5658,7 +5706,7 @@ static int Polycore_Renderer_set_exposureLevel(lua_State *L) {
 }
 
 static int Polycore_Renderer_Resize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int xRes = lua_tointeger(L, 2);
@@ -5669,33 +5717,33 @@ static int Polycore_Renderer_Resize(lua_State *L) {
 }
 
 static int Polycore_Renderer_BeginRender(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->BeginRender();
 	return 0;
 }
 
 static int Polycore_Renderer_EndRender(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->EndRender();
 	return 0;
 }
 
 static int Polycore_Renderer_createCubemap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * t0 = (Texture *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * t1 = (Texture *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Texture * t2 = (Texture *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Texture * t3 = (Texture *)lua_topointer(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	Texture * t4 = (Texture *)lua_topointer(L, 6);
-	luaL_checktype(L, 7, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 7);
 	Texture * t5 = (Texture *)lua_topointer(L, 7);
 	void *ptrRetVal = (void*)inst->createCubemap(t0, t1, t2, t3, t4, t5);
 	if(ptrRetVal == NULL) {
@@ -5707,13 +5755,13 @@ static int Polycore_Renderer_createCubemap(lua_State *L) {
 }
 
 static int Polycore_Renderer_createTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int width = lua_tointeger(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	unsigned int height = lua_tointeger(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	char * textureData = (char *)lua_topointer(L, 4);
 	luaL_checktype(L, 5, LUA_TBOOLEAN);
 	bool clamp = lua_toboolean(L, 5);
@@ -5733,11 +5781,11 @@ static int Polycore_Renderer_createTexture(lua_State *L) {
 }
 
 static int Polycore_Renderer_createRenderTextures(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * * colorBuffer = (Texture * *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * * depthBuffer = (Texture * *)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	int width = lua_tointeger(L, 4);
@@ -5748,7 +5796,7 @@ static int Polycore_Renderer_createRenderTextures(lua_State *L) {
 }
 
 static int Polycore_Renderer_createFramebufferTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int width = lua_tointeger(L, 2);
@@ -5764,41 +5812,41 @@ static int Polycore_Renderer_createFramebufferTexture(lua_State *L) {
 }
 
 static int Polycore_Renderer_bindFrameBufferTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->bindFrameBufferTexture(texture);
 	return 0;
 }
 
 static int Polycore_Renderer_unbindFramebuffers(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->unbindFramebuffers();
 	return 0;
 }
 
 static int Polycore_Renderer_renderToTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * targetTexture = (Texture *)lua_topointer(L, 2);
 	inst->renderToTexture(targetTexture);
 	return 0;
 }
 
 static int Polycore_Renderer_renderZBufferToTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * targetTexture = (Texture *)lua_topointer(L, 2);
 	inst->renderZBufferToTexture(targetTexture);
 	return 0;
 }
 
 static int Polycore_Renderer_setViewportSize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int w = lua_tointeger(L, 2);
@@ -5815,14 +5863,14 @@ static int Polycore_Renderer_setViewportSize(lua_State *L) {
 }
 
 static int Polycore_Renderer_loadIdentity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->loadIdentity();
 	return 0;
 }
 
 static int Polycore_Renderer_setOrthoMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	Number xSize;
 	if(lua_isnumber(L, 2)) {
@@ -5841,30 +5889,30 @@ static int Polycore_Renderer_setOrthoMode(lua_State *L) {
 }
 
 static int Polycore_Renderer__setOrthoMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->_setOrthoMode();
 	return 0;
 }
 
 static int Polycore_Renderer_setPerspectiveMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->setPerspectiveMode();
 	return 0;
 }
 
 static int Polycore_Renderer_setTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->setTexture(texture);
 	return 0;
 }
 
 static int Polycore_Renderer_enableBackfaceCulling(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -5873,7 +5921,7 @@ static int Polycore_Renderer_enableBackfaceCulling(lua_State *L) {
 }
 
 static int Polycore_Renderer_setClearColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -5886,7 +5934,7 @@ static int Polycore_Renderer_setClearColor(lua_State *L) {
 }
 
 static int Polycore_Renderer_setAmbientColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -5899,14 +5947,14 @@ static int Polycore_Renderer_setAmbientColor(lua_State *L) {
 }
 
 static int Polycore_Renderer_clearScreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->clearScreen();
 	return 0;
 }
 
 static int Polycore_Renderer_translate2D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -5917,7 +5965,7 @@ static int Polycore_Renderer_translate2D(lua_State *L) {
 }
 
 static int Polycore_Renderer_rotate2D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number angle = lua_tonumber(L, 2);
@@ -5926,16 +5974,16 @@ static int Polycore_Renderer_rotate2D(lua_State *L) {
 }
 
 static int Polycore_Renderer_scale2D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector2 * scale = (Vector2 *)lua_topointer(L, 2);
 	inst->scale2D(scale);
 	return 0;
 }
 
 static int Polycore_Renderer_setFOV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number fov = lua_tonumber(L, 2);
@@ -5944,7 +5992,7 @@ static int Polycore_Renderer_setFOV(lua_State *L) {
 }
 
 static int Polycore_Renderer_setVertexColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -5959,9 +6007,9 @@ static int Polycore_Renderer_setVertexColor(lua_State *L) {
 }
 
 static int Polycore_Renderer_pushDataArrayForMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Mesh * mesh = (Mesh *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int arrayType = lua_tointeger(L, 3);
@@ -5970,18 +6018,18 @@ static int Polycore_Renderer_pushDataArrayForMesh(lua_State *L) {
 }
 
 static int Polycore_Renderer_pushRenderDataArray(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	RenderDataArray * array = (RenderDataArray *)lua_topointer(L, 2);
 	inst->pushRenderDataArray(array);
 	return 0;
 }
 
 static int Polycore_Renderer_createRenderDataArrayForMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Mesh * mesh = (Mesh *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int arrayType = lua_tointeger(L, 3);
@@ -5995,7 +6043,7 @@ static int Polycore_Renderer_createRenderDataArrayForMesh(lua_State *L) {
 }
 
 static int Polycore_Renderer_createRenderDataArray(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int arrayType = lua_tointeger(L, 2);
@@ -6009,18 +6057,18 @@ static int Polycore_Renderer_createRenderDataArray(lua_State *L) {
 }
 
 static int Polycore_Renderer_setRenderArrayData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	RenderDataArray * array = (RenderDataArray *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Number * arrayData = (Number *)lua_topointer(L, 3);
 	inst->setRenderArrayData(array, arrayData);
 	return 0;
 }
 
 static int Polycore_Renderer_drawArrays(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int drawType = lua_tointeger(L, 2);
@@ -6029,39 +6077,39 @@ static int Polycore_Renderer_drawArrays(lua_State *L) {
 }
 
 static int Polycore_Renderer_translate3D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 * position = (Vector3 *)lua_topointer(L, 2);
 	inst->translate3D(position);
 	return 0;
 }
 
 static int Polycore_Renderer_scale3D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 * scale = (Vector3 *)lua_topointer(L, 2);
 	inst->scale3D(scale);
 	return 0;
 }
 
 static int Polycore_Renderer_pushMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->pushMatrix();
 	return 0;
 }
 
 static int Polycore_Renderer_popMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->popMatrix();
 	return 0;
 }
 
 static int Polycore_Renderer_setLineSmooth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6070,7 +6118,7 @@ static int Polycore_Renderer_setLineSmooth(lua_State *L) {
 }
 
 static int Polycore_Renderer_setLineSize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number lineSize = lua_tonumber(L, 2);
@@ -6079,7 +6127,7 @@ static int Polycore_Renderer_setLineSize(lua_State *L) {
 }
 
 static int Polycore_Renderer_enableLighting(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool enable = lua_toboolean(L, 2);
@@ -6088,7 +6136,7 @@ static int Polycore_Renderer_enableLighting(lua_State *L) {
 }
 
 static int Polycore_Renderer_enableFog(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool enable = lua_toboolean(L, 2);
@@ -6097,11 +6145,11 @@ static int Polycore_Renderer_enableFog(lua_State *L) {
 }
 
 static int Polycore_Renderer_setFogProperties(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int fogMode = lua_tointeger(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Color color = *(Color*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number density = lua_tonumber(L, 4);
@@ -6114,25 +6162,25 @@ static int Polycore_Renderer_setFogProperties(lua_State *L) {
 }
 
 static int Polycore_Renderer_multModelviewMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 m = *(Matrix4*)lua_topointer(L, 2);
 	inst->multModelviewMatrix(m);
 	return 0;
 }
 
 static int Polycore_Renderer_setModelviewMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 m = *(Matrix4*)lua_topointer(L, 2);
 	inst->setModelviewMatrix(m);
 	return 0;
 }
 
 static int Polycore_Renderer_setBlendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int bl_endingMode = lua_tointeger(L, 2);
@@ -6141,11 +6189,11 @@ static int Polycore_Renderer_setBlendingMode(lua_State *L) {
 }
 
 static int Polycore_Renderer_applyMaterial(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Material * material = (Material *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	ShaderBinding * localOptions = (ShaderBinding *)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	unsigned int shaderIndex = lua_tointeger(L, 4);
@@ -6154,14 +6202,14 @@ static int Polycore_Renderer_applyMaterial(lua_State *L) {
 }
 
 static int Polycore_Renderer_clearShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->clearShader();
 	return 0;
 }
 
 static int Polycore_Renderer_setDepthFunction(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int depthFunction = lua_tointeger(L, 2);
@@ -6170,25 +6218,25 @@ static int Polycore_Renderer_setDepthFunction(lua_State *L) {
 }
 
 static int Polycore_Renderer_createVertexBufferForMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Mesh * mesh = (Mesh *)lua_topointer(L, 2);
 	inst->createVertexBufferForMesh(mesh);
 	return 0;
 }
 
 static int Polycore_Renderer_drawVertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	VertexBuffer * buffer = (VertexBuffer *)lua_topointer(L, 2);
 	inst->drawVertexBuffer(buffer);
 	return 0;
 }
 
 static int Polycore_Renderer_setRenderMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int newR_enderMode = lua_tointeger(L, 2);
@@ -6197,14 +6245,14 @@ static int Polycore_Renderer_setRenderMode(lua_State *L) {
 }
 
 static int Polycore_Renderer_getRenderMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getRenderMode());
 	return 1;
 }
 
 static int Polycore_Renderer_enableDepthTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6213,7 +6261,7 @@ static int Polycore_Renderer_enableDepthTest(lua_State *L) {
 }
 
 static int Polycore_Renderer_enableDepthWrite(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6222,23 +6270,23 @@ static int Polycore_Renderer_enableDepthWrite(lua_State *L) {
 }
 
 static int Polycore_Renderer_billboardMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->billboardMatrix();
 	return 0;
 }
 
 static int Polycore_Renderer_billboardMatrixWithScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 scale = *(Vector3*)lua_topointer(L, 2);
 	inst->billboardMatrixWithScale(scale);
 	return 0;
 }
 
 static int Polycore_Renderer_setTextureFilteringMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int mode = lua_tointeger(L, 2);
@@ -6247,7 +6295,7 @@ static int Polycore_Renderer_setTextureFilteringMode(lua_State *L) {
 }
 
 static int Polycore_Renderer_enableAlphaTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6256,7 +6304,7 @@ static int Polycore_Renderer_enableAlphaTest(lua_State *L) {
 }
 
 static int Polycore_Renderer_clearBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool colorBuffer = lua_toboolean(L, 2);
@@ -6267,7 +6315,7 @@ static int Polycore_Renderer_clearBuffer(lua_State *L) {
 }
 
 static int Polycore_Renderer_drawToColorBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6276,34 +6324,33 @@ static int Polycore_Renderer_drawToColorBuffer(lua_State *L) {
 }
 
 static int Polycore_Renderer_getCameraMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getCameraMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Renderer_setCameraMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Matrix4 matrix = *(Matrix4*)lua_topointer(L, 2);
 	inst->setCameraMatrix(matrix);
 	return 0;
 }
 
 static int Polycore_Renderer_setCameraPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 pos = *(Vector3*)lua_topointer(L, 2);
 	inst->setCameraPosition(pos);
 	return 0;
 }
 
 static int Polycore_Renderer_drawScreenQuad(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number qx = lua_tonumber(L, 2);
@@ -6314,21 +6361,21 @@ static int Polycore_Renderer_drawScreenQuad(lua_State *L) {
 }
 
 static int Polycore_Renderer_getXRes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getXRes());
 	return 1;
 }
 
 static int Polycore_Renderer_getYRes(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getYRes());
 	return 1;
 }
 
 static int Polycore_Renderer_cullFrontFaces(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6337,22 +6384,22 @@ static int Polycore_Renderer_cullFrontFaces(lua_State *L) {
 }
 
 static int Polycore_Renderer_clearLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->clearLights();
 	return 0;
 }
 
 static int Polycore_Renderer_addLight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 position = *(Vector3*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	int type = lua_tointeger(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Color color = *(Color*)lua_topointer(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	Number constantAttenuation = lua_tonumber(L, 6);
@@ -6368,14 +6415,14 @@ static int Polycore_Renderer_addLight(lua_State *L) {
 	Number spotlightExponent = lua_tonumber(L, 11);
 	luaL_checktype(L, 12, LUA_TBOOLEAN);
 	bool shadowsEnabled = lua_toboolean(L, 12);
-	luaL_checktype(L, 13, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 13);
 	Matrix4 * textureMatrix = (Matrix4 *)lua_topointer(L, 13);
 	inst->addLight(position, direction, type, color, constantAttenuation, linearAttenuation, quadraticAttenuation, intensity, spotlightCutoff, spotlightExponent, shadowsEnabled, textureMatrix);
 	return 0;
 }
 
 static int Polycore_Renderer_setExposureLevel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number level = lua_tonumber(L, 2);
@@ -6384,26 +6431,26 @@ static int Polycore_Renderer_setExposureLevel(lua_State *L) {
 }
 
 static int Polycore_Renderer_rayTriangleIntersect(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 ray_origin = *(Vector3*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Vector3 ray_direction = *(Vector3*)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Vector3 vert0 = *(Vector3*)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Vector3 vert1 = *(Vector3*)lua_topointer(L, 5);
-	luaL_checktype(L, 6, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 6);
 	Vector3 vert2 = *(Vector3*)lua_topointer(L, 6);
-	luaL_checktype(L, 7, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 7);
 	Vector3 * hitPoint = (Vector3 *)lua_topointer(L, 7);
 	lua_pushboolean(L, inst->rayTriangleIntersect(ray_origin, ray_direction, vert0, vert1, vert2, hitPoint));
 	return 1;
 }
 
 static int Polycore_Renderer_enableShaders(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool flag = lua_toboolean(L, 2);
@@ -6412,31 +6459,31 @@ static int Polycore_Renderer_enableShaders(lua_State *L) {
 }
 
 static int Polycore_Renderer_initOSSpecific(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->initOSSpecific();
 	return 0;
 }
 
 static int Polycore_Renderer_addShaderModule(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolycodeShaderModule * module = (PolycodeShaderModule *)lua_topointer(L, 2);
 	inst->addShaderModule(module);
 	return 0;
 }
 
 static int Polycore_Renderer_test2DCoordinate(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number y = lua_tonumber(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Polycode::Polygon * poly = (Polycode::Polygon *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	const Matrix4 & matrix = *( Matrix4 *)lua_topointer(L, 5);
 	luaL_checktype(L, 6, LUA_TBOOLEAN);
 	bool billboardMode = lua_toboolean(L, 6);
@@ -6445,75 +6492,72 @@ static int Polycore_Renderer_test2DCoordinate(lua_State *L) {
 }
 
 static int Polycore_Renderer_getProjectionMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	 Matrix4 *retInst = new  Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getProjectionMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Renderer_getModelviewMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	 Matrix4 *retInst = new  Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getModelviewMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Renderer_addShadowMap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->addShadowMap(texture);
 	return 0;
 }
 
 static int Polycore_Renderer_Unproject(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number y = lua_tonumber(L, 3);
-	 Vector3 *retInst = new  Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->Unproject(x, y);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Renderer_sortLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	inst->sortLights();
 	return 0;
 }
 
 static int Polycore_Renderer_getNumAreaLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumAreaLights());
 	return 1;
 }
 
 static int Polycore_Renderer_getNumSpotLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumSpotLights());
 	return 1;
 }
 
 static int Polycore_Renderer_getNumLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumLights());
 	return 1;
 }
 
 static int Polycore_delete_Renderer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Renderer *inst = (Renderer*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -6528,21 +6572,21 @@ static int Polycore_Resource(lua_State *L) {
 }
 
 static int Polycore_Resource_getResourceName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getResourceName().c_str());
 	return 1;
 }
 
 static int Polycore_Resource_getResourceType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getResourceType());
 	return 1;
 }
 
 static int Polycore_Resource_setResourceName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String newName = String(lua_tostring(L, 2));
@@ -6551,7 +6595,7 @@ static int Polycore_Resource_setResourceName(lua_State *L) {
 }
 
 static int Polycore_Resource_setResourcePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String path = String(lua_tostring(L, 2));
@@ -6560,14 +6604,14 @@ static int Polycore_Resource_setResourcePath(lua_State *L) {
 }
 
 static int Polycore_Resource_getResourcePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getResourcePath().c_str());
 	return 1;
 }
 
 static int Polycore_delete_Resource(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Resource *inst = (Resource*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -6580,16 +6624,16 @@ static int Polycore_ResourceManager(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_addResource(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Resource * resource = (Resource *)lua_topointer(L, 2);
 	inst->addResource(resource);
 	return 0;
 }
 
 static int Polycore_ResourceManager_addDirResource(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6604,7 +6648,7 @@ static int Polycore_ResourceManager_addDirResource(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_addArchive(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String zipPath = String(lua_tostring(L, 2));
@@ -6613,7 +6657,7 @@ static int Polycore_ResourceManager_addArchive(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_readFile(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -6622,7 +6666,7 @@ static int Polycore_ResourceManager_readFile(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parseTextures(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6633,7 +6677,7 @@ static int Polycore_ResourceManager_parseTextures(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parseMaterials(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6644,7 +6688,7 @@ static int Polycore_ResourceManager_parseMaterials(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parseShaders(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6655,7 +6699,7 @@ static int Polycore_ResourceManager_parseShaders(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parsePrograms(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6666,7 +6710,7 @@ static int Polycore_ResourceManager_parsePrograms(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parseCubemaps(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6677,7 +6721,7 @@ static int Polycore_ResourceManager_parseCubemaps(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_parseOthers(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String dirPath = String(lua_tostring(L, 2));
@@ -6688,7 +6732,7 @@ static int Polycore_ResourceManager_parseOthers(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_getResource(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int resourceType = lua_tointeger(L, 2);
@@ -6704,58 +6748,58 @@ static int Polycore_ResourceManager_getResource(lua_State *L) {
 }
 
 static int Polycore_ResourceManager_addShaderModule(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolycodeShaderModule * module = (PolycodeShaderModule *)lua_topointer(L, 2);
 	inst->addShaderModule(module);
 	return 0;
 }
 
 static int Polycore_delete_ResourceManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ResourceManager *inst = (ResourceManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Scene_get_clearColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->clearColor);
 	return 1;
 }
 
 static int Polycore_Scene_get_useClearColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useClearColor);
 	return 1;
 }
 
 static int Polycore_Scene_get_ambientColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->ambientColor);
 	return 1;
 }
 
 static int Polycore_Scene_get_fogColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->fogColor);
 	return 1;
 }
 
 static int Polycore_Scene_get_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->enabled);
 	return 1;
 }
 
 static int Polycore_Scene_set_useClearColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useClearColor = param;
@@ -6763,7 +6807,7 @@ static int Polycore_Scene_set_useClearColor(lua_State *L) {
 }
 
 static int Polycore_Scene_set_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->enabled = param;
@@ -6777,25 +6821,25 @@ static int Polycore_Scene(lua_State *L) {
 }
 
 static int Polycore_Scene_addEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	inst->addEntity(entity);
 	return 0;
 }
 
 static int Polycore_Scene_removeEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	inst->removeEntity(entity);
 	return 0;
 }
 
 static int Polycore_Scene_getDefaultCamera(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getDefaultCamera();
 	if(ptrRetVal == NULL) {
@@ -6807,7 +6851,7 @@ static int Polycore_Scene_getDefaultCamera(lua_State *L) {
 }
 
 static int Polycore_Scene_enableLighting(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool enable = lua_toboolean(L, 2);
@@ -6816,7 +6860,7 @@ static int Polycore_Scene_enableLighting(lua_State *L) {
 }
 
 static int Polycore_Scene_enableFog(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool enable = lua_toboolean(L, 2);
@@ -6825,11 +6869,11 @@ static int Polycore_Scene_enableFog(lua_State *L) {
 }
 
 static int Polycore_Scene_setFogProperties(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int fogMode = lua_tointeger(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Color color = *(Color*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number density = lua_tonumber(L, 4);
@@ -6842,14 +6886,14 @@ static int Polycore_Scene_setFogProperties(lua_State *L) {
 }
 
 static int Polycore_Scene_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_Scene_setVirtual(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -6858,21 +6902,21 @@ static int Polycore_Scene_setVirtual(lua_State *L) {
 }
 
 static int Polycore_Scene_isVirtual(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isVirtual());
 	return 1;
 }
 
 static int Polycore_Scene_isEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isEnabled());
 	return 1;
 }
 
 static int Polycore_Scene_setEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool enabled = lua_toboolean(L, 2);
@@ -6881,14 +6925,14 @@ static int Polycore_Scene_setEnabled(lua_State *L) {
 }
 
 static int Polycore_Scene_getNumEntities(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumEntities());
 	return 1;
 }
 
 static int Polycore_Scene_getEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -6902,7 +6946,7 @@ static int Polycore_Scene_getEntity(lua_State *L) {
 }
 
 static int Polycore_Scene_getEntityAtScreenPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -6918,10 +6962,10 @@ static int Polycore_Scene_getEntityAtScreenPosition(lua_State *L) {
 }
 
 static int Polycore_Scene_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	Camera * targetCamera;
-	if(lua_islightuserdata(L, 2)) {
+	if(lua_isuserdata(L, 2)) {
 		targetCamera = (Camera *)lua_topointer(L, 2);
 	} else {
 		targetCamera = NULL;
@@ -6931,23 +6975,23 @@ static int Polycore_Scene_Render(lua_State *L) {
 }
 
 static int Polycore_Scene_RenderDepthOnly(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Camera * targetCamera = (Camera *)lua_topointer(L, 2);
 	inst->RenderDepthOnly(targetCamera);
 	return 0;
 }
 
 static int Polycore_Scene_readString(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	OSFILE * inFile = (OSFILE *)lua_topointer(L, 2);
 	lua_pushstring(L, Scene::readString(inFile).c_str());
 	return 1;
 }
 
 static int Polycore_Scene_loadScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -6956,7 +7000,7 @@ static int Polycore_Scene_loadScene(lua_State *L) {
 }
 
 static int Polycore_Scene_generateLightmaps(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number lightMapRes = lua_tonumber(L, 2);
@@ -6969,18 +7013,18 @@ static int Polycore_Scene_generateLightmaps(lua_State *L) {
 }
 
 static int Polycore_Scene_addLight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneLight * light = (SceneLight *)lua_topointer(L, 2);
 	inst->addLight(light);
 	return 0;
 }
 
 static int Polycore_Scene_getNearestLight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 pos = *(Vector3*)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getNearestLight(pos);
 	if(ptrRetVal == NULL) {
@@ -6992,29 +7036,29 @@ static int Polycore_Scene_getNearestLight(lua_State *L) {
 }
 
 static int Polycore_Scene_writeEntityMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	OSFILE * outFile = (OSFILE *)lua_topointer(L, 3);
 	inst->writeEntityMatrix(entity, outFile);
 	return 0;
 }
 
 static int Polycore_Scene_writeString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String str = String(lua_tostring(L, 2));
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	OSFILE * outFile = (OSFILE *)lua_topointer(L, 3);
 	inst->writeString(str, outFile);
 	return 0;
 }
 
 static int Polycore_Scene_saveScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -7023,14 +7067,14 @@ static int Polycore_Scene_saveScene(lua_State *L) {
 }
 
 static int Polycore_Scene_getNumStaticGeometry(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumStaticGeometry());
 	return 1;
 }
 
 static int Polycore_Scene_getStaticGeometry(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -7044,9 +7088,9 @@ static int Polycore_Scene_getStaticGeometry(lua_State *L) {
 }
 
 static int Polycore_Scene_loadCollisionChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	bool autoCollide;
 	if(lua_isboolean(L, 3)) {
@@ -7065,14 +7109,14 @@ static int Polycore_Scene_loadCollisionChild(lua_State *L) {
 }
 
 static int Polycore_Scene_getNumLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumLights());
 	return 1;
 }
 
 static int Polycore_Scene_getLight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -7086,7 +7130,7 @@ static int Polycore_Scene_getLight(lua_State *L) {
 }
 
 static int Polycore_Scene_getCustomEntityByType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String type = String(lua_tostring(L, 2));
@@ -7100,7 +7144,7 @@ static int Polycore_Scene_getCustomEntityByType(lua_State *L) {
 }
 
 static int Polycore_delete_Scene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene *inst = (Scene*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7113,7 +7157,7 @@ static int Polycore_SceneEntity(lua_State *L) {
 }
 
 static int Polycore_SceneEntity_testMouseCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity *inst = (SceneEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -7124,7 +7168,7 @@ static int Polycore_SceneEntity_testMouseCollision(lua_State *L) {
 }
 
 static int Polycore_delete_SceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity *inst = (SceneEntity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7147,7 +7191,7 @@ static int Polycore_SceneLabel(lua_State *L) {
 }
 
 static int Polycore_SceneLabel_testMouseCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLabel *inst = (SceneLabel*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -7158,7 +7202,7 @@ static int Polycore_SceneLabel_testMouseCollision(lua_State *L) {
 }
 
 static int Polycore_SceneLabel_setText(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLabel *inst = (SceneLabel*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String newText = String(lua_tostring(L, 2));
@@ -7167,7 +7211,7 @@ static int Polycore_SceneLabel_setText(lua_State *L) {
 }
 
 static int Polycore_SceneLabel_getLabel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLabel *inst = (SceneLabel*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getLabel();
 	if(ptrRetVal == NULL) {
@@ -7179,21 +7223,21 @@ static int Polycore_SceneLabel_getLabel(lua_State *L) {
 }
 
 static int Polycore_SceneLabel_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLabel *inst = (SceneLabel*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_delete_SceneLabel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLabel *inst = (SceneLabel*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_SceneLight_get_lightColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->lightColor);
 	return 1;
@@ -7202,7 +7246,7 @@ static int Polycore_SceneLight_get_lightColor(lua_State *L) {
 static int Polycore_SceneLight(lua_State *L) {
 	luaL_checktype(L, 1, LUA_TNUMBER);
 	int type = lua_tointeger(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * parentScene = (Scene *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number intensity = lua_tonumber(L, 3);
@@ -7230,67 +7274,66 @@ static int Polycore_SceneLight(lua_State *L) {
 }
 
 static int Polycore_SceneLight_getIntensity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getIntensity());
 	return 1;
 }
 
 static int Polycore_SceneLight_getConstantAttenuation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getConstantAttenuation());
 	return 1;
 }
 
 static int Polycore_SceneLight_getLinearAttenuation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getLinearAttenuation());
 	return 1;
 }
 
 static int Polycore_SceneLight_getQuadraticAttenuation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getQuadraticAttenuation());
 	return 1;
 }
 
 static int Polycore_SceneLight_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Polycore_SceneLight_renderDepthMap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * scene = (Scene *)lua_topointer(L, 2);
 	inst->renderDepthMap(scene);
 	return 0;
 }
 
 static int Polycore_SceneLight_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_SceneLight_getLightViewMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->getLightViewMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_SceneLight_getZBufferTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getZBufferTexture();
 	if(ptrRetVal == NULL) {
@@ -7302,7 +7345,7 @@ static int Polycore_SceneLight_getZBufferTexture(lua_State *L) {
 }
 
 static int Polycore_SceneLight_setLightColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -7315,7 +7358,7 @@ static int Polycore_SceneLight_setLightColor(lua_State *L) {
 }
 
 static int Polycore_SceneLight_setSpotlightProperties(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number spotlightCutoff = lua_tonumber(L, 2);
@@ -7326,21 +7369,21 @@ static int Polycore_SceneLight_setSpotlightProperties(lua_State *L) {
 }
 
 static int Polycore_SceneLight_getSpotlightCutoff(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getSpotlightCutoff());
 	return 1;
 }
 
 static int Polycore_SceneLight_getSpotlightExponent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getSpotlightExponent());
 	return 1;
 }
 
 static int Polycore_SceneLight_enableShadows(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -7355,7 +7398,7 @@ static int Polycore_SceneLight_enableShadows(lua_State *L) {
 }
 
 static int Polycore_SceneLight_setShadowMapFOV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number fov = lua_tonumber(L, 2);
@@ -7364,30 +7407,30 @@ static int Polycore_SceneLight_setShadowMapFOV(lua_State *L) {
 }
 
 static int Polycore_SceneLight_areShadowsEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->areShadowsEnabled());
 	return 1;
 }
 
 static int Polycore_SceneLight_getLightType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getLightType());
 	return 1;
 }
 
 static int Polycore_delete_SceneLight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLight *inst = (SceneLight*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_SceneLine(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity * ent1 = (SceneEntity *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * ent2 = (SceneEntity *)lua_topointer(L, 2);
 	SceneLine *inst = new SceneLine(ent1, ent2);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -7395,14 +7438,14 @@ static int Polycore_SceneLine(lua_State *L) {
 }
 
 static int Polycore_SceneLine_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLine *inst = (SceneLine*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_delete_SceneLine(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneLine *inst = (SceneLine*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7415,69 +7458,69 @@ static int Polycore_SceneManager(lua_State *L) {
 }
 
 static int Polycore_SceneManager_addScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * newScene = (Scene *)lua_topointer(L, 2);
 	inst->addScene(newScene);
 	return 0;
 }
 
 static int Polycore_SceneManager_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_SceneManager_UpdateVirtual(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
 	inst->UpdateVirtual();
 	return 0;
 }
 
 static int Polycore_SceneManager_removeScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Scene * scene = (Scene *)lua_topointer(L, 2);
 	inst->removeScene(scene);
 	return 0;
 }
 
 static int Polycore_SceneManager_registerRenderTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneRenderTexture * r_enderTexture = (SceneRenderTexture *)lua_topointer(L, 2);
 	inst->registerRenderTexture(r_enderTexture);
 	return 0;
 }
 
 static int Polycore_delete_SceneManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneManager *inst = (SceneManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_SceneMesh_get_lightmapIndex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->lightmapIndex);
 	return 1;
 }
 
 static int Polycore_SceneMesh_get_showVertexNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->showVertexNormals);
 	return 1;
 }
 
 static int Polycore_SceneMesh_set_showVertexNormals(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->showVertexNormals = param;
@@ -7493,14 +7536,14 @@ static int Polycore_SceneMesh(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_SceneMesh_getLocalShaderOptions(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getLocalShaderOptions();
 	if(ptrRetVal == NULL) {
@@ -7512,7 +7555,7 @@ static int Polycore_SceneMesh_getLocalShaderOptions(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_getMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getMesh();
 	if(ptrRetVal == NULL) {
@@ -7524,7 +7567,7 @@ static int Polycore_SceneMesh_getMesh(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_getTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTexture();
 	if(ptrRetVal == NULL) {
@@ -7536,7 +7579,7 @@ static int Polycore_SceneMesh_getTexture(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_getMaterial(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getMaterial();
 	if(ptrRetVal == NULL) {
@@ -7548,7 +7591,7 @@ static int Polycore_SceneMesh_getMaterial(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_loadTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -7563,7 +7606,7 @@ static int Polycore_SceneMesh_loadTexture(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_loadSkeleton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -7572,25 +7615,25 @@ static int Polycore_SceneMesh_loadSkeleton(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_setTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->setTexture(texture);
 	return 0;
 }
 
 static int Polycore_SceneMesh_setMaterial(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Material * material = (Material *)lua_topointer(L, 2);
 	inst->setMaterial(material);
 	return 0;
 }
 
 static int Polycore_SceneMesh_setMaterialByName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String materialName = String(lua_tostring(L, 2));
@@ -7599,25 +7642,25 @@ static int Polycore_SceneMesh_setMaterialByName(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_setMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Mesh * mesh = (Mesh *)lua_topointer(L, 2);
 	inst->setMesh(mesh);
 	return 0;
 }
 
 static int Polycore_SceneMesh_setSkeleton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Skeleton * skeleton = (Skeleton *)lua_topointer(L, 2);
 	inst->setSkeleton(skeleton);
 	return 0;
 }
 
 static int Polycore_SceneMesh_getSkeleton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSkeleton();
 	if(ptrRetVal == NULL) {
@@ -7629,14 +7672,14 @@ static int Polycore_SceneMesh_getSkeleton(lua_State *L) {
 }
 
 static int Polycore_SceneMesh_renderMeshLocally(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	inst->renderMeshLocally();
 	return 0;
 }
 
 static int Polycore_SceneMesh_cacheToVertexBuffer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool cache = lua_toboolean(L, 2);
@@ -7645,7 +7688,7 @@ static int Polycore_SceneMesh_cacheToVertexBuffer(lua_State *L) {
 }
 
 static int Polycore_delete_SceneMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneMesh *inst = (SceneMesh*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7678,16 +7721,16 @@ static int Polycore_ScenePrimitive(lua_State *L) {
 }
 
 static int Polycore_delete_ScenePrimitive(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScenePrimitive *inst = (ScenePrimitive*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_SceneRenderTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Scene * targetScene = (Scene *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Camera * targetCamera = (Camera *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int r_enderWidth = lua_tointeger(L, 3);
@@ -7699,14 +7742,14 @@ static int Polycore_SceneRenderTexture(lua_State *L) {
 }
 
 static int Polycore_SceneRenderTexture_drawScreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneRenderTexture *inst = (SceneRenderTexture*)lua_topointer(L, 1);
 	inst->drawScreen();
 	return 0;
 }
 
 static int Polycore_SceneRenderTexture_getTargetTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneRenderTexture *inst = (SceneRenderTexture*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTargetTexture();
 	if(ptrRetVal == NULL) {
@@ -7718,7 +7761,7 @@ static int Polycore_SceneRenderTexture_getTargetTexture(lua_State *L) {
 }
 
 static int Polycore_SceneRenderTexture_getTargetScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneRenderTexture *inst = (SceneRenderTexture*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTargetScene();
 	if(ptrRetVal == NULL) {
@@ -7730,7 +7773,7 @@ static int Polycore_SceneRenderTexture_getTargetScene(lua_State *L) {
 }
 
 static int Polycore_SceneRenderTexture_getTargetCamera(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneRenderTexture *inst = (SceneRenderTexture*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTargetCamera();
 	if(ptrRetVal == NULL) {
@@ -7742,7 +7785,7 @@ static int Polycore_SceneRenderTexture_getTargetCamera(lua_State *L) {
 }
 
 static int Polycore_delete_SceneRenderTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneRenderTexture *inst = (SceneRenderTexture*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7761,14 +7804,14 @@ static int Polycore_SceneSound(lua_State *L) {
 }
 
 static int Polycore_SceneSound_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneSound *inst = (SceneSound*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_SceneSound_getSound(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneSound *inst = (SceneSound*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSound();
 	if(ptrRetVal == NULL) {
@@ -7780,7 +7823,7 @@ static int Polycore_SceneSound_getSound(lua_State *L) {
 }
 
 static int Polycore_delete_SceneSound(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneSound *inst = (SceneSound*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -7793,28 +7836,28 @@ static int Polycore_SceneSoundListener(lua_State *L) {
 }
 
 static int Polycore_SceneSoundListener_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneSoundListener *inst = (SceneSoundListener*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_SceneSoundListener(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneSoundListener *inst = (SceneSoundListener*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Screen_get_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->enabled);
 	return 1;
 }
 
 static int Polycore_Screen_set_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->enabled = param;
@@ -7828,9 +7871,9 @@ static int Polycore_Screen(lua_State *L) {
 }
 
 static int Polycore_Screen_addChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * newEntity = (ScreenEntity *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->addChild(newEntity);
 	if(ptrRetVal == NULL) {
@@ -7842,9 +7885,9 @@ static int Polycore_Screen_addChild(lua_State *L) {
 }
 
 static int Polycore_Screen_removeChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * entityToRemove = (ScreenEntity *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->removeChild(entityToRemove);
 	if(ptrRetVal == NULL) {
@@ -7856,7 +7899,7 @@ static int Polycore_Screen_removeChild(lua_State *L) {
 }
 
 static int Polycore_Screen_setScreenOffset(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -7867,30 +7910,29 @@ static int Polycore_Screen_setScreenOffset(lua_State *L) {
 }
 
 static int Polycore_Screen_getScreenOffset(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getScreenOffset();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Screen_Shutdown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->Shutdown();
 	return 0;
 }
 
 static int Polycore_Screen_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_Screen_getEntityAt(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -7906,23 +7948,23 @@ static int Polycore_Screen_getEntityAt(lua_State *L) {
 }
 
 static int Polycore_Screen_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_Screen_setRenderer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Renderer * r_enderer = (Renderer *)lua_topointer(L, 2);
 	inst->setRenderer(r_enderer);
 	return 0;
 }
 
 static int Polycore_Screen_setNormalizedCoordinates(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool newVal = lua_toboolean(L, 2);
@@ -7937,7 +7979,7 @@ static int Polycore_Screen_setNormalizedCoordinates(lua_State *L) {
 }
 
 static int Polycore_Screen_setScreenShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String shaderName = String(lua_tostring(L, 2));
@@ -7946,74 +7988,74 @@ static int Polycore_Screen_setScreenShader(lua_State *L) {
 }
 
 static int Polycore_Screen_clearScreenShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->clearScreenShader();
 	return 0;
 }
 
 static int Polycore_Screen_getHighestZIndex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getHighestZIndex());
 	return 1;
 }
 
 static int Polycore_Screen_sortChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->sortChildren();
 	return 0;
 }
 
 static int Polycore_Screen_cmpZindex(lua_State *L) {
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const ScreenEntity * left = (const ScreenEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const ScreenEntity * right = (const ScreenEntity *)lua_topointer(L, 3);
 	lua_pushboolean(L, Screen::cmpZindex(left, right));
 	return 1;
 }
 
 static int Polycore_Screen_handleInputEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	InputEvent * inputEvent = (InputEvent *)lua_topointer(L, 2);
 	inst->handleInputEvent(inputEvent);
 	return 0;
 }
 
 static int Polycore_Screen_hasFilterShader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->hasFilterShader());
 	return 1;
 }
 
 static int Polycore_Screen_drawFilter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	inst->drawFilter();
 	return 0;
 }
 
 static int Polycore_Screen_usesNormalizedCoordinates(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->usesNormalizedCoordinates());
 	return 1;
 }
 
 static int Polycore_Screen_getYCoordinateSize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getYCoordinateSize());
 	return 1;
 }
 
 static int Polycore_Screen_getRootEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getRootEntity();
 	if(ptrRetVal == NULL) {
@@ -8025,14 +8067,14 @@ static int Polycore_Screen_getRootEntity(lua_State *L) {
 }
 
 static int Polycore_delete_Screen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Screen *inst = (Screen*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ScreenCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierCurve * curve = (BezierCurve *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int numVertices = lua_tointeger(L, 2);
@@ -8042,42 +8084,42 @@ static int Polycore_ScreenCurve(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenCurve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenCurve *inst = (ScreenCurve*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ScreenEntity_get_hasFocus(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->hasFocus);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_get_blockMouseInput(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->blockMouseInput);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_get_zindex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->zindex);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_get_snapToPixels(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->snapToPixels);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_set_hasFocus(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->hasFocus = param;
@@ -8085,7 +8127,7 @@ static int Polycore_ScreenEntity_set_hasFocus(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_set_blockMouseInput(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->blockMouseInput = param;
@@ -8093,7 +8135,7 @@ static int Polycore_ScreenEntity_set_blockMouseInput(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_set_zindex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->zindex = param;
@@ -8101,7 +8143,7 @@ static int Polycore_ScreenEntity_set_zindex(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_set_snapToPixels(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->snapToPixels = param;
@@ -8115,7 +8157,7 @@ static int Polycore_ScreenEntity(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8126,7 +8168,7 @@ static int Polycore_ScreenEntity_setPosition(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setScale(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8137,7 +8179,7 @@ static int Polycore_ScreenEntity_setScale(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setRotation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number roatation = lua_tonumber(L, 2);
@@ -8146,14 +8188,14 @@ static int Polycore_ScreenEntity_setRotation(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_getRotation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getRotation());
 	return 1;
 }
 
 static int Polycore_ScreenEntity__onMouseDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8168,7 +8210,7 @@ static int Polycore_ScreenEntity__onMouseDown(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity__onMouseUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8183,7 +8225,7 @@ static int Polycore_ScreenEntity__onMouseUp(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity__onMouseMove(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8196,7 +8238,7 @@ static int Polycore_ScreenEntity__onMouseMove(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity__onMouseWheelUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8209,7 +8251,7 @@ static int Polycore_ScreenEntity__onMouseWheelUp(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity__onMouseWheelDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8222,7 +8264,7 @@ static int Polycore_ScreenEntity__onMouseWheelDown(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onMouseDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8233,7 +8275,7 @@ static int Polycore_ScreenEntity_onMouseDown(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onMouseUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8244,7 +8286,7 @@ static int Polycore_ScreenEntity_onMouseUp(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onMouseMove(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8255,7 +8297,7 @@ static int Polycore_ScreenEntity_onMouseMove(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onMouseWheelUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8266,7 +8308,7 @@ static int Polycore_ScreenEntity_onMouseWheelUp(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onMouseWheelDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8277,51 +8319,51 @@ static int Polycore_ScreenEntity_onMouseWheelDown(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity__onKeyDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY key = *(PolyKEY*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	wchar_t charCode = *(wchar_t*)lua_topointer(L, 3);
 	inst->_onKeyDown(key, charCode);
 	return 0;
 }
 
 static int Polycore_ScreenEntity__onKeyUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY key = *(PolyKEY*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	wchar_t charCode = *(wchar_t*)lua_topointer(L, 3);
 	inst->_onKeyUp(key, charCode);
 	return 0;
 }
 
 static int Polycore_ScreenEntity_onKeyDown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY key = *(PolyKEY*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	wchar_t charCode = *(wchar_t*)lua_topointer(L, 3);
 	inst->onKeyDown(key, charCode);
 	return 0;
 }
 
 static int Polycore_ScreenEntity_onKeyUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PolyKEY key = *(PolyKEY*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	wchar_t charCode = *(wchar_t*)lua_topointer(L, 3);
 	inst->onKeyUp(key, charCode);
 	return 0;
 }
 
 static int Polycore_ScreenEntity_hitTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8332,37 +8374,36 @@ static int Polycore_ScreenEntity_hitTest(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_buildPositionMatrix(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	Matrix4 *retInst = new Matrix4();
+	Matrix4 *retInst = new (luaPolycode_alloc_value(L, sizeof(Matrix4), "Polycode.Matrix4")) Matrix4();
 	*retInst = inst->buildPositionMatrix();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_adjustMatrixForChildren(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->adjustMatrixForChildren();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_getWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getWidth());
 	return 1;
 }
 
 static int Polycore_ScreenEntity_getHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getHeight());
 	return 1;
 }
 
 static int Polycore_ScreenEntity_setWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number w = lua_tonumber(L, 2);
@@ -8371,7 +8412,7 @@ static int Polycore_ScreenEntity_setWidth(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number h = lua_tonumber(L, 2);
@@ -8380,21 +8421,21 @@ static int Polycore_ScreenEntity_setHeight(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_onGainFocus(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->onGainFocus();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_onLoseFocus(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->onLoseFocus();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_startDrag(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number xOffset = lua_tonumber(L, 2);
@@ -8405,14 +8446,14 @@ static int Polycore_ScreenEntity_startDrag(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_stopDrag(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->stopDrag();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_setBlendingMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int newBl_endingMode = lua_tointeger(L, 2);
@@ -8421,7 +8462,7 @@ static int Polycore_ScreenEntity_setBlendingMode(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setPositionMode(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int newPositionMode = lua_tointeger(L, 2);
@@ -8430,55 +8471,54 @@ static int Polycore_ScreenEntity_setPositionMode(lua_State *L) {
 }
 
 static int Polycore_ScreenEntity_setDragLimits(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Polycode::Rectangle rect = *(Polycode::Rectangle*)lua_topointer(L, 2);
 	inst->setDragLimits(rect);
 	return 0;
 }
 
 static int Polycore_ScreenEntity_clearDragLimits(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->clearDragLimits();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_focusChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * child = (ScreenEntity *)lua_topointer(L, 2);
 	inst->focusChild(child);
 	return 0;
 }
 
 static int Polycore_ScreenEntity_focusNextChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	inst->focusNextChild();
 	return 0;
 }
 
 static int Polycore_ScreenEntity_getPosition2D(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getPosition2D();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_ScreenEntity_isFocusable(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isFocusable());
 	return 1;
 }
 
 static int Polycore_delete_ScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity *inst = (ScreenEntity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8491,7 +8531,7 @@ static int Polycore_ScreenEvent(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEvent *inst = (ScreenEvent*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8506,7 +8546,7 @@ static int Polycore_ScreenImage(lua_State *L) {
 }
 
 static int Polycore_ScreenImage_setImageCoordinates(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenImage *inst = (ScreenImage*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8521,21 +8561,21 @@ static int Polycore_ScreenImage_setImageCoordinates(lua_State *L) {
 }
 
 static int Polycore_ScreenImage_getImageWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenImage *inst = (ScreenImage*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getImageWidth());
 	return 1;
 }
 
 static int Polycore_ScreenImage_getImageHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenImage *inst = (ScreenImage*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getImageHeight());
 	return 1;
 }
 
 static int Polycore_delete_ScreenImage(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenImage *inst = (ScreenImage*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8564,9 +8604,9 @@ static int Polycore_ScreenLabel(lua_State *L) {
 }
 
 static int Polycore_ScreenLabel_addDropShadow(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLabel *inst = (ScreenLabel*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Color color = *(Color*)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number size = lua_tonumber(L, 3);
@@ -8579,7 +8619,7 @@ static int Polycore_ScreenLabel_addDropShadow(lua_State *L) {
 }
 
 static int Polycore_ScreenLabel_setText(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLabel *inst = (ScreenLabel*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String newText = String(lua_tostring(L, 2));
@@ -8588,14 +8628,14 @@ static int Polycore_ScreenLabel_setText(lua_State *L) {
 }
 
 static int Polycore_ScreenLabel_getText(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLabel *inst = (ScreenLabel*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getText().c_str());
 	return 1;
 }
 
 static int Polycore_ScreenLabel_getLabel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLabel *inst = (ScreenLabel*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getLabel();
 	if(ptrRetVal == NULL) {
@@ -8607,16 +8647,16 @@ static int Polycore_ScreenLabel_getLabel(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenLabel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLabel *inst = (ScreenLabel*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ScreenLine(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector2 * start = (Vector2 *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector2 * _end = (Vector2 *)lua_topointer(L, 2);
 	ScreenLine *inst = new ScreenLine(start, _end);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -8624,21 +8664,21 @@ static int Polycore_ScreenLine(lua_State *L) {
 }
 
 static int Polycore_ScreenLine_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLine *inst = (ScreenLine*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_ScreenLine_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLine *inst = (ScreenLine*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_ScreenLine_setLineWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLine *inst = (ScreenLine*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number width = lua_tonumber(L, 2);
@@ -8647,7 +8687,7 @@ static int Polycore_ScreenLine_setLineWidth(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenLine(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenLine *inst = (ScreenLine*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8660,32 +8700,32 @@ static int Polycore_ScreenManager(lua_State *L) {
 }
 
 static int Polycore_ScreenManager_removeScreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenManager *inst = (ScreenManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Screen * screen = (Screen *)lua_topointer(L, 2);
 	inst->removeScreen(screen);
 	return 0;
 }
 
 static int Polycore_ScreenManager_addScreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenManager *inst = (ScreenManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Screen * screen = (Screen *)lua_topointer(L, 2);
 	inst->addScreen(screen);
 	return 0;
 }
 
 static int Polycore_ScreenManager_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenManager *inst = (ScreenManager*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_ScreenManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenManager *inst = (ScreenManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8700,14 +8740,14 @@ static int Polycore_ScreenMesh(lua_State *L) {
 }
 
 static int Polycore_ScreenMesh_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_ScreenMesh_getMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getMesh();
 	if(ptrRetVal == NULL) {
@@ -8719,7 +8759,7 @@ static int Polycore_ScreenMesh_getMesh(lua_State *L) {
 }
 
 static int Polycore_ScreenMesh_getTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTexture();
 	if(ptrRetVal == NULL) {
@@ -8731,7 +8771,7 @@ static int Polycore_ScreenMesh_getTexture(lua_State *L) {
 }
 
 static int Polycore_ScreenMesh_loadTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -8740,44 +8780,44 @@ static int Polycore_ScreenMesh_loadTexture(lua_State *L) {
 }
 
 static int Polycore_ScreenMesh_setTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Texture * texture = (Texture *)lua_topointer(L, 2);
 	inst->setTexture(texture);
 	return 0;
 }
 
 static int Polycore_delete_ScreenMesh(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenMesh *inst = (ScreenMesh*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ScreenShape_get_strokeEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->strokeEnabled);
 	return 1;
 }
 
 static int Polycore_ScreenShape_get_strokeColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->strokeColor);
 	return 1;
 }
 
 static int Polycore_ScreenShape_get_lineSmooth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->lineSmooth);
 	return 1;
 }
 
 static int Polycore_ScreenShape_set_strokeEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->strokeEnabled = param;
@@ -8785,7 +8825,7 @@ static int Polycore_ScreenShape_set_strokeEnabled(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_set_lineSmooth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->lineSmooth = param;
@@ -8825,14 +8865,14 @@ static int Polycore_ScreenShape(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_Render(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	inst->Render();
 	return 0;
 }
 
 static int Polycore_ScreenShape_setStrokeColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r = lua_tonumber(L, 2);
@@ -8847,7 +8887,7 @@ static int Polycore_ScreenShape_setStrokeColor(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_setStrokeWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number width = lua_tonumber(L, 2);
@@ -8856,7 +8896,7 @@ static int Polycore_ScreenShape_setStrokeWidth(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_setGradient(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number r1 = lua_tonumber(L, 2);
@@ -8879,14 +8919,14 @@ static int Polycore_ScreenShape_setGradient(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_clearGradient(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	inst->clearGradient();
 	return 0;
 }
 
 static int Polycore_ScreenShape_setShapeSize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number newWidth = lua_tonumber(L, 2);
@@ -8897,7 +8937,7 @@ static int Polycore_ScreenShape_setShapeSize(lua_State *L) {
 }
 
 static int Polycore_ScreenShape_addShapePoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -8908,7 +8948,7 @@ static int Polycore_ScreenShape_addShapePoint(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenShape(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenShape *inst = (ScreenShape*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8921,14 +8961,14 @@ static int Polycore_ScreenSoundListener(lua_State *L) {
 }
 
 static int Polycore_ScreenSoundListener_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSoundListener *inst = (ScreenSoundListener*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_ScreenSoundListener(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSoundListener *inst = (ScreenSoundListener*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8947,14 +8987,14 @@ static int Polycore_ScreenSound(lua_State *L) {
 }
 
 static int Polycore_ScreenSound_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSound *inst = (ScreenSound*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_ScreenSound_getSound(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSound *inst = (ScreenSound*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSound();
 	if(ptrRetVal == NULL) {
@@ -8966,7 +9006,7 @@ static int Polycore_ScreenSound_getSound(lua_State *L) {
 }
 
 static int Polycore_delete_ScreenSound(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSound *inst = (ScreenSound*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -8985,7 +9025,7 @@ static int Polycore_ScreenSprite(lua_State *L) {
 }
 
 static int Polycore_ScreenSprite_addAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSprite *inst = (ScreenSprite*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -8998,7 +9038,7 @@ static int Polycore_ScreenSprite_addAnimation(lua_State *L) {
 }
 
 static int Polycore_ScreenSprite_playAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSprite *inst = (ScreenSprite*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9011,35 +9051,35 @@ static int Polycore_ScreenSprite_playAnimation(lua_State *L) {
 }
 
 static int Polycore_ScreenSprite_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSprite *inst = (ScreenSprite*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_ScreenSprite(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenSprite *inst = (ScreenSprite*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Shader_get_numSpotLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->numSpotLights);
 	return 1;
 }
 
 static int Polycore_Shader_get_numAreaLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->numAreaLights);
 	return 1;
 }
 
 static int Polycore_Shader_set_numSpotLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->numSpotLights = param;
@@ -9047,7 +9087,7 @@ static int Polycore_Shader_set_numSpotLights(lua_State *L) {
 }
 
 static int Polycore_Shader_set_numAreaLights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	int param = lua_tointeger(L, 2);
 	inst->numAreaLights = param;
@@ -9055,14 +9095,14 @@ static int Polycore_Shader_set_numAreaLights(lua_State *L) {
 }
 
 static int Polycore_Shader_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Polycore_Shader_setName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9071,14 +9111,14 @@ static int Polycore_Shader_setName(lua_State *L) {
 }
 
 static int Polycore_Shader_getName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getName().c_str());
 	return 1;
 }
 
 static int Polycore_Shader_createBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->createBinding();
 	if(ptrRetVal == NULL) {
@@ -9090,14 +9130,14 @@ static int Polycore_Shader_createBinding(lua_State *L) {
 }
 
 static int Polycore_delete_Shader(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader *inst = (Shader*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_ShaderBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Shader * shader = (Shader *)lua_topointer(L, 1);
 	ShaderBinding *inst = new ShaderBinding(shader);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -9105,7 +9145,7 @@ static int Polycore_ShaderBinding(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_clearTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9114,18 +9154,18 @@ static int Polycore_ShaderBinding_clearTexture(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_addTexture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Texture * texture = (Texture *)lua_topointer(L, 3);
 	inst->addTexture(name, texture);
 	return 0;
 }
 
 static int Polycore_ShaderBinding_addParam(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String type = String(lua_tostring(L, 2));
@@ -9138,25 +9178,25 @@ static int Polycore_ShaderBinding_addParam(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_addCubemap(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Cubemap * cubemap = (Cubemap *)lua_topointer(L, 3);
 	inst->addCubemap(name, cubemap);
 	return 0;
 }
 
 static int Polycore_ShaderBinding_getNumLocalParams(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumLocalParams());
 	return 1;
 }
 
 static int Polycore_ShaderBinding_getLocalParam(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -9170,7 +9210,7 @@ static int Polycore_ShaderBinding_getLocalParam(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_getLocalParamByName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9184,23 +9224,23 @@ static int Polycore_ShaderBinding_getLocalParamByName(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_addRenderTargetBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	RenderTargetBinding * binding = (RenderTargetBinding *)lua_topointer(L, 2);
 	inst->addRenderTargetBinding(binding);
 	return 0;
 }
 
 static int Polycore_ShaderBinding_getNumRenderTargetBindings(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumRenderTargetBindings());
 	return 1;
 }
 
 static int Polycore_ShaderBinding_getRenderTargetBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -9214,14 +9254,14 @@ static int Polycore_ShaderBinding_getRenderTargetBinding(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_getNumInTargetBindings(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumInTargetBindings());
 	return 1;
 }
 
 static int Polycore_ShaderBinding_getInTargetBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -9235,14 +9275,14 @@ static int Polycore_ShaderBinding_getInTargetBinding(lua_State *L) {
 }
 
 static int Polycore_ShaderBinding_getNumOutTargetBindings(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumOutTargetBindings());
 	return 1;
 }
 
 static int Polycore_ShaderBinding_getOutTargetBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -9256,7 +9296,7 @@ static int Polycore_ShaderBinding_getOutTargetBinding(lua_State *L) {
 }
 
 static int Polycore_delete_ShaderBinding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ShaderBinding *inst = (ShaderBinding*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -9273,44 +9313,44 @@ static int Polycore_SkeletonAnimation(lua_State *L) {
 }
 
 static int Polycore_SkeletonAnimation_addBoneTrack(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	BoneTrack * boneTrack = (BoneTrack *)lua_topointer(L, 2);
 	inst->addBoneTrack(boneTrack);
 	return 0;
 }
 
 static int Polycore_SkeletonAnimation_getName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getName().c_str());
 	return 1;
 }
 
 static int Polycore_SkeletonAnimation_Play(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	inst->Play();
 	return 0;
 }
 
 static int Polycore_SkeletonAnimation_Stop(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	inst->Stop();
 	return 0;
 }
 
 static int Polycore_SkeletonAnimation_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_SkeletonAnimation_setSpeed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number speed = lua_tonumber(L, 2);
@@ -9319,91 +9359,91 @@ static int Polycore_SkeletonAnimation_setSpeed(lua_State *L) {
 }
 
 static int Polycore_delete_SkeletonAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SkeletonAnimation *inst = (SkeletonAnimation*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_BoneTrack_get_LocXVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->LocXVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_LocYVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->LocYVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_LocZVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->LocZVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_ScaleXVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->ScaleXVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_ScaleYVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->ScaleYVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_ScaleZVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->ScaleZVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_boneQuat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->boneQuat);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_QuatWVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->QuatWVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_QuatXVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->QuatXVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_QuatYVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->QuatYVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack_get_QuatZVec(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->QuatZVec);
 	return 1;
 }
 
 static int Polycore_BoneTrack(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Bone * bone = (Bone *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number length = lua_tonumber(L, 2);
@@ -9413,28 +9453,28 @@ static int Polycore_BoneTrack(lua_State *L) {
 }
 
 static int Polycore_BoneTrack_Play(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	inst->Play();
 	return 0;
 }
 
 static int Polycore_BoneTrack_Stop(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	inst->Stop();
 	return 0;
 }
 
 static int Polycore_BoneTrack_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_BoneTrack_setSpeed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number speed = lua_tonumber(L, 2);
@@ -9443,7 +9483,7 @@ static int Polycore_BoneTrack_setSpeed(lua_State *L) {
 }
 
 static int Polycore_delete_BoneTrack(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BoneTrack *inst = (BoneTrack*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -9458,7 +9498,7 @@ static int Polycore_Skeleton(lua_State *L) {
 }
 
 static int Polycore_Skeleton_loadSkeleton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -9467,7 +9507,7 @@ static int Polycore_Skeleton_loadSkeleton(lua_State *L) {
 }
 
 static int Polycore_Skeleton_playAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String animName = String(lua_tostring(L, 2));
@@ -9476,7 +9516,7 @@ static int Polycore_Skeleton_playAnimation(lua_State *L) {
 }
 
 static int Polycore_Skeleton_playAnimationByIndex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -9485,7 +9525,7 @@ static int Polycore_Skeleton_playAnimationByIndex(lua_State *L) {
 }
 
 static int Polycore_Skeleton_addAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9496,7 +9536,7 @@ static int Polycore_Skeleton_addAnimation(lua_State *L) {
 }
 
 static int Polycore_Skeleton_getAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9510,14 +9550,14 @@ static int Polycore_Skeleton_getAnimation(lua_State *L) {
 }
 
 static int Polycore_Skeleton_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_Skeleton_getBoneByName(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String name = String(lua_tostring(L, 2));
@@ -9531,7 +9571,7 @@ static int Polycore_Skeleton_getBoneByName(lua_State *L) {
 }
 
 static int Polycore_Skeleton_bonesVisible(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 2);
@@ -9540,7 +9580,7 @@ static int Polycore_Skeleton_bonesVisible(lua_State *L) {
 }
 
 static int Polycore_Skeleton_enableBoneLabels(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String labelFont = String(lua_tostring(L, 2));
@@ -9548,21 +9588,21 @@ static int Polycore_Skeleton_enableBoneLabels(lua_State *L) {
 	Number size = lua_tonumber(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number scale = lua_tonumber(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Color labelColor = *(Color*)lua_topointer(L, 5);
 	inst->enableBoneLabels(labelFont, size, scale, labelColor);
 	return 0;
 }
 
 static int Polycore_Skeleton_getNumBones(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumBones());
 	return 1;
 }
 
 static int Polycore_Skeleton_getBone(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int index = lua_tointeger(L, 2);
@@ -9576,7 +9616,7 @@ static int Polycore_Skeleton_getBone(lua_State *L) {
 }
 
 static int Polycore_Skeleton_getCurrentAnimation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getCurrentAnimation();
 	if(ptrRetVal == NULL) {
@@ -9588,7 +9628,7 @@ static int Polycore_Skeleton_getCurrentAnimation(lua_State *L) {
 }
 
 static int Polycore_delete_Skeleton(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Skeleton *inst = (Skeleton*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -9603,7 +9643,7 @@ static int Polycore_Sound(lua_State *L) {
 }
 
 static int Polycore_Sound_Play(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	bool loop;
 	if(lua_isboolean(L, 2)) {
@@ -9616,14 +9656,14 @@ static int Polycore_Sound_Play(lua_State *L) {
 }
 
 static int Polycore_Sound_Stop(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	inst->Stop();
 	return 0;
 }
 
 static int Polycore_Sound_setVolume(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number newVolume = lua_tonumber(L, 2);
@@ -9632,7 +9672,7 @@ static int Polycore_Sound_setVolume(lua_State *L) {
 }
 
 static int Polycore_Sound_setPitch(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number newPitch = lua_tonumber(L, 2);
@@ -9641,7 +9681,7 @@ static int Polycore_Sound_setPitch(lua_State *L) {
 }
 
 static int Polycore_Sound_setIsPositional(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool isPositional = lua_toboolean(L, 2);
@@ -9650,34 +9690,34 @@ static int Polycore_Sound_setIsPositional(lua_State *L) {
 }
 
 static int Polycore_Sound_setSoundPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 position = *(Vector3*)lua_topointer(L, 2);
 	inst->setSoundPosition(position);
 	return 0;
 }
 
 static int Polycore_Sound_setSoundVelocity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 velocity = *(Vector3*)lua_topointer(L, 2);
 	inst->setSoundVelocity(velocity);
 	return 0;
 }
 
 static int Polycore_Sound_setSoundDirection(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 2);
 	inst->setSoundDirection(direction);
 	return 0;
 }
 
 static int Polycore_Sound_setPositionalProperties(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number referenceDistance = lua_tonumber(L, 2);
@@ -9688,7 +9728,7 @@ static int Polycore_Sound_setPositionalProperties(lua_State *L) {
 }
 
 static int Polycore_Sound_loadWAV(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -9699,7 +9739,7 @@ static int Polycore_Sound_loadWAV(lua_State *L) {
 }
 
 static int Polycore_Sound_loadOGG(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String fileName = String(lua_tostring(L, 2));
@@ -9710,9 +9750,9 @@ static int Polycore_Sound_loadOGG(lua_State *L) {
 }
 
 static int Polycore_Sound_GenSource(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ALuint buffer = *(ALuint*)lua_topointer(L, 2);
 	ALuint *retInst = new ALuint();
 	*retInst = inst->GenSource(buffer);
@@ -9721,7 +9761,7 @@ static int Polycore_Sound_GenSource(lua_State *L) {
 }
 
 static int Polycore_Sound_checkALError(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String operation = String(lua_tostring(L, 2));
@@ -9730,7 +9770,7 @@ static int Polycore_Sound_checkALError(lua_State *L) {
 }
 
 static int Polycore_Sound_soundError(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String err = String(lua_tostring(L, 2));
@@ -9739,7 +9779,7 @@ static int Polycore_Sound_soundError(lua_State *L) {
 }
 
 static int Polycore_Sound_soundCheck(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool result = lua_toboolean(L, 2);
@@ -9750,7 +9790,7 @@ static int Polycore_Sound_soundCheck(lua_State *L) {
 }
 
 static int Polycore_delete_Sound(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Sound *inst = (Sound*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -9763,32 +9803,32 @@ static int Polycore_SoundManager(lua_State *L) {
 }
 
 static int Polycore_SoundManager_setListenerPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SoundManager *inst = (SoundManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 position = *(Vector3*)lua_topointer(L, 2);
 	inst->setListenerPosition(position);
 	return 0;
 }
 
 static int Polycore_SoundManager_setListenerOrientation(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SoundManager *inst = (SoundManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 orientation = *(Vector3*)lua_topointer(L, 2);
 	inst->setListenerOrientation(orientation);
 	return 0;
 }
 
 static int Polycore_SoundManager_initAL(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SoundManager *inst = (SoundManager*)lua_topointer(L, 1);
 	inst->initAL();
 	return 0;
 }
 
 static int Polycore_SoundManager_setGlobalVolume(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SoundManager *inst = (SoundManager*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number globalVolume = lua_tonumber(L, 2);
@@ -9797,26 +9837,12 @@ static int Polycore_SoundManager_setGlobalVolume(lua_State *L) {
 }
 
 static int Polycore_delete_SoundManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SoundManager *inst = (SoundManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
-static int Polycore_String_get_contents(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	String *inst = (String*)lua_topointer(L, 1);
-	lua_pushlightuserdata(L, &inst->contents);
-	return 1;
-}
-
-static int Polycore_String_get_s_contents(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	String *inst = (String*)lua_topointer(L, 1);
-	lua_pushlightuserdata(L, &inst->s_contents);
-	return 1;
-}
-
 static int Polycore_String(lua_State *L) {
 	String *inst = new String();
 	lua_pushlightuserdata(L, (void*)inst);
@@ -9824,21 +9850,21 @@ static int Polycore_String(lua_State *L) {
 }
 
 static int Polycore_String_size(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->size());
 	return 1;
 }
 
 static int Polycore_String_length(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->length());
 	return 1;
 }
 
 static int Polycore_String_getSTLString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	string *retInst = new string();
 	*retInst = inst->getSTLString();
@@ -9847,7 +9873,7 @@ static int Polycore_String_getSTLString(lua_State *L) {
 }
 
 static int Polycore_String_getSTLWString(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	wstring *retInst = new wstring();
 	*retInst = inst->getSTLWString();
@@ -9856,69 +9882,69 @@ static int Polycore_String_getSTLWString(lua_State *L) {
 }
 
 static int Polycore_String_substr(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	size_t pos = *(size_t*)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t n = *(size_t*)lua_topointer(L, 3);
 	lua_pushstring(L, inst->substr(pos, n).c_str());
 	return 1;
 }
 
 static int Polycore_String_rfind(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const String & str = *( String *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t pos = *(size_t*)lua_topointer(L, 3);
 	lua_pushinteger(L, inst->rfind(str, pos));
 	return 1;
 }
 
 static int Polycore_String_find(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const String & str = *( String *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t pos = *(size_t*)lua_topointer(L, 3);
 	lua_pushinteger(L, inst->find(str, pos));
 	return 1;
 }
 
 static int Polycore_String_find_last_of(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const String & str = *( String *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	size_t pos = *(size_t*)lua_topointer(L, 3);
 	lua_pushinteger(L, inst->find_last_of(str, pos));
 	return 1;
 }
 
 static int Polycore_String_toLowerCase(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->toLowerCase().c_str());
 	return 1;
 }
 
 static int Polycore_String_toUpperCase(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->toUpperCase().c_str());
 	return 1;
 }
 
 static int Polycore_String_replace(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const String & what = *( String *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const String & withWhat = *( String *)lua_topointer(L, 3);
 	lua_pushstring(L, inst->replace(what, withWhat).c_str());
 	return 1;
@@ -9932,7 +9958,7 @@ static int Polycore_String_NumberToString(lua_State *L) {
 }
 
 static int Polycore_String_c_str(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->c_str();
 	if(ptrRetVal == NULL) {
@@ -9944,7 +9970,7 @@ static int Polycore_String_c_str(lua_State *L) {
 }
 
 static int Polycore_String_wc_str(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->wc_str();
 	if(ptrRetVal == NULL) {
@@ -9956,7 +9982,7 @@ static int Polycore_String_wc_str(lua_State *L) {
 }
 
 static int Polycore_String_data(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->data();
 	if(ptrRetVal == NULL) {
@@ -9968,7 +9994,7 @@ static int Polycore_String_data(lua_State *L) {
 }
 
 static int Polycore_String_getDataWithEncoding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int encoding = lua_tointeger(L, 2);
@@ -9982,7 +10008,7 @@ static int Polycore_String_getDataWithEncoding(lua_State *L) {
 }
 
 static int Polycore_String_getDataSizeWithEncoding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int encoding = lua_tointeger(L, 2);
@@ -9991,9 +10017,9 @@ static int Polycore_String_getDataSizeWithEncoding(lua_State *L) {
 }
 
 static int Polycore_String_setDataWithEncoding(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	char * data = (char *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int encoding = lua_tointeger(L, 3);
@@ -10002,35 +10028,35 @@ static int Polycore_String_setDataWithEncoding(lua_State *L) {
 }
 
 static int Polycore_delete_String(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	String *inst = (String*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Texture_get_scrollSpeedX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->scrollSpeedX);
 	return 1;
 }
 
 static int Polycore_Texture_get_scrollSpeedY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->scrollSpeedY);
 	return 1;
 }
 
 static int Polycore_Texture_get_clamp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->clamp);
 	return 1;
 }
 
 static int Polycore_Texture_set_scrollSpeedX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->scrollSpeedX = param;
@@ -10038,7 +10064,7 @@ static int Polycore_Texture_set_scrollSpeedX(lua_State *L) {
 }
 
 static int Polycore_Texture_set_scrollSpeedY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->scrollSpeedY = param;
@@ -10046,7 +10072,7 @@ static int Polycore_Texture_set_scrollSpeedY(lua_State *L) {
 }
 
 static int Polycore_Texture_set_clamp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->clamp = param;
@@ -10054,46 +10080,46 @@ static int Polycore_Texture_set_clamp(lua_State *L) {
 }
 
 static int Polycore_Texture_setTextureData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	char * data = (char *)lua_topointer(L, 2);
 	inst->setTextureData(data);
 	return 0;
 }
 
 static int Polycore_Texture_recreateFromImageData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	inst->recreateFromImageData();
 	return 0;
 }
 
 static int Polycore_Texture_getScrollOffsetX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getScrollOffsetX());
 	return 1;
 }
 
 static int Polycore_Texture_getScrollOffsetY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getScrollOffsetY());
 	return 1;
 }
 
 static int Polycore_Texture_setImageData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Image * data = (Image *)lua_topointer(L, 2);
 	inst->setImageData(data);
 	return 0;
 }
 
 static int Polycore_Texture_updateScroll(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int elapsed = lua_tointeger(L, 2);
@@ -10102,7 +10128,7 @@ static int Polycore_Texture_updateScroll(lua_State *L) {
 }
 
 static int Polycore_Texture_setResourcePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TSTRING);
 	String newPath = String(lua_tostring(L, 2));
@@ -10111,14 +10137,14 @@ static int Polycore_Texture_setResourcePath(lua_State *L) {
 }
 
 static int Polycore_Texture_getResourcePath(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushstring(L, inst->getResourcePath().c_str());
 	return 1;
 }
 
 static int Polycore_Texture_getTextureData(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getTextureData();
 	if(ptrRetVal == NULL) {
@@ -10130,21 +10156,21 @@ static int Polycore_Texture_getTextureData(lua_State *L) {
 }
 
 static int Polycore_Texture_getWidth(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getWidth());
 	return 1;
 }
 
 static int Polycore_Texture_getHeight(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getHeight());
 	return 1;
 }
 
 static int Polycore_delete_Texture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Texture *inst = (Texture*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -10161,7 +10187,7 @@ static int Polycore_Timer(lua_State *L) {
 }
 
 static int Polycore_Timer_Pause(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool paused = lua_toboolean(L, 2);
@@ -10170,21 +10196,21 @@ static int Polycore_Timer_Pause(lua_State *L) {
 }
 
 static int Polycore_Timer_isPaused(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isPaused());
 	return 1;
 }
 
 static int Polycore_Timer_getTicks(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getTicks());
 	return 1;
 }
 
 static int Polycore_Timer_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int ticks = lua_tointeger(L, 2);
@@ -10193,28 +10219,28 @@ static int Polycore_Timer_Update(lua_State *L) {
 }
 
 static int Polycore_Timer_Reset(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	inst->Reset();
 	return 0;
 }
 
 static int Polycore_Timer_hasElapsed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->hasElapsed());
 	return 1;
 }
 
 static int Polycore_Timer_getElapsedf(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->getElapsedf());
 	return 1;
 }
 
 static int Polycore_delete_Timer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Timer *inst = (Timer*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -10227,46 +10253,46 @@ static int Polycore_TimerManager(lua_State *L) {
 }
 
 static int Polycore_TimerManager_removeTimer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TimerManager *inst = (TimerManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Timer * timer = (Timer *)lua_topointer(L, 2);
 	inst->removeTimer(timer);
 	return 0;
 }
 
 static int Polycore_TimerManager_addTimer(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TimerManager *inst = (TimerManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Timer * timer = (Timer *)lua_topointer(L, 2);
 	inst->addTimer(timer);
 	return 0;
 }
 
 static int Polycore_TimerManager_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TimerManager *inst = (TimerManager*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_TimerManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TimerManager *inst = (TimerManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Tween_get_repeat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->repeat);
 	return 1;
 }
 
 static int Polycore_Tween_set_repeat(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->repeat = param;
@@ -10274,7 +10300,7 @@ static int Polycore_Tween_set_repeat(lua_State *L) {
 }
 
 static int Polycore_Tween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Number * target = (Number *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int easeType = lua_tointeger(L, 2);
@@ -10296,28 +10322,28 @@ static int Polycore_Tween(lua_State *L) {
 }
 
 static int Polycore_Tween_interpolateTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->interpolateTween());
 	return 1;
 }
 
 static int Polycore_Tween_updateCustomTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	inst->updateCustomTween();
 	return 0;
 }
 
 static int Polycore_Tween_doOnComplete(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	inst->doOnComplete();
 	return 0;
 }
 
 static int Polycore_Tween_Pause(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool pauseVal = lua_toboolean(L, 2);
@@ -10326,21 +10352,21 @@ static int Polycore_Tween_Pause(lua_State *L) {
 }
 
 static int Polycore_Tween_Reset(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	inst->Reset();
 	return 0;
 }
 
 static int Polycore_Tween_isComplete(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->isComplete());
 	return 1;
 }
 
 static int Polycore_Tween_setSpeed(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number speed = lua_tonumber(L, 2);
@@ -10349,16 +10375,16 @@ static int Polycore_Tween_setSpeed(lua_State *L) {
 }
 
 static int Polycore_delete_Tween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Tween *inst = (Tween*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_BezierPathTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 * target = (Vector3 *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	BezierCurve * curve = (BezierCurve *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int easeType = lua_tointeger(L, 3);
@@ -10376,29 +10402,29 @@ static int Polycore_BezierPathTween(lua_State *L) {
 }
 
 static int Polycore_BezierPathTween_updateCustomTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierPathTween *inst = (BezierPathTween*)lua_topointer(L, 1);
 	inst->updateCustomTween();
 	return 0;
 }
 
 static int Polycore_delete_BezierPathTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	BezierPathTween *inst = (BezierPathTween*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_QuaternionTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Quaternion * target = (Quaternion *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	BezierCurve * wCurve = (BezierCurve *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	BezierCurve * xCurve = (BezierCurve *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	BezierCurve * yCurve = (BezierCurve *)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	BezierCurve * zCurve = (BezierCurve *)lua_topointer(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	int easeType = lua_tointeger(L, 6);
@@ -10416,14 +10442,14 @@ static int Polycore_QuaternionTween(lua_State *L) {
 }
 
 static int Polycore_QuaternionTween_updateCustomTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionTween *inst = (QuaternionTween*)lua_topointer(L, 1);
 	inst->updateCustomTween();
 	return 0;
 }
 
 static int Polycore_delete_QuaternionTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	QuaternionTween *inst = (QuaternionTween*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -10436,64 +10462,71 @@ static int Polycore_TweenManager(lua_State *L) {
 }
 
 static int Polycore_TweenManager_addTween(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TweenManager *inst = (TweenManager*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Tween * tween = (Tween *)lua_topointer(L, 2);
 	inst->addTween(tween);
 	return 0;
 }
 
 static int Polycore_TweenManager_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TweenManager *inst = (TweenManager*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Polycore_delete_TweenManager(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	TweenManager *inst = (TweenManager*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Polycore_Vector2(lua_State *L) {
-	Vector2 *inst = new Vector2();
-	lua_pushlightuserdata(L, (void*)inst);
+	Vector2 *inst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	return 1;
 }
 
 static int Polycore_delete_Vector2(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	Vector2 *inst = (Vector2*)lua_topointer(L, 1);
-	delete inst;
+	luaPolycode_checkpointer(L, 1);
+	if(lua_islightuserdata(L, 1)) {
+		Vector2 *inst = (Vector2*)lua_topointer(L, 1);
+		delete inst;
+	}
+	return 0;
+}
+
+static int Polycore_Vector2__gc(lua_State *L) {
+	Vector2 *inst = (Vector2*)lua_touserdata(L, 1);
+	inst->~Vector2();
 	return 0;
 }
 
 static int Polycore_Vector3_get_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->x);
 	return 1;
 }
 
 static int Polycore_Vector3_get_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->y);
 	return 1;
 }
 
 static int Polycore_Vector3_get_z(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->z);
 	return 1;
 }
 
 static int Polycore_Vector3_set_x(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->x = param;
@@ -10501,7 +10534,7 @@ static int Polycore_Vector3_set_x(lua_State *L) {
 }
 
 static int Polycore_Vector3_set_y(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->y = param;
@@ -10509,7 +10542,7 @@ static int Polycore_Vector3_set_y(lua_State *L) {
 }
 
 static int Polycore_Vector3_set_z(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->z = param;
@@ -10523,13 +10556,12 @@ static int Polycore_Vector3(lua_State *L) {
 	Number y = lua_tonumber(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number z = lua_tonumber(L, 3);
-	Vector3 *inst = new Vector3(x, y, z);
-	lua_pushlightuserdata(L, (void*)inst);
+	Vector3 *inst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3(x, y, z);
 	return 1;
 }
 
 static int Polycore_Vector3_set(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -10542,92 +10574,140 @@ static int Polycore_Vector3_set(lua_State *L) {
 }
 
 static int Polycore_Vector3_distance(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & vec2 = *( Vector3 *)lua_topointer(L, 2);
 	lua_pushnumber(L, inst->distance(vec2));
 	return 1;
 }
 
 static int Polycore_Vector3_length(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->length());
 	return 1;
 }
 
 static int Polycore_Vector3_dot(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 & u = *(Vector3 *)lua_topointer(L, 2);
 	lua_pushnumber(L, inst->dot(u));
 	return 1;
 }
 
 static int Polycore_Vector3_crossProduct(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & vec2 = *( Vector3 *)lua_topointer(L, 2);
-	 Vector3 *retInst = new  Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->crossProduct(vec2);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Vector3_Normalize(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
 	inst->Normalize();
 	return 0;
 }
 
 static int Polycore_delete_Vector3(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
-	Vector3 *inst = (Vector3*)lua_topointer(L, 1);
-	delete inst;
+	luaPolycode_checkpointer(L, 1);
+	if(lua_islightuserdata(L, 1)) {
+		Vector3 *inst = (Vector3*)lua_topointer(L, 1);
+		delete inst;
+	}
 	return 0;
 }
 
+static int Polycore_Vector3__gc(lua_State *L) {
+	Vector3 *inst = (Vector3*)lua_touserdata(L, 1);
+	inst->~Vector3();
+	return 0;
+}
+
+static int Polycore_Vector3__add(lua_State *L) {
+	Vector3 lhs = *(Vector3*)luaPolycode_checkvalue(L, 1, "Polycode.Vector3");
+	Vector3 rhs = *(Vector3*)luaPolycode_checkvalue(L, 2, "Polycode.Vector3");
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
+	*retInst = lhs + rhs;
+	return 1;
+}
+
+static int Polycore_Vector3__sub(lua_State *L) {
+	Vector3 lhs = *(Vector3*)luaPolycode_checkvalue(L, 1, "Polycode.Vector3");
+	Vector3 rhs = *(Vector3*)luaPolycode_checkvalue(L, 2, "Polycode.Vector3");
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
+	*retInst = lhs - rhs;
+	return 1;
+}
+
+static int Polycore_Vector3__mul(lua_State *L) {
+	Vector3 lhs = *(Vector3*)luaPolycode_checkvalue(L, 1, "Polycode.Vector3");
+	luaL_checktype(L, 2, LUA_TNUMBER);
+	Number rhs = lua_tonumber(L, 2);
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
+	*retInst = lhs * rhs;
+	return 1;
+}
+
+static int Polycore_Vector3__div(lua_State *L) {
+	Vector3 lhs = *(Vector3*)luaPolycode_checkvalue(L, 1, "Polycode.Vector3");
+	luaL_checktype(L, 2, LUA_TNUMBER);
+	Number rhs = lua_tonumber(L, 2);
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
+	*retInst = lhs / rhs;
+	return 1;
+}
+
+static int Polycore_Vector3__eq(lua_State *L) {
+	Vector3 lhs = *(Vector3*)luaPolycode_checkvalue(L, 1, "Polycode.Vector3");
+	Vector3 rhs = *(Vector3*)luaPolycode_checkvalue(L, 2, "Polycode.Vector3");
+	lua_pushboolean(L, lhs == rhs);
+	return 1;
+}
+
 static int Polycore_Vertex_get_restNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->restNormal);
 	return 1;
 }
 
 static int Polycore_Vertex_get_restPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->restPosition);
 	return 1;
 }
 
 static int Polycore_Vertex_get_normal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->normal);
 	return 1;
 }
 
 static int Polycore_Vertex_get_vertexColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->vertexColor);
 	return 1;
 }
 
 static int Polycore_Vertex_get_useVertexColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->useVertexColor);
 	return 1;
 }
 
 static int Polycore_Vertex_set_useVertexColor(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->useVertexColor = param;
@@ -10641,7 +10721,7 @@ static int Polycore_Vertex(lua_State *L) {
 }
 
 static int Polycore_Vertex_addBoneAssignment(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int boneID = lua_tointeger(L, 2);
@@ -10652,14 +10732,14 @@ static int Polycore_Vertex_addBoneAssignment(lua_State *L) {
 }
 
 static int Polycore_Vertex_getNumBoneAssignments(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getNumBoneAssignments());
 	return 1;
 }
 
 static int Polycore_Vertex_getBoneAssignment(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	unsigned int index = lua_tointeger(L, 2);
@@ -10673,23 +10753,22 @@ static int Polycore_Vertex_getBoneAssignment(lua_State *L) {
 }
 
 static int Polycore_Vertex_normalizeWeights(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	inst->normalizeWeights();
 	return 0;
 }
 
 static int Polycore_Vertex_getTexCoord(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getTexCoord();
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Polycore_Vertex_setTexCoord(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number u = lua_tonumber(L, 2);
@@ -10700,7 +10779,7 @@ static int Polycore_Vertex_setTexCoord(lua_State *L) {
 }
 
 static int Polycore_Vertex_setNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -10713,7 +10792,7 @@ static int Polycore_Vertex_setNormal(lua_State *L) {
 }
 
 static int Polycore_delete_Vertex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	Vertex *inst = (Vertex*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -107,6 +107,7 @@ int luaopen_Polycode(lua_State *L) {
 		{"Color_getBrightness", Polycore_Color_getBrightness},
 		{"Color_getUint", Polycore_Color_getUint},
 		{"delete_Color", Polycore_delete_Color},
+		{"Color__mul", Polycore_Color__mul},
 		{"Config", Polycore_Config},
 		{"Config_loadConfig", Polycore_Config_loadConfig},
 		{"Config_saveConfig", Polycore_Config_saveConfig},
@@ -419,6 +420,8 @@ int luaopen_Polycode(lua_State *L) {
 		{"Matrix4_inverse", Polycore_Matrix4_inverse},
 		{"Matrix4_inverseAffine", Polycore_Matrix4_inverseAffine},
 		{"delete_Matrix4", Polycore_delete_Matrix4},
+		{"Matrix4__add", Polycore_Matrix4__add},
+		{"Matrix4__mul", Polycore_Matrix4__mul},
 		{"Mesh_get_useVertexColors", Polycore_Mesh_get_useVertexColors},
 		{"Mesh_set_useVertexColors", Polycore_Mesh_set_useVertexColors},
 		{"Mesh", Polycore_Mesh},
@@ -590,6 +593,9 @@ int luaopen_Polycode(lua_State *L) {
 		{"Quaternion_createFromAxisAngle", Polycore_Quaternion_createFromAxisAngle},
 		{"Quaternion_createMatrix", Polycore_Quaternion_createMatrix},
 		{"delete_Quaternion", Polycore_delete_Quaternion},
+		{"Quaternion__add", Polycore_Quaternion__add},
+		{"Quaternion__mul", Polycore_Quaternion__mul},
+		{"Quaternion__eq", Polycore_Quaternion__eq},
 		{"QuaternionCurve", Polycore_QuaternionCurve},
 		{"QuaternionCurve_interpolate", Polycore_QuaternionCurve_interpolate},
 		{"QuaternionCurve_generatePointsFromCurves", Polycore_QuaternionCurve_generatePointsFromCurves},
@@ -1045,8 +1051,6 @@ int luaopen_Polycode(lua_State *L) {
 		{"SoundManager_initAL", Polycore_SoundManager_initAL},
 		{"SoundManager_setGlobalVolume", Polycore_SoundManager_setGlobalVolume},
 		{"delete_SoundManager", Polycore_delete_SoundManager},
-		{"String_get_contents", Polycore_String_get_contents},
-		{"String_get_s_contents", Polycore_String_get_s_contents},
 		{"String", Polycore_String},
 		{"String_size", Polycore_String_size},
 		{"String_length", Polycore_String_length},
@@ -1136,6 +1140,11 @@ int luaopen_Polycode(lua_State *L) {
 		{"Vector3_crossProduct", Polycore_Vector3_crossProduct},
 		{"Vector3_Normalize", Polycore_Vector3_Normalize},
 		{"delete_Vector3", Polycore_delete_Vector3},
+		{"Vector3__add", Polycore_Vector3__add},
+		{"Vector3__sub", Polycore_Vector3__sub},
+		{"Vector3__mul", Polycore_Vector3__mul},
+		{"Vector3__div", Polycore_Vector3__div},
+		{"Vector3__eq", Polycore_Vector3__eq},
 		{"Vertex_get_restNormal", Polycore_Vertex_get_restNormal},
 		{"Vertex_get_restPosition", Polycore_Vertex_get_restPosition},
 		{"Vertex_get_normal", Polycore_Vertex_get_normal},
@@ -1153,6 +1162,26 @@ int luaopen_Polycode(lua_State *L) {
 		{"delete_Vertex", Polycore_delete_Vertex},
 		{NULL, NULL}
 	};
+	luaL_newmetatable(L, "Polycode.Color");
+	lua_pushcfunction(L, Polycore_Color__gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+	luaL_newmetatable(L, "Polycode.Matrix4");
+	lua_pushcfunction(L, Polycore_Matrix4__gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+	luaL_newmetatable(L, "Polycode.Quaternion");
+	lua_pushcfunction(L, Polycore_Quaternion__gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+	luaL_newmetatable(L, "Polycode.Vector2");
+	lua_pushcfunction(L, Polycore_Vector2__gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+	luaL_newmetatable(L, "Polycode.Vector3");
+	lua_pushcfunction(L, Polycore_Vector3__gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
 	luaL_openlib(L, "Polycore", polycoreLib, 0);
 	return 1;
 }
\ No newline at end of file
@@ -2,6 +2,31 @@ import sys
 import CppHeaderParser
 import os
 
+# Math types that are passed by value. They are pushed to Lua as full userdata
+# holding the object inline, with a metatable that destroys it on collection.
+VALUE_TYPES = ["Vector2", "Vector3", "Color", "Quaternion", "Matrix4"]
+
+# Arithmetic metamethods generated for value types: (metamethod, C++ operator, right operand type)
+VALUE_OPERATORS = {
+	"Vector3": [("__add", "+", "Vector3"), ("__sub", "-", "Vector3"), ("__mul", "*", "Number"), ("__div", "/", "Number"), ("__eq", "==", "Vector3")],
+	"Color": [("__mul", "*", "Color")],
+	"Quaternion": [("__add", "+", "Quaternion"), ("__mul", "*", "Quaternion"), ("__eq", "==", "Quaternion")],
+	"Matrix4": [("__add", "+", "Matrix4"), ("__mul", "*", "Matrix4")]
+}
+
+# Operators that may swap their operands when Lua calls the metamethod with a number on the left
+COMMUTATIVE_OPERATORS = ["+", "*", "=="]
+
+def valueTypeAlloc(className):
+	return "new (luaPolycode_alloc_value(L, sizeof(%s), \"Polycode.%s\")) %s" % (className, className, className)
+
+def luaValueReturn(indent, className, retVal):
+	lout = "%sif %s == nil then return nil end\n" % (indent, retVal)
+	lout += "%slocal __c = %s(\"__skip_ptr__\")\n" % (indent, className)
+	lout += "%s__c.__ptr = %s\n" % (indent, retVal)
+	lout += "%sreturn __c\n" % (indent)
+	return lout
+
 
 def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, apiPath, apiClassPath, includePath, sourcePath):	
 	out = ""
@@ -17,16 +42,38 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 		sout += "CoreServices *inst = (CoreServices*)lua_topointer(L, 1);\n"
 		sout += "CoreServices::setInstance(inst);\n"
 	sout += "\tstatic const struct luaL_reg %sLib [] = {" % (libSmallName)
-	
+	metatables = []
+
 	out += "#pragma once\n\n"
-	out += "#include <%s>\n\n" % (mainInclude)
-	
+	out += "#include <%s>\n" % (mainInclude)
+	out += "#include <new>\n\n"
+
 	out += "extern \"C\" {\n\n"
 	out += "#include <stdio.h>\n"
 	out += "#include \"lua.h\"\n"
 	out += "#include \"lualib.h\"\n"
 	out += "#include \"lauxlib.h\"\n\n"
-	
+
+	out += "#ifndef POLYCODE_LUA_VALUE_TYPES\n"
+	out += "#define POLYCODE_LUA_VALUE_TYPES\n"
+	out += "static inline void luaPolycode_checkpointer(lua_State *L, int idx) {\n"
+	out += "\tif(!lua_isuserdata(L, idx))\n"
+	out += "\t\tluaL_typerror(L, idx, \"userdata\");\n"
+	out += "}\n\n"
+	out += "static inline void *luaPolycode_checkvalue(lua_State *L, int idx, const char *metatableName) {\n"
+	out += "\t// light userdata point at value members of engine objects and carry no type\n"
+	out += "\tif(lua_islightuserdata(L, idx))\n"
+	out += "\t\treturn (void*)lua_topointer(L, idx);\n"
+	out += "\treturn luaL_checkudata(L, idx, metatableName);\n"
+	out += "}\n\n"
+	out += "static inline void *luaPolycode_alloc_value(lua_State *L, size_t size, const char *metatableName) {\n"
+	out += "\tvoid *mem = lua_newuserdata(L, size);\n"
+	out += "\tluaL_getmetatable(L, metatableName);\n"
+	out += "\tlua_setmetatable(L, -2);\n"
+	out += "\treturn mem;\n"
+	out += "}\n"
+	out += "#endif\n\n"
+
 	if prefix == "Polycode":
 		out += "class LuaEventHandler : public EventHandler {\n"
 		out += "public:\n"
@@ -103,6 +150,7 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 					#		pps.append({"name": "emitter", "type": "ParticleEmitter"})
 	
 					if len(pps) > 0:
+						indexStart = len(lout)
 						lout += "function %s:__index__(name)\n" % ckey
 						for pp in pps:
 							if pidx == 0:
@@ -116,6 +164,9 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 								lout += "\t\tlocal ret = %s(\"__skip_ptr__\")\n" % (pp["type"])
 								lout += "\t\tret.__ptr = self.__ptr\n"
 								lout += "\t\treturn ret\n"
+							elif pp["type"] in VALUE_TYPES:
+								lout += "\t\tretVal = %s.%s_get_%s(self.__ptr)\n" % (libName, ckey, pp["name"])
+								lout += luaValueReturn("\t\t", pp["type"], "retVal")
 							else:
 								lout += "\t\tretVal = %s.%s_get_%s(self.__ptr)\n" % (libName, ckey, pp["name"])
 								lout += "\t\tif Polycore.__ptr_lookup[retVal] ~= nil then\n"
@@ -129,7 +180,7 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 							if not ((ckey == "ScreenParticleEmitter" or ckey == "SceneParticleEmitter") and pp["name"] == "emitter"):
 								sout += "\t\t{\"%s_get_%s\", %s_%s_get_%s},\n" % (ckey, pp["name"], libName, ckey, pp["name"])
 								out += "static int %s_%s_get_%s(lua_State *L) {\n" % (libName, ckey, pp["name"])
-								out += "\tluaL_checktype(L, 1, LUA_TLIGHTUSERDATA);\n"
+								out += "\tluaPolycode_checkpointer(L, 1);\n"
 								out += "\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
 	
 								outfunc = "lua_pushlightuserdata"
@@ -154,6 +205,20 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 	
 						lout += "\tend\n"
 						lout += "end\n"
+
+						if ckey in VALUE_TYPES:
+							# value type fields are looked up in a table instead of an if chain
+							lout = lout[:indexStart]
+							lout += "local __getters = {\n"
+							for pp in pps:
+								lout += "\t%s = %s.%s_get_%s,\n" % (pp["name"], libName, ckey, pp["name"])
+							lout += "}\n\n"
+							lout += "function %s:__index__(name)\n" % ckey
+							lout += "\tlocal getter = __getters[name]\n"
+							lout += "\tif getter ~= nil then\n"
+							lout += "\t\treturn getter(self.__ptr)\n"
+							lout += "\tend\n"
+							lout += "end\n"
 	
 					lout += "\n\n"
 					pidx = 0
@@ -170,7 +235,7 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 	
 								sout += "\t\t{\"%s_set_%s\", %s_%s_set_%s},\n" % (ckey, pp["name"], libName, ckey, pp["name"])
 								out += "static int %s_%s_set_%s(lua_State *L) {\n" % (libName, ckey, pp["name"])
-								out += "\tluaL_checktype(L, 1, LUA_TLIGHTUSERDATA);\n"
+								out += "\tluaPolycode_checkpointer(L, 1);\n"
 								out += "\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
 	
 								outfunc = "lua_topointer"
@@ -214,7 +279,7 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 								out += "static int %s_%s_%s(lua_State *L) {\n" % (libName, ckey, pm["name"])
 	
 								if pm["rtnType"].find("static ") == -1:
-									out += "\tluaL_checktype(L, 1, LUA_TLIGHTUSERDATA);\n"
+									out += "\tluaPolycode_checkpointer(L, 1);\n"
 									out += "\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
 								idx = 2
 							paramlist = []
@@ -228,7 +293,7 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 								param["name"] = param["name"].replace("end", "_end").replace("repeat", "_repeat")
 								if"type" in param:
 									luatype = "LUA_TLIGHTUSERDATA"
-									checkfunc = "lua_islightuserdata"
+									checkfunc = "lua_isuserdata"
 									if param["type"].find("*") > -1:
 										luafunc = "(%s)lua_topointer" % (param["type"].replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
 									elif param["type"].find("&") > -1:
@@ -259,8 +324,13 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 									
 									param["type"] = param["type"].replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle")
 	
+									if luatype == "LUA_TLIGHTUSERDATA":
+										checkParam = "\tluaPolycode_checkpointer(L, %d);\n" % (idx)
+									else:
+										checkParam = "\tluaL_checktype(L, %d, %s);\n" % (idx, luatype)
+
 									if "defaltValue" in param:
-										if checkfunc != "lua_islightuserdata" or (checkfunc == "lua_islightuserdata" and param["defaltValue"] == "NULL"):
+										if checkfunc != "lua_isuserdata" or (checkfunc == "lua_isuserdata" and param["defaltValue"] == "NULL"):
 											param["defaltValue"] = param["defaltValue"].replace(" 0f", ".0f")
 											param["defaltValue"] = param["defaltValue"].replace(": :", "::")
 											param["defaltValue"] = param["defaltValue"].replace("0 ", "0.")
@@ -272,13 +342,13 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 											out += "\t\t%s = %s;\n" % (param["name"], param["defaltValue"])
 											out += "\t}\n"
 										else:
-											out += "\tluaL_checktype(L, %d, %s);\n" % (idx, luatype);
+											out += checkParam
 											if param["type"] == "String":
 												out += "\t%s %s = String(%s(L, %d));\n" % (param["type"], param["name"], luafunc, idx)
 											else:
 												out += "\t%s %s = %s(L, %d);\n" % (param["type"], param["name"], luafunc, idx)
 									else:
-										out += "\tluaL_checktype(L, %d, %s);\n" % (idx, luatype);
+										out += checkParam
 										if param["type"] == "String":
 											out += "\t%s %s = String(%s(L, %d));\n" % (param["type"], param["name"], luafunc, idx)
 										else:
@@ -293,9 +363,12 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 									out += "\tLuaEventHandler *inst = new LuaEventHandler();\n"
 									out += "\tinst->wrapperIndex = luaL_ref(L, LUA_REGISTRYINDEX );\n"
 									out += "\tinst->L = L;\n"
+								elif ckey in VALUE_TYPES:
+									out += "\t%s *inst = %s(%s);\n" % (ckey, valueTypeAlloc(ckey), ", ".join(paramlist))
 								else:
 									out += "\t%s *inst = new %s(%s);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ", ".join(paramlist))
-								out += "\tlua_pushlightuserdata(L, (void*)inst);\n"
+								if ckey not in VALUE_TYPES:
+									out += "\tlua_pushlightuserdata(L, (void*)inst);\n"
 								out += "\treturn 1;\n"
 							else:
 								if pm["rtnType"].find("static ") == -1:
@@ -340,9 +413,13 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 											className = "Polycode::Polygon"
 										if className == "Rectangle":
 											className = "Polycode::Rectangle"
-										out += "\t%s *retInst = new %s();\n" % (className, className)
-										out += "\t*retInst = %s;\n" % (call)
-										out += "\t%s(L, retInst);\n" % (outfunc)
+										if className.strip() in VALUE_TYPES:
+											out += "\t%s *retInst = %s();\n" % (className.strip(), valueTypeAlloc(className.strip()))
+											out += "\t*retInst = %s;\n" % (call)
+										else:
+											out += "\t%s *retInst = new %s();\n" % (className, className)
+											out += "\t*retInst = %s;\n" % (call)
+											out += "\t%s(L, retInst);\n" % (outfunc)
 									out += "\treturn 1;\n"
 							out += "}\n\n"
 							
@@ -367,7 +444,8 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 									lout += "\t\tself.__ptr = %s.%s(self)\n" % (libName, ckey)
 								else:
 									lout += "\t\tself.__ptr = %s.%s(unpack(arg))\n" % (libName, ckey)
-								lout += "\t\tPolycore.__ptr_lookup[self.__ptr] = self\n"
+								if ckey not in VALUE_TYPES:
+									lout += "\t\tPolycore.__ptr_lookup[self.__ptr] = self\n"
 								lout += "\tend\n"
 								lout += "end\n\n"
 							else:
@@ -388,14 +466,17 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 										lout += "\treturn retVal\n"
 									else:
 										className = pm["rtnType"].replace("const", "").replace("&", "").replace("inline", "").replace("virtual", "").replace("static", "").replace("*","").replace(" ", "")
-										lout += "\tif retVal == nil then return nil end\n"
-										lout += "\tif Polycore.__ptr_lookup[retVal] ~= nil then\n"
-										lout += "\t\treturn Polycore.__ptr_lookup[retVal]\n"
-										lout += "\telse\n"
-										lout += "\t\tPolycore.__ptr_lookup[retVal] = %s(\"__skip_ptr__\")\n" % (className)
-										lout += "\t\tPolycore.__ptr_lookup[retVal].__ptr = retVal\n"
-										lout += "\t\treturn Polycore.__ptr_lookup[retVal]\n"
-										lout += "\tend\n"
+										if className in VALUE_TYPES:
+											lout += luaValueReturn("\t", className, "retVal")
+										else:
+											lout += "\tif retVal == nil then return nil end\n"
+											lout += "\tif Polycore.__ptr_lookup[retVal] ~= nil then\n"
+											lout += "\t\treturn Polycore.__ptr_lookup[retVal]\n"
+											lout += "\telse\n"
+											lout += "\t\tPolycore.__ptr_lookup[retVal] = %s(\"__skip_ptr__\")\n" % (className)
+											lout += "\t\tPolycore.__ptr_lookup[retVal].__ptr = retVal\n"
+											lout += "\t\treturn Polycore.__ptr_lookup[retVal]\n"
+											lout += "\tend\n"
 								lout += "end\n\n"
 	
 						parsed_methods.append(pm["name"])
@@ -403,12 +484,65 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 					#cleanup
 					sout += "\t\t{\"delete_%s\", %s_delete_%s},\n" % (ckey, libName, ckey)
 					out += "static int %s_delete_%s(lua_State *L) {\n" % (libName, ckey)
-					out += "\tluaL_checktype(L, 1, LUA_TLIGHTUSERDATA);\n"
-					out += "\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
-					out += "\tdelete inst;\n"
+					out += "\tluaPolycode_checkpointer(L, 1);\n"
+					if ckey in VALUE_TYPES:
+						# full userdata values are destroyed by __gc
+						out += "\tif(lua_islightuserdata(L, 1)) {\n"
+						out += "\t\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey, ckey)
+						out += "\t\tdelete inst;\n"
+						out += "\t}\n"
+					else:
+						out += "\t%s *inst = (%s*)lua_topointer(L, 1);\n" % (ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"), ckey.replace("Polygon", "Polycode::Polygon").replace("Rectangle", "Polycode::Rectangle"))
+						out += "\tdelete inst;\n"
 					out += "\treturn 0;\n"
 					out += "}\n\n"
 
+					if ckey in VALUE_TYPES:
+						metatables.append(ckey)
+						out += "static int %s_%s__gc(lua_State *L) {\n" % (libName, ckey)
+						out += "\t%s *inst = (%s*)lua_touserdata(L, 1);\n" % (ckey, ckey)
+						out += "\tinst->~%s();\n" % (ckey)
+						out += "\treturn 0;\n"
+						out += "}\n\n"
+
+						if ckey in VALUE_OPERATORS:
+							for op in VALUE_OPERATORS[ckey]:
+								sout += "\t\t{\"%s%s\", %s_%s%s},\n" % (ckey, op[0], libName, ckey, op[0])
+								out += "static int %s_%s%s(lua_State *L) {\n" % (libName, ckey, op[0])
+								out += "\t%s lhs = *(%s*)luaPolycode_checkvalue(L, 1, \"Polycode.%s\");\n" % (ckey, ckey, ckey)
+								if op[2] == "Number":
+									out += "\tluaL_checktype(L, 2, LUA_TNUMBER);\n"
+									out += "\tNumber rhs = lua_tonumber(L, 2);\n"
+								else:
+									out += "\t%s rhs = *(%s*)luaPolycode_checkvalue(L, 2, \"Polycode.%s\");\n" % (op[2], op[2], op[2])
+								if op[1] == "==":
+									out += "\tlua_pushboolean(L, lhs == rhs);\n"
+								else:
+									out += "\t%s *retInst = %s();\n" % (ckey, valueTypeAlloc(ckey))
+									out += "\t*retInst = lhs %s rhs;\n" % (op[1])
+								out += "\treturn 1;\n"
+								out += "}\n\n"
+
+								lout += "\n\n"
+								lout += "function %s:%s(other)\n" % (ckey, op[0])
+								if op[2] == "Number":
+									lout += "\tif type(self) == \"number\" then\n"
+									if op[1] in COMMUTATIVE_OPERATORS:
+										lout += "\t\tself, other = other, self\n"
+									else:
+										lout += "\t\terror(\"%s: a number cannot be on the left of a %s\", 2)\n" % (op[0], ckey)
+									lout += "\tend\n"
+									lout += "\tlocal retVal = %s.%s%s(self.__ptr, other)\n" % (libName, ckey, op[0])
+								else:
+									lout += "\tlocal retVal = %s.%s%s(self.__ptr, other.__ptr)\n" % (libName, ckey, op[0])
+								if op[1] == "==":
+									lout += "\treturn retVal\n"
+								else:
+									lout += "\tlocal __c = %s(\"__skip_ptr__\")\n" % (ckey)
+									lout += "\t__c.__ptr = retVal\n"
+									lout += "\treturn __c\n"
+								lout += "end\n"
+
 					lout += "\n\n"
 					lout += "function %s:__delete()\n" % (ckey)
 					lout += "\tPolycore.__ptr_lookup[self.__ptr] = nil\n"
@@ -433,6 +567,11 @@ def createLUABindings(inputPath, prefix, mainInclude, libSmallName, libName, api
 	
 	sout += "\t\t{NULL, NULL}\n"
 	sout += "\t};\n"
+	for ckey in metatables:
+		sout += "\tluaL_newmetatable(L, \"Polycode.%s\");\n" % (ckey)
+		sout += "\tlua_pushcfunction(L, %s_%s__gc);\n" % (libName, ckey)
+		sout += "\tlua_setfield(L, -2, \"__gc\");\n"
+		sout += "\tlua_pop(L, 1);\n"
 	sout += "\tluaL_openlib(L, \"%s\", %sLib, 0);\n" % (libName, libSmallName)
 	sout += "\treturn 1;\n"
 	sout += "}"
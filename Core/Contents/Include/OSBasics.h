@@ -59,15 +59,22 @@ class _PolyExport OSFileEntry {
 
 class _PolyExport OSFILE {
 public:
-	OSFILE(){}
+	OSFILE() : file(NULL), physFSFile(NULL), data(NULL), dataSize(0), dataPosition(0) {}
 	
 	void debugDump();
 	
 	int fileType;
 	FILE *file;	
 	PHYSFS_file *physFSFile;
+	
+	// contents of TYPE_MEMORY_FILE files
+	char *data;
+	long dataSize;
+	long dataPosition;
+	
 	static const int TYPE_FILE = 0;
 	static const int TYPE_ARCHIVE_FILE = 1;	
+	static const int TYPE_MEMORY_FILE = 2;
 };
 
 class _PolyExport OSBasics {
@@ -79,6 +86,32 @@ class _PolyExport OSBasics {
 		static size_t write( const void * ptr, size_t size, size_t count, OSFILE * stream );
 		static int seek(OSFILE * stream, long int offset, int origin );
 		static long tell(OSFILE * stream);
+		
+		/**
+		* Reads the rest of the file into a single buffer. The buffer is zero terminated and must be released with free().
+		* @param stream File to read from.
+		* @param size If not NULL, set to the number of bytes read (not counting the terminator).
+		* @return Newly allocated buffer or NULL on failure.
+		*/
+		static char *readAll(OSFILE * stream, long *size);
+		
+		/**
+		* Sets the size of the read/write buffer used for files opened after this call. Archive files are otherwise read straight through the decompressor in whatever chunk size the caller asks for.
+		* @param size Buffer size in bytes. 0 disables buffering of archive files.
+		*/
+		static void setBufferSize(size_t size);
+		
+		/**
+		* Files opened for reading that are no larger than this are read into memory in one call on open and all further reads are served from memory.
+		* @param size Size limit in bytes. 0 disables whole-file reads.
+		*/
+		static void setWholeFileReadSize(size_t size);
+		
+		/**
+		* Hints that the file is going to be read sequentially from the current position, letting the OS read ahead.
+		* @param stream File to hint.
+		*/
+		static void adviseSequential(OSFILE * stream);
 	
 		static vector<OSFileEntry> parsePhysFSFolder(String pathString, bool showHidden);
 		static vector<OSFileEntry> parseFolder(String pathString, bool showHidden);
@@ -88,4 +121,8 @@ class _PolyExport OSBasics {
 		
 	private:
 	
+		static bool readWholeFile(OSFILE *stream, long length);
+	
+		static size_t bufferSize;
+		static size_t wholeFileReadSize;
 };
@@ -146,7 +146,7 @@ namespace Polycode {
 		void addControlPoint2d(Number x, Number y);
 		
 		/**
-		* Returns the height of the curve at a specified point on the curve. Heights are cached into a buffer with a finite cache precision to speed up the curve usage in animation. If you need to quickly get 2D height out of a curve and you don't care about total precision, use this method.
+		* Returns the height of the curve at a specified point on the curve. Heights are cached into a buffer with a finite cache precision and linearly interpolated, so the lookup takes constant time. If you need to quickly get 2D height out of a curve and you don't care about total precision, use this method.
 		* @param a Normalized (0-1) position along the curve.
 		* @return Height value at specified position.
 		*/												
@@ -159,6 +159,27 @@ namespace Polycode {
 		*/														
 		Vector3 getPointAt(Number a);
 		
+		/**
+		* Evaluates the curve at many positions at once. Equivalent to calling getPointAt() for each position.
+		* @param a Array of normalized (0-1) positions along the curve.
+		* @param points Array to write the 3d points to.
+		* @param count Number of positions to evaluate.
+		*/
+		void getPointsAt(const Number *a, Vector3 *points, unsigned int count);
+		
+		/**
+		* Returns the cached height of the curve at many positions at once. Equivalent to calling getHeightAt() for each position.
+		* @param a Array of normalized (0-1) positions along the curve.
+		* @param heights Array to write the heights to.
+		* @param count Number of positions to evaluate.
+		*/
+		void getHeightsAt(const Number *a, Number *heights, unsigned int count);
+		
+		/**
+		* Returns the approximate length of the curve.
+		*/
+		Number getLength();
+		
 		/**
 		* Returns the 3d point of the curve at a specified point between two points.
 		* @param a Normalized (0-1) position between two points
@@ -170,8 +191,13 @@ namespace Polycode {
 		* Rebuilds the height cache buffers for 2d height curves.
 		*/	
 		void rebuildBuffers();
+		
+		/**
+		* Number of samples per segment used to measure the length of the curve.
+		*/
+		static const int ARC_LENGTH_SAMPLES = 32;
 
-		Number heightBuffer[BUFFER_CACHE_PRECISION];
+		Number heightBuffer[BUFFER_CACHE_PRECISION+1];
 
 		vector<BezierPoint*> controlPoints;
 		vector<Number> distances;
@@ -180,8 +206,16 @@ namespace Polycode {
 		protected:
 		
 			bool buffersDirty;
+			bool distancesDirty;
 		
 			void recalculateDistances();
+			
+			inline unsigned int findSegment(Number a);
+			inline Vector3 getPointInSegment(unsigned int segment, Number u);
+			
+			// cubic coefficients of each segment, 4 xyz triplets from the constant term up
+			vector<Number> coefficients;
+			Number totalLength;
 	
 			
 	};
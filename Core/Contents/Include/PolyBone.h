@@ -97,6 +97,13 @@ namespace Polycode {
 			*/												
 			void setBoneMatrix(Matrix4 matrix);
 			
+			/**
+			* Sets the bone matrix and the transform of the bone from a rotation and a position relative to the parent bone.
+			* @param rotation New rotation.
+			* @param position New position.
+			*/
+			void setPose(Quaternion rotation, Vector3 position);
+			
 			/**
 			* Returns the rest matrix of this bone.
 			* @return Rest matrix.
@@ -116,10 +123,17 @@ namespace Polycode {
 			Matrix4 getParentRestMatrix();
 			
 			/**
+			* Returns the model space matrix of the bone, as of the last call to rebuildFinalMatrix(). The owning Skeleton rebuilds it for every bone once per frame.
 			* @see getBoneMatrix()
 			*/																								
 			Matrix4 getFinalMatrix();
 			
+			/**
+			* Recomputes the final matrix from the bone matrix and the final matrix of the parent bone. The parent must be rebuilt first.
+			* @return True if the final matrix is different from the one it replaced.
+			*/
+			bool rebuildFinalMatrix();
+			
 			/**
 			* Sets the rest matrix for this bone.
 			* @param matrix New rest matrix.
@@ -148,6 +162,11 @@ namespace Polycode {
 			* Id of the bone.
 			*/								
 			int parentBoneId;			
+			
+			/**
+			* Index of the bone in its skeleton, or -1 if the bone does not belong to a skeleton.
+			*/
+			int boneId;
 
 			Matrix4 boneMatrix;
 			Matrix4 restMatrix;
@@ -157,6 +176,7 @@ namespace Polycode {
 		
 		protected:
 			Mesh *boneMesh;
+			Matrix4 finalMatrix;
 		
 			Bone* parentBone;
 			vector<Bone*> childBones;
@@ -46,6 +46,12 @@ namespace Polycode {
 			
 			void buildFrustrumPlanes();
 			
+			/**
+			* Extracts the six clipping planes of the renderer's current modelview and projection matrices. Because the modelview already contains the transform of the entity being rendered, the planes come out in that entity's local space. A point is inside a plane if planes[i][0]*x + planes[i][1]*y + planes[i][2]*z + planes[i][3] > 0.
+			* @param planes Array to write the normalized planes to.
+			*/
+			static void getRendererFrustumPlanes(Number planes[6][4]);
+			
 			/**
 			* Checks if the camera can see a sphere.
 			* @param pos Position of the sphere to check.
@@ -52,6 +52,7 @@ namespace Polycode {
 
 	class _PolyExport CoreMutex {
 	public:
+		virtual ~CoreMutex() {}
 		int mutexID;
 	};
 	
@@ -68,6 +69,53 @@ namespace Polycode {
 		void *windowData;
 	};
 
+	/**
+	* Interface for work that can run in the time the core would otherwise sleep between frames. See Core::setIdleHandler()
+	*/
+	class _PolyExport CoreIdleHandler {
+	public:
+		virtual ~CoreIdleHandler() {}
+		
+		/**
+		* Called by the core before it sleeps to keep the frame rate. The core sleeps for whatever is left of the idle time after this returns.
+		* @param idleTime Time in seconds until the next frame is due.
+		*/
+		virtual void handleIdle(Number idleTime) = 0;
+	};
+
+	/**
+	* Frame time statistics over the most recent frames. See Core::getFrameStats()
+	*/
+	class _PolyExport CoreFrameStats {
+	public:
+		CoreFrameStats() : numFrames(0), minFrameTime(0), averageFrameTime(0), p99FrameTime(0), maxFrameTime(0) {}
+		
+		/**
+		* Number of frames the statistics were computed from.
+		*/
+		int numFrames;
+		
+		/**
+		* Shortest frame time in seconds.
+		*/
+		Number minFrameTime;
+		
+		/**
+		* Average frame time in seconds.
+		*/
+		Number averageFrameTime;
+		
+		/**
+		* 99th percentile frame time in seconds. 99% of the frames took this long or less.
+		*/
+		Number p99FrameTime;
+		
+		/**
+		* Longest frame time in seconds.
+		*/
+		Number maxFrameTime;
+	};
+
 	/**
 	* The main core of the framework. The core deals with system-level functions, such as window initialization and OS interaction. Each platform has its own implementation of this base class. NOTE: SOME OF THE FUNCTIONALITY IN THE CORE IS NOT FULLY IMPLEMENTED!!
 	*/
@@ -256,6 +304,52 @@ namespace Polycode {
 		
 		void doSleep();
 		
+		/**
+		* Sets the frame rate the core paces rendering to.
+		* @param frameRate New frame rate in frames per second.
+		*/
+		void setFrameRate(int frameRate);
+		
+		/**
+		* Runs timers, tweens, the Update() of scenes and screens and the Update() of all their entities at a fixed rate, independent of the frame rate. Each frame runs as many fixed steps as the elapsed time calls for and then renders once, so rendering no longer updates entities. While a fixed step runs, getElapsed() returns the step length. By default the fixed time step is disabled and everything is updated once per frame.
+		* @param timeStep Length of a fixed step in seconds, or 0 to update once per frame.
+		*/
+		void setFixedTimeStep(Number timeStep);
+		
+		/**
+		* Returns the length of the fixed time step.
+		* @return Length of the fixed time step in seconds, or 0 if it is disabled.
+		*/
+		Number getFixedTimeStep();
+		
+		/**
+		* Returns true if the core runs with a fixed time step.
+		*/
+		bool isFixedTimeStepEnabled();
+		
+		/**
+		* Sets the maximum number of fixed steps run in a single frame. If the simulation falls further behind, the remaining time is dropped so that a slow frame does not cause even slower ones.
+		* @param maxSteps Maximum number of fixed steps per frame. Defaults to 5.
+		*/
+		void setMaxFixedSteps(int maxSteps);
+		
+		/**
+		* Returns how far rendering is between the last fixed step and the next one. Use it to interpolate between the previous and current simulation state when rendering.
+		* @return Interpolation alpha from 0 to 1. Always 0 if the fixed time step is disabled.
+		*/
+		Number getInterpolationAlpha();
+		
+		/**
+		* Returns the minimum, average, 99th percentile and maximum frame time over the last FRAME_STATS_WINDOW frames.
+		*/
+		CoreFrameStats getFrameStats();
+		
+		/**
+		* Sets a handler that is given the idle time left in each frame before the core sleeps.
+		* @param handler Idle handler to use or NULL to remove it. The core does not take ownership of the handler.
+		*/
+		void setIdleHandler(CoreIdleHandler *handler);
+		
 		/**
 		* Returns the time elapsed since last frame.
 		* @return Time elapsed since last frame in floating point microseconds.
@@ -274,16 +368,48 @@ namespace Polycode {
 		*/		
 		Number getTicksFloat();
 		
+		/**
+		* Returns the time elapsed since the core was created from a high resolution monotonic clock.
+		* @return Time elapsed since launch in nanoseconds.
+		*/
+		unsigned long long getTicksNanoseconds();
+		
 		void setUserPointer(void *ptr) { userPointer = ptr; }
 		void *getUserPointer() { return userPointer; }
 		
 		static const int EVENT_CORE_RESIZE = 0;		
 		
+		/**
+		* Number of frames getFrameStats() is computed from.
+		*/
+		static const int FRAME_STATS_WINDOW = 256;
+		
 	protected:
 		
 		void *userPointer;
+		CoreIdleHandler *idleHandler;
+		
+		unsigned long long frameInterval;
+		unsigned long long nextFrameDeadline;
+		unsigned long long clockStart;
+		unsigned long long lastFrameClock;
+		
+		Number fixedTimeStep;
+		int maxFixedSteps;
+		Number fixedAccumulator;
+		bool inFixedStep;
+		Number frameElapsed;
 		
-		long refreshInterval;
+		Number frameTimes[FRAME_STATS_WINDOW];
+		int frameTimeIndex;
+		int numFrameTimes;
+		
+		unsigned long long readClock();
+		
+		/**
+		* Returns the clock frame times are measured with, in nanoseconds. Defaults to getTicksNanoseconds(). Cores that simulate time override this.
+		*/
+		virtual unsigned long long getFrameClock();
 		
 		bool fullScreen;
 		int aaLevel;
@@ -302,7 +428,6 @@ namespace Polycode {
 		
 		bool mouseEnabled;
 		
-		unsigned int lastSleepFrameTicks;
 		
 		int xRes;
 		int yRes;		
@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include "PolyTweenManager.h"
 #include "PolySoundManager.h"
 #include "PolyResourceManager.h"
+#include "PolyJobSystem.h"
 #include "PolyCore.h"
 #include "PolyConfig.h"
 #include "PolyModule.h"
@@ -50,6 +51,7 @@ namespace Polycode {
 	class TweenManager;
 	class ResourceManager;
 	class SoundManager;
+	class JobSystem;
 	class Core;
 	class CoreMutex;
 	
@@ -77,6 +79,17 @@ namespace Polycode {
 			
 			void Update(int elapsed);
 			
+			/**
+			* Runs one simulation step of timers, tweens, scenes and screens without rendering. Called by the core for each fixed time step.
+			*/
+			void fixedUpdate();
+			
+			/**
+			* Renders scenes and screens without updating them. Called by the core once per frame when it runs with a fixed time step.
+			* @param elapsed Time elapsed since the last frame in milliseconds.
+			*/
+			void Render(int elapsed);
+			
 			void setCore(Core *core);
 			
 			/**
@@ -157,6 +170,13 @@ namespace Polycode {
 			* @see Config
 			*/																													
 			Config *getConfig();
+			
+			/**
+			* Returns the job system. The job system runs jobs on a pool of worker threads, which are started the first time this is called.
+			* @return Job system.
+			* @see JobSystem
+			*/
+			JobSystem *getJobSystem();
 		
 			~CoreServices();
 		
@@ -182,6 +202,7 @@ namespace Polycode {
 			ResourceManager *resourceManager;
 			SoundManager *soundManager;
 			FontManager *fontManager;
+			JobSystem *jobSystem;
 			Renderer *renderer;
 	};
 }
\ No newline at end of file
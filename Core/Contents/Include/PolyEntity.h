@@ -159,6 +159,54 @@ namespace Polycode {
 			@return Parent entity of this entity.
 			*/
 			Entity *getParentEntity();
+			
+			/**
+			* Returns the number of child entities.
+			@return Number of child entities.
+			*/
+			unsigned int getNumChildren();
+			
+			/**
+			* Returns the child entity at the specified index.
+			@param index Index of the child.
+			@return Child entity at the index.
+			*/
+			Entity *getChildAtIndex(unsigned int index);
+			
+			/**
+			* Returns a counter that changes whenever a child is added to or removed from the entity or any of its descendants. Caches of entity hierarchies can compare it to find out if they need to be rebuilt.
+			*/
+			unsigned int getHierarchyVersion() { return hierarchyVersion; }
+			
+			/**
+			* Returns true if the entity was moved or resized since the last call to clearBoundsChanged().
+			*/
+			bool hasBoundsChanged() { return boundsDirty; }
+			
+			/**
+			* Returns true if one of the entity's descendants was moved or resized since the last call to clearBoundsChanged() on it. Indexes of entity hierarchies can follow these flags to visit only the changed entities.
+			*/
+			bool hasChildBoundsChanged() { return childBoundsDirty; }
+			
+			/**
+			* Clears the flags returned by hasBoundsChanged() and hasChildBoundsChanged(). The flags of the changed descendants have to be cleared as well.
+			*/
+			void clearBoundsChanged() { boundsDirty = false; childBoundsDirty = false; }
+			
+			/**
+			* Returns a counter that changes whenever the entity or one of its children is transformed, shown, hidden or changes shape. It is brought up to date by updateEntityMatrix(). Caches of rendered results, like shadow maps, can compare it to find out if they need to be rebuilt.
+			*/
+			unsigned int getChangeRevision() { return changeRevision; }
+			
+			/**
+			* Marks the entity as changed for getChangeRevision(). Call this after changes that cannot be detected otherwise, like editing the vertices of a mesh.
+			*/
+			void markChanged() { ownRevision++; }
+			
+			/**
+			* Returns a counter for changes to the entity's own geometry that are not transform changes. Subclasses whose geometry changes by itself, like skinned meshes, override this. Used internally by updateEntityMatrix().
+			*/
+			virtual unsigned int getContentRevision() { return 0; }
 				
 			//@}
 			// ----------------------------------------------------------------------------------------------------------------
@@ -563,6 +611,17 @@ namespace Polycode {
 		
 		protected:
 			vector<Entity*> children;
+			
+			void hierarchyChanged();
+			void boundsChanged();
+			
+			unsigned int hierarchyVersion;
+			bool boundsDirty;
+			bool childBoundsDirty;
+			unsigned int ownRevision;
+			unsigned int changeRevision;
+			bool lastVisible;
+			bool lastEnabled;
 
 			Vector3 childCenter;
 			Number bBoxRadius;		
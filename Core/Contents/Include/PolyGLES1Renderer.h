@@ -57,6 +57,7 @@ namespace Polycode {
 		
 		void createVertexBufferForMesh(Mesh *mesh);
 		void drawVertexBuffer(VertexBuffer *buffer);		
+		void drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count);
 		
 		void bindFrameBufferTexture(Texture *texture);
 		void unbindFramebuffers();
@@ -67,10 +67,9 @@ namespace Polycode {
 		void cullFrontFaces(bool val);
 				
 		void pushRenderDataArray(RenderDataArray *array);
-		RenderDataArray *createRenderDataArrayForMesh(Mesh *mesh, int arrayType);
-		RenderDataArray *createRenderDataArray(int arrayType);
 		void setRenderArrayData(RenderDataArray *array, Number *arrayData);
 		void drawArrays(int drawType);		
+		void drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count);
 				
 		void setOrthoMode(Number xSize=0.0f, Number ySize=0.0f);
 		void _setOrthoMode();
@@ -139,8 +138,46 @@ namespace Polycode {
 		void clearShader();
 		void applyMaterial(Material *material,  ShaderBinding *localOptions, unsigned int shaderIndex);
 		
+		void beginGPUTimer(int pass);
+		void endGPUTimer(int pass);
+		
+		/**
+		* Number of frames timer query results are kept around for before they are read back.
+		*/
+		static const int GPU_TIMER_FRAMES = 3;
+		
+		/**
+		* Maximum number of timer queries issued per frame. Passes that would need more are not measured.
+		*/
+		static const int MAX_GPU_TIMER_QUERIES = 64;
+		
+		/**
+		* Maximum nesting depth of timed passes.
+		*/
+		static const int MAX_GPU_TIMER_DEPTH = 8;
+		
 	protected:
 
+		void initGPUTimers();
+		void readGPUTimers(int frame);
+		void startTimerQuery(int pass);
+		void stopTimerQuery();
+		
+		bool gpuTimersInitialized;
+		bool gpuTimersSupported;
+		bool timerQueryActive;
+		
+		GLuint timerQueries[GPU_TIMER_FRAMES][MAX_GPU_TIMER_QUERIES];
+		int timerQueryPasses[GPU_TIMER_FRAMES][MAX_GPU_TIMER_QUERIES];
+		int numTimerQueries[GPU_TIMER_FRAMES];
+		int timerFrame;
+		
+		int timerPassStack[MAX_GPU_TIMER_DEPTH];
+		int timerPassDepth;
+		
+		Number gpuTimes[GPU_TIMER_COUNT];
+		bool gpuTimesAvailable;
+		
 		
 		Number nearPlane;
 		Number farPlane;
@@ -40,13 +40,35 @@ namespace Polycode {
 	typedef struct {
 		Texture *texture;
 		String name;
+		int slot;
 	} GLSLTextureBinding;
 
 	typedef struct {
 		Cubemap *cubemap;
 		String name;
+		int slot;
 	} GLSLCubemapBinding;
 	
+	/**
+	* A program parameter of a linked GLSL shader. The uniform location is looked up once when the shader is linked and the last uploaded value is kept so that unchanged values are not uploaded again.
+	*/
+	class _PolyExport GLSLUniformSlot {
+		public:
+			GLSLProgramParam param;
+			int location;
+			bool uploaded;
+			Number value[3];
+	};
+	
+	/**
+	* A sampler uniform of a linked GLSL shader and the texture unit last assigned to it.
+	*/
+	class _PolyExport GLSLSamplerSlot {
+		public:
+			String name;
+			int location;
+			int unit;
+	};
 	
 	class _PolyExport GLSLShader : public Shader {
 		public:
@@ -55,12 +77,31 @@ namespace Polycode {
 
 			ShaderBinding *createBinding();
 			
+			/**
+			* Looks up the uniform locations of all vertex and fragment program parameters and of the shadow map samplers. Called after the shader is linked, this also forgets all uploaded values.
+			*/
+			void resolveUniforms();
+			
+			/**
+			* Returns the sampler slot for the sampler uniform with the specified name, adding it to the sampler table if it has not been looked up yet.
+			* @param name Name of the sampler uniform.
+			* @return Index into the samplers vector.
+			*/
+			int getSamplerSlot(String name);
+			
 			unsigned int shader_id;		
 			GLSLProgram *vp;
 			GLSLProgram *fp;			
 			
+			vector<GLSLUniformSlot> uniforms;
+			vector<GLSLSamplerSlot> samplers;
+			
+			int shadowMapSlots[4];
+			int shadowMatrixLocations[4];
+			
 		protected:
 			
+			void addUniformSlots(GLSLProgram *program);
 	};
 	
 	class _PolyExport GLSLShaderBinding : public ShaderBinding {
@@ -73,9 +114,25 @@ namespace Polycode {
 			void clearTexture(String name);			
 			void addParam(String type, String name, String value);
 			
+			/**
+			* Maps the local parameters, textures and cubemaps of this binding to the uniform and sampler slots of the specified shader. Nothing is done if the binding is already resolved for that shader and has not changed since.
+			* @param shader Shader the binding is about to be applied with.
+			*/
+			void resolveSlots(GLSLShader *shader);
+			
 			vector<GLSLTextureBinding> textures;
 			vector<GLSLCubemapBinding> cubemaps;		
 		
+			/**
+			* Local parameter for each uniform slot of the resolved shader, or NULL if the binding does not set it.
+			*/
+			vector<LocalShaderParam*> paramSlots;
+		
 			GLSLShader *glslShader;
+			
+		protected:
+		
+			GLSLShader *slotShader;
+			unsigned int slotParamCount;
 	};
 }
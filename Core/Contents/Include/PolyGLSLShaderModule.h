@@ -55,7 +55,8 @@ namespace Polycode {
 		void addParamToProgram(GLSLProgram *program,TiXmlNode *node);		
 		void recreateGLSLProgram(GLSLProgram *prog, String fileName, int type);
 		GLSLProgram *createGLSLProgram(String fileName, int type);		
-		void updateGLSLParam(Renderer *renderer, GLSLShader *glslShader, GLSLProgramParam &param, ShaderBinding *materialOptions, ShaderBinding *localOptions);		
+		void updateGLSLParam(Renderer *renderer, GLSLUniformSlot &slot, LocalShaderParam *materialParam, LocalShaderParam *localParam);		
+		void setGLSLSampler(GLSLShader *glslShader, int samplerSlot, int textureUnit);
 			
 		void setGLSLAreaLightPositionParameter(Renderer *renderer, GLSLProgramParam &param, int lightIndex);
 		void setGLSLAreaLightColorParameter(Renderer *renderer, GLSLProgramParam &param, int lightIndex);	
@@ -70,6 +71,8 @@ namespace Polycode {
 //		GLSLprofile fragmentProfile;
 		
 		vector<GLSLProgram*> programs;
+		
+		GLuint currentProgram;
 	};
 	
 }
@@ -29,6 +29,9 @@ THE SOFTWARE.
 
 #define COMPILE_GL_RENDERER
 
+// Compile the profiler markers. Without it, PROFILE_SCOPE compiles to nothing.
+#define COMPILE_PROFILER
+
 #ifdef _WINDOWS
 	#define WIN32_LEAN_AND_MEAN
 
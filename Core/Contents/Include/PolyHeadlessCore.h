@@ -0,0 +1,107 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "PolyGlobals.h"
+#include "PolyCore.h"
+#include "PolyNullRenderer.h"
+#include "PolyRectangle.h"
+#include <vector>
+#include <SDL/SDL.h>
+
+using std::vector;
+
+namespace Polycode {
+
+	class _PolyExport HeadlessCoreMutex : public CoreMutex {
+	public:
+		~HeadlessCoreMutex() { SDL_DestroyMutex(pMutex); }
+		SDL_mutex *pMutex;
+	};
+
+	/**
+	* Core without a window or graphics context. It renders through a NullRenderer and takes no input, so scenes can be run on build machines without a display, for example to run benchmarks. Threads and mutexes use SDL, which does not need a display for them. getThreadID() is provided by the SDL core built next to it.
+	*
+	* The core can simulate time. With a simulated frame time set, every call to Update() advances the clock by exactly that amount, which makes runs deterministic regardless of how long the frames take to compute.
+	*/
+	class _PolyExport HeadlessCore : public Core {
+		
+	public:
+		
+		/**
+		* Constructor.
+		* @param xRes Horizontal resolution the scenes are rendered at.
+		* @param yRes Vertical resolution the scenes are rendered at.
+		* @param frameRate Frame rate to pace Update() to. Pass 0 to run frames back to back.
+		*/
+		HeadlessCore(int xRes, int yRes, int frameRate=0);
+		~HeadlessCore();
+		
+		unsigned int getTicks();
+		bool Update();
+		void setVideoMode(int xRes, int yRes, bool fullScreen, int aaLevel);
+		void createThread(Threaded *target);
+		vector<Rectangle> getVideoModes();
+		
+		void setCursor(int cursorType);
+		void lockMutex(CoreMutex *mutex);
+		void unlockMutex(CoreMutex *mutex);
+		CoreMutex *createMutex();
+		void copyStringToClipboard(String str);
+		String getClipboardString();
+		void createFolder(String folderPath);
+		void copyDiskItem(String itemPath, String destItemPath);
+		void moveDiskItem(String itemPath, String destItemPath);
+		void removeDiskItem(String itemPath);
+		String openFolderPicker();
+		vector<string> openFilePicker(vector<CoreFileExtension> extensions, bool allowMultiple);
+		void resizeTo(int xRes, int yRes);
+		
+		/**
+		* Sets the time every frame advances the clock by. Frame statistics then report the simulated time as well, use getTicksNanoseconds() to measure how long frames really take.
+		* @param frameTime Simulated frame time in seconds. Pass 0 to use the real clock.
+		*/
+		void setSimulatedFrameTime(Number frameTime);
+		
+		/**
+		* Returns the simulated frame time in seconds, or 0 if the real clock is used.
+		*/
+		Number getSimulatedFrameTime();
+		
+		/**
+		* Returns the null renderer the core renders through.
+		*/
+		NullRenderer *getNullRenderer();
+		
+	protected:
+		
+		unsigned long long getFrameClock();
+		
+		NullRenderer *nullRenderer;
+		
+		unsigned long long simulatedFrameTime;
+		unsigned long long simulatedClock;
+		
+		String clipboardString;
+	};
+}
@@ -172,6 +172,14 @@ namespace Polycode {
 			*/									
 			void perlinNoise(int seed, bool alpha);
 			
+			/**
+			* Fills the image with noise. The noise is evaluated over one unit of noise coordinates across the image, in bands of rows. Noise values from -1 to 1 are mapped to black and white.
+			* @param noise Noise to sample.
+			* @param tileable If true, the noise wraps at the image edges so the image can be tiled. See Perlin::fillTileableGrid2D().
+			* @param alpha If true, affects alpha, if false only affects the color.
+			*/
+			void fillNoise(Perlin *noise, bool tileable, bool alpha);
+			
 			/**
 			* Blurs the image using box blur.
 			* @param blurSize Size of the blur in pixels.
@@ -0,0 +1,247 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include "PolyThreaded.h"
+#include <vector>
+#include <deque>
+
+using std::vector;
+using std::deque;
+
+namespace Polycode {
+
+	class Core;
+	class CoreMutex;
+	class JobSystem;
+	class JobWakeup;
+
+	/**
+	* Counts jobs that were submitted with it and have not finished yet. Pass a counter to JobSystem::submit() and wait on it with JobSystem::wait(), or use it as the dependency of other jobs. A counter can be reused once it is finished.
+	*/
+	class _PolyExport JobCounter {
+		public:
+			JobCounter() { count = 0; }
+			
+			/**
+			* Number of unfinished jobs. Only changed by the job system while it holds its counter lock, use JobSystem::isFinished() to read it from another thread.
+			*/
+			int count;
+	};
+
+	/**
+	* A unit of work for the job system. Subclass it and implement run(). Jobs run on worker threads, which have no CoreServices instance of their own, so jobs that make GL calls or use the managers in CoreServices must be marked as main thread only.
+	*/
+	class _PolyExport Job {
+		public:
+			Job();
+			virtual ~Job();
+			
+			/**
+			* Implement this method with the work of the job.
+			*/
+			virtual void run() = 0;
+			
+			/**
+			* If true, the job only runs on the main thread. Defaults to false.
+			*/
+			bool mainThreadOnly;
+			
+			/**
+			* Counter decremented when the job finishes. Set by JobSystem::submit().
+			*/
+			JobCounter *counter;
+			
+			/**
+			* Counter that has to finish before the job can start. Set by JobSystem::submit().
+			*/
+			JobCounter *dependency;
+	};
+	
+	/**
+	* Body of a loop run by JobSystem::parallelFor().
+	*/
+	class _PolyExport ParallelForBody {
+		public:
+			virtual ~ParallelForBody() {}
+			
+			/**
+			* Processes a range of the loop. Called concurrently from several threads with ranges that do not overlap.
+			* @param begin First index of the range.
+			* @param end Index one past the last index of the range.
+			*/
+			virtual void run(int begin, int end) = 0;
+	};
+	
+	/**
+	* A worker thread of the job system. Each worker has its own job queue, taking the newest jobs from its end and stealing the oldest jobs from the other workers when it runs out. Workers that find no jobs for a while sleep until a new job is queued.
+	*/
+	class _PolyExport JobWorker : public Threaded {
+		public:
+			JobWorker(JobSystem *jobSystem, int index);
+			virtual ~JobWorker();
+			
+			void runThread();
+			void updateThread();
+			void killThread();
+			
+			bool isRunning();
+			
+			/**
+			* Returns true once the worker thread has left its loop after killThread().
+			*/
+			bool isFinished();
+			
+			deque<Job*> jobs;
+			CoreMutex *jobsMutex;
+			
+			long threadID;
+			bool started;
+			bool finished;
+			
+		protected:
+		
+			JobSystem *jobSystem;
+			int index;
+			int idleCount;
+	};
+
+	/**
+	* Runs jobs on a pool of worker threads. Accessed via CoreServices::getJobSystem(), which starts the workers the first time it is called.
+	
+	Jobs are queued on the worker that submits them, or spread over the workers when submitted from another thread. Idle workers steal from the others. A thread that waits for a counter runs queued jobs in the meantime, so waiting from within a job does not block a worker. Jobs marked as main thread only are run by the main thread while it waits for a counter and once per frame from CoreServices.
+	*/
+	class _PolyExport JobSystem {
+		public:
+			/**
+			* Constructor.
+			* @param core Core used to create the worker threads and mutexes.
+			* @param numWorkers Number of worker threads to start. If negative, one less than the number of CPU cores is used. With no workers, all jobs run on the main thread.
+			*/
+			JobSystem(Core *core, int numWorkers = -1);
+			~JobSystem();
+			
+			/**
+			* Queues a job to run. The job system does not take ownership of the job, it has to stay valid until it has finished.
+			* @param job Job to run.
+			* @param counter Optional counter that counts the job until it finishes.
+			* @param dependency Optional counter that has to finish before the job can start.
+			*/
+			void submit(Job *job, JobCounter *counter = NULL, JobCounter *dependency = NULL);
+			
+			/**
+			* Runs queued jobs on the calling thread until the counter has finished.
+			* @param counter Counter to wait for.
+			*/
+			void wait(JobCounter *counter);
+			
+			/**
+			* Returns true if all jobs counted by the counter have finished.
+			*/
+			bool isFinished(JobCounter *counter);
+			
+			/**
+			* Splits a loop into ranges and runs them on the workers and the calling thread. Returns when the whole loop has finished.
+			* @param begin First index of the loop.
+			* @param end Index one past the last index of the loop.
+			* @param grainSize Number of indices per range. If 0 or less, the loop is split into about four ranges per thread.
+			* @param body Loop body to run.
+			*/
+			void parallelFor(int begin, int end, int grainSize, ParallelForBody *body);
+			
+			/**
+			* Runs the main thread only jobs that are ready. Called from the main thread once per frame.
+			*/
+			void runMainThreadJobs();
+			
+			/**
+			* Runs one queued job on the calling thread, if there is one.
+			* @return True if a job was run.
+			*/
+			bool runNextJob();
+			
+			/**
+			* Returns the number of worker threads.
+			*/
+			int getNumWorkers();
+			
+			/**
+			* Returns true if called from the thread that created the job system.
+			*/
+			bool isMainThread();
+			
+			Core *getCore();
+			
+			/**
+			* Blocks until all workers have started. Called by the workers before they take jobs.
+			*/
+			void waitUntilReady();
+			
+			/**
+			* Returns a counter that is incremented every time a job is queued for the workers.
+			*/
+			unsigned int getQueueGeneration();
+			
+			/**
+			* Puts an idle worker to sleep until a job is queued after the generation was read or the worker is stopped.
+			* @param worker Worker to put to sleep.
+			* @param generation Value of getQueueGeneration() read before the worker last looked for jobs.
+			*/
+			void waitForJobs(JobWorker *worker, unsigned int generation);
+			
+			/**
+			* Returns the number of CPU cores available to the process.
+			*/
+			static int getNumCPUCores();
+			
+			/**
+			* Maximum number of worker threads.
+			*/
+			static const int MAX_WORKERS = 64;
+			
+		protected:
+		
+			void queueJob(Job *job);
+			Job *takeJob(int workerIndex, bool mainThread);
+			void runJob(Job *job);
+			int getWorkerIndex();
+			
+			Core *core;
+			long mainThreadID;
+			
+			vector<JobWorker*> workers;
+			int nextWorker;
+			bool ready;
+			
+			deque<Job*> mainThreadJobs;
+			CoreMutex *mainThreadMutex;
+			
+			vector<Job*> waitingJobs;
+			CoreMutex *counterMutex;
+			
+			JobWakeup *wakeup;
+			unsigned int queueGeneration;
+	};
+	
+}
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include <stdio.h>
 #include <stdarg.h>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #ifdef MSVC
@@ -34,14 +35,218 @@ THE SOFTWARE.
 using std::wstring;
 using std::string;
 
+/**
+* Messages below this level are compiled out. Define it before building to strip debug logging from release builds. Use the POLYCODE_LOG_ macros so the arguments of compiled out messages are not evaluated either.
+*/
+#ifndef POLYCODE_LOG_MIN_LEVEL
+#define POLYCODE_LOG_MIN_LEVEL 0
+#endif
+
 namespace Polycode {
 
+	class Core;
+
+	/**
+	* Destination for log messages. Subclass this and add it to the Logger with Logger::addSink() to receive messages. Sinks are always called by one thread at a time. Messages a sink logs while it is writing are dropped.
+	*/
+	class _PolyExport LogSink {
+		public:
+			LogSink(){}
+			virtual ~LogSink(){}
+			
+			/**
+			* Writes a message.
+			* @param level Severity level of the message.
+			* @param message Formatted message text.
+			*/
+			virtual void write(int level, const char *message) = 0;
+			
+			/**
+			* Flushes buffered output. Called after every batch of messages.
+			*/
+			virtual void flush(){}
+	};
+	
+	/**
+	* Writes messages to stderr. This is the sink the Logger starts with.
+	*/
+	class _PolyExport StdErrLogSink : public LogSink {
+		public:
+			void write(int level, const char *message);
+			void flush();
+	};
+	
+	/**
+	* Appends messages to a file.
+	*/
+	class _PolyExport FileLogSink : public LogSink {
+		public:
+			/**
+			* Constructor.
+			* @param fileName Path of the log file.
+			* @param append If true, messages are added to the end of an existing file, otherwise it is overwritten.
+			*/
+			FileLogSink(const char *fileName, bool append = false);
+			virtual ~FileLogSink();
+			
+			void write(int level, const char *message);
+			void flush();
+			
+		protected:
+			FILE *file;
+	};
+	
+	/**
+	* Keeps the most recent messages in memory, for example to show them in an in-game console. Lock the logger with Logger::lockSinks() while reading the lines if the logger is running asynchronously.
+	*/
+	class _PolyExport MemoryLogSink : public LogSink {
+		public:
+			/**
+			* Constructor.
+			* @param maxLines Maximum number of lines to keep. Older lines are discarded first.
+			*/
+			MemoryLogSink(unsigned int maxLines = 256);
+			
+			void write(int level, const char *message);
+			
+			unsigned int getNumLines() const;
+			const string &getLine(unsigned int index) const;
+			int getLineLevel(unsigned int index) const;
+			void clear();
+			
+		protected:
+			unsigned int maxLines;
+			unsigned int firstLine;
+			std::vector<string> lines;
+			std::vector<int> levels;
+	};
+
+	/**
+	* Engine logger. Messages are filtered by severity level and written to a list of sinks. By default messages are written synchronously to stderr. After startAsync() is called, messages are instead formatted into a lock-free ring buffer and written to the sinks by a background thread, so logging only costs the formatting on the calling thread. If the buffer is full or the rate limit is reached, messages are dropped and the number of dropped messages is reported.
+	*/
 	class _PolyExport Logger {
 		public:
 			Logger(){}
 			~Logger(){}
 
+			/**
+			* Logs a message at LOG_INFO level.
+			* @param format printf style format string.
+			*/
 			static void log(const char *format, ...);
 			static void logw(const char *str);
+			
+			/**
+			* Logs a message at LOG_DEBUG level.
+			* @param format printf style format string.
+			*/			
+			static void debug(const char *format, ...);
+
+			/**
+			* Logs a message at LOG_WARNING level.
+			* @param format printf style format string.
+			*/						
+			static void warning(const char *format, ...);
+
+			/**
+			* Logs a message at LOG_ERROR level.
+			* @param format printf style format string.
+			*/									
+			static void error(const char *format, ...);
+			
+			/**
+			* Logs a message at the specified level.
+			* @param level Severity level. Possible values are LOG_DEBUG, LOG_INFO, LOG_WARNING and LOG_ERROR.
+			* @param format printf style format string.
+			* @param args Format arguments.
+			*/
+			static void logv(int level, const char *format, va_list args);
+			
+			/**
+			* Sets the lowest level that is logged. Defaults to LOG_INFO.
+			* @param level Minimum level. Use LOG_NONE to disable logging.
+			*/
+			static void setLevel(int level);
+			static int getLevel();
+			
+			/**
+			* Returns true if messages at the specified level are logged. Use this to skip building expensive log messages.
+			*/
+			static inline bool isLevelEnabled(int level) { return level >= POLYCODE_LOG_MIN_LEVEL && level >= minLevel; }
+			
+			/**
+			* Adds a sink. The logger does not take ownership of the sink.
+			* @param sink Sink to add.
+			*/
+			static void addSink(LogSink *sink);
+			
+			/**
+			* Removes a sink. Messages still in the buffer will not be written to it.
+			* @param sink Sink to remove.
+			*/
+			static void removeSink(LogSink *sink);
+			
+			/**
+			* Returns the stderr sink the logger starts with, so that it can be removed.
+			*/
+			static LogSink *getDefaultSink();
+			
+			/**
+			* Limits the number of messages accepted per second. Messages over the limit are dropped.
+			* @param messagesPerSecond Maximum messages per second, or 0 for no limit.
+			*/
+			static void setRateLimit(unsigned int messagesPerSecond);
+			
+			/**
+			* Starts writing messages from a background thread. The Core stops it when it is destroyed.
+			* @param core Core used to create the thread.
+			*/
+			static void startAsync(Core *core);
+			
+			/**
+			* Stops the background thread and writes out any buffered messages, including the ones other threads are still writing to the buffer.
+			*/
+			static void stopAsync();
+			
+			/**
+			* Writes out all buffered messages from the calling thread.
+			*/
+			static void flush();
+			
+			/**
+			* Locks the sinks. While locked, no messages are written. Use this to safely read from a sink while the logger is running asynchronously. The lock can be taken again by the thread that holds it.
+			*/
+			static void lockSinks();
+			static void unlockSinks();
+			
+			/**
+			* Returns the number of messages dropped because the buffer was full or the rate limit was reached, since the logger started.
+			*/
+			static unsigned int getNumDroppedMessages();
+			
+			static const int LOG_DEBUG = 0;
+			static const int LOG_INFO = 1;
+			static const int LOG_WARNING = 2;
+			static const int LOG_ERROR = 3;
+			static const int LOG_NONE = 4;
+			
+			static const unsigned int RING_SIZE = 256;
+			static const unsigned int MESSAGE_SIZE = 4096;
+			
+		protected:
+		
+			static bool acceptMessage();
+			static void writeToSinks(int level, const char *message);
+			static void reportDropped();
+			
+			static int minLevel;
 	};
 }
+
+/**
+* Level logging macros. The message is only formatted, and its arguments only evaluated, if the level is enabled. The format and its arguments go in their own parentheses, for example POLYCODE_LOG_DEBUG(("requested %s\n", name.c_str()));
+*/
+#define POLYCODE_LOG_DEBUG(args) do { if(Polycode::Logger::isLevelEnabled(Polycode::Logger::LOG_DEBUG)) Polycode::Logger::debug args; } while(0)
+#define POLYCODE_LOG_INFO(args) do { if(Polycode::Logger::isLevelEnabled(Polycode::Logger::LOG_INFO)) Polycode::Logger::log args; } while(0)
+#define POLYCODE_LOG_WARNING(args) do { if(Polycode::Logger::isLevelEnabled(Polycode::Logger::LOG_WARNING)) Polycode::Logger::warning args; } while(0)
+#define POLYCODE_LOG_ERROR(args) do { if(Polycode::Logger::isLevelEnabled(Polycode::Logger::LOG_ERROR)) Polycode::Logger::error args; } while(0)
\ No newline at end of file
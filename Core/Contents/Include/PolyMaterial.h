@@ -61,8 +61,6 @@ namespace Polycode {
 			vector<Shader*> materialShaders;
 			vector<ShaderBinding*> shaderBindings;
 			vector<ShaderRenderTarget*> renderTargets;
-					
-			String name;
 		
 	};
 }
\ No newline at end of file
@@ -106,6 +106,41 @@ namespace Polycode {
 		float y;
 	} Vector2_struct;
 	
+	/**
+	* Header of a packed mesh file. A packed mesh stores its data in 16-byte aligned blocks that directly follow the header: the interleaved vertex block (vertexCount PackedVertex entries), the optional bone weight block (vertexCount PackedBoneWeights entries, present if flags has PACKED_MESH_HAS_BONE_WEIGHTS set) and the index block (indexCount unsigned ints, zero-padded to a multiple of 16 bytes). Every polygon corner is one index into the vertex block.
+	*/
+	typedef struct {
+		char magic[4];
+		unsigned int version;
+		unsigned int meshType;
+		unsigned int flags;
+		unsigned int vertexCount;
+		unsigned int indexCount;
+		unsigned int reserved[2];
+	} PackedMeshHeader;
+
+	/**
+	* Interleaved vertex as stored in the vertex block of a packed mesh file.
+	*/
+	typedef struct {
+		float position[3];
+		float normal[3];
+		float color[4];
+		float texCoord[2];
+	} PackedVertex;
+
+	/**
+	* Bone weights of a vertex as stored in the bone weight block of a packed mesh file. Unused slots have a weight of 0.
+	*/
+	typedef struct {
+		unsigned int boneIDs[4];
+		float weights[4];
+	} PackedBoneWeights;
+	
+	#define PACKED_MESH_VERSION 1
+	#define PACKED_MESH_MAX_BONE_WEIGHTS 4
+	#define PACKED_MESH_HAS_BONE_WEIGHTS 1
+	
 	/**
 	* A polygonal mesh. The mesh is assembled from Polygon instances, which in turn contain Vertex instances. This structure is provided for convenience and when the mesh is rendered, it is cached into vertex arrays with no notions of separate polygons. When data in the mesh changes, arrayDirtyMap must be set to true for the appropriate array types (color, position, normal, etc). Available types are defined in RenderDataArray.
 	*/
@@ -145,8 +180,20 @@ namespace Polycode {
 			*/			
 			void saveToFile(String fileName);
 
+			/**
+			* Saves mesh to a file in the packed mesh format. Packed meshes are read back in a single bulk read and load considerably faster than the default format. Vertices with more than 4 bone assignments keep their 4 heaviest ones.
+			* @param fileName Path to file to save to.
+			* @see PackedMeshHeader
+			*/
+			void savePackedToFile(String fileName);
+
+			/**
+			* Loads the mesh from an open file. Both the default and the packed mesh format are detected automatically.
+			* @param inFile File to load from.
+			*/
 			void loadFromFile(OSFILE *inFile);
 			void saveToFile(OSFILE *outFile);
+			void savePackedToFile(OSFILE *outFile);
 			
 			/**
 			* Returns the number of polygons in the mesh.
@@ -331,6 +378,9 @@ namespace Polycode {
 			bool useVertexColors;
 		
 		protected:
+		
+		void loadPackedFromFile(OSFILE *inFile);
+		void setRenderDataArray(int arrayType, int size, int count, float *data);
 					
 		VertexBuffer *vertexBuffer;
 		bool meshHasVertexBuffer;
@@ -0,0 +1,252 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include "PolyRenderer.h"
+#include "PolyTexture.h"
+#include "PolyCubemap.h"
+#include "PolyMesh.h"
+#include <vector>
+
+using std::vector;
+
+namespace Polycode {
+
+	/**
+	* Texture that only keeps its pixel data in memory. Created by the NullRenderer.
+	*/
+	class _PolyExport NullTexture : public Texture {
+		public:
+			NullTexture(unsigned int width, unsigned int height, char *textureData, bool clamp, int type=Image::IMAGE_RGBA);
+			virtual ~NullTexture();
+			
+			void setTextureData(char *data);
+			void recreateFromImageData();
+	};
+	
+	/**
+	* Vertex buffer that keeps the mesh vertex data in memory. Created by the NullRenderer.
+	*/
+	class _PolyExport NullVertexBuffer : public VertexBuffer {
+		public:
+			NullVertexBuffer(Mesh *mesh);
+			virtual ~NullVertexBuffer();
+			
+			vector<float> vertices;
+			vector<float> normals;
+			vector<float> texCoords;
+	};
+	
+	/**
+	* A render command recorded by the NullRenderer.
+	*/
+	class _PolyExport NullRenderCommand {
+		public:
+			NullRenderCommand() : type(0), drawType(0), count(0), target(NULL) {}
+			
+			/**
+			* Command type. Possible values are NullRenderer::COMMAND_DRAW, NullRenderer::COMMAND_SET_TEXTURE, NullRenderer::COMMAND_APPLY_MATERIAL, NullRenderer::COMMAND_SET_BLENDING_MODE, NullRenderer::COMMAND_BIND_FRAMEBUFFER and NullRenderer::COMMAND_CLEAR.
+			*/
+			int type;
+			
+			/**
+			* Mesh type of a draw command or the blending mode of a blending mode command.
+			*/
+			int drawType;
+			
+			/**
+			* Number of vertices of a draw command.
+			*/
+			unsigned int count;
+			
+			/**
+			* Texture, material or vertex buffer the command uses, if any.
+			*/
+			void *target;
+			
+			/**
+			* Modelview matrix at the time of a draw command.
+			*/
+			Matrix4 modelviewMatrix;
+	};
+
+	/**
+	* Renderer that does not draw anything. It implements the whole Renderer interface without a graphics context, so scenes can be updated and rendered on machines without a display, for example to run benchmarks. It keeps track of the modelview and projection matrices, creates textures and vertex buffers in memory, counts its work in the frame statistics and can record the commands it receives.
+	*/
+	class _PolyExport NullRenderer : public Renderer {
+		
+	public:
+		
+		NullRenderer();
+		virtual ~NullRenderer();
+		
+		void Resize(int xRes, int yRes);
+		void BeginRender();
+		void EndRender();
+		
+		Cubemap *createCubemap(Texture *t0, Texture *t1, Texture *t2, Texture *t3, Texture *t4, Texture *t5);
+		Texture *createTexture(unsigned int width, unsigned int height, char *textureData, bool clamp, int type = Image::IMAGE_RGBA);
+		Texture *createFramebufferTexture(unsigned int width, unsigned int height);
+		void createRenderTextures(Texture **colorBuffer, Texture **depthBuffer, int width, int height);
+		
+		void enableAlphaTest(bool val);
+		
+		void createVertexBufferForMesh(Mesh *mesh);
+		void drawVertexBuffer(VertexBuffer *buffer);
+		void bindFrameBufferTexture(Texture *texture);
+		void unbindFramebuffers();
+		
+		void cullFrontFaces(bool val);
+		
+		void pushRenderDataArray(RenderDataArray *array);
+		void setRenderArrayData(RenderDataArray *array, Number *arrayData);
+		void drawArrays(int drawType);
+		void drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count);
+		
+		void setOrthoMode(Number xSize=0.0f, Number ySize=0.0f);
+		void _setOrthoMode();
+		void setPerspectiveMode();
+		
+		void enableBackfaceCulling(bool val);
+		void setViewportSize(int w, int h, Number fov=45.0f);
+		
+		void setLineSmooth(bool val);
+		
+		void loadIdentity();
+		void setClearColor(Number r, Number g, Number b);
+		
+		void setTexture(Texture *texture);
+		
+		void renderToTexture(Texture *targetTexture);
+		void renderZBufferToTexture(Texture *targetTexture);
+		void clearScreen();
+		
+		void translate2D(Number x, Number y);
+		void rotate2D(Number angle);
+		void scale2D(Vector2 *scale);
+		
+		void setLineSize(Number lineSize);
+		
+		void setVertexColor(Number r, Number g, Number b, Number a);
+		
+		void setBlendingMode(int blendingMode);
+		
+		void enableLighting(bool enable);
+		void enableFog(bool enable);
+		void setFogProperties(int fogMode, Color color, Number density, Number startDepth, Number endDepth);
+		
+		void translate3D(Vector3 *position);
+		void translate3D(Number x, Number y, Number z);
+		void scale3D(Vector3 *scale);
+		
+		Matrix4 getProjectionMatrix();
+		Matrix4 getModelviewMatrix();
+		void setModelviewMatrix(Matrix4 m);
+		void multModelviewMatrix(Matrix4 m);
+		
+		void enableDepthTest(bool val);
+		void enableDepthWrite(bool val);
+		
+		void setClippingPlanes(Number near, Number far);
+		
+		void clearBuffer(bool colorBuffer, bool depthBuffer);
+		void drawToColorBuffer(bool val);
+		
+		void drawScreenQuad(Number qx, Number qy);
+		
+		void pushMatrix();
+		void popMatrix();
+		
+		/**
+		* Always returns false, the null renderer can not hit test.
+		*/
+		bool test2DCoordinate(Number x, Number y, Polycode::Polygon *poly, const Matrix4 &matrix, bool billboardMode);
+		
+		void setFOV(Number fov);
+		
+		/**
+		* Unprojects a screen coordinate onto the near plane. The null renderer has no depth buffer to read the depth from.
+		*/
+		Vector3 Unproject(Number x, Number y);
+		
+		void setDepthFunction(int depthFunction);
+		
+		void clearShader();
+		void applyMaterial(Material *material, ShaderBinding *localOptions, unsigned int shaderIndex);
+		
+		/**
+		* Enables or disables recording of render commands. Recorded commands are cleared at the start of every frame, so after a frame they describe that frame.
+		* @param val If true, commands are recorded.
+		*/
+		void setRecordCommands(bool val);
+		
+		/**
+		* Returns true if commands are being recorded.
+		*/
+		bool isRecordingCommands();
+		
+		/**
+		* Returns the number of recorded commands.
+		*/
+		unsigned int getNumRecordedCommands();
+		
+		/**
+		* Returns a recorded command.
+		* @param index Index of the command.
+		* @return The recorded command.
+		*/
+		NullRenderCommand getRecordedCommand(unsigned int index);
+		
+		/**
+		* Clears the recorded commands.
+		*/
+		void clearRecordedCommands();
+		
+		static const int COMMAND_DRAW = 0;
+		static const int COMMAND_SET_TEXTURE = 1;
+		static const int COMMAND_APPLY_MATERIAL = 2;
+		static const int COMMAND_SET_BLENDING_MODE = 3;
+		static const int COMMAND_BIND_FRAMEBUFFER = 4;
+		static const int COMMAND_CLEAR = 5;
+		
+	protected:
+		
+		void recordCommand(int type, int drawType, unsigned int count, void *target);
+		void setPerspectiveProjection(Number fov, Number aspect);
+		void setOrthoProjection(Number left, Number right, Number bottom, Number top, Number zNear, Number zFar);
+		
+		Number nearPlane;
+		Number farPlane;
+		
+		int verticesToDraw;
+		
+		Matrix4 modelviewMatrix;
+		Matrix4 projectionMatrix;
+		vector<Matrix4> modelviewStack;
+		vector<Matrix4> projectionStack;
+		
+		bool recordCommands;
+		vector<NullRenderCommand> recordedCommands;
+	};
+}
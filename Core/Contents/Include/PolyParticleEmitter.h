@@ -284,4 +284,223 @@ namespace Polycode {
 		ScreenMesh *emitterMesh;		
 		Screen *particleParentScreen;
 	};		
+
+	/**
+	* Data-oriented 3D particle emitter. Unlike SceneParticleEmitter, which creates a separate scene entity for every particle, this emitter keeps the particle state in flat per-attribute arrays and renders all of its particles as camera facing quads in a single draw call. This makes emitters with tens of thousands of particles practical.
+	*
+	* Particles are simulated in world space, so moving the emitter does not drag already emitted particles along. Add the emitter to a scene like any other entity. Its blending, depth and alpha test settings apply to all of its particles.
+	*/
+	class _PolyExport SceneParticleBatch : public SceneEntity {
+	public:
+		/**
+		* Constructor.
+		* @param materialName Name of the material to use for particles.
+		* @param emitterType Type of emitter to create. Can be ParticleEmitter::CONTINUOUS_EMITTER or ParticleEmitter::TRIGGERED_EMITTER
+		* @param lifespan Lifetime of particles in seconds.
+		* @param numParticles Total number of particles to create.
+		* @param direction Direction of the emitter, length of this vector controls emitter strength
+		* @param gravity Gravity direction and strength
+		* @param deviation Emitter deviation on each axis
+		*/
+		SceneParticleBatch(String materialName, int emitterType, Number lifespan, unsigned int numParticles, Vector3 direction, Vector3 gravity, Vector3 deviation);
+		virtual ~SceneParticleBatch();
+		
+		void Update();
+		void Render();
+		
+		/**
+		* Sets the material used to render the particles.
+		* @param material New particle material.
+		*/
+		void setMaterial(Material *material);
+		
+		/**
+		* Sets the speed at which particles rotate in degrees per second.
+		* @param speed New rotation speed.
+		*/
+		void setRotationSpeed(Number speed);
+		
+		/**
+		* Enables perlin noise movement for particles.
+		*/
+		void enablePerlin(bool val);
+		
+		/**
+		* Sets the strength of the perlin noise movement.
+		*/
+		void setPerlinModSize(Number size);
+		
+		/**
+		* Enables or disables the emitter.
+		*/
+		void enableEmitter(bool val);
+		
+		/**
+		* Returns true if the emitter is enabled, false otherwise.
+		*/
+		bool emitterEnabled();
+		
+		/**
+		* Sets the emitter radius on all 3 axises.
+		*/
+		void setEmitterRadius(Vector3 rad);
+		
+		/**
+		* If set to true, will release all particles at once.
+		*/
+		void setAllAtOnce(bool val);
+		
+		/**
+		* If emitter mode is TRIGGERED_EMITTER, calling this method will trigger particle emission.
+		*/
+		void Trigger();
+		
+		/**
+		* Changes the particle count in the emitter.
+		*/
+		void setParticleCount(unsigned int count);
+		
+		/**
+		* Returns the particle count of the emitter.
+		*/
+		unsigned int getParticleCount();
+		
+		/**
+		* Returns the number of particles drawn in the last rendered frame.
+		*/
+		unsigned int getNumVisibleParticles();
+		
+		/**
+		* Advances particles in the range [start, end) by the elapsed time. Update() calls this for all particles. Not thread-safe, respawning particles uses rand() and the perlin noise is shared by all ranges.
+		* @param start First particle to update.
+		* @param end One past the last particle to update.
+		* @param elapsed Elapsed time in seconds.
+		*/
+		void updateParticleRange(unsigned int start, unsigned int end, Number elapsed);
+		
+		/**
+		* Particle movement speed multiplier
+		*/
+		Number particleSpeedMod;
+		
+		/**
+		* Particle brightness deviation
+		*/
+		Number brightnessDeviation;
+		
+		/**
+		* Size of the particle quads. If scale curves are used, the curve value is multiplied by this.
+		*/
+		Number particleSize;
+		
+		/**
+		* Particle direction deviation
+		*/
+		Vector3 deviation;
+		
+		/**
+		* Particle direction and emission strength vector
+		*/
+		Vector3 dirVector;
+		
+		/**
+		* Particle gravity strength vector
+		*/
+		Vector3 gravVector;
+		
+		/**
+		* Lifespan of particles.
+		*/
+		Number lifespan;
+		
+		/**
+		* If set to true, particles' rotation will follow their movement on screen.
+		*/
+		bool rotationFollowsPath;
+		
+		/**
+		* Bezier curve that controls the scale of the particles.
+		*/
+		BezierCurve scaleCurve;
+		
+		/**
+		* Bezier curve that controls the red component of particles' color.
+		*/
+		BezierCurve colorCurveR;
+		/**
+		* Bezier curve that controls the green component of particles' color.
+		*/
+		BezierCurve colorCurveG;
+		/**
+		* Bezier curve that controls the blue component of particles' color.
+		*/
+		BezierCurve colorCurveB;
+		/**
+		* Bezier curve that controls the alpha component of particles' color.
+		*/
+		BezierCurve colorCurveA;
+		
+		/**
+		* If set to true, will use the color curves to control particle color. False by default.
+		*/
+		bool useColorCurves;
+		
+		/**
+		* If set to true, will use the scale curve to control particle scale. False by default.
+		*/
+		bool useScaleCurves;
+		
+		/**
+		* Number of samples the scale and color curves are baked into every frame.
+		*/
+		static const int CURVE_TABLE_SIZE = 128;
+		
+	protected:
+	
+		void resetParticle(unsigned int index, Matrix4 &baseMatrix);
+		void resizeParticleArrays(unsigned int count);
+		void bakeCurveTables();
+		void buildParticleArrays();
+		void updateBounds();
+		
+		int emitterType;
+		bool isEmitterEnabled;
+		bool allAtOnce;
+		
+		Vector3 emitterRadius;
+		Number perlinModSize;
+		Perlin *motionPerlin;
+		bool perlinEnabled;
+		Number rotationSpeed;
+		
+		Material *particleMaterial;
+		ShaderBinding *localShaderOptions;
+		
+		unsigned int numParticles;
+		unsigned int numVisibleParticles;
+		Number lastElapsed;
+		Matrix4 emitterMatrix;
+		
+		vector<float> positionX;
+		vector<float> positionY;
+		vector<float> positionZ;
+		vector<float> velocityX;
+		vector<float> velocityY;
+		vector<float> velocityZ;
+		vector<float> life;
+		vector<float> rotation;
+		vector<float> brightness;
+		vector<float> perlinPosX;
+		vector<float> perlinPosY;
+		vector<float> perlinPosZ;
+		
+		float scaleTable[CURVE_TABLE_SIZE];
+		float colorTable[CURVE_TABLE_SIZE*4];
+		
+		RenderDataArray *vertexArray;
+		RenderDataArray *normalArray;
+		RenderDataArray *texCoordArray;
+		RenderDataArray *colorArray;
+		unsigned int texCoordCapacity;
+	};
 }
\ No newline at end of file
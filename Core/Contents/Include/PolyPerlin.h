@@ -29,7 +29,7 @@ THE SOFTWARE.
 namespace Polycode {
 
 /**
-* 2D Perlin noise.
+* Perlin noise. The gradient tables are generated from the seed when the noise is constructed, so evaluation does not touch the global random number generator and a Perlin instance can be sampled from several threads at once.
 */ 
 class _PolyExport Perlin
 {
@@ -56,10 +56,115 @@ public:
 		vec[1] = y;
 		return perlin_noise_2D(vec);
 	};
+	
+	/**
+	* Returns 1D noise value at the specified coordinate.
+	* @param x Coordinate.
+	*/
+	Number Get1D(Number x);
+	
+	/**
+	* Returns 3D noise value at the specified coordinate.
+	* @param x X coordinate.
+	* @param y Y coordinate.
+	* @param z Z coordinate.
+	*/
+	Number Get3D(Number x, Number y, Number z);
+	
+	/**
+	* Sets how the octaves are combined. Possible values are FRACTAL_FBM, FRACTAL_TURBULENCE and FRACTAL_RIDGED.
+	* @param type New fractal type.
+	*/
+	void setFractalType(int type);
+	
+	/**
+	* Returns the fractal type.
+	*/
+	int getFractalType();
+	
+	/**
+	* Fills an array with 1D noise sampled at evenly spaced coordinates.
+	* @param values Array to fill.
+	* @param count Number of values.
+	* @param x Coordinate of the first value.
+	* @param stepX Distance between values.
+	*/
+	void fillArray1D(Number *values, unsigned int count, Number x, Number stepX);
+	
+	/**
+	* Fills a row-major grid with 2D noise. Returns the same values as calling Get() for every grid point, but shares the row setup between columns.
+	* @param values Array of width*height values to fill.
+	* @param width Grid width.
+	* @param height Grid height.
+	* @param x Horizontal coordinate of the first grid point.
+	* @param y Vertical coordinate of the first grid point.
+	* @param stepX Horizontal distance between grid points.
+	* @param stepY Vertical distance between grid points.
+	*/
+	void fillGrid2D(Number *values, int width, int height, Number x, Number y, Number stepX, Number stepY);
+	
+	/**
+	* Fills a grid with 2D noise that wraps seamlessly at its edges. The grid covers one unit of noise coordinates, so it tiles exactly when the frequency is a whole number.
+	* @param values Array of width*numRows values to fill.
+	* @param width Grid width.
+	* @param height Grid height.
+	* @param startRow First row to fill, so that a grid can be filled in bands.
+	* @param numRows Number of rows to fill.
+	*/
+	void fillTileableGrid2D(Number *values, int width, int height, int startRow, int numRows);
+	
+	/**
+	* Fills a grid with 3D noise, x varying fastest.
+	* @param values Array of width*height*depth values to fill.
+	* @param width Grid width.
+	* @param height Grid height.
+	* @param depth Grid depth.
+	* @param x X coordinate of the first grid point.
+	* @param y Y coordinate of the first grid point.
+	* @param z Z coordinate of the first grid point.
+	* @param step Distance between grid points.
+	*/
+	void fillGrid3D(Number *values, int width, int height, int depth, Number x, Number y, Number z, Number step);
+	
+	/**
+	* Evaluates 2D noise at a list of points.
+	* @param x Array of horizontal coordinates.
+	* @param y Array of vertical coordinates.
+	* @param values Array to write the noise values to.
+	* @param count Number of points.
+	*/
+	void fillPoints2D(const Number *x, const Number *y, Number *values, unsigned int count);
+	
+	/**
+	* Evaluates 3D noise at a list of points.
+	* @param x Array of X coordinates.
+	* @param y Array of Y coordinates.
+	* @param z Array of Z coordinates.
+	* @param values Array to write the noise values to.
+	* @param count Number of points.
+	*/
+	void fillPoints3D(const Number *x, const Number *y, const Number *z, Number *values, unsigned int count);
+	
+	/**
+	* Octaves are summed.
+	*/
+	static const int FRACTAL_FBM = 0;
+	
+	/**
+	* Absolute values of the octaves are summed, giving billowy noise.
+	*/
+	static const int FRACTAL_TURBULENCE = 1;
+	
+	/**
+	* Inverted absolute values of the octaves are squared and summed, giving sharp ridges.
+	*/
+	static const int FRACTAL_RIDGED = 2;
 
 protected:
   void init_perlin(int n,Number p);
   Number perlin_noise_2D(Number vec[2]);
+  void fillGridOctaves(Number *values, int width, int height, Number x, Number y, Number stepX, Number stepY, int period);
+  inline Number octaveValue(Number n);
 
   Number noise1(Number arg);
   Number noise2(Number vec[2]);
@@ -67,17 +172,19 @@ protected:
   void normalize2(Number v[2]);
   void normalize3(Number v[3]);
   void init(void);
+  int nextRandom();
 
   int   mOctaves;
   Number mFrequency;
   Number mAmplitude;
   int   mSeed;
+  int   mFractalType;
+  unsigned int mRandomState;
 
   int p[SAMPLE_SIZE + SAMPLE_SIZE + 2];
   Number g3[SAMPLE_SIZE + SAMPLE_SIZE + 2][3];
   Number g2[SAMPLE_SIZE + SAMPLE_SIZE + 2][2];
   Number g1[SAMPLE_SIZE + SAMPLE_SIZE + 2];
-  bool  mStart;
 
 };
 
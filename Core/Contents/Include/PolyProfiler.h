@@ -0,0 +1,223 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include <vector>
+
+using std::vector;
+
+#ifdef COMPILE_PROFILER
+	#define POLY_PROFILER_CONCAT2(a, b) a##b
+	#define POLY_PROFILER_CONCAT(a, b) POLY_PROFILER_CONCAT2(a, b)
+	#define PROFILE_SCOPE(name) Polycode::ProfilerScope POLY_PROFILER_CONCAT(profilerScope, __LINE__)(name)
+#else
+	#define PROFILE_SCOPE(name)
+#endif
+
+namespace Polycode {
+
+	class Core;
+	class CoreMutex;
+
+	/**
+	* A timed marker recorded by the profiler.
+	*/
+	class _PolyExport ProfilerEvent {
+		public:
+			/**
+			* Name of the marker. Has to point to a string that is never freed, such as a string literal.
+			*/
+			const char *name;
+			
+			/**
+			* Start and end time in nanoseconds since the core was created.
+			*/
+			unsigned long long start;
+			unsigned long long end;
+			
+			/**
+			* Number of markers the marker is nested in.
+			*/
+			int depth;
+	};
+
+	/**
+	* Ring buffer of the most recent profiler events of one thread. Once full, the oldest events are overwritten. Only the owning thread adds events, so adding takes no lock. Other threads can read the events at any time.
+	*/
+	class _PolyExport ProfilerThreadBuffer {
+		public:
+			ProfilerThreadBuffer(long threadID, int index);
+			
+			/**
+			* Adds an event. Must only be called from the thread that owns the buffer.
+			*/
+			void addEvent(const char *name, unsigned long long start, unsigned long long end, int depth);
+			
+			/**
+			* Appends the buffered events to a vector, oldest first. Events the owning thread overwrites while they are being copied are left out.
+			*/
+			void getEvents(vector<ProfilerEvent> &target);
+			
+			/**
+			* Has to be a power of two, so that the event index can wrap around.
+			*/
+			static const int EVENT_BUFFER_SIZE = 8192;
+			
+			long threadID;
+			int index;
+			int depth;
+			
+		protected:
+		
+			ProfilerEvent events[EVENT_BUFFER_SIZE];
+			
+			/**
+			* Number of events ever added. Written after the event it counts.
+			*/
+			volatile unsigned int writeCount;
+			
+			/**
+			* Number of valid events in the buffer. Written after writeCount.
+			*/
+			volatile unsigned int numEvents;
+	};
+	
+	/**
+	* Total time of one marker within a frame. See Profiler::getLastFrameMarkers()
+	*/
+	class _PolyExport ProfilerMarkerStats {
+		public:
+			const char *name;
+			int depth;
+			
+			/**
+			* Total time in seconds.
+			*/
+			Number time;
+			
+			/**
+			* Number of times the marker was hit.
+			*/
+			int calls;
+	};
+
+	/**
+	* Hierarchical CPU profiler. Code is timed with the PROFILE_SCOPE macro, which records how long the enclosing scope takes. Each thread records into its own ring buffer, so markers can be used from job system workers too. 
+	
+	The profiler is compiled in when COMPILE_PROFILER is defined in PolyGlobals.h, but records nothing until it is enabled. Without COMPILE_PROFILER the markers compile to nothing. The recorded markers can be shown with ProfilerOverlay or exported in the Chrome trace event format, which can be opened in chrome://tracing.
+	*/
+	class _PolyExport Profiler {
+		public:
+			/**
+			* Returns the profiler. Unlike CoreServices, the profiler is shared by all threads.
+			*/
+			static Profiler *getInstance();
+			
+			/**
+			* Starts or stops recording. Has to be called from the main thread.
+			* @param enabled True to record markers.
+			*/
+			void setEnabled(bool enabled);
+			bool isEnabled();
+			
+			/**
+			* Marks the start of a new frame. Called by the core.
+			*/
+			void beginFrame();
+			
+			/**
+			* Returns the length of the last complete frame.
+			* @return Frame time in seconds.
+			*/
+			Number getLastFrameTime();
+			
+			/**
+			* Returns the markers recorded on the main thread during the last complete frame, merged by name and depth and in the order they were first hit.
+			*/
+			vector<ProfilerMarkerStats> getLastFrameMarkers();
+			
+			/**
+			* Writes all buffered events in the Chrome trace event format.
+			* @param fileName Path of the file to write.
+			* @return True if the file was written.
+			*/
+			bool writeChromeTrace(const String &fileName);
+			
+			/**
+			* Returns the recording buffer of the calling thread, creating it if needed.
+			*/
+			ProfilerThreadBuffer *getThreadBuffer();
+			
+			/**
+			* Returns the current time in nanoseconds.
+			*/
+			unsigned long long getTime();
+			
+			/**
+			* True while recording. Checked by the markers before they do anything else.
+			*/
+			static bool enabled;
+			
+		protected:
+		
+			Profiler();
+			
+			Core *core;
+			CoreMutex *buffersMutex;
+			vector<ProfilerThreadBuffer*> buffers;
+			
+			long mainThreadID;
+			unsigned long long frameStart;
+			unsigned long long lastFrameStart;
+			unsigned long long lastFrameEnd;
+	};
+	
+	/**
+	* Records the time between its construction and destruction as a profiler marker. Use it through the PROFILE_SCOPE macro.
+	*/
+	class _PolyExport ProfilerScope {
+		public:
+			ProfilerScope(const char *name) {
+				buffer = NULL;
+				if(Profiler::enabled)
+					begin(name);
+			}
+			
+			~ProfilerScope() {
+				if(buffer)
+					end();
+			}
+			
+		protected:
+		
+			void begin(const char *name);
+			void end();
+		
+			ProfilerThreadBuffer *buffer;
+			const char *name;
+			unsigned long long start;
+			int depth;
+	};
+	
+}
@@ -0,0 +1,77 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include "PolyScreen.h"
+#include "PolyScreenLabel.h"
+#include "PolyScreenShape.h"
+#include "PolyProfiler.h"
+#include <vector>
+
+using std::vector;
+
+namespace Polycode {
+
+	/**
+	* Screen that shows the frame time and the profiler markers of the last frame on the main thread, indented by nesting depth. Creating the overlay enables the profiler. The text is only refreshed every refresh interval, since every change of a label creates a new texture.
+	*/
+	class _PolyExport ProfilerOverlay : public Screen {
+		public:
+			/**
+			* Constructor.
+			* @param fontSize Size of the text in pixels.
+			* @param fontName Name of a registered font to use.
+			*/
+			ProfilerOverlay(int fontSize = 12, String fontName = "sans");
+			virtual ~ProfilerOverlay();
+			
+			void Update();
+			
+			/**
+			* Sets how often the text is refreshed.
+			* @param interval Refresh interval in seconds. Defaults to 0.5.
+			*/
+			void setRefreshInterval(Number interval);
+			
+			/**
+			* Maximum number of lines shown.
+			*/
+			static const int MAX_LINES = 32;
+			
+		protected:
+		
+			void refresh();
+			void setLine(int index, const String &text);
+		
+			ScreenShape *background;
+			vector<ScreenLabel*> lines;
+			int numLines;
+			
+			int fontSize;
+			String fontName;
+			Number refreshInterval;
+			Number timeSinceRefresh;
+	};
+	
+}
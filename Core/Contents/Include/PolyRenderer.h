@@ -63,6 +63,74 @@ namespace Polycode {
 			bool operator() (LightInfo i,LightInfo j) { return ((cameraMatrix*i.position).distance(basePosition)<(cameraMatrix*j.position).distance(basePosition));}
 	};
 
+	/**
+	* Rendering statistics for a single frame. See Renderer::getFrameStats()
+	*/
+	class _PolyExport RendererFrameStats {
+	public:
+		RendererFrameStats();
+		
+		/**
+		* Resets all counters to zero.
+		*/
+		void reset();
+		
+		/**
+		* Number of draw calls issued.
+		*/
+		unsigned int numDrawCalls;
+		
+		/**
+		* Number of primitives drawn. Quads are counted as two triangles.
+		*/
+		unsigned int numPrimitives;
+		
+		/**
+		* Number of vertices submitted.
+		*/
+		unsigned int numVertices;
+		
+		/**
+		* Number of vertex buffers created and client side vertex arrays sent to the driver.
+		*/
+		unsigned int numBufferUploads;
+		
+		/**
+		* Number of texture binds.
+		*/
+		unsigned int numTextureBinds;
+		
+		/**
+		* Number of shader program changes.
+		*/
+		unsigned int numShaderSwitches;
+		
+		/**
+		* Number of state changes that were skipped because the state was already set.
+		*/
+		unsigned int numRedundantStateSets;
+		
+		/**
+		* True if the GPU times below were measured. They are only available if the driver supports timer queries.
+		*/
+		bool gpuTimersAvailable;
+		
+		/**
+		* GPU time spent rendering scenes, in milliseconds.
+		*/
+		Number gpuSceneTime;
+		
+		/**
+		* GPU time spent rendering screens, in milliseconds.
+		*/
+		Number gpuScreenTime;
+		
+		/**
+		* GPU time spent on post processing filters, in milliseconds.
+		*/
+		Number gpuFilterTime;
+	};
+
 	/**
 	* Main renderer. The renderer should only be accessed from the CoreServices singleton. Renderer operations should only be called from within Render methods of entities so that they can be properly managed.
 	*/
@@ -114,11 +182,19 @@ namespace Polycode {
 		void pushDataArrayForMesh(Mesh *mesh, int arrayType);
 		
 		virtual void pushRenderDataArray(RenderDataArray *array) = 0;
-		virtual RenderDataArray *createRenderDataArrayForMesh(Mesh *mesh, int arrayType) = 0;
-		virtual RenderDataArray *createRenderDataArray(int arrayType) = 0;
+		virtual RenderDataArray *createRenderDataArrayForMesh(Mesh *mesh, int arrayType);
+		virtual RenderDataArray *createRenderDataArray(int arrayType);
 		virtual void setRenderArrayData(RenderDataArray *array, Number *arrayData) = 0;
 		virtual void drawArrays(int drawType) = 0;
 		
+		/**
+		* Draws the pushed render data arrays using a list of vertex indices.
+		* @param drawType Mesh type to draw as.
+		* @param indices Vertex indices.
+		* @param count Number of indices.
+		*/
+		virtual void drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count) = 0;
+		
 		virtual void translate3D(Vector3 *position) = 0;
 		virtual void translate3D(Number x, Number y, Number z) = 0;
 		virtual void scale3D(Vector3 *scale) = 0;
@@ -184,6 +260,11 @@ namespace Polycode {
 		bool rayTriangleIntersect(Vector3 ray_origin, Vector3 ray_direction, Vector3 vert0, Vector3 vert1, Vector3 vert2, Vector3 *hitPoint);
 		
 		void enableShaders(bool flag);
+		
+		/**
+		* Returns false while shaders are disabled, for example while Scene::RenderDepthOnly() renders a shadow map.
+		*/
+		bool areShadersEnabled();
 
 		virtual void initOSSpecific() {};
 		
@@ -230,8 +311,54 @@ namespace Polycode {
 		vector<LightInfo> getAreaLights() { return areaLights; }
 		vector<LightInfo> getSpotLights() { return spotLights;	}
 		
+		/**
+		* Returns the statistics of the last completed frame. GPU times lag a few frames behind the counters, because timer query results are read back only once they are available.
+		* @return Statistics of the last frame.
+		*/
+		RendererFrameStats getFrameStats();
+		
+		/**
+		* Returns the statistics of the frame being rendered. Renderer and shader module implementations use this to count their work.
+		* @return Statistics of the current frame.
+		*/
+		RendererFrameStats *getCurrentFrameStats() { return &currentFrameStats; }
+		
+		/**
+		* Starts measuring GPU time for a render pass. Passes can be nested. While a nested pass is measured, the time is only added to the nested pass. Does nothing if the renderer has no GPU timers.
+		* @param pass Pass to measure. Possible values are GPU_TIMER_SCENE, GPU_TIMER_SCREEN and GPU_TIMER_FILTER.
+		*/
+		virtual void beginGPUTimer(int pass) {}
+		
+		/**
+		* Stops measuring GPU time for a render pass started with beginGPUTimer().
+		* @param pass Pass to stop measuring.
+		*/
+		virtual void endGPUTimer(int pass) {}
+		
+		static const int GPU_TIMER_SCENE = 0;
+		static const int GPU_TIMER_SCREEN = 1;
+		static const int GPU_TIMER_FILTER = 2;
+		static const int GPU_TIMER_COUNT = 3;
+		
 	protected:
 	
+		/**
+		* Finishes the statistics of the current frame and starts counting a new one. Called by implementations at the start of a frame.
+		*/
+		void beginFrameStats();
+		
+		/**
+		* Counts a draw call.
+		* @param drawType Mesh type that was drawn.
+		* @param numVertices Number of vertices submitted.
+		*/
+		void countDrawCall(int drawType, unsigned int numVertices);
+		
+		RendererFrameStats currentFrameStats;
+		RendererFrameStats lastFrameStats;
+	
+		int currentBlendingMode;
+	
 		bool cullingFrontFaces;
 				
 		Texture *currentTexture;
@@ -49,6 +49,11 @@ namespace Polycode {
 			
 			
 			String getResourceName();
+			
+			/**
+			* Returns the interned symbol of the resource name. See String::getSymbol().
+			*/
+			unsigned int getResourceNameSymbol();
 			int getResourceType();
 			void setResourceName(String newName);
 			void setResourcePath(String path);
@@ -54,6 +54,12 @@ namespace Polycode {
 			*/ 
 			void addResource(Resource *resource);
 			
+			/**
+			* Removes a resource. The resource is not deleted.
+			* @param resource Resource to remove.
+			*/
+			void removeResource(Resource *resource);
+			
 			/**
 			* Loads resources from a directory.
 			* @param dirPath Path to directory to load resources from.
@@ -37,6 +37,7 @@ namespace Polycode {
 
 	class _PolyExport SDLCoreMutex : public CoreMutex {
 	public:
+		~SDLCoreMutex() { SDL_DestroyMutex(pMutex); }
 		SDL_mutex *pMutex;
 	};
 
@@ -96,6 +96,11 @@ namespace Polycode {
 		void setFogProperties(int fogMode, Color color, Number density, Number startDepth, Number endDepth);
 	
 		virtual void Update();
+		
+		/**
+		* Runs Update() on all entities in the scene. Rendering does this every frame, unless the core runs with a fixed time step, in which case the scene manager calls it for every fixed step instead.
+		*/
+		void updateEntities();
 		void setVirtual(bool val);
 		bool isVirtual();
 	
@@ -129,7 +134,13 @@ namespace Polycode {
 		
 		void writeEntityMatrix(SceneEntity *entity, OSFILE *outFile);
 		void writeString(String str, OSFILE *outFile);
-		void saveScene(String fileName);
+		
+		/**
+		* Saves the static geometry of the scene.
+		* @param fileName File to save to.
+		* @param packedMeshes If true, meshes are written in the packed format, which loads faster but keeps only 4 bone weights per vertex.
+		*/
+		void saveScene(String fileName, bool packedMeshes = false);
 		
 		int getNumStaticGeometry();
 		SceneMesh *getStaticGeometry(int index);
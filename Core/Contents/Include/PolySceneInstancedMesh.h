@@ -0,0 +1,194 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include "PolySceneMesh.h"
+#include "PolyMatrix4.h"
+#include "PolyColor.h"
+#include <vector>
+
+using std::vector;
+
+namespace Polycode {
+
+	/**
+	* Transform and color of a single SceneInstancedMesh instance.
+	*/
+	class _PolyExport MeshInstance {
+		public:
+			/**
+			* Instance transform, relative to the SceneInstancedMesh.
+			*/
+			Matrix4 transform;
+			
+			/**
+			* Instance color. Multiplied with the entity color and, if the mesh uses them, the vertex colors.
+			*/
+			Color color;
+			
+			/**
+			* Bounding radius of the instance in entity space.
+			*/
+			Number radius;
+	};
+
+	/**
+	* Visible instances and combined vertex stream of one kind of render pass.
+	*/
+	class _PolyExport InstanceStream {
+		public:
+			InstanceStream();
+			~InstanceStream();
+			
+			/**
+			* Indices of the instances that passed frustum culling, in the order they appear in the stream.
+			*/
+			vector<unsigned int> visibleInstances;
+			
+			/**
+			* Culling output, swapped with visibleInstances when the visible set changes so that culling does not allocate.
+			*/
+			vector<unsigned int> culledInstances;
+			
+			RenderDataArray *vertexArray;
+			RenderDataArray *normalArray;
+			RenderDataArray *texCoordArray;
+			RenderDataArray *colorArray;
+			
+			/**
+			* Entity color the stream colors were built with.
+			*/
+			Color color;
+			
+			bool dirty;
+	};
+
+	/**
+	* Renders many copies of one Mesh as a single entity. Instead of one SceneMesh per copy, which each go through the full transformAndRender path and issue their own draw call, the instanced mesh keeps a compact list of per-instance transforms and colors. Every frame the instances are culled against the view frustum in bulk and the visible ones are pre-transformed into one vertex stream that is submitted with a single draw call. The stream is only rebuilt when the visible set or the instances change, so static forests and debris fields cost one draw call and almost no CPU per frame. Shadow map passes cull against the light's frustum and keep a stream of their own, so they do not force the camera's stream to be rebuilt every frame.
+	*
+	* Triangle strip and fan meshes, skinned meshes and meshes cached to a vertex buffer cannot be merged into one stream and are drawn once per visible instance instead.
+	*/
+	class _PolyExport SceneInstancedMesh : public SceneMesh {
+		public:
+			/**
+			* Construct from an existing Mesh instance. The mesh is not copied and can be shared with other entities.
+			* @param mesh Mesh to instance.
+			*/
+			SceneInstancedMesh(Mesh *mesh);
+			virtual ~SceneInstancedMesh();
+			
+			void Render();
+			
+			/**
+			* Adds an instance.
+			* @param transform Instance transform, relative to this entity.
+			* @param color Instance color.
+			* @return Index of the new instance.
+			*/
+			unsigned int addInstance(const Matrix4 &transform, Color color = Color(1.0f,1.0f,1.0f,1.0f));
+			
+			/**
+			* Adds an instance at a position.
+			* @param position Instance position, relative to this entity.
+			* @return Index of the new instance.
+			*/
+			unsigned int addInstance(const Vector3 &position);
+			
+			/**
+			* Removes an instance. The last instance takes its index.
+			* @param index Index of the instance to remove.
+			*/
+			void removeInstance(unsigned int index);
+			
+			/**
+			* Removes all instances.
+			*/
+			void clearInstances();
+			
+			/**
+			* Sets the transform of an instance.
+			* @param index Index of the instance.
+			* @param transform New instance transform.
+			*/
+			void setInstanceTransform(unsigned int index, const Matrix4 &transform);
+			
+			/**
+			* Sets the color of an instance.
+			* @param index Index of the instance.
+			* @param color New instance color.
+			*/
+			void setInstanceColor(unsigned int index, Color color);
+			
+			/**
+			* Returns the instance at an index.
+			* @param index Index of the instance.
+			*/
+			MeshInstance *getInstance(unsigned int index);
+			
+			/**
+			* Returns the number of instances.
+			*/
+			unsigned int getNumInstances();
+			
+			/**
+			* Returns the number of instances that passed frustum culling in the last rendered frame. Shadow map passes are not counted.
+			*/
+			unsigned int getNumVisibleInstances();
+			
+			/**
+			* Call this after changing the vertex data of the instanced mesh so that the combined vertex stream is rebuilt.
+			*/
+			void rebuildInstances();
+			
+			/**
+			* If set to false, instances will not be culled individually. Defaults to true.
+			*/
+			bool cullInstances;
+			
+		protected:
+		
+			bool canBatchInstances();
+			void updateInstanceRadius(unsigned int index);
+			void updateBBoxRadius();
+			void invalidateStreams();
+			void cullInstancesToFrustum(InstanceStream *stream);
+			void buildSourceArrays();
+			void buildInstanceArrays(InstanceStream *stream);
+			void renderBatched(InstanceStream *stream);
+			void renderEachInstance(InstanceStream *stream);
+		
+			vector<MeshInstance> instances;
+			
+			Number meshRadius;
+			bool sourceDirty;
+			
+			vector<float> sourcePositions;
+			vector<float> sourceNormals;
+			vector<float> sourceTexCoords;
+			vector<float> sourceColors;
+			
+			InstanceStream *cameraStream;
+			InstanceStream *depthStream;
+	};
+}
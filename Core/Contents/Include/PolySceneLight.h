@@ -37,6 +37,17 @@ namespace Polycode {
 	class Camera;
 //	class ScenePrimitive;
 	
+	/**
+	* State of a shadow caster when a light last rendered its shadow map. Used internally by SceneLight.
+	*/
+	class _PolyExport ShadowCasterState {
+		public:
+			SceneEntity *entity;
+			unsigned int changeRevision;
+			unsigned int hierarchyVersion;
+			bool inFrustum;
+	};
+
 	/**
 	* 3D light source. Lights can be area or spot lights and can be set to different colors. 
 	*/
@@ -168,6 +179,23 @@ namespace Polycode {
 			* @param fov New field of view value.
 			*/
 			void setShadowMapFOV(Number fov);
+			
+			/**
+			* If set to true, the shadow map is only rendered again when the light or a shadow casting entity in its frustum has changed, instead of every frame. Changes are detected through Entity::getChangeRevision(). Defaults to true.
+			* @param val If true, enables shadow map caching.
+			*/
+			void setShadowMapCaching(bool val);
+			
+			/**
+			* Makes the light render its shadow map again on the next frame. Call this after changes to shadow casters that are not detected automatically.
+			* @see Entity::markChanged()
+			*/
+			void invalidateShadowMap();
+			
+			/**
+			* Returns true if the shadow map was rendered in the last call to renderDepthMap(), false if the cached one was kept.
+			*/
+			bool wasShadowMapRendered() { return shadowMapRendered; }
 		
 			/**
 			* Returns true if shadows are enabled.
@@ -204,6 +232,15 @@ namespace Polycode {
 			Scene *parentScene;
 			
 			Matrix4 lightViewMatrix;
+			
+			bool shadowMapNeedsUpdate(Scene *scene);
+			void storeShadowCasters(Scene *scene);
+			
+			bool shadowMapCaching;
+			bool shadowMapDirty;
+			bool shadowMapRendered;
+			Matrix4 shadowLightMatrix;
+			vector<ShadowCasterState> shadowCasters;
 		
 			Number shadowMapRes;
 			Number shadowMapFOV;	
@@ -43,12 +43,30 @@ namespace Polycode {
 		void addScene(Scene *newScene);
 		void Update();
 		void UpdateVirtual();
+		
+		/**
+		* Updates all enabled scenes and the virtual scenes of registered render textures without rendering them. Used by the core's fixed time step.
+		*/
+		void fixedUpdate();
+		
+		/**
+		* Renders all enabled scenes without updating them.
+		*/
+		void Render();
+		
+		/**
+		* Renders registered render textures without updating their scenes.
+		*/
+		void RenderVirtual();
+		
 		void removeScene(Scene *scene);	
 		void registerRenderTexture(SceneRenderTexture *renderTexture);
 		
 		private:
 		
 		void updateRenderTextures(Scene *scene);
+		void renderTargets(bool updateScenes);
+		void renderScenes(bool updateScenes);
 		
 		vector <Scene*> scenes;
 		vector <SceneRenderTexture*> renderTextures;
@@ -131,6 +131,11 @@ namespace Polycode {
 		
 			void renderMeshLocally();
 			
+			/**
+			* Returns the pose revision of the skeleton, so that shadow maps are updated when a skinned mesh moves.
+			*/
+			unsigned int getContentRevision();
+			
 			/**
 			* If this is set to true, the mesh will be cached to a hardware vertex buffer if those are available. This can dramatically speed up rendering.
 			*/
@@ -147,7 +152,12 @@ namespace Polycode {
 			Mesh *mesh;
 			Texture *texture;
 			Material *material;
+			void skinMesh();
+			void initMesh();
+		
 			Skeleton *skeleton;
+			unsigned int skinnedPoseRevision;
+			vector<Matrix4> skinPalette;
 			ShaderBinding *localShaderOptions;
 	};
 }
\ No newline at end of file
@@ -25,6 +25,8 @@ THE SOFTWARE.
 #include "PolyString.h"
 #include "PolyGlobals.h"
 #include "PolyScreenEntity.h"
+#include "PolyScreenSpatialIndex.h"
+#include "PolyScreenRenderBatch.h"
 #include "PolyRenderer.h"
 #include "PolyInputEvent.h"
 #include "PolyCoreServices.h"
@@ -78,13 +80,49 @@ namespace Polycode {
 		virtual void Shutdown();
 		virtual void Update();
 		
+		/**
+		* Runs Update() on all entities in the screen. Rendering does this every frame, unless the core runs with a fixed time step, in which case the screen manager calls it for every fixed step instead.
+		*/
+		void updateEntities();
+		
 		/**
 		* Returns the entity at specified point. This is a deprecated method which does not take rotation or scale into account. Please use the 2d physics and collision module for proper collision detection.
 		*/
 		ScreenEntity *getEntityAt(Number x, Number y);
+		
+		/**
+		* Brings the spatial index used for mouse event routing up to date. Entities that were moved or resized since the last update are indexed again, and the whole index is rebuilt when entities were added or removed. Called before every mouse event.
+		*/
+		void updateSpatialIndex();
+		
+		/**
+		* Marks the whole spatial index as out of date, so it is rebuilt before the next mouse event.
+		*/
+		void invalidateSpatialIndex();
+		
+		/**
+		* Returns the spatial index of the screen's entities.
+		*/
+		ScreenSpatialIndex *getSpatialIndex() { return &spatialIndex; }
 
 		void Render();
 		void setRenderer(Renderer *renderer);
+		
+		/**
+		* Turns batched rendering on or off. When it is on, the screen's quads (images, sprites, labels and rectangle shapes) are transformed on the CPU and drawn together in as few draw calls as the changes in texture and render state allow. Entities that cannot be batched are rendered as usual, in order. Batching is on by default.
+		* @param enabled If true, the screen is rendered through its render batch.
+		*/
+		void setBatchingEnabled(bool enabled);
+		
+		/**
+		* Returns true if batched rendering is on.
+		*/
+		bool isBatchingEnabled() { return batchingEnabled; }
+		
+		/**
+		* Returns the render batch of the screen. Its counters describe the last rendered frame.
+		*/
+		ScreenRenderBatch *getRenderBatch() { return &renderBatch; }
 
 		/**
 		* Changes the screen's coordinate system. By default, screens' dimensions are in pixels. To accommodate changing resolutions without changing the dimensions of a screen's content, you can call this method to make it use normalized coordinates.
@@ -148,6 +186,10 @@ namespace Polycode {
 		
 	protected:
 		
+		void indexEntity(ScreenEntity *entity, Number originX, Number originY, int topIndex, int *order);
+		void indexChangedEntities(ScreenEntity *entity);
+		void routeMouseMove(Number x, Number y, int timestamp);
+		
 		bool useNormalizedCoordinates;
 		Number yCoordinateSize;		
 		
@@ -158,6 +200,17 @@ namespace Polycode {
 		ScreenEntity *focusChild;
 		vector <ScreenEntity*> children;
 		
+		ScreenSpatialIndex spatialIndex;
+		bool spatialIndexDirty;
+		unsigned int spatialIndexHierarchyVersion;
+		unsigned int getHierarchyVersion();
+		vector<int> draggedEntries;
+		vector<int> hoveredEntries;
+		vector<int> routedEntries;
+		
+		bool batchingEnabled;
+		ScreenRenderBatch renderBatch;
+		
 		Material *filterShaderMaterial;			
 		Texture *originalSceneTexture;			
 		Texture *zBufferSceneTexture;						
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "PolyEventDispatcher.h"
 #include "PolyRectangle.h"
 #include "PolyEntity.h"
+#include "PolyScreenRenderBatch.h"
 
 
 namespace Polycode {
@@ -76,6 +77,21 @@ class _PolyExport ScreenEntity : public Entity, public EventDispatcher {
 		void _onMouseMove(Number x, Number y, int timestamp);
 		void _onMouseWheelUp(Number x, Number y, int timestamp);
 		void _onMouseWheelDown(Number x, Number y, int timestamp);
+		
+		/**
+		* Moves the entity if it is being dragged. Used internally by the mouse move routing.
+		*/
+		void _updateDrag(Number x, Number y);
+		
+		/**
+		* Handles a mouse move for this entity only, without passing it on to its children. Used internally by the mouse move routing.
+		* @param x Horizontal mouse position in the parent's coordinates.
+		* @param y Vertical mouse position in the parent's coordinates.
+		* @param timestamp Time of the mouse move.
+		* @param event Event object to dispatch the resulting events with. It is reused instead of allocating one per event.
+		* @return True if the mouse is over the entity after the move.
+		*/
+		bool _handleMouseMove(Number x, Number y, int timestamp, InputEvent *event);
 	
 		virtual void onMouseDown(Number x, Number y){}
 		virtual void onMouseUp(Number x, Number y){}
@@ -90,10 +106,42 @@ class _PolyExport ScreenEntity : public Entity, public EventDispatcher {
 		virtual void onKeyUp(PolyKEY key, wchar_t charCode){}
 		
 		bool hitTest(Number x, Number y);		
+		
+		/**
+		* Returns the area tested by hitTest(), in the coordinates of the entity's parent.
+		*/
+		Rectangle getHitBounds();
 	
 		Matrix4 buildPositionMatrix();
 		void adjustMatrixForChildren();
 		
+		/**
+		* Returns how the entity is drawn by the screen's render batch. Possible values are ScreenEntity::RENDER_BATCH_GROUP, ScreenEntity::RENDER_BATCH_QUADS and ScreenEntity::RENDER_BATCH_NONE.
+		
+		Returns the mode set with setBatchMode(), RENDER_BATCH_NONE by default, so entities are drawn with transformAndRender() and Render() is called as usual.
+		*/
+		virtual int getBatchMode() { return batchMode; }
+		
+		/**
+		* Sets how the entity is drawn by the screen's render batch. Set RENDER_BATCH_GROUP on entities that have no geometry of their own and do not draw in Render(), so that their children can be batched.
+		* @param batchMode New batch mode.
+		*/
+		void setBatchMode(int batchMode);
+		
+		/**
+		* Adds the entity's own quads to a render batch. Called for entities that return RENDER_BATCH_QUADS from getBatchMode().
+		* @param batch Batch to add to.
+		* @param matrix Concatenated matrix of the entity, in screen space.
+		*/
+		virtual void addToBatch(ScreenRenderBatch *batch, const Matrix4 &matrix) {}
+		
+		/**
+		* Batched counterpart of transformAndRender(). Adds the entity and its children to a render batch, falling back to transformAndRender() for entities that cannot be batched. Used internally by Screen.
+		* @param batch Batch to add to.
+		* @param parentMatrix Concatenated matrix of the entity's parent, in screen space.
+		*/
+		void transformAndBatch(ScreenRenderBatch *batch, const Matrix4 &parentMatrix);
+		
 		/**
 		* Returns the width of the screen entity.
 		* @return Height of the screen entity.
@@ -110,19 +158,32 @@ class _PolyExport ScreenEntity : public Entity, public EventDispatcher {
 		* Sets the width of the screen entity.
 		* @param w New height value.
 		*/									
-		void setWidth(Number w) { width = w; hitwidth = w; }
+		void setWidth(Number w) { width = w; hitwidth = w; boundsChanged(); }
 		
 		/**
 		* Sets the height of the screen entity.
 		* @param h New height value.
 		*/									
-		void setHeight(Number h) { height = h; hitheight = h; }
+		void setHeight(Number h) { height = h; hitheight = h; boundsChanged(); }
+		
+		/**
+		* Sets the size of the area in which the entity receives mouse events, without changing the width and height of the entity.
+		* @param width New hit area width.
+		* @param height New hit area height.
+		*/
+		void setHitbox(Number width, Number height);
 	
 		virtual void onGainFocus(){}
 		virtual void onLoseFocus(){}		
 		
 		void startDrag(Number xOffset, Number yOffset);
 		void stopDrag();
+		bool isDragging() { return isDragged; }
+		
+		/**
+		* Returns true if the mouse was over the entity at the last mouse move.
+		*/
+		bool isMouseOver() { return mouseOver; }
 				
 		void setBlendingMode(int newBlendingMode);
 		
@@ -146,12 +207,21 @@ class _PolyExport ScreenEntity : public Entity, public EventDispatcher {
 		
 		static const int POSITION_TOPLEFT = 0;
 		static const int POSITION_CENTER = 1;
+		
+		static const int RENDER_BATCH_GROUP = 0;
+		static const int RENDER_BATCH_QUADS = 1;
+		static const int RENDER_BATCH_NONE = 2;
 
 		bool isFocusable();
 		
 		bool hasFocus;
 		bool blockMouseInput;
 		int zindex;	
+		
+		/**
+		* Used internally by the spatial index of the screen the entity is in.
+		*/
+		int spatialIndexId;
 	
 		/**
 		* If this option is true, the screen entity's positions will be roudnded to whole pixels. This only works if the screen is using pixel coordinates.
@@ -161,6 +231,7 @@ class _PolyExport ScreenEntity : public Entity, public EventDispatcher {
 
 	protected:
 	
+		int batchMode;
 		bool focusable;
 		bool focusChildren;
 		
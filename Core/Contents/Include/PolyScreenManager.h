@@ -50,6 +50,11 @@ namespace Polycode {
 		void addScreen(Screen* screen);
 		void Update();
 		
+		/**
+		* Updates all enabled screens without rendering them. Used by the core's fixed time step.
+		*/
+		void fixedUpdate();
+		
 		void handleEvent(Event *event);
 		
 		private:
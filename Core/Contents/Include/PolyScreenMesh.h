@@ -53,6 +53,12 @@ namespace Polycode {
 			
 			void Render();
 			
+			/**
+			* Returns ScreenEntity::RENDER_BATCH_QUADS if the mesh is a quad mesh made of 4 vertex polygons, otherwise ScreenEntity::RENDER_BATCH_NONE.
+			*/
+			virtual int getBatchMode();
+			virtual void addToBatch(ScreenRenderBatch *batch, const Matrix4 &matrix);
+			
 			/**
 			* Returns the mesh for this screen mesh.
 			* @return The mesh.
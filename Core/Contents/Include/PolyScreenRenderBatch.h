@@ -0,0 +1,126 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyGlobals.h"
+#include "PolyMatrix4.h"
+#include "PolyColor.h"
+
+namespace Polycode {
+
+	class Renderer;
+	class Texture;
+	class Mesh;
+	class RenderDataArray;
+	class ScreenEntity;
+
+	/**
+	* Collects 2D quads into one vertex stream. The Screen renders its entities through a render batch: instead of setting up its own matrix and state and issuing a draw call, every batchable entity transforms its quads on the CPU and appends them to the batch. The batch is drawn with a single indexed draw call whenever the texture or render state changes, when it is full, when an entity that has to render itself comes up, and at the end of the frame, so painter's order is kept.
+	*
+	* Sprites that share a texture (for example through a TextureAtlas) and render state are drawn together, which collapses most 2D screens into a handful of draw calls.
+	*/
+	class _PolyExport ScreenRenderBatch {
+		public:
+			ScreenRenderBatch();
+			~ScreenRenderBatch();
+			
+			/**
+			* Starts a new frame. The modelview matrix is expected to be identity while the batch is in use.
+			* @param renderer Renderer to draw with.
+			*/
+			void begin(Renderer *renderer);
+			
+			/**
+			* Draws everything that is still in the batch. Call this at the end of the frame.
+			*/
+			void end();
+			
+			/**
+			* Sets the texture and render state of the quads that are added next. If it differs from the state of the quads already in the batch, the batch is drawn first.
+			*/
+			void setState(Texture *texture, int blendingMode, bool depthWrite, bool depthTest, bool alphaTest, bool backfaceCulled);
+			
+			/**
+			* Adds the polygons of a quad mesh to the batch. Each polygon must have 4 vertices.
+			* @param mesh Mesh to add.
+			* @param matrix Transform of the mesh, from mesh space to screen space.
+			* @param color Color of the mesh. If the mesh uses vertex colors, they are used instead, same as in the unbatched path.
+			*/
+			void addMesh(Mesh *mesh, const Matrix4 &matrix, const Color &color);
+			
+			/**
+			* Draws the quads in the batch and empties it.
+			*/
+			void flush();
+			
+			/**
+			* Renders an entity that cannot be batched through its own transformAndRender(). The batch is drawn first to keep the drawing order.
+			* @param entity Entity to render.
+			* @param parentMatrix Concatenated matrix of the entity's parent, in screen space.
+			*/
+			void renderUnbatched(ScreenEntity *entity, const Matrix4 &parentMatrix);
+			
+			/**
+			* Returns the number of draw calls issued by the batch in the last frame.
+			*/
+			unsigned int getDrawCallCount() { return drawCallCount; }
+			
+			/**
+			* Returns the number of quads drawn through the batch in the last frame.
+			*/
+			unsigned int getQuadCount() { return totalQuadCount; }
+			
+			/**
+			* Returns the number of entities that rendered themselves in the last frame.
+			*/
+			unsigned int getUnbatchedCount() { return unbatchedCount; }
+			
+			/**
+			* Maximum number of quads in one draw call. Keeps the vertex indices within 16 bits.
+			*/
+			static const int MAX_QUADS = 16384;
+			
+		protected:
+		
+			void reserveQuads(unsigned int count);
+		
+			Renderer *renderer;
+			
+			RenderDataArray *vertexArray;
+			RenderDataArray *texCoordArray;
+			RenderDataArray *colorArray;
+			unsigned short *indices;
+			unsigned int quadCapacity;
+			unsigned int quadCount;
+			
+			Texture *texture;
+			int blendingMode;
+			bool depthWrite;
+			bool depthTest;
+			bool alphaTest;
+			bool backfaceCulled;
+			
+			unsigned int drawCallCount;
+			unsigned int totalQuadCount;
+			unsigned int unbatchedCount;
+	};
+}
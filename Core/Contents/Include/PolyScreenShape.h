@@ -51,6 +51,11 @@ namespace Polycode {
 			ScreenShape(int shapeType, Number option1=0, Number option2=0, Number option3=0, Number option4=0);
 			virtual ~ScreenShape();
 			void Render();
+			
+			/**
+			* Shapes with a stroke are not batched.
+			*/
+			int getBatchMode();
 
 			/**
 			* Sets the color of the shape stroke if it's enabled.
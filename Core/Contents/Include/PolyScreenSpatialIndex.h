@@ -0,0 +1,175 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyGlobals.h"
+#include "PolyScreenEntity.h"
+#include <vector>
+
+using std::vector;
+
+namespace Polycode {
+
+	/**
+	* Spatial index record of one screen entity. Used internally by ScreenSpatialIndex and Screen.
+	*/
+	class _PolyExport ScreenSpatialIndexEntry {
+		public:
+			ScreenSpatialIndexEntry();
+			
+			/**
+			* Returns true if all parents of the entity are enabled. Entities are enabled and disabled by setting their enabled member, so this is looked up on every call instead of being stored in the index.
+			*/
+			bool areParentsEnabled();
+			
+			/**
+			* Returns true if the entity and all its parents are enabled, so it can be hit by the mouse.
+			*/
+			bool isActive();
+			
+			/**
+			* Indexed entity, or NULL if the entry is unused.
+			*/
+			ScreenEntity *entity;
+			
+			/**
+			* Screen position of the entity's parent. Mouse positions are passed to the entity relative to this.
+			*/
+			Number originX;
+			Number originY;
+			
+			/**
+			* Hit area of the entity in screen coordinates.
+			*/
+			Number minX;
+			Number minY;
+			Number maxX;
+			Number maxY;
+			
+			/**
+			* True if the mouse was over the entity at the last routed mouse move.
+			*/
+			bool hovered;
+			
+			/**
+			* Index of the screen child the entity belongs to and the position of the entity in a depth first walk of the screen.
+			*/
+			int topIndex;
+			int order;
+			
+			int cellMode;
+			int cellMinX;
+			int cellMinY;
+			int cellMaxX;
+			int cellMaxY;
+			
+			unsigned int updateStamp;
+			unsigned int queryStamp;
+			
+			static const int CELLS_NONE = 0;
+			static const int CELLS_GRID = 1;
+			static const int CELLS_LARGE = 2;
+	};
+
+	/**
+	* Uniform grid over the hit areas of screen entities. Each entity is stored in the grid cells its hit area overlaps, so a point query only has to test the entities in one cell. Entities that would cover too many cells are kept in a separate list that is tested on every query.
+	*
+	* The index is rebuilt by walking the entity tree with beginUpdate(), updateEntity() and endUpdate(). Only entities whose hit area changed are moved in the grid and entities that were not visited during the walk are removed. Between rebuilds, updateEntity() can be called on its own for entities that moved.
+	*/
+	class _PolyExport ScreenSpatialIndex {
+		public:
+			/**
+			* Constructor.
+			* @param cellSize Size of a grid cell in screen units.
+			*/
+			ScreenSpatialIndex(Number cellSize = DEFAULT_CELL_SIZE);
+			~ScreenSpatialIndex();
+			
+			/**
+			* Starts a refresh of the index.
+			*/
+			void beginUpdate();
+			
+			/**
+			* Adds an entity to the index or updates its hit area.
+			* @param entity Entity to index.
+			* @param originX Horizontal screen position of the entity's parent.
+			* @param originY Vertical screen position of the entity's parent.
+			* @param topIndex Index of the screen child the entity belongs to.
+			* @param order Position of the entity in a depth first walk of the screen.
+			* @return Id of the entity's entry.
+			*/
+			int updateEntity(ScreenEntity *entity, Number originX, Number originY, int topIndex, int order);
+			
+			/**
+			* Finishes a refresh and removes all entities that were not updated since beginUpdate().
+			*/
+			void endUpdate();
+			
+			/**
+			* Finds the entities whose hit area contains a point.
+			* @param x Horizontal screen position.
+			* @param y Vertical screen position.
+			* @param activeOnly If true, only entities that are enabled and have enabled parents are returned.
+			* @param result Vector the entry ids are added to.
+			*/
+			void queryPoint(Number x, Number y, bool activeOnly, vector<int> &result);
+			
+			/**
+			* Returns the entry with the specified id.
+			*/
+			ScreenSpatialIndexEntry *getEntry(int id);
+			
+			/**
+			* Returns the number of indexed entities.
+			*/
+			unsigned int getNumEntities();
+			
+			/**
+			* Removes all entities from the index.
+			*/
+			void clear();
+			
+			static const int DEFAULT_CELL_SIZE = 64;
+			static const int NUM_BUCKETS = 4096;
+			static const int MAX_CELLS_PER_ENTITY = 64;
+			
+		protected:
+		
+			void insertEntry(int id);
+			void removeEntry(int id);
+			void removeFromBucket(int bucket, int id);
+			int getCell(Number val);
+			int getBucket(int cellX, int cellY);
+			
+			Number cellSize;
+			unsigned int numEntities;
+			unsigned int updateStamp;
+			unsigned int queryStamp;
+			
+			vector<ScreenSpatialIndexEntry> entries;
+			vector<int> freeEntries;
+			vector< vector<int> > buckets;
+			vector<int> largeEntries;
+	};
+
+}
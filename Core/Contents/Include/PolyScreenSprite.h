@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "PolyGlobals.h"
 #include "PolyCoreServices.h"
 #include "PolyScreenShape.h"
+#include "PolyTextureAtlas.h"
 #include <vector>
 #include <string>
 
@@ -37,6 +38,8 @@ class _PolyExport SpriteAnimation {
 		int numFrames;
 	
 		vector<Vector2> framesOffsets;
+		vector<Vector2> framesSizes;
+		vector<Vector2> framesShapeSizes;
 };
 
 /**
@@ -52,12 +55,20 @@ class _PolyExport ScreenSprite : public ScreenShape
 		* @param spriteWidth Pixel height of each sprite cell.		
 		*/
 		ScreenSprite(String fileName, Number spriteWidth, Number spriteHeight);
+		
+		/**
+		* Create a sprite that takes its frames from a texture atlas. Sprites created from the same atlas share its texture, so they are drawn together when the screen is batched. The sprite shows the first frame of the atlas until an animation is played. Atlas frames can differ in size, the sprite is resized for every frame so the frames are not stretched.
+		* @param atlas Atlas to take the frames from. It has to stay alive as long as the sprite.
+		* @param spriteWidth Width of the sprite when it shows the first frame of the atlas. Other frames are scaled by the same factor.
+		* @param spriteHeight Height of the sprite when it shows the first frame of the atlas. Other frames are scaled by the same factor.
+		*/
+		ScreenSprite(TextureAtlas *atlas, Number spriteWidth, Number spriteHeight);
 		~ScreenSprite();
 		
 		/**
-		* Adds a new animation to the sprite. Animations are added by specifying a list of frame indexes and then can be played back by the specified name.
+		* Adds a new animation to the sprite. Animations are added by specifying a list of frame indexes and then can be played back by the specified name. If the sprite was created from a texture atlas, the frames can also be given by their names in the atlas.
 		* @param name Name of the new animation.
-		* @param frames A comma separated list of frames indexes to include in the animation.
+		* @param frames A comma separated list of frames indexes or atlas frame names to include in the animation.
 		* @speed Speed at which to play back the animation.
 		*/
 		void addAnimation(String name, String frames, Number speed);
@@ -71,8 +82,17 @@ class _PolyExport ScreenSprite : public ScreenShape
 		void playAnimation(String name, int startFrame, bool once);
 		void Update();
 		
+		/**
+		* Shows a frame of the sprite's texture atlas without playing an animation.
+		* @param name Name of the atlas frame.
+		*/
+		void showAtlasFrame(String name);
+		
 	protected:
 	
+		void setFrameCoordinates(Vector2 uvOffset, Vector2 uvSize, Vector2 shapeSize);
+		Vector2 getAtlasFrameShapeSize(TextureAtlasFrame *frame);
+	
 		Number spriteWidth;
 		Number spriteHeight;
 			
@@ -85,6 +105,8 @@ class _PolyExport ScreenSprite : public ScreenShape
 		SpriteAnimation *currentAnimation;
 		
 		vector<SpriteAnimation*> animations;
+		TextureAtlas *atlas;
+		Vector2 atlasScale;
 };
 	
 }
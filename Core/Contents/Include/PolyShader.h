@@ -49,7 +49,6 @@ namespace Polycode {
 							
 		protected:
 		
-			String name;
 			int type;
 	};
 	
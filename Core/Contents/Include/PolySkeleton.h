@@ -29,25 +29,88 @@ THE SOFTWARE.
 #include <vector>
 #include "PolyBezierCurve.h"
 #include "PolyTween.h"
+#include "PolyQuaternionCurve.h"
 
 using std::string;
 using std::vector;
 
 namespace Polycode {
 	
-	class QuaternionTween;
-	class BezierPathTween;
+	class SkeletonAnimation;
 	
+	/**
+	* Animation curves of a single bone. The curves are baked into keyframes by the SkeletonAnimation the track is added to.
+	*/
 	class _PolyExport BoneTrack {
 		public:
 			BoneTrack(Bone *bone, Number length);
 			~BoneTrack();
+			
+			/**
+			* Enables the track.
+			*/
 			void Play();
+			
+			/**
+			* Disables the track. The bone keeps its current pose.
+			*/
 			void Stop();
+			
+			/**
+			* Applies the pose of the track at the current animation time to the bone.
+			*/
 			void Update();
 		
+			/**
+			* Sets a speed multiplier for this track, relative to the speed of the animation.
+			* @param speed Speed multiplier.
+			*/
 			void setSpeed(Number speed);
 			
+			/**
+			* Returns the speed multiplier of the track.
+			*/
+			Number getSpeed();
+			
+			/**
+			* Sets the blend weight of the track. Used to mask bones out of an animation when it is mixed with others.
+			* @param weight Weight between 0 and 1.
+			*/
+			void setWeight(Number weight);
+			
+			/**
+			* Returns the blend weight of the track.
+			*/
+			Number getWeight();
+			
+			/**
+			* Returns true if the track is enabled.
+			*/
+			bool isPlaying();
+			
+			/**
+			* Returns the bone animated by this track.
+			*/
+			Bone *getBone();
+			
+			/**
+			* Evaluates the curves of the track. Used for baking.
+			* @param time Time in seconds.
+			* @param key Array of SkeletonAnimation::KEY_SIZE floats to write the position and rotation to.
+			*/
+			void sampleCurves(Number time, float *key);
+			
+			/**
+			* Applies a baked key to the bone.
+			* @param key Position and rotation, as written by sampleCurves().
+			*/
+			void applyKey(const float *key);
+			
+			/**
+			* Sets the animation the track belongs to. Called by SkeletonAnimation::addBoneTrack().
+			*/
+			void setAnimation(SkeletonAnimation *animation, unsigned int trackIndex);
+			
 			BezierCurve *scaleX;
 			BezierCurve *scaleY;
 			BezierCurve *scaleZ;
@@ -69,7 +132,6 @@ namespace Polycode {
 		
 		
 			Quaternion boneQuat;
-			QuaternionTween *quatTween;
 			
 			Vector3 QuatWVec;
 			Vector3 QuatXVec;
@@ -80,12 +142,13 @@ namespace Polycode {
 		protected:
 		
 			Number length;
-		
-			bool initialized;
-		
+			Number speed;
+			Number weight;
+			bool playing;
 			Bone *targetBone;
-			vector <BezierPathTween*> pathTweens;
-		
+			QuaternionCurve *quatCurve;
+			SkeletonAnimation *animation;
+			unsigned int trackIndex;
 	};
 
 	/**
@@ -112,23 +175,134 @@ namespace Polycode {
 			* Plays the animation.
 			*/
 			void Play();			
+			
 			/**
 			* Stops the animation.
 			*/			
 			void Stop();
+			
+			/**
+			* Advances the animation time and poses all bones.
+			*/
 			void Update();
-
+			
 			/**
 			* Sets the animation multiplier speed.
 			* @param speed Number to multiply the animation speed by.
 			*/					
 			void setSpeed(Number speed);
 			
-		protected:
+			/**
+			* Bakes the curves of all tracks into uniformly sampled keyframes. Called when the animation is loaded; the animation is rebaked automatically if tracks are added later.
+			* @param samplesPerSecond Keyframes per second of animation.
+			*/
+			void bake(int samplesPerSecond = BAKE_SAMPLES_PER_SECOND);
+			
+			/**
+			* Poses the bones of all enabled tracks at the specified time in one pass over the baked keyframes.
+			* @param time Animation time in seconds.
+			*/
+			void evaluatePose(Number time);
+			
+			/**
+			* Poses the bone of a single track at the specified time.
+			* @param index Index of the track.
+			* @param time Animation time in seconds.
+			*/
+			void evaluateTrack(unsigned int index, Number time);
+			
+			/**
+			* Blends the pose of the animation at the current time over a pose buffer, with the weight of the animation multiplied by the weight of each track.
+			* @param pose Pose buffer with KEY_SIZE floats per bone, indexed by Bone::boneId.
+			* @param numBones Number of bones in the pose buffer.
+			*/
+			void blendPose(float *pose, unsigned int numBones);
+			
+			/**
+			* Advances the animation time and any weight fade in progress.
+			* @param elapsed Elapsed time in seconds.
+			*/
+			void advance(Number elapsed);
+			
+			/**
+			* Sets the blend weight of the animation and cancels any fade in progress.
+			* @param weight Weight between 0 and 1.
+			*/
+			void setWeight(Number weight);
 			
+			/**
+			* Returns the blend weight of the animation.
+			*/
+			Number getWeight();
+			
+			/**
+			* Fades the blend weight of the animation over time.
+			* @param weight Target weight.
+			* @param fadeTime Fade duration in seconds. If 0, the weight is set immediately.
+			*/
+			void fadeTo(Number weight, Number fadeTime);
+			
+			/**
+			* Returns true if the weight of the animation is still fading.
+			*/
+			bool isFading();
+			
+			/**
+			* Sets the blend weight of the tracks that animate a bone.
+			* @param bone Bone to mask.
+			* @param weight Weight between 0 and 1.
+			* @param includeChildren If true, the weight is also applied to all children of the bone.
+			*/
+			void setBoneMask(Bone *bone, Number weight, bool includeChildren);
+			
+			/**
+			* Returns the current animation time in seconds.
+			*/
+			Number getTime();
+			
+			/**
+			* Sets the current animation time.
+			* @param time New time in seconds.
+			*/
+			void setTime(Number time);
+			
+			/**
+			* Returns the duration of the animation in seconds.
+			*/
+			Number getDuration();
+			
+			/**
+			* Returns true if the animation is playing.
+			*/
+			bool isPlaying();
+			
+			/**
+			* Default number of baked keyframes per second.
+			*/
+			static const int BAKE_SAMPLES_PER_SECOND = 30;
+			
+			/**
+			* Number of floats in a baked key: position x, y, z and rotation w, x, y, z.
+			*/
+			static const int KEY_SIZE = 7;
+			
+		protected:
+		
+			void interpolateKey(unsigned int index, Number time, float *key);
+		
 			String name;
 			Number duration;
+			Number speed;
+			Number time;
+			Number weight;
+			Number targetWeight;
+			Number fadeRate;
+			bool playing;
 			vector<BoneTrack*> boneTracks;
+			
+			// keyframes laid out by sample, then track, so one pose reads two contiguous rows
+			vector<float> bakedKeys;
+			unsigned int numSamples;
 	};
 
 	/**
@@ -160,6 +334,53 @@ namespace Polycode {
 						
 			void playAnimationByIndex(int index);		
 			
+			/**
+			* Fades a loaded animation in over the animations that are playing and stops them once the fade is complete.
+			* @param animName Name of animation to fade to.
+			* @param fadeTime Crossfade duration in seconds.
+			*/
+			void crossfadeAnimation(String animName, Number fadeTime);
+			
+			/**
+			* Plays a loaded animation on top of the animations that are playing, or changes its weight if it is already playing. Animations are mixed in the order they were started, each one blending over the result of the previous ones by its weight.
+			* @param animName Name of animation to blend.
+			* @param weight Blend weight between 0 and 1.
+			* @param fadeTime Time in seconds to fade to the new weight.
+			*/
+			void blendAnimation(String animName, Number weight, Number fadeTime = 0);
+			
+			/**
+			* Stops a playing animation.
+			* @param animName Name of animation to stop.
+			* @param fadeTime Time in seconds to fade the animation out before stopping it.
+			*/
+			void stopAnimation(String animName, Number fadeTime = 0);
+			
+			/**
+			* Stops all playing animations.
+			*/
+			void stopAllAnimations();
+			
+			/**
+			* Sets the weight of a bone in an animation. Use this to restrict an animation layer to part of the skeleton.
+			* @param animName Name of the animation.
+			* @param boneName Name of the bone.
+			* @param weight Weight between 0 and 1.
+			* @param includeChildren If true, the weight is also applied to all children of the bone.
+			*/
+			void setAnimationBoneMask(String animName, String boneName, Number weight, bool includeChildren = true);
+			
+			/**
+			* Returns the number of animations being mixed.
+			*/
+			int getNumActiveAnimations();
+			
+			/**
+			* Returns an animation being mixed by its index, in mixing order.
+			* @param index Index of the animation.
+			*/
+			SkeletonAnimation *getActiveAnimation(int index);
+			
 			/**
 			* Loads in a new animation from a file and adds it to the skeleton.
 			* @param name Name of the new animation.
@@ -210,14 +431,72 @@ namespace Polycode {
 			* Returns the current animation.
 			*/
 			SkeletonAnimation *getCurrentAnimation() { return currentAnimation; }
+			
+			/**
+			* Recomputes the model space matrices of all bones, parents first. Called every frame by Update().
+			*/
+			void updateBoneMatrices();
+			
+			/**
+			* Evaluates the skeleton pose only every specified number of frames. Animation time still advances every frame.
+			* @param frames Number of frames between pose updates.
+			*/
+			void setUpdateInterval(int frames);
+			
+			/**
+			* Reduces the pose update rate with distance to the camera. Within nearDistance the pose is updated every frame, at farDistance and beyond every maxInterval frames.
+			* @param nearDistance Distance up to which the skeleton updates every frame.
+			* @param farDistance Distance at which the skeleton updates at the lowest rate.
+			* @param maxInterval Number of frames between pose updates at farDistance.
+			*/
+			void setUpdateLOD(Number nearDistance, Number farDistance, int maxInterval);
+			
+			/**
+			* Returns the number of frames between pose updates at the current camera distance.
+			*/
+			int getUpdateInterval();
+			
+			/**
+			* Returns a counter that is incremented every time the pose of the skeleton changes. Used by SceneMesh to skip skinning when the pose has not changed.
+			*/
+			unsigned int getPoseRevision();
+			
+			/**
+			* Marks the skeleton as rendered this frame. Called by SceneMesh when it renders the skeleton.
+			*/
+			void setRendered();
+			
+			/**
+			* If false, the pose is not evaluated while no mesh using the skeleton was rendered in the previous frame. Defaults to true.
+			*/
+			bool updateWhenCulled;
 		
 		protected:
 		
+			void startAnimation(SkeletonAnimation *anim, Number weight, Number fadeTime, bool exclusive);
+			void removeActiveAnimation(int index);
+			void evaluatePose();
+		
 			SceneEntity *bonesEntity;
 		
 			SkeletonAnimation *currentAnimation;
 			vector<Bone*> bones;
+			vector<Bone*> sortedBones;
 			vector<SkeletonAnimation*> animations;
+			
+			vector<SkeletonAnimation*> activeAnimations;
+			SkeletonAnimation *crossfadeTarget;
+			vector<float> bindPose;
+			vector<float> pose;
+			vector<float> lastPose;
+			
+			int updateInterval;
+			int framesSinceUpdate;
+			Number lodNearDistance;
+			Number lodFarDistance;
+			int lodMaxInterval;
+			bool rendered;
+			unsigned int poseRevision;
 	};
 
 }
\ No newline at end of file
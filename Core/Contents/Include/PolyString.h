@@ -41,6 +41,8 @@ namespace Polycode {
 
 	/**
 	* Unicode-friendly string. The Polycode String class wraps around STL wstring to support Unicode text in the engine. You can request data from it in different encodings (currently only UTF-8) or plain char data. It is mostly just a wrapper around STL created for easier Unicode support, LUA bindings and convenience methods.
+	
+	Conversions to char data, the hash and the interned symbol of the string are cached until the string is modified.
 	*/
 	class _PolyExport String {
 		public:
@@ -131,10 +133,10 @@ namespace Polycode {
 		
 			inline String operator + (const char *str) const { return String(contents + String(str).contents); }		
 			inline String operator + (const String &str) const { return String(contents + str.contents); }		
-			String operator += (const String &str) { contents = contents + str.contents; return *this; }		
-			String operator = (const String &str) {  contents = str.contents; return *this;}
-			inline bool operator == (const String &str) const {  return (str.contents == contents); }		
-			inline bool operator != (const String &str) const {  return (str.contents != contents); }		
+			String operator += (const String &str) { contents = contents + str.contents; contentsChanged(); return *this; }		
+			String operator = (const String &str) {  contents = str.contents; copyCaches(str); return *this;}
+			inline bool operator == (const String &str) const {  return !hashesDiffer(str) && (str.contents == contents); }		
+			inline bool operator != (const String &str) const {  return hashesDiffer(str) || (str.contents != contents); }		
 			inline wchar_t operator [] ( const size_t i ) const { return contents[i]; }
 
 			/**
@@ -214,14 +216,27 @@ namespace Polycode {
 			void setDataWithEncoding(char *data, int encoding);
 			
 			/**
-			* STL wstring version of the string.
-			*/																																					
-			wstring contents;	
+			* Returns a hash of the string. The hash is cached until the string changes.
+			*/
+			unsigned int getHash();
 			
 			/**
-			* STL string version of the string.
-			*/																																								
-			string s_contents;
+			* Returns the interned symbol of the string. Strings with the same contents always have the same symbol, so symbols can be compared instead of strings. Interned contents are kept for the lifetime of the program.
+			* @return Symbol of the string, never 0.
+			*/
+			unsigned int getSymbol();
+			
+			/**
+			* Returns the symbol of the string without interning it. Use this to look up strings that may never have been interned, so the symbol table does not grow with every lookup.
+			* @return Symbol of the string or 0 if no string with the same contents has been interned.
+			*/
+			unsigned int findSymbol();
+			
+			/**
+			* Replaces the contents of the string and drops the cached conversions, hash and symbol.
+			* @param str New contents.
+			*/
+			void setContents(const wstring &str);
 			
 			/**
 			* UTF-8 encoding.
@@ -231,9 +246,28 @@ namespace Polycode {
 		
 		protected:
 		
+			inline bool hashesDiffer(const String &str) const { return (cacheFlags & CACHED_HASH) && (str.cacheFlags & CACHED_HASH) && hash != str.hash; }
+			void copyCaches(const String &str);
+			void contentsChanged();
+			
+			static const unsigned int CACHED_NARROW = 1;
+			static const unsigned int CACHED_UTF8 = 2;
+			static const unsigned int CACHED_HASH = 4;
+			static const unsigned int CACHED_SYMBOL = 8;
+			
+			unsigned int cacheFlags;
+			string utf8Contents;
+			unsigned int hash;
+			unsigned int symbol;
+		
+		private:
+		
+			wstring contents;
+			string s_contents;
+		
 	};
 
-	static inline String operator+ (const char *str, const String &rstr) { return String(String(str).contents + rstr.contents); }
-	static inline String operator+ (const wchar_t *str, const String &rstr) { return String(String(str).contents + rstr.contents); }	
-	static inline String operator+ (const wchar_t str, const String &rstr) { wstring tmp=L" "; tmp[0] = str; return String(tmp + rstr.contents); }		
+	static inline String operator+ (const char *str, const String &rstr) { return String(str) + rstr; }
+	static inline String operator+ (const wchar_t *str, const String &rstr) { return String(str) + rstr; }	
+	static inline String operator+ (const wchar_t str, const String &rstr) { wstring tmp=L" "; tmp[0] = str; return String(tmp) + rstr; }		
 }
@@ -0,0 +1,129 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include "PolyString.h"
+#include "PolyGlobals.h"
+#include "PolyVector2.h"
+#include <vector>
+
+using std::vector;
+
+namespace Polycode {
+
+	class Texture;
+
+	/**
+	* A named rectangle in a TextureAtlas.
+	*/
+	class _PolyExport TextureAtlasFrame {
+		public:
+			/**
+			* Name of the frame.
+			*/
+			String name;
+			
+			/**
+			* Pixel rectangle of the frame in the atlas image, measured from the top-left corner.
+			*/
+			Number x;
+			Number y;
+			Number width;
+			Number height;
+			
+			/**
+			* Position and size of the frame in texture coordinates, with the position measured from the top-left corner like the pixel rectangle.
+			*/
+			Vector2 uvOffset;
+			Vector2 uvSize;
+	};
+
+	/**
+	* Many images packed into one texture. Sprites and images that take their frames from the same atlas share a texture, so the screen's render batch can draw all of them in one draw call instead of one per texture.
+	*
+	* Atlases are loaded from an XML description that names the image and lists its frames in pixels:
+	* <pre>
+	* &lt;atlas image="sprites.png"&gt;
+	*     &lt;frame name="walk_0" x="0" y="0" width="32" height="48"/&gt;
+	*     &lt;frame name="walk_1" x="32" y="0" width="32" height="48"/&gt;
+	* &lt;/atlas&gt;
+	* </pre>
+	* The image path is relative to the description file.
+	* @see ScreenSprite
+	*/
+	class _PolyExport TextureAtlas {
+		public:
+			/**
+			* Loads an atlas from an XML description.
+			* @param fileName Path to the atlas description.
+			*/
+			TextureAtlas(String fileName);
+			
+			/**
+			* Creates an empty atlas for a texture. Add frames with addFrame().
+			* @param texture Atlas texture.
+			*/
+			TextureAtlas(Texture *texture);
+			~TextureAtlas();
+			
+			/**
+			* Adds a frame.
+			* @param name Name of the frame.
+			* @param x Horizontal pixel position of the frame's top-left corner.
+			* @param y Vertical pixel position of the frame's top-left corner.
+			* @param width Pixel width of the frame.
+			* @param height Pixel height of the frame.
+			* @return The new frame.
+			*/
+			TextureAtlasFrame *addFrame(String name, Number x, Number y, Number width, Number height);
+			
+			/**
+			* Returns a frame by name, or NULL if there is no frame with that name.
+			*/
+			TextureAtlasFrame *getFrame(String name);
+			
+			/**
+			* Returns a frame by index, or NULL if the index is out of range. Frames are indexed in the order they were added.
+			*/
+			TextureAtlasFrame *getFrame(unsigned int index);
+			
+			/**
+			* Returns the number of frames.
+			*/
+			unsigned int getNumFrames();
+			
+			/**
+			* Returns the atlas texture.
+			*/
+			Texture *getTexture();
+			
+			/**
+			* Returns true if the atlas texture was loaded.
+			*/
+			bool isLoaded();
+			
+		protected:
+		
+			Texture *texture;
+			vector<TextureAtlasFrame*> frames;
+	};
+}
@@ -56,6 +56,11 @@ namespace Polycode {
 		bool isPaused();
 		
 		unsigned int getTicks();
+		
+		/**
+		* Called by the TimerManager when the timer is due. Dispatches the trigger event and schedules the next trigger.
+		* @param ticks Current ticks in milliseconds.
+		*/
 		void Update(unsigned int ticks);
 		
 		/**
@@ -71,8 +76,18 @@ namespace Polycode {
 
 		static const int EVENT_TRIGGER = 0;
 		
+		/**
+		* Timing wheel links. Used internally by the TimerManager.
+		*/
+		Timer *wheelNext;
+		Timer *wheelPrev;
+		Timer **wheelHead;
+		unsigned int wheelDeadline;
+		
 		protected:
 			
+			Event triggerEvent;
+			
 			int elapsed;
 			bool paused;
 			unsigned int msecs;
@@ -33,6 +33,9 @@ namespace Polycode {
 
 	class Timer;
 
+	/**
+	* Drives all timers from a hierarchical timing wheel. A trigger timer sits in the wheel slot of its next deadline, so each frame only the slots between the last and the current tick are visited, instead of every timer. Adding, removing and rescheduling a timer are constant time.
+	*/
 	class _PolyExport TimerManager {
 		public:
 		TimerManager();
@@ -42,8 +45,45 @@ namespace Polycode {
 		void addTimer(Timer *timer);
 		void Update();
 		
+		/**
+		* Schedules a timer to trigger at the given tick. If the timer is already scheduled, it is moved.
+		* @param timer Timer to schedule.
+		* @param deadline Tick in milliseconds at which the timer is due.
+		*/
+		void scheduleTimer(Timer *timer, unsigned int deadline);
+		
+		/**
+		* Removes a timer from the wheel without removing it from the manager.
+		* @param timer Timer to unschedule.
+		*/
+		void unscheduleTimer(Timer *timer);
+		
+		/**
+		* Returns the tick of the last manager update in milliseconds.
+		*/
+		unsigned int getTicks();
+		
+		/**
+		* Number of slots on each level of the wheel.
+		*/
+		static const unsigned int WHEEL_SIZE = 256;
+		
 		private:
 		
-		vector <Timer*> timers;
+		void linkTimer(Timer *timer, Timer **head);
+		void unlinkTimer(Timer *timer);
+		void placeTimer(Timer *timer);
+		void cascadeTimers(Timer **head);
+		void fireTimers(Timer **head, unsigned int ticks);
+		
+		Timer *nearTimers[WHEEL_SIZE];
+		Timer *farTimers[WHEEL_SIZE];
+		Timer *overflowTimers;
+		Timer *pendingTimers;
+		Timer *firingTimers;
+		
+		unsigned int currentTicks;
+		unsigned int frameTicks;
+		bool started;
 	};
 }
\ No newline at end of file
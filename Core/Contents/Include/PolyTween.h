@@ -50,8 +50,14 @@ namespace Polycode {
 		Tween(Number *target, int easeType, Number startVal, Number endVal, Number time, bool repeat=false);
 		~Tween();
 		
-		void handleEvent(Event *event);
 		Number interpolateTween();
+		
+		/**
+		* Advances the tween to the specified time. Called by the TweenManager every frame.
+		* @param tweenTime Current time of the tween in seconds. Wrapped around if the tween repeats.
+		* @param endTime Duration of the tween in seconds.
+		*/
+		void updateTween(Number &tweenTime, Number endTime);
 		virtual void updateCustomTween() {}
 		void doOnComplete();
 		
@@ -101,9 +107,14 @@ namespace Polycode {
 		*/
 		void setSpeed(Number speed);
 		
+		/**
+		* Index of the tween in the TweenManager, or -1 if it is not managed. Used internally by the TweenManager.
+		*/
+		int tweenIndex;
 
 	protected:
 	
+		Number interpolateAt(Number tweenTime, Number endTime);
 		
 		int easeType;
 		bool complete;
@@ -111,11 +122,8 @@ namespace Polycode {
 		Number cVal;
 		Number startVal;
 		Number actEndTime;
-		Number endTime;
 		Number *targetVal;
 		Number localTargetVal;
-		Number tweenTime;
-		Timer *tweenTimer;
 	};
 	
 	/**
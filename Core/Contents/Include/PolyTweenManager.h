@@ -32,14 +32,72 @@ namespace Polycode {
 
 	class Tween;
 
+	/**
+	* Advances all tweens. The tween clocks are kept in flat arrays that are advanced together once per frame, and all tweens that completed during the frame are retired in a single pass.
+	*/
 	class _PolyExport TweenManager {
 		public:
 			TweenManager();
 			~TweenManager();
 			void addTween(Tween *tween);
+			
+			/**
+			* Stops updating a tween. Called by the Tween destructor.
+			* @param tween Tween to remove.
+			*/
+			void removeTween(Tween *tween);
+			
 			void Update();
-		
+			
+			/**
+			* Advances all tweens by the specified time.
+			* @param elapsed Elapsed time in seconds.
+			*/
+			void updateTweens(Number elapsed);
+			
+			/**
+			* Returns the current time of a tween in seconds.
+			* @param index Index of the tween in the manager.
+			*/
+			Number getTweenTime(int index);
+			
+			/**
+			* Sets the current time of a tween.
+			* @param index Index of the tween in the manager.
+			* @param time New time in seconds.
+			*/
+			void setTweenTime(int index, Number time);
+			
+			/**
+			* Returns the duration of a tween in seconds.
+			* @param index Index of the tween in the manager.
+			*/
+			Number getTweenDuration(int index);
+			
+			/**
+			* Sets the duration of a tween.
+			* @param index Index of the tween in the manager.
+			* @param duration New duration in seconds.
+			*/
+			void setTweenDuration(int index, Number duration);
+			
+			/**
+			* Pauses or resumes a tween.
+			* @param index Index of the tween in the manager.
+			* @param paused If true, the tween time will not advance.
+			*/
+			void setTweenPaused(int index, bool paused);
+			
+			/**
+			* Returns the number of tweens being updated.
+			*/
+			unsigned int getNumTweens();
+			
 		private:
 			vector <Tween*> tweens;
+			vector <Number> tweenTimes;
+			vector <Number> tweenDurations;
+			vector <Number> tweenRates;
+			vector <Tween*> completedTweens;
 	};
 }
\ No newline at end of file
@@ -97,6 +97,7 @@ namespace Polycode {
 
 	class _PolyExport Win32Mutex : public CoreMutex {
 	public:
+		~Win32Mutex() { CloseHandle(winMutex); }
 		HANDLE winMutex; 
 	};
 
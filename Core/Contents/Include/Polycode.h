@@ -36,6 +36,8 @@
 #include "PolyTimer.h"
 #include "PolyTween.h"
 #include "PolyTweenManager.h"
+#include "PolyJobSystem.h"
+#include "PolyProfiler.h"
 #include "PolyResourceManager.h"
 #include "PolyCore.h"
 #include "PolyCoreInput.h"
@@ -46,9 +48,12 @@
 #include "PolyQuaternionCurve.h"
 #include "PolyRectangle.h"
 #include "PolyRenderer.h"
+#include "PolyNullRenderer.h"
 #include "PolyCoreServices.h"
 #include "PolyScreen.h"
 #include "PolyScreenEntity.h"
+#include "PolyScreenSpatialIndex.h"
+#include "PolyScreenRenderBatch.h"
 #include "PolyScreenLine.h"
 #include "PolyScreenMesh.h"
 #include "PolyScreenShape.h"
@@ -58,8 +63,10 @@
 #include "PolyScreenImage.h"
 #include "PolyScreenSprite.h"
 #include "PolyScreenLabel.h"
+#include "PolyProfilerOverlay.h"
 #include "PolyScreenCurve.h"
 #include "PolyTexture.h"
+#include "PolyTextureAtlas.h"
 #include "PolyMaterial.h"
 #include "PolyMesh.h"
 #include "PolyShader.h"
@@ -70,6 +77,7 @@
 #include "PolyScene.h"
 #include "PolySceneEntity.h"
 #include "PolySceneMesh.h"
+#include "PolySceneInstancedMesh.h"
 #include "PolySceneLine.h"
 #include "PolySceneLight.h"
 #include "PolySkeleton.h"
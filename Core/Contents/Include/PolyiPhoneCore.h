@@ -33,6 +33,7 @@ namespace Polycode {
 	
 	class _PolyExport PosixMutex : public CoreMutex {
 	public:
+		~PosixMutex() { pthread_mutex_destroy(&pMutex); }
 		pthread_mutex_t pMutex;
 	};
 	
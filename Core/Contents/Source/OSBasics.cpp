@@ -21,6 +21,14 @@
 */
 
 #include "OSBasics.h"
+#include <string.h>
+
+#if PLATFORM == PLATFORM_UNIX
+	#include <fcntl.h>
+#endif
+
+size_t OSBasics::bufferSize = 64 * 1024;
+size_t OSBasics::wholeFileReadSize = 256 * 1024;
 
 
 #ifdef _WINDOWS
@@ -65,14 +73,85 @@ void OSFILE::debugDump() {
 	long tellval = OSBasics::tell(this);
 	OSBasics::seek(this, 0, SEEK_SET);
 	
-	char buffer;
-	while(OSBasics::read(&buffer, 1, 1, this)) {
-		printf("%c", buffer);
+	long size;
+	char *buffer = OSBasics::readAll(this, &size);
+	if(buffer) {
+		fwrite(buffer, 1, size, stdout);
+		free(buffer);
 	}
 	
 	OSBasics::seek(this, tellval, SEEK_SET);
 }
 
+void OSBasics::setBufferSize(size_t size) {
+	bufferSize = size;
+}
+
+void OSBasics::setWholeFileReadSize(size_t size) {
+	wholeFileReadSize = size;
+}
+
+bool OSBasics::readWholeFile(OSFILE *stream, long length) {
+	char *data = (char*)malloc(length+1);
+	if(!data)
+		return false;
+	
+	size_t bytesRead = 0;
+	switch(stream->fileType) {
+		case OSFILE::TYPE_FILE:
+			bytesRead = fread(data, 1, length, stream->file);
+		break;
+		case OSFILE::TYPE_ARCHIVE_FILE:
+			bytesRead = PHYSFS_read(stream->physFSFile, data, 1, length);
+		break;
+	}
+	
+	if(bytesRead != (size_t)length) {
+		free(data);
+		seek(stream, 0, SEEK_SET);
+		return false;
+	}
+	
+	data[length] = 0;
+	stream->data = data;
+	stream->dataSize = length;
+	stream->dataPosition = 0;
+	return true;
+}
+
+char *OSBasics::readAll(OSFILE * stream, long *size) {
+	long position = tell(stream);
+	seek(stream, 0, SEEK_END);
+	long length = tell(stream) - position;
+	seek(stream, position, SEEK_SET);
+	if(length < 0)
+		length = 0;
+	
+	char *buffer = (char*)malloc(length+1);
+	if(!buffer)
+		return NULL;
+	
+	long bytesRead = read(buffer, 1, length, stream);
+	buffer[bytesRead] = 0;
+	if(size)
+		*size = bytesRead;
+	return buffer;
+}
+
+void OSBasics::adviseSequential(OSFILE * stream) {
+	switch(stream->fileType) {
+		case OSFILE::TYPE_FILE:
+#if PLATFORM == PLATFORM_UNIX && defined(POSIX_FADV_SEQUENTIAL)
+			posix_fadvise(fileno(stream->file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+		break;
+		case OSFILE::TYPE_ARCHIVE_FILE:
+			// larger inflate chunks for streams that will be read front to back
+			PHYSFS_setBuffer(stream->physFSFile, bufferSize * 4);
+		break;
+	}
+}
+
 OSFILE *OSBasics::open(String filename, String opts) {
 	OSFILE *retFile = NULL;
 	if(PHYSFS_exists(filename.c_str())) {
@@ -97,7 +176,16 @@ OSFILE *OSBasics::open(String filename, String opts) {
 					printf("Error opening file from archive (%s)\n", filename.c_str());
 					return NULL;		
 				}
+				PHYSFS_sint64 length = PHYSFS_fileLength(retFile->physFSFile);
+				if(length >= 0 && (size_t)length <= wholeFileReadSize && readWholeFile(retFile, (long)length)) {
+					PHYSFS_close(retFile->physFSFile);
+					retFile->physFSFile = NULL;
+					retFile->fileType = OSFILE::TYPE_MEMORY_FILE;
+					return retFile;
+				}
 			}
+			if(bufferSize > 0)
+				PHYSFS_setBuffer(retFile->physFSFile, bufferSize);
 			return retFile;
 		}
 	} else {
@@ -109,6 +197,20 @@ OSFILE *OSBasics::open(String filename, String opts) {
 		retFile = new OSFILE;
 		retFile->fileType = OSFILE::TYPE_FILE;
 		retFile->file = file;		
+		if(bufferSize > 0)
+			setvbuf(file, NULL, _IOFBF, bufferSize);
+		
+		bool readOnly = (opts.find("w") == string::npos && opts.find("a") == string::npos && opts.find("+") == string::npos);
+		if(readOnly && wholeFileReadSize > 0) {
+			fseek(file, 0, SEEK_END);
+			long length = ftell(file);
+			fseek(file, 0, SEEK_SET);
+			if(length >= 0 && (size_t)length <= wholeFileReadSize && readWholeFile(retFile, length)) {
+				fclose(file);
+				retFile->file = NULL;
+				retFile->fileType = OSFILE::TYPE_MEMORY_FILE;
+			}
+		}
 		return retFile;
 	}
 	
@@ -123,6 +225,10 @@ int OSBasics::close(OSFILE *file) {
 		case OSFILE::TYPE_ARCHIVE_FILE:
 			return PHYSFS_close(file->physFSFile);
 			break;			
+		case OSFILE::TYPE_MEMORY_FILE:
+			free(file->data);
+			file->data = NULL;
+			break;
 	}
 	return 0;
 }
@@ -135,6 +241,9 @@ long OSBasics::tell(OSFILE * stream) {
 		case OSFILE::TYPE_ARCHIVE_FILE:
 			return PHYSFS_tell(stream->physFSFile);
 			break;			
+		case OSFILE::TYPE_MEMORY_FILE:
+			return stream->dataPosition;
+			break;
 	}
 	return 0;
 }
@@ -147,6 +256,17 @@ size_t OSBasics::read( void * ptr, size_t size, size_t count, OSFILE * stream )
 		case OSFILE::TYPE_ARCHIVE_FILE:
 			return PHYSFS_read(stream->physFSFile, ptr, size, count);
 		break;			
+		case OSFILE::TYPE_MEMORY_FILE: {
+			if(size == 0)
+				return 0;
+			size_t available = (stream->dataSize - stream->dataPosition) / size;
+			if(count > available)
+				count = available;
+			memcpy(ptr, stream->data + stream->dataPosition, size * count);
+			stream->dataPosition += size * count;
+			return count;
+		}
+		break;
 	}
 	return 0;
 }
@@ -154,10 +274,10 @@ size_t OSBasics::read( void * ptr, size_t size, size_t count, OSFILE * stream )
 size_t OSBasics::write( const void * ptr, size_t size, size_t count, OSFILE * stream ) {
 	switch(stream->fileType) {
 		case OSFILE::TYPE_FILE:
-			fwrite(ptr, size, count, stream->file);
+			return fwrite(ptr, size, count, stream->file);
 			break;
 		case OSFILE::TYPE_ARCHIVE_FILE:
-			PHYSFS_write(stream->physFSFile, ptr, size, count);
+			return PHYSFS_write(stream->physFSFile, ptr, size, count);
 		break;			
 	}
 	return 0;
@@ -180,11 +300,22 @@ int OSBasics::seek(OSFILE * stream, long int offset, int origin ) {
 				break;
 				case SEEK_END: {
 					PHYSFS_sint64 fileLength =  PHYSFS_fileLength(stream->physFSFile);
-					return PHYSFS_seek(stream->physFSFile, fileLength-offset);
+					return PHYSFS_seek(stream->physFSFile, fileLength+offset);
 				}
 				break;
 			}
 			break;			
+		case OSFILE::TYPE_MEMORY_FILE: {
+			long position = offset;
+			if(origin == SEEK_CUR)
+				position = stream->dataPosition + offset;
+			else if(origin == SEEK_END)
+				position = stream->dataSize + offset;
+			if(position < 0 || position > stream->dataSize)
+				return -1;
+			stream->dataPosition = position;
+		}
+		break;
 	}
 	return 0;	
 }
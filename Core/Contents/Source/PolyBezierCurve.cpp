@@ -38,11 +38,13 @@ BezierPoint::BezierPoint(Number p1x, Number p1y, Number p1z, Number p2x, Number
 }
 
 BezierCurve::BezierCurve(){
-	for(int i=0; i < BUFFER_CACHE_PRECISION; i++) {
+	for(int i=0; i <= BUFFER_CACHE_PRECISION; i++) {
 		heightBuffer[i] = 0;
 	}
 	
 	buffersDirty = false;	
+	distancesDirty = false;
+	totalLength = 0;
 }
 
 BezierCurve::~BezierCurve() {
@@ -53,7 +55,7 @@ void BezierCurve::addControlPoint(Number p1x, Number p1y, Number p1z, Number p2x
 	BezierPoint* newPoint = new BezierPoint(p1x, p1y, p1z, p2x, p2y, p2z, p3x, p3y, p3z);
 	controlPoints.push_back(newPoint);
 	distances.push_back(0);
-	recalculateDistances();
+	distancesDirty = true;
 	buffersDirty = true;	
 }
 
@@ -75,31 +77,69 @@ void BezierCurve::addControlPoint2d(Number x, Number y) {
 
 
 void BezierCurve::recalculateDistances() {
+	distancesDirty = false;
 	if(controlPoints.size() < 2)
 		return;
+	
+	unsigned int numSegments = controlPoints.size()-1;
+	coefficients.resize(numSegments * 12);
+	for(int i=0; i < numSegments; i++) {
+		Number p0[3] = {controlPoints[i]->p2.x, controlPoints[i]->p2.y, controlPoints[i]->p2.z};
+		Number p1[3] = {controlPoints[i]->p3.x, controlPoints[i]->p3.y, controlPoints[i]->p3.z};
+		Number p2[3] = {controlPoints[i+1]->p1.x, controlPoints[i+1]->p1.y, controlPoints[i+1]->p1.z};
+		Number p3[3] = {controlPoints[i+1]->p2.x, controlPoints[i+1]->p2.y, controlPoints[i+1]->p2.z};
 		
-	Number dist, lastDist = 0;
+		Number *c = &coefficients[i*12];
+		for(int j=0; j < 3; j++) {
+			c[j] = p0[j];
+			c[3+j] = 3.0 * (p1[j] - p0[j]);
+			c[6+j] = 3.0 * (p0[j] - 2.0*p1[j] + p2[j]);
+			c[9+j] = p3[j] - p0[j] + 3.0 * (p1[j] - p2[j]);
+		}
+	}
+	
 	distances[0] = 0;
-	Number totalDistance = 0;
+	totalLength = 0;
 		
 	Vector3 point, lastPoint;
-	for(int i=0; i < controlPoints.size()-1; i++) {
-		lastPoint = getPointBetween(0, controlPoints[i], controlPoints[i+1]);
-		dist = 0;
-		for(Number a=0.0f; a < 1.0f; a += 0.01) {
-			point = getPointBetween(a, controlPoints[i], controlPoints[i+1]);
-			dist += point.distance(lastPoint);
+	for(int i=0; i < numSegments; i++) {
+		lastPoint = getPointInSegment(i, 0);
+		for(int j=1; j <= ARC_LENGTH_SAMPLES; j++) {
+			point = getPointInSegment(i, ((Number)j)/((Number)ARC_LENGTH_SAMPLES));
+			totalLength += point.distance(lastPoint);
 			lastPoint = point;
 		}
-		lastDist += dist;
-		distances[i+1] = lastDist;
-		totalDistance += dist;
+		distances[i+1] = totalLength;
 	}
 	
 	// normalize distances to total distance
 	for(int i=0; i < controlPoints.size(); i++) {
-		distances[i] = distances[i]/totalDistance;
+		if(totalLength > 0)
+			distances[i] = distances[i]/totalLength;
+		else
+			distances[i] = ((Number)i)/((Number)numSegments);
+	}
+}
+
+Vector3 BezierCurve::getPointInSegment(unsigned int segment, Number u) {
+	const Number *c = &coefficients[segment*12];
+	return Vector3(((c[9]*u + c[6])*u + c[3])*u + c[0],
+				((c[10]*u + c[7])*u + c[4])*u + c[1],
+				((c[11]*u + c[8])*u + c[5])*u + c[2]);
+}
+
+unsigned int BezierCurve::findSegment(Number a) {
+	// last segment that starts at or before a
+	unsigned int low = 0;
+	unsigned int high = controlPoints.size()-2;
+	while(low < high) {
+		unsigned int mid = (low + high + 1) / 2;
+		if(distances[mid] <= a)
+			low = mid;
+		else
+			high = mid-1;
 	}
+	return low;
 }
 
 Vector3 BezierCurve::getPointBetween(Number a, BezierPoint *bp1, BezierPoint *bp2) {
@@ -121,6 +161,12 @@ unsigned int BezierCurve::getNumControlPoints() {
 	return controlPoints.size();
 }
 
+Number BezierCurve::getLength() {
+	if(distancesDirty)
+		recalculateDistances();
+	return totalLength;
+}
+
 Number BezierCurve::getHeightAt(Number a) {
 	if( a< 0) a = 0;
 	if(a > 1) a = 1;
@@ -128,14 +174,34 @@ Number BezierCurve::getHeightAt(Number a) {
 	if (buffersDirty) 
 		rebuildBuffers();
 	
-	int index = ((Number)(BUFFER_CACHE_PRECISION)) * a;	
-	return heightBuffer[index];
+	Number position = ((Number)(BUFFER_CACHE_PRECISION)) * a;
+	int index = position;
+	if(index >= BUFFER_CACHE_PRECISION)
+		index = BUFFER_CACHE_PRECISION-1;
+	Number f = position - index;
+	return heightBuffer[index] + (heightBuffer[index+1] - heightBuffer[index]) * f;
+}
+
+void BezierCurve::getHeightsAt(const Number *a, Number *heights, unsigned int count) {
+	if (buffersDirty) 
+		rebuildBuffers();
 	
-//	return getPointAt(a).y;
+	for(unsigned int i=0; i < count; i++) {
+		Number position = a[i];
+		if(position < 0) position = 0;
+		if(position > 1) position = 1;
+		position *= (Number)BUFFER_CACHE_PRECISION;
+		
+		int index = position;
+		if(index >= BUFFER_CACHE_PRECISION)
+			index = BUFFER_CACHE_PRECISION-1;
+		Number f = position - index;
+		heights[i] = heightBuffer[index] + (heightBuffer[index+1] - heightBuffer[index]) * f;
+	}
 }
 
 void BezierCurve::rebuildBuffers() {
-	for(int i=0; i < BUFFER_CACHE_PRECISION; i++) {
+	for(int i=0; i <= BUFFER_CACHE_PRECISION; i++) {
 		heightBuffer[i]	= getPointAt(((Number)i)/((Number)BUFFER_CACHE_PRECISION)).y;
 	}
 	buffersDirty = false;
@@ -147,15 +213,40 @@ Vector3 BezierCurve::getPointAt(Number a) {
 	if(a > 1)
 		a = 1;
 		
-		
 	if(controlPoints.size() < 2)
 		return Vector3(0,0,0);
 	
-	Vector3 retVector;
-	for(int i=0; i < controlPoints.size()-1; i++) {
-		if(a >= distances[i] && a <= distances[i+1]) {
-			retVector = getPointBetween(1.0f-((a-distances[i])/(distances[i+1]-distances[i])), controlPoints[i], controlPoints[i+1]);
+	if(distancesDirty)
+		recalculateDistances();
+	
+	unsigned int segment = findSegment(a);
+	Number span = distances[segment+1] - distances[segment];
+	if(span <= 0)
+		return getPointInSegment(segment, 0);
+	return getPointInSegment(segment, (a - distances[segment]) / span);
+}
+
+void BezierCurve::getPointsAt(const Number *a, Vector3 *points, unsigned int count) {
+	if(controlPoints.size() < 2) {
+		for(unsigned int i=0; i < count; i++) {
+			points[i] = Vector3(0,0,0);
 		}
+		return;
+	}
+	
+	if(distancesDirty)
+		recalculateDistances();
+	
+	for(unsigned int i=0; i < count; i++) {
+		Number position = a[i];
+		if(position < 0) position = 0;
+		if(position > 1) position = 1;
+		
+		unsigned int segment = findSegment(position);
+		Number span = distances[segment+1] - distances[segment];
+		Number u = 0;
+		if(span > 0)
+			u = (position - distances[segment]) / span;
+		points[i] = getPointInSegment(segment, u);
 	}
-	return retVector;
 }
@@ -29,7 +29,9 @@ Bone::Bone(String boneName) : SceneEntity() {
 //	boneMesh = new ScenePrimitive(ScenePrimitive::TYPE_BOX, 0.1, 0.1, 0.1);
 	this->depthTest = false;
 	parentBone = NULL;
+	boneId = -1;
 	boneMatrix.identity();
+	finalMatrix.identity();
 //	addChild(boneMesh);
 	
 	boneMesh = new Mesh(Mesh::QUAD_MESH);
@@ -74,19 +76,37 @@ Matrix4 Bone::getBoneMatrix() {
 }
 
 Matrix4 Bone::getFinalMatrix() {
-	Matrix4 final = boneMatrix;
+	return finalMatrix;
+}
 
+bool Bone::rebuildFinalMatrix() {
+	Matrix4 lastMatrix = finalMatrix;
 	if(parentBone) {
-		final = final * parentBone->getFinalMatrix();
-	} 
-	
-	return final;
+		finalMatrix = boneMatrix * parentBone->finalMatrix;
+	} else {
+		finalMatrix = boneMatrix;
+	}
+	for(int i=0; i < 16; i++) {
+		if(finalMatrix.ml[i] != lastMatrix.ml[i])
+			return true;
+	}
+	return false;
 }
 
 void Bone::setBoneMatrix(Matrix4 matrix) {
 	boneMatrix = matrix;
 }
 
+void Bone::setPose(Quaternion rotation, Vector3 position) {
+	Matrix4 newMatrix = rotation.createMatrix();
+	newMatrix.m[3][0] = position.x;
+	newMatrix.m[3][1] = position.y;
+	newMatrix.m[3][2] = position.z;
+	
+	setBoneMatrix(newMatrix);
+	setTransformByMatrixPure(newMatrix);
+}
+
 void Bone::setBaseMatrix(Matrix4 matrix) {
 	baseMatrix = matrix;
 }
@@ -79,149 +79,28 @@ bool Camera::getOrthoMode() {
 }
 
 void Camera::buildFrustrumPlanes() {
+	getRendererFrustumPlanes(frustumPlanes);
+}
 
-	Matrix4 p; 
-	Matrix4 mv;
-	Matrix4 mvp;
-	Number t;
-
-	p = CoreServices::getInstance()->getRenderer()->getProjectionMatrix();
-    mv = CoreServices::getInstance()->getRenderer()->getModelviewMatrix();
-
-    //
-    // Concatenate the projection matrix and the model-view matrix to produce 
-    // a combined model-view-projection matrix.
-    //
-
-    mvp.ml[ 0] = mv.ml[ 0] * p.ml[ 0] + mv.ml[ 1] * p.ml[ 4] + mv.ml[ 2] * p.ml[ 8] + mv.ml[ 3] * p.ml[12];
-
-    mvp.ml[ 1] = mv.ml[ 0] * p.ml[ 1] + mv.ml[ 1] * p.ml[ 5] + mv.ml[ 2] * p.ml[ 9] + mv.ml[ 3] * p.ml[13];
-    mvp.ml[ 2] = mv.ml[ 0] * p.ml[ 2] + mv.ml[ 1] * p.ml[ 6] + mv.ml[ 2] * p.ml[10] + mv.ml[ 3] * p.ml[14];
-    mvp.ml[ 3] = mv.ml[ 0] * p.ml[ 3] + mv.ml[ 1] * p.ml[ 7] + mv.ml[ 2] * p.ml[11] + mv.ml[ 3] * p.ml[15];
-
-    mvp.ml[ 4] = mv.ml[ 4] * p.ml[ 0] + mv.ml[ 5] * p.ml[ 4] + mv.ml[ 6] * p.ml[ 8] + mv.ml[ 7] * p.ml[12];
-    mvp.ml[ 5] = mv.ml[ 4] * p.ml[ 1] + mv.ml[ 5] * p.ml[ 5] + mv.ml[ 6] * p.ml[ 9] + mv.ml[ 7] * p.ml[13];
-    mvp.ml[ 6] = mv.ml[ 4] * p.ml[ 2] + mv.ml[ 5] * p.ml[ 6] + mv.ml[ 6] * p.ml[10] + mv.ml[ 7] * p.ml[14];
-    mvp.ml[ 7] = mv.ml[ 4] * p.ml[ 3] + mv.ml[ 5] * p.ml[ 7] + mv.ml[ 6] * p.ml[11] + mv.ml[ 7] * p.ml[15];
-
-    mvp.ml[ 8] = mv.ml[ 8] * p.ml[ 0] + mv.ml[ 9] * p.ml[ 4] + mv.ml[10] * p.ml[ 8] + mv.ml[11] * p.ml[12];
-    mvp.ml[ 9] = mv.ml[ 8] * p.ml[ 1] + mv.ml[ 9] * p.ml[ 5] + mv.ml[10] * p.ml[ 9] + mv.ml[11] * p.ml[13];
-    mvp.ml[10] = mv.ml[ 8] * p.ml[ 2] + mv.ml[ 9] * p.ml[ 6] + mv.ml[10] * p.ml[10] + mv.ml[11] * p.ml[14];
-    mvp.ml[11] = mv.ml[ 8] * p.ml[ 3] + mv.ml[ 9] * p.ml[ 7] + mv.ml[10] * p.ml[11] + mv.ml[11] * p.ml[15];
-
-    mvp.ml[12] = mv.ml[12] * p.ml[ 0] + mv.ml[13] * p.ml[ 4] + mv.ml[14] * p.ml[ 8] + mv.ml[15] * p.ml[12];
-    mvp.ml[13] = mv.ml[12] * p.ml[ 1] + mv.ml[13] * p.ml[ 5] + mv.ml[14] * p.ml[ 9] + mv.ml[15] * p.ml[13];
-    mvp.ml[14] = mv.ml[12] * p.ml[ 2] + mv.ml[13] * p.ml[ 6] + mv.ml[14] * p.ml[10] + mv.ml[15] * p.ml[14];
-    mvp.ml[15] = mv.ml[12] * p.ml[ 3] + mv.ml[13] * p.ml[ 7] + mv.ml[14] * p.ml[11] + mv.ml[15] * p.ml[15];
-
-    //
-    // Extract the frustum's right clipping plane and normalize it.
-    //
-
-    frustumPlanes[0][0] = mvp.ml[ 3] - mvp.ml[ 0];
-    frustumPlanes[0][1] = mvp.ml[ 7] - mvp.ml[ 4];
-    frustumPlanes[0][2] = mvp.ml[11] - mvp.ml[ 8];
-    frustumPlanes[0][3] = mvp.ml[15] - mvp.ml[12];
-
-    t = (Number) sqrt( frustumPlanes[0][0] * frustumPlanes[0][0] + 
-                      frustumPlanes[0][1] * frustumPlanes[0][1] + 
-                      frustumPlanes[0][2] * frustumPlanes[0][2] );
-
-    frustumPlanes[0][0] /= t;
-    frustumPlanes[0][1] /= t;
-    frustumPlanes[0][2] /= t;
-    frustumPlanes[0][3] /= t;
-
-    //
-    // Extract the frustum's left clipping plane and normalize it.
-    //
-
-    frustumPlanes[1][0] = mvp.ml[ 3] + mvp.ml[ 0];
-    frustumPlanes[1][1] = mvp.ml[ 7] + mvp.ml[ 4];
-    frustumPlanes[1][2] = mvp.ml[11] + mvp.ml[ 8];
-    frustumPlanes[1][3] = mvp.ml[15] + mvp.ml[12];
-
-    t = (Number) sqrt( frustumPlanes[1][0] * frustumPlanes[1][0] + 
-                      frustumPlanes[1][1] * frustumPlanes[1][1] + 
-                      frustumPlanes[1][2] * frustumPlanes[1][2] );
-
-    frustumPlanes[1][0] /= t;
-    frustumPlanes[1][1] /= t;
-    frustumPlanes[1][2] /= t;
-    frustumPlanes[1][3] /= t;
-
-    //
-    // Extract the frustum's bottom clipping plane and normalize it.
-    //
-
-    frustumPlanes[2][0] = mvp.ml[ 3] + mvp.ml[ 1];
-    frustumPlanes[2][1] = mvp.ml[ 7] + mvp.ml[ 5];
-    frustumPlanes[2][2] = mvp.ml[11] + mvp.ml[ 9];
-    frustumPlanes[2][3] = mvp.ml[15] + mvp.ml[13];
-
-    t = (Number) sqrt( frustumPlanes[2][0] * frustumPlanes[2][0] + 
-                      frustumPlanes[2][1] * frustumPlanes[2][1] + 
-                      frustumPlanes[2][2] * frustumPlanes[2][2] );
-
-    frustumPlanes[2][0] /= t;
-    frustumPlanes[2][1] /= t;
-    frustumPlanes[2][2] /= t;
-    frustumPlanes[2][3] /= t;
-
-    //
-    // Extract the frustum's top clipping plane and normalize it.
-    //
-
-    frustumPlanes[3][0] = mvp.ml[ 3] - mvp.ml[ 1];
-    frustumPlanes[3][1] = mvp.ml[ 7] - mvp.ml[ 5];
-    frustumPlanes[3][2] = mvp.ml[11] - mvp.ml[ 9];
-    frustumPlanes[3][3] = mvp.ml[15] - mvp.ml[13];
-
-    t = (Number) sqrt( frustumPlanes[3][0] * frustumPlanes[3][0] + 
-                      frustumPlanes[3][1] * frustumPlanes[3][1] + 
-                      frustumPlanes[3][2] * frustumPlanes[3][2] );
-
-    frustumPlanes[3][0] /= t;
-    frustumPlanes[3][1] /= t;
-    frustumPlanes[3][2] /= t;
-    frustumPlanes[3][3] /= t;
-
-    //
-    // Extract the frustum's far clipping plane and normalize it.
-    //
-
-    frustumPlanes[4][0] = mvp.ml[ 3] - mvp.ml[ 2];
-    frustumPlanes[4][1] = mvp.ml[ 7] - mvp.ml[ 6];
-    frustumPlanes[4][2] = mvp.ml[11] - mvp.ml[10];
-    frustumPlanes[4][3] = mvp.ml[15] - mvp.ml[14];
-
-    t = (Number) sqrt( frustumPlanes[4][0] * frustumPlanes[4][0] +  
-                      frustumPlanes[4][1] * frustumPlanes[4][1] + 
-                      frustumPlanes[4][2] * frustumPlanes[4][2] );
-
-    frustumPlanes[4][0] /= t;
-    frustumPlanes[4][1] /= t;
-    frustumPlanes[4][2] /= t;
-    frustumPlanes[4][3] /= t;
-
-    //
-    // Extract the frustum's near clipping plane and normalize it.
-    //
-
-    frustumPlanes[5][0] = mvp.ml[ 3] + mvp.ml[ 2];
-    frustumPlanes[5][1] = mvp.ml[ 7] + mvp.ml[ 6];
-    frustumPlanes[5][2] = mvp.ml[11] + mvp.ml[10];
-    frustumPlanes[5][3] = mvp.ml[15] + mvp.ml[14];
-
-    t = (Number) sqrt( frustumPlanes[5][0] * frustumPlanes[5][0] + 
-                      frustumPlanes[5][1] * frustumPlanes[5][1] + 
-                      frustumPlanes[5][2] * frustumPlanes[5][2] );
-
-    frustumPlanes[5][0] /= t;
-    frustumPlanes[5][1] /= t;
-    frustumPlanes[5][2] /= t;
-    frustumPlanes[5][3] /= t;
-
+void Camera::getRendererFrustumPlanes(Number planes[6][4]) {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	Matrix4 mvp = renderer->getModelviewMatrix() * renderer->getProjectionMatrix();
+	
+	// right, left, top, bottom, far and near planes: the fourth column of
+	// the matrix minus or plus the column of the x, y and z axis
+	for(int p=0; p < 6; p++) {
+		int axis = p/2;
+		Number sign = (p % 2) ? 1.0 : -1.0;
+		for(int c=0; c < 4; c++) {
+			planes[p][c] = mvp.m[c][3] + sign * mvp.m[c][axis];
+		}
+		Number t = sqrt(planes[p][0]*planes[p][0] + planes[p][1]*planes[p][1] + planes[p][2]*planes[p][2]);
+		if(t > 0) {
+			for(int c=0; c < 4; c++) {
+				planes[p][c] /= t;
+			}
+		}
+	}
 }
 
 bool Camera::canSee(SceneEntity *entity) {
@@ -296,6 +175,7 @@ void Camera::drawFilter() {
 	parentScene->Render();
 	CoreServices::getInstance()->getRenderer()->unbindFramebuffers();
 
+	CoreServices::getInstance()->getRenderer()->beginGPUTimer(Renderer::GPU_TIMER_FILTER);
 	ShaderBinding* materialBinding;		
 	for(int i=0; i < filterShaderMaterial->getNumShaders(); i++) {
 		materialBinding = filterShaderMaterial->getShaderBinding(i);
@@ -314,7 +194,7 @@ void Camera::drawFilter() {
 		CoreServices::getInstance()->getRenderer()->clearShader();
 		CoreServices::getInstance()->getRenderer()->loadIdentity();
 	}
-
+	CoreServices::getInstance()->getRenderer()->endGPUTimer(Renderer::GPU_TIMER_FILTER);
 }
 
 void Camera::doCameraTransform() {
@@ -21,11 +21,23 @@
 */
 
 #include "PolyCore.h"
+#include "PolyProfiler.h"
+#include <algorithm>
+#include <math.h>
 #if defined(_WINDOWS) || defined(_MINGW)
 #include <windows.h>
-
+#elif defined(__APPLE__)
+#include <mach/mach_time.h>
+#include <unistd.h>
+#else
+#include <time.h>
+#include <unistd.h>
 #endif
 
+// time before a frame deadline at which doSleep() stops sleeping and spins,
+// since the OS may wake a sleeping thread late
+#define CORE_SLEEP_SPIN_MARGIN 2000000ULL
+
 namespace Polycode {
 	
 	Core::Core(int xRes, int yRes, bool fullScreen, int aaLevel, int frameRate) : EventDispatcher() {
@@ -41,9 +53,109 @@ namespace Polycode {
 		this->xRes = xRes;
 		this->yRes = yRes;
 		mouseEnabled = true;
-		lastSleepFrameTicks = 0;
+		idleHandler = NULL;
 		
-		refreshInterval = 1000 / frameRate;
+		fixedTimeStep = 0;
+		maxFixedSteps = 5;
+		fixedAccumulator = 0;
+		inFixedStep = false;
+		frameElapsed = 0;
+		frameTimeIndex = 0;
+		numFrameTimes = 0;
+		
+		clockStart = readClock();
+		lastFrameClock = 0;
+		nextFrameDeadline = 0;
+		setFrameRate(frameRate);
+	}
+	
+	void Core::setFrameRate(int frameRate) {
+		if(frameRate > 0)
+			frameInterval = (unsigned long long)(1000000000.0 / frameRate);
+		else
+			frameInterval = 0;
+	}
+	
+	void Core::setFixedTimeStep(Number timeStep) {
+		if(timeStep < 0)
+			timeStep = 0;
+		fixedTimeStep = timeStep;
+		fixedAccumulator = 0;
+	}
+	
+	Number Core::getFixedTimeStep() {
+		return fixedTimeStep;
+	}
+	
+	bool Core::isFixedTimeStepEnabled() {
+		return fixedTimeStep > 0;
+	}
+	
+	void Core::setMaxFixedSteps(int maxSteps) {
+		if(maxSteps < 1)
+			maxSteps = 1;
+		maxFixedSteps = maxSteps;
+	}
+	
+	Number Core::getInterpolationAlpha() {
+		if(fixedTimeStep <= 0)
+			return 0;
+		return fixedAccumulator / fixedTimeStep;
+	}
+	
+	CoreFrameStats Core::getFrameStats() {
+		CoreFrameStats stats;
+		if(numFrameTimes == 0)
+			return stats;
+		
+		vector<Number> times(frameTimes, frameTimes + numFrameTimes);
+		Number total = 0;
+		stats.minFrameTime = times[0];
+		stats.maxFrameTime = times[0];
+		for(int i=0; i < times.size(); i++) {
+			total += times[i];
+			if(times[i] < stats.minFrameTime)
+				stats.minFrameTime = times[i];
+			if(times[i] > stats.maxFrameTime)
+				stats.maxFrameTime = times[i];
+		}
+		stats.numFrames = numFrameTimes;
+		stats.averageFrameTime = total / numFrameTimes;
+		
+		int p99Index = (int)ceil(numFrameTimes * 0.99) - 1;
+		std::nth_element(times.begin(), times.begin() + p99Index, times.end());
+		stats.p99FrameTime = times[p99Index];
+		return stats;
+	}
+	
+	unsigned long long Core::readClock() {
+#if defined(_WINDOWS) || defined(_MINGW)
+		LARGE_INTEGER frequency;
+		LARGE_INTEGER counter;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&counter);
+		unsigned long long seconds = counter.QuadPart / frequency.QuadPart;
+		unsigned long long remainder = counter.QuadPart % frequency.QuadPart;
+		return seconds * 1000000000ULL + (remainder * 1000000000ULL) / frequency.QuadPart;
+#elif defined(__APPLE__)
+		static mach_timebase_info_data_t timebase;
+		if(timebase.denom == 0)
+			mach_timebase_info(&timebase);
+		unsigned long long ticks = mach_absolute_time();
+		return (ticks / timebase.denom) * timebase.numer + ((ticks % timebase.denom) * timebase.numer) / timebase.denom;
+#else
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+	}
+	
+	unsigned long long Core::getTicksNanoseconds() {
+		return readClock() - clockStart;
+	}
+	
+	unsigned long long Core::getFrameClock() {
+		return getTicksNanoseconds();
 	}
 	
 	void Core::enableMouse(bool newval) {
@@ -69,6 +181,7 @@ namespace Polycode {
 	Core::~Core() {
 		printf("Shutting down core");
 		delete services;
+		Logger::stopAsync();
 	}
 	
 	void Core::Shutdown() {	
@@ -76,7 +189,9 @@ namespace Polycode {
 	}
 	
 	Number Core::getElapsed() {
-		return ((Number)elapsed)/1000.0f;
+		if(inFixedStep)
+			return fixedTimeStep;
+		return frameElapsed;
 	}
 	
 	Number Core::getTicksFloat() {
@@ -92,13 +207,52 @@ namespace Polycode {
 	}
 	
 	void Core::updateCore() {
+#ifdef COMPILE_PROFILER
+		Profiler::getInstance()->beginFrame();
+#endif
+		PROFILE_SCOPE("Core::updateCore");
+		
 		frames++;
 		frameTicks = getTicks();
 		elapsed = frameTicks - lastFrameTicks;
 		
 		if(elapsed > 1000)
 			elapsed = 1000;
-		services->Update(elapsed);
+		
+		// the first frame has nothing to measure against, so it neither
+		// counts towards the stats nor runs fixed steps
+		unsigned long long frameClock = getFrameClock();
+		frameElapsed = 0;
+		if(lastFrameClock > 0) {
+			frameElapsed = ((Number)(frameClock - lastFrameClock)) / 1000000000.0;
+			if(frameElapsed > 1.0)
+				frameElapsed = 1.0;
+			frameTimes[frameTimeIndex] = frameElapsed;
+			frameTimeIndex = (frameTimeIndex + 1) % FRAME_STATS_WINDOW;
+			if(numFrameTimes < FRAME_STATS_WINDOW)
+				numFrameTimes++;
+		}
+		lastFrameClock = frameClock;
+		
+		if(fixedTimeStep > 0) {
+			fixedAccumulator += frameElapsed;
+			int steps = 0;
+			inFixedStep = true;
+			while(fixedAccumulator >= fixedTimeStep && steps < maxFixedSteps) {
+				services->fixedUpdate();
+				fixedAccumulator -= fixedTimeStep;
+				steps++;
+			}
+			inFixedStep = false;
+			
+			// too far behind, drop the backlog instead of spiraling
+			if(fixedAccumulator >= fixedTimeStep)
+				fixedAccumulator = fmod(fixedAccumulator, fixedTimeStep);
+			
+			services->Render(elapsed);
+		} else {
+			services->Update(elapsed);
+		}
 
 		if(frameTicks-lastFPSTicks >= 1000) {
 			fps = frames;
@@ -110,18 +264,38 @@ namespace Polycode {
 	}
 	
 	void Core::doSleep() {
-		unsigned int ticks = getTicks();
-		unsigned int ticksSinceLastFrame = ticks - lastSleepFrameTicks;
-		if(ticksSinceLastFrame <= refreshInterval)
+		PROFILE_SCOPE("Core::doSleep");
+		unsigned long long now = getTicksNanoseconds();
+		
+		// deadlines advance by a fixed interval so rounding does not drift,
+		// but more than a frame behind we start over instead of rushing frames
+		if(now > nextFrameDeadline + frameInterval)
+			nextFrameDeadline = now;
+		
+		if(idleHandler && now < nextFrameDeadline) {
+			idleHandler->handleIdle(((Number)(nextFrameDeadline - now)) / 1000000000.0);
+			now = getTicksNanoseconds();
+		}
+		
+		if(now + CORE_SLEEP_SPIN_MARGIN < nextFrameDeadline) {
+			unsigned long long sleepTime = nextFrameDeadline - now - CORE_SLEEP_SPIN_MARGIN;
 #if defined(_WINDOWS) || defined(_MINGW)
-		Sleep((refreshInterval - ticksSinceLastFrame));
+			Sleep((DWORD)(sleepTime / 1000000));
 #else
-			usleep((refreshInterval - ticksSinceLastFrame) * 1000);
+			usleep((useconds_t)(sleepTime / 1000));
 #endif
-		lastSleepFrameTicks = ticks;
+		}
+		while(getTicksNanoseconds() < nextFrameDeadline) {
+		}
+		
+		nextFrameDeadline += frameInterval;
 	}
 	
 	
+	void Core::setIdleHandler(CoreIdleHandler *handler) {
+		idleHandler = handler;
+	}
+	
 	Number Core::getFPS() {
 		return fps;
 	}
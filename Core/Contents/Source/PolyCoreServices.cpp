@@ -21,6 +21,7 @@
 */
 
 #include "PolyCoreServices.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
@@ -81,6 +82,12 @@ Config *CoreServices::getConfig() {
 	return config;
 }
 
+JobSystem *CoreServices::getJobSystem() {
+	if(!jobSystem)
+		jobSystem = new JobSystem(core);
+	return jobSystem;
+}
+
 void CoreServices::installModule(PolycodeModule *module)  {
 	modules.push_back(module);
 	switch(module->getType()) {
@@ -110,9 +117,11 @@ CoreServices::CoreServices() : EventDispatcher() {
 	tweenManager = new TweenManager();
 	soundManager = new SoundManager();
 	fontManager = new FontManager();
+	jobSystem = NULL;
 }
 
 CoreServices::~CoreServices() {
+	delete jobSystem;
 	delete materialManager;
 	delete screenManager;
 	delete sceneManager;
@@ -168,6 +177,8 @@ Renderer *CoreServices::getRenderer() {
 }
 
 void CoreServices::Update(int elapsed) {
+	if(jobSystem)
+		jobSystem->runMainThreadJobs();
 	timerManager->Update();
 	tweenManager->Update();
 	materialManager->Update(elapsed);
@@ -179,6 +190,25 @@ void CoreServices::Update(int elapsed) {
 	screenManager->Update();
 }
 
+void CoreServices::fixedUpdate() {
+	PROFILE_SCOPE("CoreServices::fixedUpdate");
+	timerManager->Update();
+	tweenManager->Update();
+	sceneManager->fixedUpdate();
+	screenManager->fixedUpdate();
+}
+
+void CoreServices::Render(int elapsed) {
+	if(jobSystem)
+		jobSystem->runMainThreadJobs();
+	materialManager->Update(elapsed);
+	renderer->setPerspectiveMode();
+	sceneManager->RenderVirtual();
+	renderer->clearScreen();
+	sceneManager->Render();
+	screenManager->Update();
+}
+
 SoundManager *CoreServices::getSoundManager() {
 	return soundManager;
 }
@@ -61,21 +61,15 @@ bool Data::saveToFile(String fileName) {
 
 void Data::loadFromFile(String fileName) {
 	OSFILE *file = OSBasics::open(fileName, "rb");
-	
-	OSBasics::seek(file, 0L, SEEK_END);
-	dataSize = OSBasics::tell(file);
-	OSBasics::seek(file, 0L, SEEK_SET);
+	if(!file)
+		return;
 	
 	if(data)
 		free(data);
 	
-	data = (char*)malloc(dataSize);
-	if(!data) {
-		OSBasics::close(file);		
-		return;
-	}
-	
-	OSBasics::read(data, sizeof(char), dataSize, file);	
+	data = OSBasics::readAll(file, &dataSize);
+	if(!data)
+		dataSize = 0;
 	OSBasics::close(file);
 		
 }
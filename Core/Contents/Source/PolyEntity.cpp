@@ -23,6 +23,7 @@
 
 using namespace Polycode;
 
+
 Entity::Entity() {
 	scale.set(1,1,1);
 	pitch = 0;
@@ -51,12 +52,44 @@ Entity::Entity() {
 	maskEntity = NULL;
 	isMask = false;
 	hasMask = false;
+	ownRevision = 0;
+	changeRevision = 0;
+	hierarchyVersion = 0;
+	boundsDirty = false;
+	childBoundsDirty = false;
+	lastVisible = visible;
+	lastEnabled = enabled;
 }
 
 Entity *Entity::getParentEntity() {
 	return parentEntity;
 }
 
+unsigned int Entity::getNumChildren() {
+	return children.size();
+}
+
+Entity *Entity::getChildAtIndex(unsigned int index) {
+	if(index >= children.size())
+		return NULL;
+	return children[index];
+}
+
+void Entity::hierarchyChanged() {
+	for(Entity *entity = this; entity; entity = entity->parentEntity) {
+		entity->hierarchyVersion++;
+	}
+}
+
+void Entity::boundsChanged() {
+	boundsDirty = true;
+	// the ancestors of an entity that is already marked are marked too,
+	// so moving many entities under one parent walks up only once
+	for(Entity *entity = parentEntity; entity && !entity->childBoundsDirty; entity = entity->parentEntity) {
+		entity->childBoundsDirty = true;
+	}
+}
+
 Color Entity::getCombinedColor() {
 	if(parentEntity) {
 		if(parentEntity->colorAffectsChildren)
@@ -111,6 +144,7 @@ void Entity::removeChild(Entity *entityToRemove) {
 			children.erase(children.begin()+i);
 		}
 	}	
+	hierarchyChanged();
 }
 
 void Entity::addChild(Entity *newChild) {
@@ -197,6 +231,8 @@ void Entity::rebuildTransformMatrix() {
 	Matrix4 posMatrix = buildPositionMatrix();
 
 	transformMatrix = scaleMatrix*transformMatrix*posMatrix;
+	if(matrixDirty)
+		ownRevision++;
 	matrixDirty = false;
 }
 
@@ -211,9 +247,19 @@ void Entity::updateEntityMatrix() {
 	if(matrixDirty)
 		rebuildTransformMatrix();
 	
+	if(visible != lastVisible || enabled != lastEnabled) {
+		lastVisible = visible;
+		lastEnabled = enabled;
+		ownRevision++;
+	}
+	
+	// a sum of counters that only go up changes whenever any of them does
+	unsigned int revision = ownRevision + getContentRevision();
 	for(int i=0; i < children.size(); i++) {
 		children[i]->updateEntityMatrix();
+		revision += children[i]->changeRevision;
 	}
+	changeRevision = revision;
 }
 
 Vector3 Entity::getCompoundScale() {
@@ -360,6 +406,7 @@ void Entity::addEntity(Entity *newChild) {
 	newChild->setRenderer(renderer);
 	newChild->setParentEntity(this);
 	children.push_back(newChild);
+	hierarchyChanged();
 	
 	if(hasMask) {
 		newChild->setMask(maskEntity);
@@ -477,7 +524,14 @@ Number Entity::getRoll() {
 }
 
 void Entity::setTransformByMatrixPure(Matrix4 matrix) {
-	transformMatrix = matrix;
+	// physics and animation set this every frame, also when nothing moved
+	for(int i=0; i < 16; i++) {
+		if(transformMatrix.ml[i] != matrix.ml[i]) {
+			transformMatrix = matrix;
+			ownRevision++;
+			return;
+		}
+	}
 }
 
 void Entity::setTransformByMatrix(Matrix4 matrix) {
@@ -498,21 +552,25 @@ void Entity::setTransformByMatrix(Matrix4 matrix) {
 void Entity::setPosition(Vector3 posVec) {
 	position = posVec;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void Entity::setPositionX(Number x) {
 	position.x = x;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void Entity::setPositionY(Number y) {
 	position.y = y;
 	matrixDirty = true;	
+	boundsChanged();
 }
 
 void Entity::setPositionZ(Number z) {
 	position.z = z;
 	matrixDirty = true;	
+	boundsChanged();
 }
 
 
@@ -537,11 +595,13 @@ void Entity::setPosition(Number x, Number y, Number z) {
 	position.y = y;
 	position.z = z;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void Entity::Translate(Vector3 tVec) {
 	position += tVec;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void Entity::Translate(Number x, Number y, Number z) {
@@ -549,6 +609,7 @@ void Entity::Translate(Number x, Number y, Number z) {
 	position.y += y;
 	position.z += z;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void Entity::Scale(Number x, Number y, Number z) {
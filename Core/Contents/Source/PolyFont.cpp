@@ -32,12 +32,9 @@ Font::Font(String fileName) {
 	buffer = NULL;
 	OSFILE *file = OSBasics::open(fileName, "rb");
 	if(file) {
-		OSBasics::seek(file, 0, SEEK_END);	
-		long progsize = OSBasics::tell(file);
-		OSBasics::seek(file, 0, SEEK_SET);
-		buffer = (unsigned char*)malloc(progsize);
-		memset(buffer, 0, progsize);
-		OSBasics::read(buffer, progsize, 1, file);
+		long progsize;
+		buffer = (unsigned char*)OSBasics::readAll(file, &progsize);
+		OSBasics::close(file);
 	
 		valid = true;
 		if(FT_New_Memory_Face(FTLibrary, buffer, progsize, 0, &ftFace) != 0) {
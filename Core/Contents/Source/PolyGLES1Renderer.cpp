@@ -228,6 +228,39 @@ void OpenGLES1Renderer::drawVertexBuffer(VertexBuffer *buffer) {
 	 */
 }
 
+void OpenGLES1Renderer::drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count) {
+	GLenum mode = GL_TRIANGLES;
+	switch(drawType) {
+		case Mesh::TRI_MESH:
+			mode = (renderMode == RENDER_MODE_WIREFRAME) ? GL_LINE_LOOP : GL_TRIANGLES;
+			break;
+		case Mesh::TRIFAN_MESH:
+			mode = (renderMode == RENDER_MODE_WIREFRAME) ? GL_LINE_LOOP : GL_TRIANGLE_FAN;
+			break;
+		case Mesh::TRISTRIP_MESH:
+			mode = (renderMode == RENDER_MODE_WIREFRAME) ? GL_LINE_LOOP : GL_TRIANGLE_STRIP;
+			break;
+		case Mesh::LINE_MESH:
+			mode = GL_LINES;
+			break;
+		case Mesh::POINT_MESH:
+			mode = GL_POINTS;
+			break;
+		default:
+			// OpenGL ES has no quads
+			return;
+	}
+	
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glDrawElements(mode, count, GL_UNSIGNED_SHORT, indices);
+	countDrawCall(drawType, count);
+	
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_NORMAL_ARRAY);
+	glDisableClientState(GL_COLOR_ARRAY);
+}
+
 void OpenGLES1Renderer::enableFog(bool enable) {
 	if(enable)
 		glEnable(GL_FOG);
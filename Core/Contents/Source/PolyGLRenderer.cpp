@@ -21,6 +21,7 @@
 */
 
 #include "PolyGLRenderer.h"
+#include <string.h>
 
 #ifdef _WINDOWS
 
@@ -62,6 +63,13 @@ PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC glFramebufferRenderbufferEXT;
 PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glGetFramebufferAttachmentParameterivEXT;
 PFNGLGENERATEMIPMAPEXTPROC glGenerateMipmapEXT;
 
+// ARB_occlusion_query, EXT_timer_query
+PFNGLGENQUERIESARBPROC glGenQueriesARB;
+PFNGLDELETEQUERIESARBPROC glDeleteQueriesARB;
+PFNGLBEGINQUERYARBPROC glBeginQueryARB;
+PFNGLENDQUERYARBPROC glEndQueryARB;
+PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT;
+
 #endif
 using namespace Polycode;
 
@@ -70,6 +78,19 @@ OpenGLRenderer::OpenGLRenderer() : Renderer() {
 	nearPlane = 0.1f;
 	farPlane = 100.0f;
 	verticesToDraw = 0;
+	
+	gpuTimersInitialized = false;
+	gpuTimersSupported = false;
+	timerQueryActive = false;
+	timerFrame = 0;
+	timerPassDepth = 0;
+	gpuTimesAvailable = false;
+	for(int i=0; i < GPU_TIMER_FRAMES; i++) {
+		numTimerQueries[i] = 0;
+	}
+	for(int i=0; i < GPU_TIMER_COUNT; i++) {
+		gpuTimes[i] = 0;
+	}
 }
 
 void OpenGLRenderer::setClippingPlanes(Number _nearPlane, Number _farPlane) {
@@ -116,6 +137,12 @@ void OpenGLRenderer::initOSSpecific(){
         glGetFramebufferAttachmentParameterivEXT = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)wglGetProcAddress("glGetFramebufferAttachmentParameterivEXT");
         glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC)wglGetProcAddress("glGenerateMipmapEXT");
 
+        glGenQueriesARB = (PFNGLGENQUERIESARBPROC)wglGetProcAddress("glGenQueriesARB");
+        glDeleteQueriesARB = (PFNGLDELETEQUERIESARBPROC)wglGetProcAddress("glDeleteQueriesARB");
+        glBeginQueryARB = (PFNGLBEGINQUERYARBPROC)wglGetProcAddress("glBeginQueryARB");
+        glEndQueryARB = (PFNGLENDQUERYARBPROC)wglGetProcAddress("glEndQueryARB");
+                glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)wglGetProcAddress("glGetQueryObjectui64vEXT");
+
 #endif
 }
 
@@ -134,6 +161,7 @@ void OpenGLRenderer::Resize(int xRes, int yRes) {
 	glMatrixMode(GL_MODELVIEW);
 	glLineWidth(1);
 	glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	currentBlendingMode = BLEND_MODE_NORMAL;
 	
 	glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);
 	glEnable(GL_BLEND);
@@ -297,6 +325,7 @@ void OpenGLRenderer::setLineSize(Number lineSize) {
 void OpenGLRenderer::createVertexBufferForMesh(Mesh *mesh) {
 	OpenGLVertexBuffer *buffer = new OpenGLVertexBuffer(mesh);
 	mesh->setVertexBuffer(buffer);
+	currentFrameStats.numBufferUploads++;
 }
 
 void OpenGLRenderer::drawVertexBuffer(VertexBuffer *buffer) {
@@ -359,6 +388,7 @@ void OpenGLRenderer::drawVertexBuffer(VertexBuffer *buffer) {
 	}	
 	
 	glDrawArrays( mode, 0, buffer->getVertexCount() );
+	countDrawCall(buffer->meshType, buffer->getVertexCount());
 	
 	glDisableClientState( GL_VERTEX_ARRAY);	
 	glDisableClientState( GL_TEXTURE_COORD_ARRAY );		
@@ -376,6 +406,12 @@ void OpenGLRenderer::enableFog(bool enable) {
 }
 
 void OpenGLRenderer::setBlendingMode(int blendingMode) {
+	if(blendingMode == currentBlendingMode) {
+		currentFrameStats.numRedundantStateSets++;
+		return;
+	}
+	currentBlendingMode = blendingMode;
+	
 	switch(blendingMode) {
 		case BLEND_MODE_NORMAL:
 				glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -414,6 +450,8 @@ void OpenGLRenderer::renderZBufferToTexture(Texture *targetTexture) {
 void OpenGLRenderer::renderToTexture(Texture *targetTexture) {
 	OpenGLTexture *glTexture = (OpenGLTexture*)targetTexture;
 	glBindTexture (GL_TEXTURE_2D, glTexture->getTextureID());
+	currentTexture = NULL;
+	currentFrameStats.numTextureBinds++;
 	glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 0, 0, targetTexture->getWidth(), targetTexture->getHeight(), 0);	
 
 }
@@ -503,11 +541,108 @@ void OpenGLRenderer::setPerspectiveMode() {
 }
 
 void OpenGLRenderer::BeginRender() {
+	beginFrameStats();
+	
+	if(!gpuTimersInitialized) {
+		initGPUTimers();
+	}
+	
+	if(gpuTimersSupported) {
+		timerFrame = (timerFrame + 1) % GPU_TIMER_FRAMES;
+		readGPUTimers(timerFrame);
+		
+		lastFrameStats.gpuTimersAvailable = gpuTimesAvailable;
+		lastFrameStats.gpuSceneTime = gpuTimes[GPU_TIMER_SCENE];
+		lastFrameStats.gpuScreenTime = gpuTimes[GPU_TIMER_SCREEN];
+		lastFrameStats.gpuFilterTime = gpuTimes[GPU_TIMER_FILTER];
+	}
+	
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	glLoadIdentity();
 	currentTexture = NULL;
 }
 
+void OpenGLRenderer::initGPUTimers() {
+	gpuTimersInitialized = true;
+	
+	const char *extensions = (const char*)glGetString(GL_EXTENSIONS);
+	if(!extensions || !strstr(extensions, "GL_EXT_timer_query")) {
+		Logger::log("GPU timer queries are not supported, GPU times will not be measured.\n");
+		return;
+	}
+	
+	for(int i=0; i < GPU_TIMER_FRAMES; i++) {
+		glGenQueriesARB(MAX_GPU_TIMER_QUERIES, timerQueries[i]);
+		numTimerQueries[i] = 0;
+	}
+	gpuTimersSupported = true;
+}
+
+void OpenGLRenderer::readGPUTimers(int frame) {
+	if(numTimerQueries[frame] == 0) {
+		return;
+	}
+	
+	// the queries of this frame slot were issued GPU_TIMER_FRAMES frames ago,
+	// so reading their results rarely has to wait for the GPU.
+	for(int i=0; i < GPU_TIMER_COUNT; i++) {
+		gpuTimes[i] = 0;
+	}
+	
+	for(int i=0; i < numTimerQueries[frame]; i++) {
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64vEXT(timerQueries[frame][i], GL_QUERY_RESULT_ARB, &elapsed);
+		gpuTimes[timerQueryPasses[frame][i]] += ((Number)elapsed) / 1000000.0;
+	}
+	numTimerQueries[frame] = 0;
+	gpuTimesAvailable = true;
+}
+
+void OpenGLRenderer::startTimerQuery(int pass) {
+	if(numTimerQueries[timerFrame] >= MAX_GPU_TIMER_QUERIES) {
+		return;
+	}
+	int index = numTimerQueries[timerFrame];
+	timerQueryPasses[timerFrame][index] = pass;
+	glBeginQueryARB(GL_TIME_ELAPSED_EXT, timerQueries[timerFrame][index]);
+	numTimerQueries[timerFrame]++;
+	timerQueryActive = true;
+}
+
+void OpenGLRenderer::stopTimerQuery() {
+	if(timerQueryActive) {
+		glEndQueryARB(GL_TIME_ELAPSED_EXT);
+		timerQueryActive = false;
+	}
+}
+
+void OpenGLRenderer::beginGPUTimer(int pass) {
+	if(!gpuTimersSupported || pass < 0 || pass >= GPU_TIMER_COUNT) {
+		return;
+	}
+	
+	// timer queries can not be nested, so the enclosing pass is suspended
+	// and resumed in endGPUTimer()
+	stopTimerQuery();
+	if(timerPassDepth < MAX_GPU_TIMER_DEPTH) {
+		timerPassStack[timerPassDepth] = pass;
+	}
+	timerPassDepth++;
+	startTimerQuery(pass);
+}
+
+void OpenGLRenderer::endGPUTimer(int pass) {
+	if(!gpuTimersSupported || timerPassDepth == 0) {
+		return;
+	}
+	
+	stopTimerQuery();
+	timerPassDepth--;
+	if(timerPassDepth > 0 && timerPassDepth <= MAX_GPU_TIMER_DEPTH) {
+		startTimerQuery(timerPassStack[timerPassDepth-1]);
+	}
+}
+
 void OpenGLRenderer::setClearColor(Number r, Number g, Number b) {
 	clearColor.setColor(r,g,b,1.0f);	
 	glClearColor(r,g,b,0.0f);
@@ -735,6 +870,9 @@ void OpenGLRenderer::setTexture(Texture *texture) {
 		if(currentTexture != texture) {			
 			OpenGLTexture *glTexture = (OpenGLTexture*)texture;
 			glBindTexture (GL_TEXTURE_2D, glTexture->getTextureID());
+			currentFrameStats.numTextureBinds++;
+		} else {
+			currentFrameStats.numRedundantStateSets++;
 		}
 	} else {
 		glDisable(GL_TEXTURE_2D);
@@ -753,6 +891,7 @@ void OpenGLRenderer::popMatrix() {
 
 void OpenGLRenderer::pushRenderDataArray(RenderDataArray *array) {
 		
+	currentFrameStats.numBufferUploads++;
 	
 	switch(array->arrayType) {
 		case RenderDataArray::VERTEX_DATA_ARRAY:
@@ -778,157 +917,41 @@ void OpenGLRenderer::pushRenderDataArray(RenderDataArray *array) {
 	}
 }
 
-RenderDataArray *OpenGLRenderer::createRenderDataArrayForMesh(Mesh *mesh, int arrayType) {
-	RenderDataArray *newArray = createRenderDataArray(arrayType);
-		
-	newArray->count = 0;
-	long bufferSize = 0;
-	long newBufferSize = 0;		
-	GLfloat* buffer = NULL;
-	
-	switch (arrayType) {
-		case RenderDataArray::VERTEX_DATA_ARRAY:
-		{		
-			buffer = (GLfloat*)malloc(1);							
-			for(int i=0; i < mesh->getPolygonCount(); i++) {
-				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
-					newArray->count++;			
-					newBufferSize = bufferSize + 3;
-					buffer = (GLfloat*)realloc(buffer, newBufferSize * sizeof(GLfloat));
-					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->x;
-					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->y;
-					buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->z;			
-					bufferSize = newBufferSize;	
-				}		   
-			}
-		}
-		break;
-		case RenderDataArray::COLOR_DATA_ARRAY:
-		{
-			buffer = (GLfloat*)malloc(1);			
-			for(int i=0; i < mesh->getPolygonCount(); i++) {
-				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
-					newBufferSize = bufferSize + 4;			
-					buffer = (GLfloat*)realloc(buffer, newBufferSize * sizeof(GLfloat));
-					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->vertexColor.r;
-					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->vertexColor.g;
-					buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->vertexColor.b;
-					buffer[bufferSize+3] = mesh->getPolygon(i)->getVertex(j)->vertexColor.a;			
-					bufferSize = newBufferSize;					
-				}		   
-			}
-		}
-		break;
-		case RenderDataArray::NORMAL_DATA_ARRAY:
-		{
-			buffer = (GLfloat*)malloc(1);	
-			
-			for(int i=0; i < mesh->getPolygonCount(); i++) {
-				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
-					newBufferSize = bufferSize + 3;			
-					buffer = (GLfloat*)realloc(buffer, newBufferSize * sizeof(GLfloat));		
-					if(mesh->getPolygon(i)->useVertexNormals) {
-						buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->normal.x;
-						buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->normal.y;
-						buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->normal.z;				
-					} else {
-						buffer[bufferSize+0] = mesh->getPolygon(i)->getFaceNormal().x;
-						buffer[bufferSize+1] = mesh->getPolygon(i)->getFaceNormal().y;
-						buffer[bufferSize+2] = mesh->getPolygon(i)->getFaceNormal().z;
-					}
-					bufferSize = newBufferSize;					
-				}		   
-			}			
-		}
-		break;
-		case RenderDataArray::TEXCOORD_DATA_ARRAY:
-		{
-			buffer = (GLfloat*)malloc(1);				
-			for(int i=0; i < mesh->getPolygonCount(); i++) {
-				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
-					newBufferSize = bufferSize + 2;			
-					buffer = (GLfloat*)realloc(buffer, newBufferSize * sizeof(GLfloat));		
-					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->getTexCoord().x;											
-					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->getTexCoord().y;							
-					bufferSize = newBufferSize;					
-				}		   
-			}			
-		}
-		break;
-		default:
-		break;
-	}
-	
-	if(buffer != NULL) {
-		free(newArray->arrayPtr);
-		newArray->arrayPtr = buffer;		
-	}
-	
-	return newArray;
-}
-
-RenderDataArray *OpenGLRenderer::createRenderDataArray(int arrayType) {
-	RenderDataArray *newArray = new RenderDataArray();
-	newArray->arrayType = arrayType;
-	newArray->arrayPtr = malloc(1);
-	newArray->stride = 0;
-	newArray->count = 0;
-	
-	switch (arrayType) {
-		case RenderDataArray::VERTEX_DATA_ARRAY:
-			newArray->size = 3;
-			break;
-		case RenderDataArray::COLOR_DATA_ARRAY:
-			newArray->size = 4;
-			break;			
-		case RenderDataArray::NORMAL_DATA_ARRAY:
-			newArray->size = 3;
-			break;						
-		case RenderDataArray::TEXCOORD_DATA_ARRAY:
-			newArray->size = 2;
-			break;									
-		default:
-			break;
-	}
-	
-	return newArray;
-}
-
 void OpenGLRenderer::setRenderArrayData(RenderDataArray *array, Number *arrayData) {
 	
 }
 
-void OpenGLRenderer::drawArrays(int drawType) {
+static GLenum getGLDrawMode(int drawType, int renderMode) {
 	
 	GLenum mode = GL_TRIANGLES;
 	
 	switch(drawType) {
 		case Mesh::TRI_MESH:
 			switch(renderMode) {
-				case RENDER_MODE_NORMAL:
+				case Renderer::RENDER_MODE_NORMAL:
 					mode = GL_TRIANGLES;
 					break;
-				case RENDER_MODE_WIREFRAME:
+				case Renderer::RENDER_MODE_WIREFRAME:
 					mode = GL_LINE_LOOP;
 					break;
 			}
 			break;
 		case Mesh::TRIFAN_MESH:
 			switch(renderMode) {
-				case RENDER_MODE_NORMAL:
+				case Renderer::RENDER_MODE_NORMAL:
 					mode = GL_TRIANGLE_FAN;
 					break;
-				case RENDER_MODE_WIREFRAME:
+				case Renderer::RENDER_MODE_WIREFRAME:
 					mode = GL_LINE_LOOP;
 					break;
 			}
 			break;
 		case Mesh::QUAD_MESH:
 			switch(renderMode) {
-				case RENDER_MODE_NORMAL:
+				case Renderer::RENDER_MODE_NORMAL:
 					mode = GL_QUADS;
 					break;
-				case RENDER_MODE_WIREFRAME:
+				case Renderer::RENDER_MODE_WIREFRAME:
 					mode = GL_LINE_LOOP;
 					break;
 			}
@@ -941,7 +964,31 @@ void OpenGLRenderer::drawArrays(int drawType) {
 		break;
 	}
 	
+	return mode;
+}
+
+void OpenGLRenderer::drawArrays(int drawType) {
+	
+	GLenum mode = getGLDrawMode(drawType, renderMode);
+	
 	glDrawArrays( mode, 0, verticesToDraw);	
+	countDrawCall(drawType, verticesToDraw);
+	
+	verticesToDraw = 0;
+		
+	glDisableClientState( GL_VERTEX_ARRAY);	
+	glDisableClientState( GL_TEXTURE_COORD_ARRAY );		
+	glDisableClientState( GL_NORMAL_ARRAY );
+	glDisableClientState( GL_COLOR_ARRAY );		
+}
+
+void OpenGLRenderer::drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count) {
+	
+	GLenum mode = getGLDrawMode(drawType, renderMode);
+	
+	glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+	glDrawElements(mode, count, GL_UNSIGNED_SHORT, indices);
+	countDrawCall(drawType, count);
 	
 	verticesToDraw = 0;
 		
@@ -1018,5 +1065,10 @@ void OpenGLRenderer::EndRender() {
 }
 
 OpenGLRenderer::~OpenGLRenderer() {
-
+	if(gpuTimersSupported) {
+		stopTimerQuery();
+		for(int i=0; i < GPU_TIMER_FRAMES; i++) {
+			glDeleteQueriesARB(MAX_GPU_TIMER_QUERIES, timerQueries[i]);
+		}
+	}
 }
\ No newline at end of file
@@ -43,6 +43,8 @@ using namespace Polycode;
 
 GLSLShaderBinding::GLSLShaderBinding(GLSLShader *shader) : ShaderBinding(shader) {
 	glslShader = shader;
+	slotShader = NULL;
+	slotParamCount = 0;
 }
 
 GLSLShaderBinding::~GLSLShaderBinding() {
@@ -54,22 +56,27 @@ void GLSLShaderBinding::addTexture(String name, Texture *texture) {
 	GLSLTextureBinding binding;
 	binding.name = name;
 	binding.texture = texture;
+	binding.slot = -1;
 //	binding.vpParam = GLSLGetNamedParameter(glslShader->fp->program, name.c_str());
 	textures.push_back(binding);
+	slotShader = NULL;
 }
 
 void GLSLShaderBinding::addCubemap(String name, Cubemap *cubemap) {
 	GLSLCubemapBinding binding;
 	binding.cubemap = cubemap;
 	binding.name = name;
+	binding.slot = -1;
 //	binding.vpParam = GLSLGetNamedParameter(GLSLShader->fp->program, name.c_str());
 	cubemaps.push_back(binding);
+	slotShader = NULL;
 }
 
 void GLSLShaderBinding::clearTexture(String name) {
 	for(int i=0; i < textures.size(); i++) {
 		if(textures[i].name == name) {
 			textures.erase(textures.begin()+i);
+			slotShader = NULL;
 			return;
 		}
 	}
@@ -85,6 +92,26 @@ void GLSLShaderBinding::addParam(String type, String name, String value) {
 	localParams.push_back(newParam);
 }
 
+void GLSLShaderBinding::resolveSlots(GLSLShader *shader) {
+	if(slotShader == shader && slotParamCount == localParams.size())
+		return;
+	
+	paramSlots.resize(shader->uniforms.size());
+	for(int i=0; i < shader->uniforms.size(); i++) {
+		paramSlots[i] = getLocalParamByName(shader->uniforms[i].param.name);
+	}
+	
+	for(int i=0; i < textures.size(); i++) {
+		textures[i].slot = shader->getSamplerSlot(textures[i].name);
+	}
+	for(int i=0; i < cubemaps.size(); i++) {
+		cubemaps[i].slot = shader->getSamplerSlot(cubemaps[i].name);
+	}
+	
+	slotShader = shader;
+	slotParamCount = localParams.size();
+}
+
 GLSLShader::GLSLShader(GLSLProgram *vp, GLSLProgram *fp) : Shader(Shader::MODULE_SHADER) {
 	this->vp = vp;
 	this->fp = fp;
@@ -93,6 +120,8 @@ GLSLShader::GLSLShader(GLSLProgram *vp, GLSLProgram *fp) : Shader(Shader::MODULE
     glAttachShader(shader_id, fp->program);
     glAttachShader(shader_id, vp->program);
     glLinkProgram(shader_id);	
+	
+	resolveUniforms();
 }
 
 GLSLShader::~GLSLShader() {
@@ -101,6 +130,49 @@ GLSLShader::~GLSLShader() {
 	glDeleteProgram(shader_id);	
 }
 
+void GLSLShader::addUniformSlots(GLSLProgram *program) {
+	for(int i=0; i < program->params.size(); i++) {
+		GLSLUniformSlot slot;
+		slot.param = program->params[i];
+		slot.location = glGetUniformLocation(shader_id, slot.param.name.c_str());
+		slot.uploaded = false;
+		slot.value[0] = slot.value[1] = slot.value[2] = 0;
+		uniforms.push_back(slot);
+	}
+}
+
+void GLSLShader::resolveUniforms() {
+	uniforms.clear();
+	addUniformSlots(vp);
+	addUniformSlots(fp);
+	
+	for(int i=0; i < samplers.size(); i++) {
+		samplers[i].location = glGetUniformLocation(shader_id, samplers[i].name.c_str());
+		samplers[i].unit = -1;
+	}
+	
+	char name[32];
+	for(int i=0; i < 4; i++) {
+		sprintf(name, "shadowMap%d", i);
+		shadowMapSlots[i] = getSamplerSlot(name);
+		sprintf(name, "shadowMatrix%d", i);
+		shadowMatrixLocations[i] = glGetUniformLocation(shader_id, name);
+	}
+}
+
+int GLSLShader::getSamplerSlot(String name) {
+	for(int i=0; i < samplers.size(); i++) {
+		if(samplers[i].name == name)
+			return i;
+	}
+	GLSLSamplerSlot slot;
+	slot.name = name;
+	slot.location = glGetUniformLocation(shader_id, name.c_str());
+	slot.unit = -1;
+	samplers.push_back(slot);
+	return samplers.size()-1;
+}
+
 ShaderBinding *GLSLShader::createBinding() {
 	return new GLSLShaderBinding(this);
 }
\ No newline at end of file
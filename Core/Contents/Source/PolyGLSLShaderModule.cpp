@@ -46,6 +46,7 @@ PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
 #endif
 
 GLSLShaderModule::GLSLShaderModule() : PolycodeShaderModule() {
+	currentProgram = 0;
 #ifdef _WINDOWS
 	glUseProgram   = (PFNGLUSEPROGRAMPROC)wglGetProcAddress("glUseProgram");
 	glUniform1i = (PFNGLUNIFORM1IPROC)wglGetProcAddress("glUniform1i");
@@ -131,7 +132,10 @@ Shader *GLSLShaderModule::createShader(TiXmlNode *node) {
 }
 
 void GLSLShaderModule::clearShader() {
+	if(currentProgram == 0)
+		return;
 	glUseProgram(0);
+	currentProgram = 0;
 }
 
 void GLSLShaderModule::setGLSLAreaLightPositionParameter(Renderer *renderer, GLSLProgramParam &param, int lightIndex) {
@@ -206,7 +210,8 @@ void GLSLShaderModule::setGLSLSpotLightTextureMatrixParameter(Renderer *renderer
 
 
 
-void GLSLShaderModule::updateGLSLParam(Renderer *renderer, GLSLShader *glslShader, GLSLProgramParam &param, ShaderBinding *materialOptions, ShaderBinding *localOptions) {
+void GLSLShaderModule::updateGLSLParam(Renderer *renderer, GLSLUniformSlot &slot, LocalShaderParam *materialParam, LocalShaderParam *localParam) {
+	GLSLProgramParam &param = slot.param;
 	if(param.isAuto) {
 		switch(param.autoID) {
 			case GLSLProgramParam::POLY_MODELVIEWPROJ_MATRIX:
@@ -334,36 +339,50 @@ void GLSLShaderModule::updateGLSLParam(Renderer *renderer, GLSLShader *glslShade
 				break;
 		}
 	} else {
+		if(slot.location == -1)
+			return;
+	
 		void *paramData = param.defaultData;
-		LocalShaderParam *localParam = materialOptions->getLocalParamByName(param.name);
-		if(localParam)
-			paramData = localParam->data;
-		localParam = localOptions->getLocalParamByName(param.name);
+		if(materialParam)
+			paramData = materialParam->data;
 		if(localParam)
 			paramData = localParam->data;
 		
-		Number *fval;
-		
 		switch(param.paramType) {
 			case GLSLProgramParam::PARAM_Number:
 			{
-				fval = (Number*)paramData;
-				int paramLocation = glGetUniformLocation(glslShader->shader_id, param.name.c_str());
-				glUniform1f(paramLocation, *fval);
+				Number *fval = (Number*)paramData;
+				if(slot.uploaded && slot.value[0] == *fval)
+					break;
+				glUniform1f(slot.location, *fval);
+				slot.value[0] = *fval;
+				slot.uploaded = true;
 				break;
 			}
 			case GLSLProgramParam::PARAM_Number3:
 			{
 				Vector3 *fval3 = (Vector3*)paramData;
-				fval = (Number*)paramData;
-				int paramLocation = glGetUniformLocation(glslShader->shader_id, param.name.c_str());
-				glUniform3f(paramLocation, fval3->x,fval3->y,fval3->z);
+				if(slot.uploaded && slot.value[0] == fval3->x && slot.value[1] == fval3->y && slot.value[2] == fval3->z)
+					break;
+				glUniform3f(slot.location, fval3->x,fval3->y,fval3->z);
+				slot.value[0] = fval3->x;
+				slot.value[1] = fval3->y;
+				slot.value[2] = fval3->z;
+				slot.uploaded = true;
 				break;				
 			}
 		}
 	}
 }
 
+void GLSLShaderModule::setGLSLSampler(GLSLShader *glslShader, int samplerSlot, int textureUnit) {
+	GLSLSamplerSlot &sampler = glslShader->samplers[samplerSlot];
+	if(sampler.location == -1 || sampler.unit == textureUnit)
+		return;
+	glUniform1i(sampler.location, textureUnit);
+	sampler.unit = textureUnit;
+}
+
 bool GLSLShaderModule::applyShaderMaterial(Renderer *renderer, Material *material, ShaderBinding *localOptions, unsigned int shaderIndex) {	
 
 	GLSLShader *glslShader = (GLSLShader*)material->getShader(shaderIndex);
@@ -434,11 +453,16 @@ bool GLSLShaderModule::applyShaderMaterial(Renderer *renderer, Material *materia
 
 	vector<LightInfo> spotLights = renderer->getSpotLights();
 //	vector<Texture*> shadowMapTextures = renderer->getShadowMapTextures();	
-	char texName[32];
-	char matName[32];	
 	int shadowMapTextureIndex = 0;
 					
-	glUseProgram(glslShader->shader_id);	
+	RendererFrameStats *frameStats = renderer->getCurrentFrameStats();
+	if(currentProgram != glslShader->shader_id) {
+		glUseProgram(glslShader->shader_id);
+		currentProgram = glslShader->shader_id;
+		frameStats->numShaderSwitches++;
+	} else {
+		frameStats->numRedundantStateSets++;
+	}
 	int textureIndex = 0;					
 					
 	for(int i=0; i < glslShader->numSpotLights; i++) {
@@ -489,35 +513,16 @@ bool GLSLShaderModule::applyShaderMaterial(Renderer *renderer, Material *materia
 		
 		if(light.shadowsEnabled) {		
 			if(shadowMapTextureIndex < 4) {
-				switch(shadowMapTextureIndex) {
-					case 0:
-						strcpy(texName, "shadowMap0");
-						strcpy(matName, "shadowMatrix0");						
-					break;
-					case 1:
-						strcpy(texName, "shadowMap1");
-						strcpy(matName, "shadowMatrix1");												
-					break;
-					case 2:
-						strcpy(texName, "shadowMap2");
-						strcpy(matName, "shadowMatrix2");																		
-					break;
-					case 3:
-						strcpy(texName, "shadowMap3");
-						strcpy(matName, "shadowMatrix3");																		
-					break;							
-				}
-			
-				int texture_location = glGetUniformLocation(glslShader->shader_id, texName);
-				glUniform1i(texture_location, textureIndex);
+				setGLSLSampler(glslShader, glslShader->shadowMapSlots[shadowMapTextureIndex], textureIndex);
 				glActiveTexture(GL_TEXTURE0 + textureIndex);		
 				glBindTexture(GL_TEXTURE_2D, ((OpenGLTexture*)light.shadowMapTexture)->getTextureID());	
+				frameStats->numTextureBinds++;
 				textureIndex++;
 				
 //				glMatrixMode(GL_MODELVIEW);
 //				glPushMatrix();
 //				glLoadMatrixd(light.textureMatrix.ml);			
-				int mloc = glGetUniformLocation(glslShader->shader_id, matName);				
+				int mloc = glslShader->shadowMatrixLocations[shadowMapTextureIndex];
 				
 				
 				light.textureMatrix = light.textureMatrix;
@@ -547,42 +552,38 @@ bool GLSLShaderModule::applyShaderMaterial(Renderer *renderer, Material *materia
 	glEnable(GL_TEXTURE_2D);
 		
 	GLSLShaderBinding *cgBinding = (GLSLShaderBinding*)material->getShaderBinding(shaderIndex);
+	GLSLShaderBinding *localBinding = (GLSLShaderBinding*)localOptions;
+	cgBinding->resolveSlots(glslShader);
+	localBinding->resolveSlots(glslShader);
 	
-	for(int i=0; i < glslShader->vp->params.size(); i++) {
-		GLSLProgramParam param = glslShader->vp->params[i];
-		updateGLSLParam(renderer, glslShader, param, material->getShaderBinding(shaderIndex), localOptions);
+	for(int i=0; i < glslShader->uniforms.size(); i++) {
+		updateGLSLParam(renderer, glslShader->uniforms[i], cgBinding->paramSlots[i], localBinding->paramSlots[i]);
 	}
 	
-	for(int i=0; i < glslShader->fp->params.size(); i++) {
-		GLSLProgramParam param = glslShader->fp->params[i];
-		updateGLSLParam(renderer, glslShader, param, material->getShaderBinding(shaderIndex), localOptions);
-	}	
-	
 	for(int i=0; i < cgBinding->textures.size(); i++) {
-		int texture_location = glGetUniformLocation(glslShader->shader_id, cgBinding->textures[i].name.c_str());
-		glUniform1i(texture_location, textureIndex);
+		setGLSLSampler(glslShader, cgBinding->textures[i].slot, textureIndex);
 		glActiveTexture(GL_TEXTURE0 + textureIndex);		
 		glBindTexture(GL_TEXTURE_2D, ((OpenGLTexture*)cgBinding->textures[i].texture)->getTextureID());	
+		frameStats->numTextureBinds++;
 		textureIndex++;
 	}	
 	
 		
 	for(int i=0; i < cgBinding->cubemaps.size(); i++) {
-		int texture_location = glGetUniformLocation(glslShader->shader_id, cgBinding->cubemaps[i].name.c_str());
-		glUniform1i(texture_location, textureIndex);
+		setGLSLSampler(glslShader, cgBinding->cubemaps[i].slot, textureIndex);
 		
 		glActiveTexture(GL_TEXTURE0 + textureIndex);	
 			
 		glBindTexture(GL_TEXTURE_CUBE_MAP, ((OpenGLCubemap*)cgBinding->cubemaps[i].cubemap)->getTextureID());	
+		frameStats->numTextureBinds++;
 		textureIndex++;
 	}	
 	
-	cgBinding = (GLSLShaderBinding*)localOptions;
-	for(int i=0; i < cgBinding->textures.size(); i++) {
-		int texture_location = glGetUniformLocation(glslShader->shader_id, cgBinding->textures[i].name.c_str());
-		glUniform1i(texture_location, textureIndex);
+	for(int i=0; i < localBinding->textures.size(); i++) {
+		setGLSLSampler(glslShader, localBinding->textures[i].slot, textureIndex);
 		glActiveTexture(GL_TEXTURE0 + textureIndex);		
-		glBindTexture(GL_TEXTURE_2D, ((OpenGLTexture*)cgBinding->textures[i].texture)->getTextureID());	
+		glBindTexture(GL_TEXTURE_2D, ((OpenGLTexture*)localBinding->textures[i].texture)->getTextureID());	
+		frameStats->numTextureBinds++;
 		textureIndex++;
 	}	
 
@@ -764,12 +765,16 @@ void GLSLShaderModule::reloadPrograms() {
 void GLSLShaderModule::recreateGLSLProgram(GLSLProgram *prog, String fileName, int type) {
 	
 	OSFILE *file = OSBasics::open(fileName, "r");
-	OSBasics::seek(file, 0, SEEK_END);	
-	long progsize = OSBasics::tell(file);
-	OSBasics::seek(file, 0, SEEK_SET);
-	char *buffer = (char*)malloc(progsize+1);
-	memset(buffer, 0, progsize+1);
-	OSBasics::read(buffer, progsize, 1, file);
+	if(!file) {
+		Logger::log("Error opening GLSL program %s\n", fileName.c_str());
+		return;
+	}
+	char *buffer = OSBasics::readAll(file, NULL);
+	OSBasics::close(file);
+	if(!buffer) {
+		Logger::log("Error reading GLSL program %s\n", fileName.c_str());
+		return;
+	}
 	
 	if(type == GLSLProgram::TYPE_VERT) {
 		prog->program =  glCreateShader(GL_VERTEX_SHADER);
@@ -0,0 +1,166 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyHeadlessCore.h"
+#include "PolyCoreServices.h"
+#include "PolyThreaded.h"
+#include "OSBasics.h"
+#include <stdio.h>
+
+using namespace Polycode;
+
+HeadlessCore::HeadlessCore(int xRes, int yRes, int frameRate) : Core(xRes, yRes, false, 0, frameRate) {
+	simulatedFrameTime = 0;
+	simulatedClock = 0;
+	
+	nullRenderer = new NullRenderer();
+	renderer = nullRenderer;
+	services->setRenderer(renderer);
+	
+	setVideoMode(xRes, yRes, false, 0);
+}
+
+HeadlessCore::~HeadlessCore() {
+
+}
+
+void HeadlessCore::setVideoMode(int xRes, int yRes, bool fullScreen, int aaLevel) {
+	this->xRes = xRes;
+	this->yRes = yRes;
+	renderer->Resize(xRes, yRes);
+}
+
+vector<Polycode::Rectangle> HeadlessCore::getVideoModes() {
+	vector<Polycode::Rectangle> retVector;
+	Rectangle res;
+	res.w = xRes;
+	res.h = yRes;
+	retVector.push_back(res);
+	return retVector;
+}
+
+void HeadlessCore::setSimulatedFrameTime(Number frameTime) {
+	if(frameTime > 0)
+		simulatedFrameTime = (unsigned long long)(frameTime * 1000000000.0);
+	else
+		simulatedFrameTime = 0;
+}
+
+Number HeadlessCore::getSimulatedFrameTime() {
+	return ((Number)simulatedFrameTime) / 1000000000.0;
+}
+
+NullRenderer *HeadlessCore::getNullRenderer() {
+	return nullRenderer;
+}
+
+unsigned long long HeadlessCore::getFrameClock() {
+	if(simulatedFrameTime > 0)
+		return simulatedClock;
+	return getTicksNanoseconds();
+}
+
+unsigned int HeadlessCore::getTicks() {
+	return (unsigned int)(getFrameClock() / 1000000);
+}
+
+bool HeadlessCore::Update() {
+	if(!running)
+		return false;
+	
+	simulatedClock += simulatedFrameTime;
+	
+	renderer->BeginRender();
+	updateCore();
+	renderer->EndRender();
+	
+	if(frameInterval > 0)
+		doSleep();
+	return running;
+}
+
+int HeadlessThreadFunc(void *data) {
+	Threaded *target = (Threaded*)data;
+	target->runThread();
+	return 1;
+}
+
+void HeadlessCore::createThread(Threaded *target) {
+	SDL_CreateThread(HeadlessThreadFunc, (void*)target);
+}
+
+void HeadlessCore::setCursor(int cursorType) {
+
+}
+
+void HeadlessCore::lockMutex(CoreMutex *mutex) {
+	HeadlessCoreMutex *hmutex = (HeadlessCoreMutex*)mutex;
+	SDL_mutexP(hmutex->pMutex);
+}
+
+void HeadlessCore::unlockMutex(CoreMutex *mutex) {
+	HeadlessCoreMutex *hmutex = (HeadlessCoreMutex*)mutex;
+	SDL_mutexV(hmutex->pMutex);
+}
+
+CoreMutex *HeadlessCore::createMutex() {
+	HeadlessCoreMutex *mutex = new HeadlessCoreMutex();
+	mutex->pMutex = SDL_CreateMutex();
+	return mutex;
+}
+
+void HeadlessCore::copyStringToClipboard(String str) {
+	clipboardString = str;
+}
+
+String HeadlessCore::getClipboardString() {
+	return clipboardString;
+}
+
+void HeadlessCore::createFolder(String folderPath) {
+	OSBasics::createFolder(folderPath);
+}
+
+void HeadlessCore::copyDiskItem(String itemPath, String destItemPath) {
+
+}
+
+void HeadlessCore::moveDiskItem(String itemPath, String destItemPath) {
+	rename(itemPath.c_str(), destItemPath.c_str());
+}
+
+void HeadlessCore::removeDiskItem(String itemPath) {
+	OSBasics::removeItem(itemPath);
+}
+
+String HeadlessCore::openFolderPicker() {
+	return "";
+}
+
+vector<string> HeadlessCore::openFilePicker(vector<CoreFileExtension> extensions, bool allowMultiple) {
+	vector<string> retVector;
+	return retVector;
+}
+
+void HeadlessCore::resizeTo(int xRes, int yRes) {
+	setVideoMode(xRes, yRes, false, 0);
+}
@@ -126,14 +126,54 @@ void Image::perlinNoise(int seed, bool alpha) {
 	Color pixelColor;
 	Number noiseVal;
 	
+	Number *noiseValues = (Number*)malloc(width*height*sizeof(Number));
+	perlin->fillGrid2D(noiseValues, width, height, 0.1, 0, 0.9f/((Number)width), ((Number)width)/((Number)height));
+	
 	for(int i=0; i < width*height;i++) {
-			noiseVal = fabs(1.0f/perlin->Get( 0.1+(0.9f/((Number)width)) * (i%width), (1.0f/((Number)height)) *   (i - (i%width))));
+			noiseVal = fabs(1.0f/noiseValues[i]);
 			if(alpha)
 				pixelColor.setColor(noiseVal, noiseVal, noiseVal, noiseVal);
 			else
 				pixelColor.setColor(noiseVal, noiseVal, noiseVal, 1.0f);
 			imageData32[i] = pixelColor.getUint();
 	}
+	free(noiseValues);
+	delete perlin;
+}
+
+void Image::fillNoise(Perlin *noise, bool tileable, bool alpha) {
+	// rows per band, keeping the scratch buffer small for large images
+	const int bandRows = 32;
+	
+	unsigned int *imageData32 = (unsigned int*)imageData;
+	Color pixelColor;
+	Number noiseVal;
+	
+	Number *noiseValues = (Number*)malloc(width*bandRows*sizeof(Number));
+	for(int startRow=0; startRow < height; startRow += bandRows) {
+		int numRows = height - startRow;
+		if(numRows > bandRows)
+			numRows = bandRows;
+			
+		if(tileable) {
+			noise->fillTileableGrid2D(noiseValues, width, height, startRow, numRows);
+		} else {
+			noise->fillGrid2D(noiseValues, width, numRows, 0, ((Number)startRow)/((Number)height), 1.0f/((Number)width), 1.0f/((Number)height));
+		}
+		
+		unsigned int *bandData = imageData32 + (startRow*width);
+		for(int i=0; i < width*numRows; i++) {
+			noiseVal = noiseValues[i] * 0.5f + 0.5f;
+			if(noiseVal < 0) noiseVal = 0;
+			if(noiseVal > 1) noiseVal = 1;
+			if(alpha)
+				pixelColor.setColor(noiseVal, noiseVal, noiseVal, noiseVal);
+			else
+				pixelColor.setColor(noiseVal, noiseVal, noiseVal, 1.0f);
+			bandData[i] = pixelColor.getUint();
+		}
+	}
+	free(noiseValues);
 }
 
 void Image::writeBMP(String fileName) {
@@ -0,0 +1,502 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyJobSystem.h"
+#include "PolyCore.h"
+#if defined(_WINDOWS) || defined(_MINGW)
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
+
+using namespace Polycode;
+
+namespace Polycode {
+
+	// condition variable idle workers sleep on, the Core only provides mutexes
+	class JobWakeup {
+		public:
+			JobWakeup() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				InitializeCriticalSection(&section);
+				InitializeConditionVariable(&condition);
+#else
+				pthread_mutex_init(&mutex, NULL);
+				pthread_cond_init(&condition, NULL);
+#endif
+			}
+			
+			~JobWakeup() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				DeleteCriticalSection(&section);
+#else
+				pthread_cond_destroy(&condition);
+				pthread_mutex_destroy(&mutex);
+#endif
+			}
+			
+			void lock() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				EnterCriticalSection(&section);
+#else
+				pthread_mutex_lock(&mutex);
+#endif
+			}
+			
+			void unlock() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				LeaveCriticalSection(&section);
+#else
+				pthread_mutex_unlock(&mutex);
+#endif
+			}
+			
+			// must be called with the lock held
+			void wait() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				SleepConditionVariableCS(&condition, &section, INFINITE);
+#else
+				pthread_cond_wait(&condition, &mutex);
+#endif
+			}
+			
+			void signal() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				WakeConditionVariable(&condition);
+#else
+				pthread_cond_signal(&condition);
+#endif
+			}
+			
+			void broadcast() {
+#if defined(_WINDOWS) || defined(_MINGW)
+				WakeAllConditionVariable(&condition);
+#else
+				pthread_cond_broadcast(&condition);
+#endif
+			}
+			
+		protected:
+#if defined(_WINDOWS) || defined(_MINGW)
+			CRITICAL_SECTION section;
+			CONDITION_VARIABLE condition;
+#else
+			pthread_mutex_t mutex;
+			pthread_cond_t condition;
+#endif
+	};
+}
+
+namespace {
+
+	// a range of a parallelFor() loop
+	class ParallelForJob : public Job {
+		public:
+			void run() { body->run(begin, end); }
+			
+			ParallelForBody *body;
+			int begin;
+			int end;
+	};
+	
+	void idleSleep() {
+#if defined(_WINDOWS) || defined(_MINGW)
+		Sleep(1);
+#else
+		usleep(200);
+#endif
+	}
+}
+
+Job::Job() {
+	mainThreadOnly = false;
+	counter = NULL;
+	dependency = NULL;
+}
+
+Job::~Job() {
+
+}
+
+JobWorker::JobWorker(JobSystem *jobSystem, int index) : Threaded() {
+	this->jobSystem = jobSystem;
+	this->index = index;
+	jobsMutex = jobSystem->getCore()->createMutex();
+	threadID = 0;
+	started = false;
+	finished = false;
+	idleCount = 0;
+}
+
+JobWorker::~JobWorker() {
+	delete jobsMutex;
+}
+
+void JobWorker::runThread() {
+	// the ids are published through the mutexes before any job is queued
+	jobSystem->getCore()->lockMutex(jobsMutex);
+	threadID = getThreadID();
+	started = true;
+	jobSystem->getCore()->unlockMutex(jobsMutex);
+	jobSystem->waitUntilReady();
+	
+	while(isRunning())
+		updateThread();
+	
+	jobSystem->getCore()->lockMutex(jobsMutex);
+	finished = true;
+	jobSystem->getCore()->unlockMutex(jobsMutex);
+}
+
+void JobWorker::killThread() {
+	jobSystem->getCore()->lockMutex(jobsMutex);
+	threadRunning = false;
+	jobSystem->getCore()->unlockMutex(jobsMutex);
+}
+
+bool JobWorker::isRunning() {
+	jobSystem->getCore()->lockMutex(jobsMutex);
+	bool running = threadRunning;
+	jobSystem->getCore()->unlockMutex(jobsMutex);
+	return running;
+}
+
+bool JobWorker::isFinished() {
+	jobSystem->getCore()->lockMutex(jobsMutex);
+	bool isDone = finished;
+	jobSystem->getCore()->unlockMutex(jobsMutex);
+	return isDone;
+}
+
+void JobWorker::updateThread() {
+	if(jobSystem->runNextJob()) {
+		idleCount = 0;
+		return;
+	}
+	// spin for a while before sleeping, new jobs usually come in bursts
+	idleCount++;
+	if(idleCount < 64)
+		return;
+	
+	// jobs queued after the generation was read wake the worker up again,
+	// jobs queued before it are found by the last look at the queues
+	unsigned int generation = jobSystem->getQueueGeneration();
+	if(!jobSystem->runNextJob())
+		jobSystem->waitForJobs(this, generation);
+	idleCount = 0;
+}
+
+JobSystem::JobSystem(Core *core, int numWorkers) {
+	this->core = core;
+	mainThreadID = getThreadID();
+	nextWorker = 0;
+	ready = false;
+	mainThreadMutex = core->createMutex();
+	counterMutex = core->createMutex();
+	wakeup = new JobWakeup();
+	queueGeneration = 0;
+	
+	if(numWorkers < 0)
+		numWorkers = getNumCPUCores() - 1;
+	if(numWorkers > MAX_WORKERS)
+		numWorkers = MAX_WORKERS;
+	
+	for(int i=0; i < numWorkers; i++) {
+		workers.push_back(new JobWorker(this, i));
+	}
+	for(int i=0; i < workers.size(); i++) {
+		core->createThread(workers[i]);
+	}
+	// job placement depends on knowing the worker thread ids
+	for(int i=0; i < workers.size(); i++) {
+		bool started = false;
+		while(!started) {
+			core->lockMutex(workers[i]->jobsMutex);
+			started = workers[i]->started;
+			core->unlockMutex(workers[i]->jobsMutex);
+			if(!started)
+				idleSleep();
+		}
+	}
+	core->lockMutex(mainThreadMutex);
+	ready = true;
+	core->unlockMutex(mainThreadMutex);
+	Logger::log("Started job system with %d workers\n", numWorkers);
+}
+
+JobSystem::~JobSystem() {
+	for(int i=0; i < workers.size(); i++) {
+		workers[i]->killThread();
+	}
+	wakeup->lock();
+	queueGeneration++;
+	wakeup->broadcast();
+	wakeup->unlock();
+	
+	// workers steal from each other until they finish, so none can be
+	// freed before all of them have stopped
+	for(int i=0; i < workers.size(); i++) {
+		while(!workers[i]->isFinished())
+			idleSleep();
+	}
+	for(int i=0; i < workers.size(); i++) {
+		delete workers[i];
+	}
+	delete wakeup;
+	delete mainThreadMutex;
+	delete counterMutex;
+}
+
+unsigned int JobSystem::getQueueGeneration() {
+	wakeup->lock();
+	unsigned int generation = queueGeneration;
+	wakeup->unlock();
+	return generation;
+}
+
+void JobSystem::waitForJobs(JobWorker *worker, unsigned int generation) {
+	wakeup->lock();
+	while(queueGeneration == generation && worker->isRunning())
+		wakeup->wait();
+	wakeup->unlock();
+}
+
+void JobSystem::waitUntilReady() {
+	bool isReady = false;
+	while(!isReady) {
+		core->lockMutex(mainThreadMutex);
+		isReady = ready;
+		core->unlockMutex(mainThreadMutex);
+		if(!isReady)
+			idleSleep();
+	}
+}
+
+Core *JobSystem::getCore() {
+	return core;
+}
+
+int JobSystem::getNumWorkers() {
+	return workers.size();
+}
+
+bool JobSystem::isMainThread() {
+	return getThreadID() == mainThreadID;
+}
+
+int JobSystem::getNumCPUCores() {
+#if defined(_WINDOWS) || defined(_MINGW)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+#else
+	long numCores = sysconf(_SC_NPROCESSORS_ONLN);
+	if(numCores < 1)
+		return 1;
+	return numCores;
+#endif
+}
+
+int JobSystem::getWorkerIndex() {
+	long threadID = getThreadID();
+	for(int i=0; i < workers.size(); i++) {
+		if(workers[i]->threadID == threadID)
+			return i;
+	}
+	return -1;
+}
+
+void JobSystem::submit(Job *job, JobCounter *counter, JobCounter *dependency) {
+	job->counter = counter;
+	job->dependency = dependency;
+	
+	core->lockMutex(counterMutex);
+	if(counter)
+		counter->count++;
+	if(dependency && dependency->count > 0) {
+		// queued once the dependency finishes
+		waitingJobs.push_back(job);
+		core->unlockMutex(counterMutex);
+		return;
+	}
+	core->unlockMutex(counterMutex);
+	
+	queueJob(job);
+}
+
+void JobSystem::queueJob(Job *job) {
+	if(job->mainThreadOnly || workers.size() == 0) {
+		core->lockMutex(mainThreadMutex);
+		mainThreadJobs.push_back(job);
+		core->unlockMutex(mainThreadMutex);
+		return;
+	}
+	
+	int workerIndex = getWorkerIndex();
+	if(workerIndex == -1) {
+		workerIndex = nextWorker % workers.size();
+		nextWorker = workerIndex + 1;
+	}
+	JobWorker *worker = workers[workerIndex];
+	core->lockMutex(worker->jobsMutex);
+	worker->jobs.push_back(job);
+	core->unlockMutex(worker->jobsMutex);
+	
+	wakeup->lock();
+	queueGeneration++;
+	wakeup->signal();
+	wakeup->unlock();
+}
+
+Job *JobSystem::takeJob(int workerIndex, bool mainThread) {
+	Job *job = NULL;
+	
+	if(mainThread) {
+		core->lockMutex(mainThreadMutex);
+		if(mainThreadJobs.size() > 0) {
+			job = mainThreadJobs.front();
+			mainThreadJobs.pop_front();
+		}
+		core->unlockMutex(mainThreadMutex);
+		if(job)
+			return job;
+	}
+	
+	// newest job from our own queue, it is most likely still in the cache
+	if(workerIndex != -1) {
+		JobWorker *worker = workers[workerIndex];
+		core->lockMutex(worker->jobsMutex);
+		if(worker->jobs.size() > 0) {
+			job = worker->jobs.back();
+			worker->jobs.pop_back();
+		}
+		core->unlockMutex(worker->jobsMutex);
+		if(job)
+			return job;
+	}
+	
+	// oldest job of another worker, which tends to be the biggest piece of work
+	for(int i=1; i <= workers.size(); i++) {
+		JobWorker *victim = workers[(workerIndex + i) % workers.size()];
+		core->lockMutex(victim->jobsMutex);
+		if(victim->jobs.size() > 0) {
+			job = victim->jobs.front();
+			victim->jobs.pop_front();
+		}
+		core->unlockMutex(victim->jobsMutex);
+		if(job)
+			return job;
+	}
+	return NULL;
+}
+
+void JobSystem::runJob(Job *job) {
+	JobCounter *counter = job->counter;
+	job->run();
+	if(!counter)
+		return;
+	
+	// the job may be deleted as soon as its counter finishes, so it is not
+	// touched after this point
+	vector<Job*> readyJobs;
+	core->lockMutex(counterMutex);
+	counter->count--;
+	if(counter->count == 0) {
+		for(int i=0; i < waitingJobs.size(); i++) {
+			if(waitingJobs[i]->dependency == counter) {
+				readyJobs.push_back(waitingJobs[i]);
+				waitingJobs.erase(waitingJobs.begin()+i);
+				i--;
+			}
+		}
+	}
+	core->unlockMutex(counterMutex);
+	
+	for(int i=0; i < readyJobs.size(); i++) {
+		queueJob(readyJobs[i]);
+	}
+}
+
+bool JobSystem::runNextJob() {
+	Job *job = takeJob(getWorkerIndex(), isMainThread());
+	if(!job)
+		return false;
+	runJob(job);
+	return true;
+}
+
+bool JobSystem::isFinished(JobCounter *counter) {
+	core->lockMutex(counterMutex);
+	bool finished = (counter->count == 0);
+	core->unlockMutex(counterMutex);
+	return finished;
+}
+
+void JobSystem::wait(JobCounter *counter) {
+	while(!isFinished(counter)) {
+		if(!runNextJob()) {
+			// the remaining jobs are running on other threads
+			idleSleep();
+		}
+	}
+}
+
+void JobSystem::runMainThreadJobs() {
+	vector<Job*> jobs;
+	core->lockMutex(mainThreadMutex);
+	jobs.assign(mainThreadJobs.begin(), mainThreadJobs.end());
+	mainThreadJobs.clear();
+	core->unlockMutex(mainThreadMutex);
+	
+	for(int i=0; i < jobs.size(); i++) {
+		runJob(jobs[i]);
+	}
+}
+
+void JobSystem::parallelFor(int begin, int end, int grainSize, ParallelForBody *body) {
+	if(end <= begin)
+		return;
+	int count = end - begin;
+	if(grainSize <= 0) {
+		grainSize = count / ((workers.size() + 1) * 4);
+		if(grainSize < 1)
+			grainSize = 1;
+	}
+	if(count <= grainSize || workers.size() == 0) {
+		body->run(begin, end);
+		return;
+	}
+	
+	int numRanges = (count + grainSize - 1) / grainSize;
+	vector<ParallelForJob> jobs(numRanges);
+	JobCounter counter;
+	for(int i=0; i < numRanges; i++) {
+		jobs[i].body = body;
+		jobs[i].begin = begin + i * grainSize;
+		jobs[i].end = jobs[i].begin + grainSize;
+		if(jobs[i].end > end)
+			jobs[i].end = end;
+		submit(&jobs[i], &counter);
+	}
+	wait(&counter);
+}
@@ -21,38 +21,443 @@
 */
 
 #include "PolyLogger.h"
+#include "PolyCore.h"
+#include <time.h>
+
+#ifdef MSVC
+#define vsnprintf _vsnprintf
+#define snprintf _snprintf
+#else
+#include <unistd.h>
+#include <sched.h>
+#endif
 
 using namespace Polycode;
 
+#ifdef MSVC
+static inline bool atomicCompareAndSwap(volatile unsigned int *ptr, unsigned int oldValue, unsigned int newValue) {
+	return InterlockedCompareExchange((volatile LONG*)ptr, (LONG)newValue, (LONG)oldValue) == (LONG)oldValue;
+}
+static inline unsigned int atomicIncrement(volatile unsigned int *ptr) {
+	return (unsigned int)InterlockedIncrement((volatile LONG*)ptr);
+}
+static inline unsigned int atomicDecrement(volatile unsigned int *ptr) {
+	return (unsigned int)InterlockedDecrement((volatile LONG*)ptr);
+}
+static inline void memoryBarrier() { MemoryBarrier(); }
+static inline void yieldThread() { Sleep(0); }
+static inline void sleepMilliseconds(unsigned int ms) { Sleep(ms); }
+#else
+static inline bool atomicCompareAndSwap(volatile unsigned int *ptr, unsigned int oldValue, unsigned int newValue) {
+	return __sync_bool_compare_and_swap(ptr, oldValue, newValue);
+}
+static inline unsigned int atomicIncrement(volatile unsigned int *ptr) {
+	return __sync_add_and_fetch(ptr, 1);
+}
+static inline unsigned int atomicDecrement(volatile unsigned int *ptr) {
+	return __sync_sub_and_fetch(ptr, 1);
+}
+static inline void memoryBarrier() { __sync_synchronize(); }
+static inline void yieldThread() { sched_yield(); }
+static inline void sleepMilliseconds(unsigned int ms) { usleep(ms * 1000); }
+#endif
+
+namespace Polycode {
+	class LoggerThread : public Threaded {
+		public:
+			LoggerThread() : Threaded() { finished = 0; }
+			
+			void runThread() {
+				while(threadRunning)
+					updateThread();
+				memoryBarrier();
+				finished = 1;
+			}
+			
+			void updateThread() {
+				Logger::flush();
+				sleepMilliseconds(FLUSH_INTERVAL);
+			}
+			
+			volatile unsigned int finished;
+			
+			static const unsigned int FLUSH_INTERVAL = 5;
+	};
+}
+
+// Bounded multi-producer single-consumer queue. A slot is free for the producer
+// that claimed position pos when its sequence equals pos, and holds a finished
+// message for the consumer when it equals pos+1.
+struct LogSlot {
+	volatile unsigned int sequence;
+	int level;
+	char message[Logger::MESSAGE_SIZE];
+};
+
+static LogSlot ring[Logger::RING_SIZE];
+static volatile unsigned int ringHead = 0;
+static unsigned int ringTail = 0;
+static volatile unsigned int asyncEnabled = 0;
+static volatile unsigned int asyncWriters = 0;
+static volatile unsigned int sinkLock = 0;
+static volatile long sinkOwner = 0;
+static unsigned int sinkLockDepth = 0;
+static volatile unsigned int writingSinks = 0;
+static volatile unsigned int droppedMessages = 0;
+static unsigned int reportedDropped = 0;
+static unsigned int rateLimit = 0;
+// low bits of the current second in the top bits, messages accepted in it below,
+// so the window and the count change together in one compare and swap
+static volatile unsigned int rateState = 0;
+static const unsigned int RATE_COUNT_BITS = 20;
+static const unsigned int RATE_COUNT_MASK = (1 << RATE_COUNT_BITS) - 1;
+static LoggerThread loggerThread;
+
+int Logger::minLevel = Logger::LOG_INFO;
+
+static StdErrLogSink &getStdErrSink() {
+	static StdErrLogSink defaultSink;
+	return defaultSink;
+}
+
+static std::vector<LogSink*> &getSinks() {
+	static std::vector<LogSink*> sinks(1, &getStdErrSink());
+	return sinks;
+}
+
+void StdErrLogSink::write(int level, const char *message) {
+	fputs(message, stderr);
+
+#ifdef MSVC
+#ifdef _DEBUG
+	WCHAR wbuf[Logger::MESSAGE_SIZE];
+	int i = 0;
+	while(message[i] != '\0' && i < Logger::MESSAGE_SIZE-1) {
+		wbuf[i] = (WCHAR)message[i];
+		++i;
+	}
+	wbuf[i] = L'\0';
+	OutputDebugString(wbuf);
+#endif
+#endif
+}
+
+void StdErrLogSink::flush() {
+	fflush(stderr);
+}
+
+FileLogSink::FileLogSink(const char *fileName, bool append) {
+	file = fopen(fileName, append ? "a" : "w");
+	if(!file) {
+		fprintf(stderr, "Error opening log file %s\n", fileName);
+	}
+}
+
+FileLogSink::~FileLogSink() {
+	if(file)
+		fclose(file);
+}
+
+void FileLogSink::write(int level, const char *message) {
+	if(file)
+		fputs(message, file);
+}
+
+void FileLogSink::flush() {
+	if(file)
+		fflush(file);
+}
+
+MemoryLogSink::MemoryLogSink(unsigned int maxLines) : LogSink() {
+	this->maxLines = maxLines;
+	firstLine = 0;
+}
+
+void MemoryLogSink::write(int level, const char *message) {
+	if(maxLines == 0)
+		return;
+	if(lines.size() < maxLines) {
+		lines.push_back(message);
+		levels.push_back(level);
+	} else {
+		lines[firstLine] = message;
+		levels[firstLine] = level;
+		firstLine = (firstLine + 1) % maxLines;
+	}
+}
+
+unsigned int MemoryLogSink::getNumLines() const {
+	return lines.size();
+}
+
+const string &MemoryLogSink::getLine(unsigned int index) const {
+	return lines[(firstLine + index) % lines.size()];
+}
+
+int MemoryLogSink::getLineLevel(unsigned int index) const {
+	return levels[(firstLine + index) % levels.size()];
+}
+
+void MemoryLogSink::clear() {
+	lines.clear();
+	levels.clear();
+	firstLine = 0;
+}
+
 void Logger::logw(const char *str) {
 	std::wcout << str << std::endl;
 }
 
 void Logger::log(const char *format, ...) {
 	va_list args;
+	va_start(args, format);
+	logv(LOG_INFO, format, args);
+	va_end(args);
+}
 
+void Logger::debug(const char *format, ...) {
+	if(!isLevelEnabled(LOG_DEBUG))
+		return;
+	va_list args;
 	va_start(args, format);
-	vfprintf(stderr, format, args);
+	logv(LOG_DEBUG, format, args);
 	va_end(args);
+}
 
-#ifdef MSVC
-#ifdef _DEBUG
-	
-	char buffer[4096];
+void Logger::warning(const char *format, ...) {
+	va_list args;
 	va_start(args, format);
-	vsprintf(buffer, format, args);
+	logv(LOG_WARNING, format, args);
 	va_end(args);
+}
 
-	WCHAR wbuf[4096];
-	int i = 0;
-	while(buffer[i] != '\0') {
-		wbuf[i] = (WCHAR)buffer[i];
-		++i;
+void Logger::error(const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	logv(LOG_ERROR, format, args);
+	va_end(args);
+}
+
+bool Logger::acceptMessage() {
+	unsigned int limit = rateLimit;
+	if(limit == 0)
+		return true;
+	
+	unsigned int window = ((unsigned int)time(NULL)) << RATE_COUNT_BITS;
+	while(true) {
+		unsigned int state = rateState;
+		unsigned int newState;
+		if((state & ~RATE_COUNT_MASK) != window) {
+			newState = window | 1;
+		} else if((state & RATE_COUNT_MASK) >= limit) {
+			atomicIncrement(&droppedMessages);
+			return false;
+		} else {
+			newState = state + 1;
+		}
+		if(atomicCompareAndSwap(&rateState, state, newState))
+			return true;
 	}
-	wbuf[i] = L'\0';
-	OutputDebugString(wbuf);
+}
+
+void Logger::logv(int level, const char *format, va_list args) {
+	if(!isLevelEnabled(level))
+		return;
 	
-#endif
-#endif
+	// a sink that logs would write to itself again, or loop in flush()
+	if(writingSinks && sinkOwner == getThreadID()) {
+		atomicIncrement(&droppedMessages);
+		return;
+	}
+	
+	if(!acceptMessage())
+		return;
+	
+	// stopAsync() waits for the writers counted here before the last flush
+	atomicIncrement(&asyncWriters);
+	if(!asyncEnabled) {
+		atomicDecrement(&asyncWriters);
+		char buffer[MESSAGE_SIZE];
+		vsnprintf(buffer, sizeof(buffer), format, args);
+		buffer[sizeof(buffer)-1] = '\0';
+		lockSinks();
+		writeToSinks(level, buffer);
+		std::vector<LogSink*> &sinks = getSinks();
+		for(int i=0; i < sinks.size(); i++) {
+			sinks[i]->flush();
+		}
+		unlockSinks();
+		return;
+	}
+	
+	unsigned int pos = ringHead;
+	LogSlot *slot;
+	while(true) {
+		slot = &ring[pos % RING_SIZE];
+		int diff = (int)(slot->sequence - pos);
+		if(diff == 0) {
+			if(atomicCompareAndSwap(&ringHead, pos, pos+1))
+				break;
+			pos = ringHead;
+		} else if(diff < 0) {
+			atomicIncrement(&droppedMessages);
+			atomicDecrement(&asyncWriters);
+			return;
+		} else {
+			pos = ringHead;
+		}
+	}
+	
+	slot->level = level;
+	vsnprintf(slot->message, MESSAGE_SIZE, format, args);
+	slot->message[MESSAGE_SIZE-1] = '\0';
+	memoryBarrier();
+	slot->sequence = pos + 1;
+	atomicDecrement(&asyncWriters);
+}
+
+void Logger::writeToSinks(int level, const char *message) {
+	writingSinks = 1;
+	std::vector<LogSink*> &sinks = getSinks();
+	for(int i=0; i < sinks.size(); i++) {
+		sinks[i]->write(level, message);
+	}
+	writingSinks = 0;
+}
+
+void Logger::reportDropped() {
+	unsigned int dropped = droppedMessages;
+	if(dropped == reportedDropped)
+		return;
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), "Logger: %u messages dropped\n", dropped - reportedDropped);
+	writeToSinks(LOG_WARNING, buffer);
+	reportedDropped = dropped;
+}
+
+void Logger::flush() {
+	lockSinks();
+	bool wrote = false;
+	while(true) {
+		LogSlot *slot = &ring[ringTail % RING_SIZE];
+		if(slot->sequence != ringTail + 1)
+			break;
+		memoryBarrier();
+		writeToSinks(slot->level, slot->message);
+		memoryBarrier();
+		slot->sequence = ringTail + RING_SIZE;
+		ringTail++;
+		wrote = true;
+	}
+	if(droppedMessages != reportedDropped) {
+		reportDropped();
+		wrote = true;
+	}
+	if(wrote) {
+		writingSinks = 1;
+		std::vector<LogSink*> &sinks = getSinks();
+		for(int i=0; i < sinks.size(); i++) {
+			sinks[i]->flush();
+		}
+		writingSinks = 0;
+	}
+	unlockSinks();
+}
+
+void Logger::lockSinks() {
+	// only the owner can find its own id here, so the check needs no lock
+	long threadID = getThreadID();
+	if(sinkOwner == threadID) {
+		sinkLockDepth++;
+		return;
+	}
+	while(!atomicCompareAndSwap(&sinkLock, 0, 1)) {
+		yieldThread();
+	}
+	sinkOwner = threadID;
+	sinkLockDepth = 1;
+}
+
+void Logger::unlockSinks() {
+	sinkLockDepth--;
+	if(sinkLockDepth > 0)
+		return;
+	sinkOwner = 0;
+	memoryBarrier();
+	sinkLock = 0;
+}
+
+void Logger::setLevel(int level) {
+	minLevel = level;
+}
+
+int Logger::getLevel() {
+	return minLevel;
+}
+
+void Logger::addSink(LogSink *sink) {
+	lockSinks();
+	getSinks().push_back(sink);
+	unlockSinks();
+}
+
+void Logger::removeSink(LogSink *sink) {
+	lockSinks();
+	std::vector<LogSink*> &sinks = getSinks();
+	for(int i=0; i < sinks.size(); i++) {
+		if(sinks[i] == sink) {
+			sinks.erase(sinks.begin()+i);
+			break;
+		}
+	}
+	unlockSinks();
+}
+
+LogSink *Logger::getDefaultSink() {
+	return &getStdErrSink();
+}
+
+void Logger::setRateLimit(unsigned int messagesPerSecond) {
+	if(messagesPerSecond > RATE_COUNT_MASK)
+		messagesPerSecond = RATE_COUNT_MASK;
+	rateLimit = messagesPerSecond;
+}
+
+unsigned int Logger::getNumDroppedMessages() {
+	return droppedMessages;
+}
 
-}
\ No newline at end of file
+void Logger::startAsync(Core *core) {
+	if(asyncEnabled)
+		return;
+	lockSinks();
+	for(unsigned int i=0; i < RING_SIZE; i++) {
+		ring[i].sequence = i;
+	}
+	ringHead = 0;
+	ringTail = 0;
+	unlockSinks();
+	
+	loggerThread.threadRunning = true;
+	loggerThread.finished = 0;
+	core->createThread(&loggerThread);
+	memoryBarrier();
+	asyncEnabled = 1;
+}
+
+void Logger::stopAsync() {
+	if(!asyncEnabled)
+		return;
+	asyncEnabled = 0;
+	memoryBarrier();
+	
+	// messages that are being written to the buffer are flushed with the rest
+	while(asyncWriters > 0) {
+		yieldThread();
+	}
+	loggerThread.killThread();
+	while(!loggerThread.finished) {
+		yieldThread();
+	}
+	flush();
+}
@@ -25,7 +25,7 @@
 using namespace Polycode;
 
 Material::Material(String name) : Resource(Resource::RESOURCE_MATERIAL) {
-	this->name = name;
+	setResourceName(name);
 	specularValue = 75.0;
 }
 
@@ -60,7 +60,7 @@ unsigned int Material::getNumShaders() {
 }
 
 String Material::getName() {
-	return name;
+	return getResourceName();
 }
 
 Shader *Material::getShader(unsigned int index) {
@@ -21,9 +21,22 @@
 */
 
 #include "PolyMesh.h"
+#include <map>
+#include <string.h>
 
 namespace Polycode {
 
+	static int verticesPerFaceForMeshType(int meshType) {
+		switch(meshType) {
+			case Mesh::TRI_MESH:
+				return 3;
+			case Mesh::QUAD_MESH:
+				return 4;
+			default:
+				return 1;
+		}
+	}
+
 	Mesh::Mesh(String fileName) {
 		
 		for(int i=0; i < 16; i++) {
@@ -139,24 +152,228 @@ namespace Polycode {
 	}
 
 	
+	void Mesh::savePackedToFile(OSFILE *outFile) {
+		vector<PackedVertex> vertices;
+		vector<PackedBoneWeights> boneWeights;
+		vector<unsigned int> indices;
+		map<string, unsigned int> vertexIndices;
+		bool hasBoneWeights = false;
+		
+		for(int i=0; i < polygons.size(); i++) {
+			for(int j=0; j < polygons[i]->getVertexCount(); j++) {
+				Vertex *vertex = polygons[i]->getVertex(j);
+				
+				PackedVertex packedVertex;
+				memset(&packedVertex, 0, sizeof(PackedVertex));
+				packedVertex.position[0] = vertex->x;
+				packedVertex.position[1] = vertex->y;
+				packedVertex.position[2] = vertex->z;
+				packedVertex.normal[0] = vertex->normal.x;
+				packedVertex.normal[1] = vertex->normal.y;
+				packedVertex.normal[2] = vertex->normal.z;
+				packedVertex.color[0] = vertex->vertexColor.r;
+				packedVertex.color[1] = vertex->vertexColor.g;
+				packedVertex.color[2] = vertex->vertexColor.b;
+				packedVertex.color[3] = vertex->vertexColor.a;
+				packedVertex.texCoord[0] = vertex->getTexCoord().x;
+				packedVertex.texCoord[1] = vertex->getTexCoord().y;
+				
+				// keep the heaviest assignments and renormalize if any had to be dropped
+				PackedBoneWeights packedWeights;
+				memset(&packedWeights, 0, sizeof(PackedBoneWeights));
+				vector<BoneAssignment*> assignments;
+				for(int b=0; b < vertex->getNumBoneAssignments(); b++) {
+					assignments.push_back(vertex->getBoneAssignment(b));
+				}
+				int numWeights = 0;
+				float totalWeight = 0;
+				while(assignments.size() > 0 && numWeights < PACKED_MESH_MAX_BONE_WEIGHTS) {
+					int heaviest = 0;
+					for(int b=1; b < assignments.size(); b++) {
+						if(assignments[b]->weight > assignments[heaviest]->weight)
+							heaviest = b;
+					}
+					packedWeights.boneIDs[numWeights] = assignments[heaviest]->boneID;
+					packedWeights.weights[numWeights] = assignments[heaviest]->weight;
+					totalWeight += packedWeights.weights[numWeights];
+					assignments.erase(assignments.begin()+heaviest);
+					numWeights++;
+				}
+				if(assignments.size() > 0 && totalWeight > 0) {
+					for(int b=0; b < numWeights; b++) {
+						packedWeights.weights[b] /= totalWeight;
+					}
+				}
+				if(numWeights > 0)
+					hasBoneWeights = true;
+				
+				string key = string((const char*)&packedVertex, sizeof(PackedVertex)) + string((const char*)&packedWeights, sizeof(PackedBoneWeights));
+				map<string, unsigned int>::iterator it = vertexIndices.find(key);
+				if(it != vertexIndices.end()) {
+					indices.push_back(it->second);
+				} else {
+					unsigned int index = vertices.size();
+					vertices.push_back(packedVertex);
+					boneWeights.push_back(packedWeights);
+					vertexIndices[key] = index;
+					indices.push_back(index);
+				}
+			}
+		}
+		
+		PackedMeshHeader header;
+		memset(&header, 0, sizeof(PackedMeshHeader));
+		memcpy(header.magic, "PMSH", 4);
+		header.version = PACKED_MESH_VERSION;
+		header.meshType = meshType;
+		header.flags = hasBoneWeights ? PACKED_MESH_HAS_BONE_WEIGHTS : 0;
+		header.vertexCount = vertices.size();
+		header.indexCount = indices.size();
+		
+		OSBasics::write(&header, sizeof(PackedMeshHeader), 1, outFile);
+		if(vertices.size() > 0)
+			OSBasics::write(&vertices[0], sizeof(PackedVertex), vertices.size(), outFile);
+		if(hasBoneWeights)
+			OSBasics::write(&boneWeights[0], sizeof(PackedBoneWeights), boneWeights.size(), outFile);
+		
+		// pad the index block so that the next block stays 16 byte aligned
+		while((indices.size() * sizeof(unsigned int)) % 16 != 0) {
+			indices.push_back(0);
+		}
+		if(indices.size() > 0)
+			OSBasics::write(&indices[0], sizeof(unsigned int), indices.size(), outFile);
+	}
+	
+	void Mesh::setRenderDataArray(int arrayType, int size, int count, float *data) {
+		if(renderDataArrays[arrayType]) {
+			free(renderDataArrays[arrayType]->arrayPtr);
+			delete renderDataArrays[arrayType];
+		}
+		RenderDataArray *newArray = new RenderDataArray();
+		newArray->arrayType = arrayType;
+		newArray->size = size;
+		newArray->stride = 0;
+		newArray->count = count;
+		newArray->arrayPtr = data;
+		newArray->rendererData = NULL;
+		renderDataArrays[arrayType] = newArray;
+		arrayDirtyMap[arrayType] = false;
+	}
+	
+	void Mesh::loadPackedFromFile(OSFILE *inFile) {
+		PackedMeshHeader header;
+		memcpy(header.magic, "PMSH", 4);
+		if(OSBasics::read(((char*)&header) + 4, sizeof(PackedMeshHeader) - 4, 1, inFile) != 1) {
+			Logger::log("Error reading packed mesh header\n");
+			return;
+		}
+		if(header.version > PACKED_MESH_VERSION) {
+			Logger::log("Unsupported packed mesh version %d\n", header.version);
+			return;
+		}
+		setMeshType(header.meshType);
+		bool wasEmpty = (polygons.size() == 0);
+		
+		size_t vertexBlockSize = sizeof(PackedVertex) * header.vertexCount;
+		size_t boneBlockSize = 0;
+		if(header.flags & PACKED_MESH_HAS_BONE_WEIGHTS)
+			boneBlockSize = sizeof(PackedBoneWeights) * header.vertexCount;
+		size_t indexBlockSize = ((sizeof(unsigned int) * header.indexCount + 15) / 16) * 16;
+		size_t dataSize = vertexBlockSize + boneBlockSize + indexBlockSize;
+		
+		char *data = (char*)malloc(dataSize);
+		if(OSBasics::read(data, 1, dataSize, inFile) != dataSize) {
+			Logger::log("Error reading packed mesh data\n");
+			free(data);
+			return;
+		}
+		
+		PackedVertex *vertices = (PackedVertex*)data;
+		PackedBoneWeights *boneWeights = NULL;
+		if(boneBlockSize > 0)
+			boneWeights = (PackedBoneWeights*)(data + vertexBlockSize);
+		unsigned int *indices = (unsigned int*)(data + vertexBlockSize + boneBlockSize);
+		
+		// the render arrays are filled in the same pass so that the renderer
+		// does not have to rebuild them from the polygons on first use
+		float *positionArray = (float*)malloc(sizeof(float) * 3 * header.indexCount + 1);
+		float *normalArray = (float*)malloc(sizeof(float) * 3 * header.indexCount + 1);
+		float *colorArray = (float*)malloc(sizeof(float) * 4 * header.indexCount + 1);
+		float *texCoordArray = (float*)malloc(sizeof(float) * 2 * header.indexCount + 1);
+		
+		int verticesPerFace = verticesPerFaceForMeshType(header.meshType);
+		Polygon *poly = NULL;
+		for(unsigned int i=0; i < header.indexCount; i++) {
+			if(indices[i] >= header.vertexCount) {
+				Logger::log("Invalid vertex index in packed mesh\n");
+				wasEmpty = false;
+				break;
+			}
+			PackedVertex *packedVertex = &vertices[indices[i]];
+			
+			Vertex *vertex = new Vertex(packedVertex->position[0], packedVertex->position[1], packedVertex->position[2]);
+			vertex->setNormal(packedVertex->normal[0], packedVertex->normal[1], packedVertex->normal[2]);
+			vertex->restNormal.set(packedVertex->normal[0], packedVertex->normal[1], packedVertex->normal[2]);
+			vertex->vertexColor.setColor(packedVertex->color[0], packedVertex->color[1], packedVertex->color[2], packedVertex->color[3]);
+			vertex->setTexCoord(packedVertex->texCoord[0], packedVertex->texCoord[1]);
+			if(boneWeights) {
+				PackedBoneWeights *packedWeights = &boneWeights[indices[i]];
+				for(int b=0; b < PACKED_MESH_MAX_BONE_WEIGHTS; b++) {
+					if(packedWeights->weights[b] > 0)
+						vertex->addBoneAssignment(packedWeights->boneIDs[b], packedWeights->weights[b]);
+				}
+			}
+			
+			memcpy(positionArray + (i*3), packedVertex->position, sizeof(float) * 3);
+			memcpy(normalArray + (i*3), packedVertex->normal, sizeof(float) * 3);
+			memcpy(colorArray + (i*4), packedVertex->color, sizeof(float) * 4);
+			memcpy(texCoordArray + (i*2), packedVertex->texCoord, sizeof(float) * 2);
+			
+			if(!poly)
+				poly = new Polygon();
+			poly->addVertex(vertex);
+			if(poly->getVertexCount() == verticesPerFace) {
+				addPolygon(poly);
+				poly = NULL;
+			}
+		}
+		if(poly)
+			addPolygon(poly);
+		free(data);
+		
+		if(wasEmpty) {
+			setRenderDataArray(RenderDataArray::VERTEX_DATA_ARRAY, 3, header.indexCount, positionArray);
+			setRenderDataArray(RenderDataArray::NORMAL_DATA_ARRAY, 3, header.indexCount, normalArray);
+			setRenderDataArray(RenderDataArray::COLOR_DATA_ARRAY, 4, header.indexCount, colorArray);
+			setRenderDataArray(RenderDataArray::TEXCOORD_DATA_ARRAY, 2, header.indexCount, texCoordArray);
+		} else {
+			// the arrays only match the file when it is the whole mesh,
+			// otherwise they are rebuilt from the polygons
+			free(positionArray);
+			free(normalArray);
+			free(colorArray);
+			free(texCoordArray);
+			arrayDirtyMap[RenderDataArray::VERTEX_DATA_ARRAY] = true;
+			arrayDirtyMap[RenderDataArray::COLOR_DATA_ARRAY] = true;
+			arrayDirtyMap[RenderDataArray::TEXCOORD_DATA_ARRAY] = true;
+			arrayDirtyMap[RenderDataArray::NORMAL_DATA_ARRAY] = true;
+		}
+	}
+	
 	void Mesh::loadFromFile(OSFILE *inFile) {
 
-		unsigned int meshType;		
-		OSBasics::read(&meshType, sizeof(unsigned int), 1, inFile);				
+		char magic[4];
+		OSBasics::read(magic, 1, 4, inFile);
+		if(memcmp(magic, "PMSH", 4) == 0) {
+			loadPackedFromFile(inFile);
+			return;
+		}
+		
+		unsigned int meshType;
+		memcpy(&meshType, magic, sizeof(unsigned int));
 		setMeshType(meshType);
 		
-		int verticesPerFace;
-		switch(meshType) {
-			case TRI_MESH:
-				verticesPerFace = 3;
-			break;
-			case QUAD_MESH:
-				verticesPerFace = 4;
-			break;
-			default:
-				verticesPerFace = 1;				
-			break;
-		}
+		int verticesPerFace = verticesPerFaceForMeshType(meshType);
 		
 		unsigned int numFaces;		
 		OSBasics::read(&numFaces, sizeof(unsigned int), 1, inFile);
@@ -214,6 +431,16 @@ namespace Polycode {
 	
 	}
 	
+	void Mesh::savePackedToFile(String fileName) {
+		OSFILE *outFile = OSBasics::open(fileName.c_str(), "wb");
+		if(!outFile) {
+			Logger::log("Error opening mesh file for saving: %s", fileName.c_str());
+			return;
+		}
+		savePackedToFile(outFile);
+		OSBasics::close(outFile);
+	}
+	
 	void Mesh::loadMesh(String fileName) {
 		OSFILE *inFile = OSBasics::open(fileName.c_str(), "rb");
 		if(!inFile) {
@@ -221,11 +448,6 @@ namespace Polycode {
 		}
 		loadFromFile(inFile);
 		OSBasics::close(inFile);	
-		arrayDirtyMap[RenderDataArray::VERTEX_DATA_ARRAY] = true;		
-		arrayDirtyMap[RenderDataArray::COLOR_DATA_ARRAY] = true;				
-		arrayDirtyMap[RenderDataArray::TEXCOORD_DATA_ARRAY] = true;						
-		arrayDirtyMap[RenderDataArray::NORMAL_DATA_ARRAY] = true;										
-		
 	}
 	
 	void Mesh::createVPlane(Number w, Number h) { 
@@ -0,0 +1,531 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyNullRenderer.h"
+#include "PolyFixedShader.h"
+#include "PolyModule.h"
+#include <string.h>
+#include <math.h>
+
+using namespace Polycode;
+
+NullTexture::NullTexture(unsigned int width, unsigned int height, char *textureData, bool clamp, int type) : Texture(width, height, textureData, clamp, type) {
+
+}
+
+NullTexture::~NullTexture() {
+
+}
+
+void NullTexture::setTextureData(char *data) {
+	if(data)
+		memcpy(textureData, data, width*height*pixelSize);
+}
+
+void NullTexture::recreateFromImageData() {
+
+}
+
+NullVertexBuffer::NullVertexBuffer(Mesh *mesh) : VertexBuffer() {
+	if(mesh->getMeshType() == Mesh::QUAD_MESH) {
+		verticesPerFace = 4;		
+	} else {
+		verticesPerFace = 3;				
+	}
+	meshType = mesh->getMeshType();
+	
+	vertexCount = 0;
+	for(int i=0; i < mesh->getPolygonCount(); i++) {
+		Polycode::Polygon *polygon = mesh->getPolygon(i);
+		for(int j=0; j < polygon->getVertexCount(); j++) {
+			Vertex *vertex = polygon->getVertex(j);
+			vertexCount++;
+			
+			vertices.push_back(vertex->x);
+			vertices.push_back(vertex->y);
+			vertices.push_back(vertex->z);
+			
+			if(polygon->useVertexNormals) {
+				normals.push_back(vertex->normal.x);
+				normals.push_back(vertex->normal.y);
+				normals.push_back(vertex->normal.z);
+			} else {
+				normals.push_back(polygon->getFaceNormal().x);
+				normals.push_back(polygon->getFaceNormal().y);
+				normals.push_back(polygon->getFaceNormal().z);
+			}
+			
+			texCoords.push_back(vertex->getTexCoord().x);
+			texCoords.push_back(vertex->getTexCoord().y);
+		}
+	}
+}
+
+NullVertexBuffer::~NullVertexBuffer() {
+
+}
+
+NullRenderer::NullRenderer() : Renderer() {
+	nearPlane = 0.1f;
+	farPlane = 100.0f;
+	verticesToDraw = 0;
+	recordCommands = false;
+}
+
+NullRenderer::~NullRenderer() {
+
+}
+
+void NullRenderer::recordCommand(int type, int drawType, unsigned int count, void *target) {
+	if(!recordCommands)
+		return;
+	
+	NullRenderCommand command;
+	command.type = type;
+	command.drawType = drawType;
+	command.count = count;
+	command.target = target;
+	command.modelviewMatrix = modelviewMatrix;
+	recordedCommands.push_back(command);
+}
+
+void NullRenderer::setRecordCommands(bool val) {
+	recordCommands = val;
+}
+
+bool NullRenderer::isRecordingCommands() {
+	return recordCommands;
+}
+
+unsigned int NullRenderer::getNumRecordedCommands() {
+	return recordedCommands.size();
+}
+
+NullRenderCommand NullRenderer::getRecordedCommand(unsigned int index) {
+	if(index >= recordedCommands.size())
+		return NullRenderCommand();
+	return recordedCommands[index];
+}
+
+void NullRenderer::clearRecordedCommands() {
+	recordedCommands.clear();
+}
+
+void NullRenderer::setPerspectiveProjection(Number fov, Number aspect) {
+	Number f = 1.0 / tan(fov * TORADIANS * 0.5);
+	projectionMatrix = Matrix4();
+	projectionMatrix.m[0][0] = f / aspect;
+	projectionMatrix.m[1][1] = f;
+	projectionMatrix.m[2][2] = (farPlane + nearPlane) / (nearPlane - farPlane);
+	projectionMatrix.m[2][3] = -1;
+	projectionMatrix.m[3][2] = (2.0 * farPlane * nearPlane) / (nearPlane - farPlane);
+	projectionMatrix.m[3][3] = 0;
+}
+
+void NullRenderer::setOrthoProjection(Number left, Number right, Number bottom, Number top, Number zNear, Number zFar) {
+	projectionMatrix = Matrix4();
+	projectionMatrix.m[0][0] = 2.0 / (right - left);
+	projectionMatrix.m[1][1] = 2.0 / (top - bottom);
+	projectionMatrix.m[2][2] = -2.0 / (zFar - zNear);
+	projectionMatrix.m[3][0] = -(right + left) / (right - left);
+	projectionMatrix.m[3][1] = -(top + bottom) / (top - bottom);
+	projectionMatrix.m[3][2] = -(zFar + zNear) / (zFar - zNear);
+}
+
+void NullRenderer::Resize(int xRes, int yRes) {
+	this->xRes = xRes;
+	this->yRes = yRes;
+	if(yRes > 0)
+		setPerspectiveProjection(fov, (Number)xRes/(Number)yRes);
+	currentBlendingMode = BLEND_MODE_NORMAL;
+}
+
+void NullRenderer::BeginRender() {
+	beginFrameStats();
+	recordedCommands.clear();
+	modelviewMatrix.identity();
+	currentTexture = NULL;
+	recordCommand(COMMAND_CLEAR, 0, 0, NULL);
+}
+
+void NullRenderer::EndRender() {
+
+}
+
+Cubemap *NullRenderer::createCubemap(Texture *t0, Texture *t1, Texture *t2, Texture *t3, Texture *t4, Texture *t5) {
+	return new Cubemap(t0,t1,t2,t3,t4,t5);
+}
+
+Texture *NullRenderer::createTexture(unsigned int width, unsigned int height, char *textureData, bool clamp, int type) {
+	currentFrameStats.numBufferUploads++;
+	return new NullTexture(width, height, textureData, clamp, type);
+}
+
+Texture *NullRenderer::createFramebufferTexture(unsigned int width, unsigned int height) {
+	return new NullTexture(width, height, NULL, true);
+}
+
+void NullRenderer::createRenderTextures(Texture **colorBuffer, Texture **depthBuffer, int width, int height) {
+	if(colorBuffer) {
+		*colorBuffer = new NullTexture(width, height, NULL, true);
+	}
+	if(depthBuffer) {
+		*depthBuffer = new NullTexture(width, height, NULL, true);
+	}
+}
+
+void NullRenderer::enableAlphaTest(bool val) {
+
+}
+
+void NullRenderer::createVertexBufferForMesh(Mesh *mesh) {
+	NullVertexBuffer *buffer = new NullVertexBuffer(mesh);
+	mesh->setVertexBuffer(buffer);
+	currentFrameStats.numBufferUploads++;
+}
+
+void NullRenderer::drawVertexBuffer(VertexBuffer *buffer) {
+	countDrawCall(buffer->meshType, buffer->getVertexCount());
+	recordCommand(COMMAND_DRAW, buffer->meshType, buffer->getVertexCount(), buffer);
+}
+
+void NullRenderer::bindFrameBufferTexture(Texture *texture) {
+	if(currentFrameBufferTexture) {
+		previousFrameBufferTexture = currentFrameBufferTexture;
+	}
+	currentFrameBufferTexture = texture;
+	recordCommand(COMMAND_BIND_FRAMEBUFFER, 0, 0, texture);
+	recordCommand(COMMAND_CLEAR, 0, 0, NULL);
+}
+
+void NullRenderer::unbindFramebuffers() {
+	currentFrameBufferTexture = NULL;
+	recordCommand(COMMAND_BIND_FRAMEBUFFER, 0, 0, NULL);
+	if(previousFrameBufferTexture) {
+		bindFrameBufferTexture(previousFrameBufferTexture);
+		previousFrameBufferTexture = NULL;
+	}
+}
+
+void NullRenderer::cullFrontFaces(bool val) {
+	cullingFrontFaces = val;
+}
+
+void NullRenderer::pushRenderDataArray(RenderDataArray *array) {
+	currentFrameStats.numBufferUploads++;
+	if(array->arrayType == RenderDataArray::VERTEX_DATA_ARRAY) {
+		verticesToDraw = array->count;
+	}
+}
+
+void NullRenderer::setRenderArrayData(RenderDataArray *array, Number *arrayData) {
+
+}
+
+void NullRenderer::drawArrays(int drawType) {
+	countDrawCall(drawType, verticesToDraw);
+	recordCommand(COMMAND_DRAW, drawType, verticesToDraw, NULL);
+	verticesToDraw = 0;
+}
+
+void NullRenderer::drawIndexedArrays(int drawType, unsigned short *indices, unsigned int count) {
+	countDrawCall(drawType, count);
+	recordCommand(COMMAND_DRAW, drawType, count, NULL);
+	verticesToDraw = 0;
+}
+
+void NullRenderer::_setOrthoMode() {
+	if(!orthoMode) {
+		projectionStack.push_back(projectionMatrix);
+		setOrthoProjection(-1, 1, -1, 1, nearPlane, farPlane);
+		orthoMode = true;
+	}
+	modelviewMatrix.identity();
+}
+
+void NullRenderer::setOrthoMode(Number xSize, Number ySize) {
+	if(xSize == 0)
+		xSize = xRes;
+	
+	if(ySize == 0)
+		ySize = yRes;
+	
+	setBlendingMode(BLEND_MODE_NORMAL);
+	if(!orthoMode) {
+		projectionStack.push_back(projectionMatrix);
+		setOrthoProjection(0.0f, xSize, ySize, 0, -1.0f, 1.0f);
+		orthoMode = true;
+	}
+	modelviewMatrix.identity();
+}
+
+void NullRenderer::setPerspectiveMode() {
+	setBlendingMode(BLEND_MODE_NORMAL);
+	if(orthoMode) {
+		if(projectionStack.size() > 0) {
+			projectionMatrix = projectionStack.back();
+			projectionStack.pop_back();
+		}
+		orthoMode = false;
+	}
+	modelviewMatrix.identity();
+	currentTexture = NULL;
+}
+
+void NullRenderer::enableBackfaceCulling(bool val) {
+
+}
+
+void NullRenderer::setViewportSize(int w, int h, Number fov) {
+	if(h > 0)
+		setPerspectiveProjection(fov, (Number)w/(Number)h);
+}
+
+void NullRenderer::setLineSmooth(bool val) {
+
+}
+
+void NullRenderer::loadIdentity() {
+	modelviewMatrix.identity();
+}
+
+void NullRenderer::setClearColor(Number r, Number g, Number b) {
+	clearColor.setColor(r,g,b,1.0f);
+}
+
+void NullRenderer::setTexture(Texture *texture) {
+	if(texture == NULL || renderMode != RENDER_MODE_NORMAL) {
+		currentTexture = texture;
+		return;
+	}
+	
+	if(currentTexture != texture) {
+		currentFrameStats.numTextureBinds++;
+		recordCommand(COMMAND_SET_TEXTURE, 0, 0, texture);
+	} else {
+		currentFrameStats.numRedundantStateSets++;
+	}
+	currentTexture = texture;
+}
+
+void NullRenderer::renderToTexture(Texture *targetTexture) {
+	currentTexture = NULL;
+	currentFrameStats.numTextureBinds++;
+}
+
+void NullRenderer::renderZBufferToTexture(Texture *targetTexture) {
+
+}
+
+void NullRenderer::clearScreen() {
+	recordCommand(COMMAND_CLEAR, 0, 0, NULL);
+}
+
+void NullRenderer::translate2D(Number x, Number y) {
+	translate3D(x, y, 0.0f);
+}
+
+void NullRenderer::rotate2D(Number angle) {
+	Number c = cos(angle * TORADIANS);
+	Number s = sin(angle * TORADIANS);
+	Matrix4 rotation;
+	rotation.m[0][0] = c;
+	rotation.m[0][1] = s;
+	rotation.m[1][0] = -s;
+	rotation.m[1][1] = c;
+	modelviewMatrix = rotation * modelviewMatrix;
+}
+
+void NullRenderer::scale2D(Vector2 *scale) {
+	Vector3 scale3(scale->x, scale->y, 1.0f);
+	scale3D(&scale3);
+}
+
+void NullRenderer::setLineSize(Number lineSize) {
+
+}
+
+void NullRenderer::setVertexColor(Number r, Number g, Number b, Number a) {
+
+}
+
+void NullRenderer::setBlendingMode(int blendingMode) {
+	if(blendingMode == currentBlendingMode) {
+		currentFrameStats.numRedundantStateSets++;
+		return;
+	}
+	currentBlendingMode = blendingMode;
+	recordCommand(COMMAND_SET_BLENDING_MODE, blendingMode, 0, NULL);
+}
+
+void NullRenderer::enableLighting(bool enable) {
+	lightingEnabled = enable;
+}
+
+void NullRenderer::enableFog(bool enable) {
+
+}
+
+void NullRenderer::setFogProperties(int fogMode, Color color, Number density, Number startDepth, Number endDepth) {
+
+}
+
+void NullRenderer::translate3D(Vector3 *position) {
+	translate3D(position->x, position->y, position->z);
+}
+
+void NullRenderer::translate3D(Number x, Number y, Number z) {
+	Matrix4 translation;
+	translation.setPosition(x, y, z);
+	modelviewMatrix = translation * modelviewMatrix;
+}
+
+void NullRenderer::scale3D(Vector3 *scale) {
+	Matrix4 scaling;
+	scaling.setScale(*scale);
+	modelviewMatrix = scaling * modelviewMatrix;
+}
+
+Matrix4 NullRenderer::getProjectionMatrix() {
+	return projectionMatrix;
+}
+
+Matrix4 NullRenderer::getModelviewMatrix() {
+	return modelviewMatrix;
+}
+
+void NullRenderer::setModelviewMatrix(Matrix4 m) {
+	modelviewMatrix = m;
+}
+
+void NullRenderer::multModelviewMatrix(Matrix4 m) {
+	modelviewMatrix = m * modelviewMatrix;
+}
+
+void NullRenderer::enableDepthTest(bool val) {
+
+}
+
+void NullRenderer::enableDepthWrite(bool val) {
+
+}
+
+void NullRenderer::setClippingPlanes(Number _nearPlane, Number _farPlane) {
+	nearPlane = _nearPlane;
+	farPlane = _farPlane;
+	Resize(xRes, yRes);
+}
+
+void NullRenderer::clearBuffer(bool colorBuffer, bool depthBuffer) {
+	recordCommand(COMMAND_CLEAR, 0, 0, NULL);
+}
+
+void NullRenderer::drawToColorBuffer(bool val) {
+
+}
+
+void NullRenderer::drawScreenQuad(Number qx, Number qy) {
+	setOrthoMode();
+	countDrawCall(Mesh::QUAD_MESH, 4);
+	recordCommand(COMMAND_DRAW, Mesh::QUAD_MESH, 4, NULL);
+	setPerspectiveMode();
+}
+
+void NullRenderer::pushMatrix() {
+	modelviewStack.push_back(modelviewMatrix);
+}
+
+void NullRenderer::popMatrix() {
+	if(modelviewStack.size() == 0)
+		return;
+	modelviewMatrix = modelviewStack.back();
+	modelviewStack.pop_back();
+}
+
+bool NullRenderer::test2DCoordinate(Number x, Number y, Polycode::Polygon *poly, const Matrix4 &matrix, bool billboardMode) {
+	return false;
+}
+
+void NullRenderer::setFOV(Number fov) {
+	this->fov = fov;
+	if(yRes > 0)
+		setPerspectiveProjection(fov, (Number)xRes/(Number)yRes);
+}
+
+Vector3 NullRenderer::Unproject(Number x, Number y) {
+	if(xRes <= 0 || yRes <= 0)
+		return Vector3(0,0,0);
+	
+	Matrix4 inverse = (modelviewMatrix * projectionMatrix).inverse();
+	Number nx = (2.0 * x / xRes) - 1.0;
+	Number ny = 1.0 - (2.0 * y / yRes);
+	Number nz = -1.0;
+	
+	Number ux = nx*inverse.m[0][0] + ny*inverse.m[1][0] + nz*inverse.m[2][0] + inverse.m[3][0];
+	Number uy = nx*inverse.m[0][1] + ny*inverse.m[1][1] + nz*inverse.m[2][1] + inverse.m[3][1];
+	Number uz = nx*inverse.m[0][2] + ny*inverse.m[1][2] + nz*inverse.m[2][2] + inverse.m[3][2];
+	Number uw = nx*inverse.m[0][3] + ny*inverse.m[1][3] + nz*inverse.m[2][3] + inverse.m[3][3];
+	
+	if(uw == 0)
+		return Vector3(ux, uy, uz);
+	return Vector3(ux/uw, uy/uw, uz/uw);
+}
+
+void NullRenderer::setDepthFunction(int depthFunction) {
+
+}
+
+void NullRenderer::clearShader() {
+	if(currentShaderModule) {
+		currentShaderModule->clearShader();
+		currentShaderModule = NULL;
+	}
+	currentMaterial = NULL;
+}
+
+void NullRenderer::applyMaterial(Material *material, ShaderBinding *localOptions, unsigned int shaderIndex) {
+	if(!material->getShader(shaderIndex) || !shadersEnabled) {
+		setTexture(NULL);
+		return;
+	}
+	
+	recordCommand(COMMAND_APPLY_MATERIAL, 0, 0, material);
+	
+	FixedShaderBinding *fBinding;
+	
+	switch(material->getShader(shaderIndex)->getType()) {
+		case Shader::FIXED_SHADER:
+			fBinding = (FixedShaderBinding*)material->getShaderBinding(shaderIndex);
+			setTexture(fBinding->getDiffuseTexture());
+		break;
+		case Shader::MODULE_SHADER:
+			currentMaterial = material;
+			for(int m=0; m < shaderModules.size(); m++) {
+				PolycodeShaderModule *shaderModule = shaderModules[m];
+				if(shaderModule->hasShader(material->getShader(shaderIndex))) {
+					shaderModule->applyShaderMaterial(this, material, localOptions, shaderIndex);
+					currentShaderModule = shaderModule;
+				}
+			}
+		break;
+	}
+}
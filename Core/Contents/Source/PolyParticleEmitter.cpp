@@ -358,4 +358,398 @@ void ParticleEmitter::updateEmitter() {
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+SceneParticleBatch::SceneParticleBatch(String materialName, int emitterType, Number lifespan, unsigned int numParticles, Vector3 direction, Vector3 gravity, Vector3 deviation) : SceneEntity() {
+	dirVector = direction;
+	gravVector = gravity;
+	this->emitterType = emitterType;
+	this->deviation = deviation;
+	this->lifespan = lifespan;
+	rotationFollowsPath = false;
+	rotationSpeed = 100.0f;
+	perlinEnabled = false;
+	emitterRadius = Vector3(0.0f,0.0f,0.0f);
+	perlinModSize = 0.002;
+	brightnessDeviation = 0.0f;
+	particleSpeedMod = 1.0f;
+	particleSize = 1.0f;
+	isEmitterEnabled = true;
+	allAtOnce = false;
+	useColorCurves = false;
+	useScaleCurves = false;
+	motionPerlin = new Perlin(3,5,1.0,rand());
+	
+	depthWrite = false;
+	backfaceCulled = false;
+	
+	this->numParticles = 0;
+	numVisibleParticles = 0;
+	lastElapsed = 0;
+	texCoordCapacity = 0;
+	
+	particleMaterial = NULL;
+	localShaderOptions = NULL;
+	Material *material = (Material*)CoreServices::getInstance()->getResourceManager()->getResource(Resource::RESOURCE_MATERIAL, materialName);
+	if(material)
+		setMaterial(material);
+	
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	vertexArray = renderer->createRenderDataArray(RenderDataArray::VERTEX_DATA_ARRAY);
+	normalArray = renderer->createRenderDataArray(RenderDataArray::NORMAL_DATA_ARRAY);
+	texCoordArray = renderer->createRenderDataArray(RenderDataArray::TEXCOORD_DATA_ARRAY);
+	colorArray = renderer->createRenderDataArray(RenderDataArray::COLOR_DATA_ARRAY);
+	
+	emitterMatrix = getConcatenatedMatrix();
+	setParticleCount(numParticles);
+	
+	// triggered emitters stay dark until the first Trigger()
+	for(int i=0; i < this->numParticles; i++) {
+		if(emitterType == ParticleEmitter::TRIGGERED_EMITTER)
+			life[i] = lifespan + 1.0f;
+	}
+}
+
+SceneParticleBatch::~SceneParticleBatch() {
+	delete motionPerlin;
+	delete localShaderOptions;
+	RenderDataArray *arrays[4] = {vertexArray, normalArray, texCoordArray, colorArray};
+	for(int i=0; i < 4; i++) {
+		free(arrays[i]->arrayPtr);
+		delete arrays[i];
+	}
+}
+
+void SceneParticleBatch::setMaterial(Material *material) {
+	particleMaterial = material;
+	delete localShaderOptions;
+	localShaderOptions = NULL;
+	if(material->getShader(0))
+		localShaderOptions = material->getShader(0)->createBinding();
+}
+
+void SceneParticleBatch::setRotationSpeed(Number speed) {
+	rotationSpeed = speed;
+}
+
+void SceneParticleBatch::enablePerlin(bool val) {
+	perlinEnabled = val;
+}
+
+void SceneParticleBatch::setPerlinModSize(Number size) {
+	perlinModSize = size;
+}
+
+void SceneParticleBatch::setEmitterRadius(Vector3 rad) {
+	emitterRadius = rad;
+}
+
+bool SceneParticleBatch::emitterEnabled() {
+	return isEmitterEnabled;
+}
+
+void SceneParticleBatch::enableEmitter(bool val) {
+	isEmitterEnabled = val;
+	if(val) {
+		for(int i=0; i < numParticles; i++) {
+			life[i] = lifespan * ((Number)rand()/RAND_MAX);
+		}
+	}
+}
+
+void SceneParticleBatch::setAllAtOnce(bool val) {
+	allAtOnce = val;
+	for(int i=0; i < numParticles; i++) {
+		if(allAtOnce)
+			life[i] = 0;
+		else
+			life[i] = lifespan * ((Number)rand()/RAND_MAX);
+	}
+}
+
+void SceneParticleBatch::Trigger() {
+	if(!isEmitterEnabled)
+		return;
+	emitterMatrix = getConcatenatedMatrix();
+	for(int i=0; i < numParticles; i++) {
+		resetParticle(i, emitterMatrix);
+		life[i] = 0;
+	}
+}
+
+unsigned int SceneParticleBatch::getParticleCount() {
+	return numParticles;
+}
+
+unsigned int SceneParticleBatch::getNumVisibleParticles() {
+	return numVisibleParticles;
+}
+
+void SceneParticleBatch::resizeParticleArrays(unsigned int count) {
+	positionX.resize(count);
+	positionY.resize(count);
+	positionZ.resize(count);
+	velocityX.resize(count);
+	velocityY.resize(count);
+	velocityZ.resize(count);
+	life.resize(count);
+	rotation.resize(count);
+	brightness.resize(count);
+	perlinPosX.resize(count);
+	perlinPosY.resize(count);
+	perlinPosZ.resize(count);
+}
+
+void SceneParticleBatch::setParticleCount(unsigned int count) {
+	unsigned int oldCount = numParticles;
+	resizeParticleArrays(count);
+	numParticles = count;
+	for(int i=oldCount; i < count; i++) {
+		resetParticle(i, emitterMatrix);
+		life[i] = lifespan * ((Number)rand()/RAND_MAX);
+	}
+}
+
+void SceneParticleBatch::resetParticle(unsigned int index, Matrix4 &baseMatrix) {
+	Vector3 startVector = Vector3(-(emitterRadius.x/2.0f)+emitterRadius.x*((Number)rand()/RAND_MAX),-(emitterRadius.y/2.0f)+emitterRadius.y*((Number)rand()/RAND_MAX),-(emitterRadius.z/2.0f)+emitterRadius.z*((Number)rand()/RAND_MAX));
+	startVector = baseMatrix * startVector;
+	
+	Vector3 velVector = dirVector;
+	velVector.x += (deviation.x/2.0f*-1.0f) + ((deviation.x)*((Number)rand()/RAND_MAX));
+	velVector.y += (deviation.y/2.0f*-1.0f) + ((deviation.y)*((Number)rand()/RAND_MAX));
+	velVector.z += (deviation.z/2.0f*-1.0f) + ((deviation.z)*((Number)rand()/RAND_MAX));
+	velVector = baseMatrix.rotateVector(velVector);
+	
+	positionX[index] = startVector.x;
+	positionY[index] = startVector.y;
+	positionZ[index] = startVector.z;
+	velocityX[index] = velVector.x;
+	velocityY[index] = velVector.y;
+	velocityZ[index] = velVector.z;
+	rotation[index] = 0;
+	brightness[index] = 1.0f - ( (-brightnessDeviation) + ((brightnessDeviation*2) * ((Number)rand()/RAND_MAX)));
+	perlinPosX[index] = (Number)rand()/RAND_MAX;
+	perlinPosY[index] = (Number)rand()/RAND_MAX;
+	perlinPosZ[index] = (Number)rand()/RAND_MAX;
+	
+	if(emitterType == ParticleEmitter::CONTINUOUS_EMITTER && life[index] > lifespan)
+		life[index] = life[index] - lifespan;
+	else
+		life[index] = 0;
+}
+
+void SceneParticleBatch::updateParticleRange(unsigned int start, unsigned int end, Number elapsed) {
+	float step = elapsed * particleSpeedMod;
+	float gX = gravVector.x * step;
+	float gY = gravVector.y * step;
+	float gZ = gravVector.z * step;
+	float spin = rotationSpeed * elapsed;
+	
+	float *px = &positionX[0];
+	float *py = &positionY[0];
+	float *pz = &positionZ[0];
+	float *vx = &velocityX[0];
+	float *vy = &velocityY[0];
+	float *vz = &velocityZ[0];
+	float *lf = &life[0];
+	float *rot = &rotation[0];
+	
+	// straight passes over each attribute so the compiler can vectorize them
+	for(unsigned int i=start; i < end; i++) {
+		lf[i] += elapsed;
+		rot[i] += spin;
+	}
+	for(unsigned int i=start; i < end; i++) {
+		vx[i] -= gX;
+		vy[i] -= gY;
+		vz[i] -= gZ;
+	}
+	for(unsigned int i=start; i < end; i++) {
+		px[i] += vx[i] * step;
+		py[i] += vy[i] * step;
+		pz[i] += vz[i] * step;
+	}
+	
+	if(perlinEnabled) {
+		float perlinStep = perlinModSize * step;
+		for(unsigned int i=start; i < end; i++) {
+			Number normLife = lf[i] / lifespan;
+			px[i] += perlinStep * motionPerlin->Get(normLife, perlinPosX[i]);
+			py[i] += perlinStep * motionPerlin->Get(normLife, perlinPosY[i]);
+			pz[i] += perlinStep * motionPerlin->Get(normLife, perlinPosZ[i]);
+		}
+	}
+	
+	if(isEmitterEnabled && emitterType == ParticleEmitter::CONTINUOUS_EMITTER) {
+		for(unsigned int i=start; i < end; i++) {
+			if(lf[i] > lifespan)
+				resetParticle(i, emitterMatrix);
+		}
+	}
+}
+
+void SceneParticleBatch::Update() {
+	lastElapsed = CoreServices::getInstance()->getCore()->getElapsed();
+	emitterMatrix = getConcatenatedMatrix();
+	if(numParticles > 0)
+		updateParticleRange(0, numParticles, lastElapsed);
+	updateBounds();
+}
+
+void SceneParticleBatch::updateBounds() {
+	// done on update rather than when building the quads, a culled batch
+	// is not rendered and would otherwise never grow back into view
+	Number maxDistance = 0;
+	Vector3 origin = emitterMatrix.getPosition();
+	for(int i=0; i < numParticles; i++) {
+		if(life[i] > lifespan || life[i] < 0.0f)
+			continue;
+		Number dx = positionX[i] - origin.x;
+		Number dy = positionY[i] - origin.y;
+		Number dz = positionZ[i] - origin.z;
+		Number distance = dx*dx + dy*dy + dz*dz;
+		if(distance > maxDistance)
+			maxDistance = distance;
+	}
+	bBoxRadius = sqrt(maxDistance) + particleSize;
+}
+
+void SceneParticleBatch::bakeCurveTables() {
+	for(int i=0; i < CURVE_TABLE_SIZE; i++) {
+		Number t = ((Number)i)/(CURVE_TABLE_SIZE-1);
+		scaleTable[i] = particleSize * (useScaleCurves ? scaleCurve.getHeightAt(t) : 1.0f);
+		if(useColorCurves) {
+			colorTable[i*4] = colorCurveR.getHeightAt(t);
+			colorTable[(i*4)+1] = colorCurveG.getHeightAt(t);
+			colorTable[(i*4)+2] = colorCurveB.getHeightAt(t);
+			colorTable[(i*4)+3] = colorCurveA.getHeightAt(t);
+		} else {
+			colorTable[i*4] = 1.0f;
+			colorTable[(i*4)+1] = 1.0f;
+			colorTable[(i*4)+2] = 1.0f;
+			colorTable[(i*4)+3] = 1.0f;
+		}
+	}
+}
+
+void SceneParticleBatch::buildParticleArrays() {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	// the modelview already contains this entity's transform, remove it to get from world to view space
+	Matrix4 view = emitterMatrix.inverseAffine() * renderer->getModelviewMatrix();
+	Vector3 right = Vector3(view.m[0][0], view.m[1][0], view.m[2][0]);
+	Vector3 up = Vector3(view.m[0][1], view.m[1][1], view.m[2][1]);
+	Vector3 facing = Vector3(view.m[0][2], view.m[1][2], view.m[2][2]);
+	right.Normalize();
+	up.Normalize();
+	facing.Normalize();
+	
+	bakeCurveTables();
+	Color entityColor = getCombinedColor();
+	
+	unsigned int maxVertices = numParticles * 4;
+	vertexArray->arrayPtr = realloc(vertexArray->arrayPtr, sizeof(float) * 3 * maxVertices + 1);
+	normalArray->arrayPtr = realloc(normalArray->arrayPtr, sizeof(float) * 3 * maxVertices + 1);
+	colorArray->arrayPtr = realloc(colorArray->arrayPtr, sizeof(float) * 4 * maxVertices + 1);
+	
+	// texture coordinates are the same for every quad and only need filling when the array grows
+	if(texCoordCapacity < numParticles) {
+		texCoordArray->arrayPtr = realloc(texCoordArray->arrayPtr, sizeof(float) * 2 * maxVertices + 1);
+		float *texCoords = (float*)texCoordArray->arrayPtr;
+		for(int i=0; i < numParticles; i++) {
+			texCoords[0] = 0; texCoords[1] = 0;
+			texCoords[2] = 1; texCoords[3] = 0;
+			texCoords[4] = 1; texCoords[5] = 1;
+			texCoords[6] = 0; texCoords[7] = 1;
+			texCoords += 8;
+		}
+		texCoordCapacity = numParticles;
+	}
+	
+	float *positions = (float*)vertexArray->arrayPtr;
+	float *normals = (float*)normalArray->arrayPtr;
+	float *colors = (float*)colorArray->arrayPtr;
+	
+	static const float cornerX[4] = {-0.5f, 0.5f, 0.5f, -0.5f};
+	static const float cornerY[4] = {0.5f, 0.5f, -0.5f, -0.5f};
+	
+	unsigned int visible = 0;
+	for(int i=0; i < numParticles; i++) {
+		Number lifeRatio = life[i] / lifespan;
+		if(lifeRatio > 1.0f || lifeRatio < 0.0f)
+			continue;
+		
+		int sample = (int)(lifeRatio * (CURVE_TABLE_SIZE-1));
+		float size = scaleTable[sample];
+		float *color = &colorTable[sample*4];
+		
+		Number angle;
+		if(rotationFollowsPath) {
+			Number vRight = velocityX[i]*right.x + velocityY[i]*right.y + velocityZ[i]*right.z;
+			Number vUp = velocityX[i]*up.x + velocityY[i]*up.y + velocityZ[i]*up.z;
+			angle = atan2(vUp, vRight);
+		} else {
+			angle = rotation[i] * TORADIANS;
+		}
+		Number s = sin(angle) * size;
+		Number c = cos(angle) * size;
+		
+		for(int v=0; v < 4; v++) {
+			Number cx = cornerX[v]*c - cornerY[v]*s;
+			Number cy = cornerX[v]*s + cornerY[v]*c;
+			positions[0] = positionX[i] + right.x*cx + up.x*cy;
+			positions[1] = positionY[i] + right.y*cx + up.y*cy;
+			positions[2] = positionZ[i] + right.z*cx + up.z*cy;
+			positions += 3;
+			
+			normals[0] = facing.x;
+			normals[1] = facing.y;
+			normals[2] = facing.z;
+			normals += 3;
+			
+			colors[0] = entityColor.r * color[0] * brightness[i];
+			colors[1] = entityColor.g * color[1] * brightness[i];
+			colors[2] = entityColor.b * color[2] * brightness[i];
+			colors[3] = entityColor.a * color[3] * brightness[i];
+			colors += 4;
+		}
+		
+		visible++;
+	}
+	
+	numVisibleParticles = visible;
+	vertexArray->count = visible * 4;
+	normalArray->count = visible * 4;
+	texCoordArray->count = visible * 4;
+	colorArray->count = visible * 4;
+}
+
+void SceneParticleBatch::Render() {
+	if(numParticles == 0)
+		return;
+	
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	buildParticleArrays();
+	if(numVisibleParticles == 0)
+		return;
+	
+	if(particleMaterial) {
+		renderer->applyMaterial(particleMaterial, localShaderOptions,0);
+	} else {
+		renderer->setTexture(NULL);
+	}
+	
+	renderer->pushMatrix();
+	renderer->multModelviewMatrix(emitterMatrix.inverseAffine());
+	
+	renderer->pushRenderDataArray(colorArray);
+	renderer->pushRenderDataArray(vertexArray);
+	renderer->pushRenderDataArray(normalArray);
+	renderer->pushRenderDataArray(texCoordArray);
+	renderer->drawArrays(Mesh::QUAD_MESH);
+	
+	renderer->popMatrix();
+	
+	if(particleMaterial)
+		renderer->clearShader();
+}
@@ -45,6 +45,26 @@ using namespace Polycode;
 	r0 = t - (int)t;\
 	r1 = r0 - 1.0f;
 
+// same as setup, wrapping the lattice every period cells if period is not 0
+static inline void latticeSetup(Number v, int period, int &b0, int &b1, Number &r0, Number &r1) {
+	if(period == 0) {
+		Number t = v + N;
+		b0 = ((int)t) & BM;
+		b1 = (b0+1) & BM;
+		r0 = t - (int)t;
+	} else {
+		Number cell = floor(v);
+		r0 = v - cell;
+		b0 = ((int)cell) % period;
+		if(b0 < 0)
+			b0 += period;
+		b1 = (b0+1) % period;
+		b0 &= BM;
+		b1 &= BM;
+	}
+	r1 = r0 - 1.0f;
+}
+
 Number Perlin::noise1(Number arg)
 {
 	int bx0, bx1;
@@ -52,13 +72,6 @@ Number Perlin::noise1(Number arg)
 
 	vec[0] = arg;
 
-	if (mStart)
-  {
-    srand(mSeed);
-		mStart = false;
-		init();
-	}
-
 	setup(0, bx0,bx1, rx0,rx1);
 
 	sx = s_curve(rx0);
@@ -75,13 +88,6 @@ Number Perlin::noise2(Number vec[2])
 	Number rx0, rx1, ry0, ry1, *q, sx, sy, a, b, t, u, v;
 	int i, j;
 
-	if (mStart)
-  {
-    srand(mSeed);
-		mStart = false;
-		init();
-	}
-
 	setup(0,bx0,bx1,rx0,rx1);
 	setup(1,by0,by1,ry0,ry1);
 
@@ -119,13 +125,6 @@ Number Perlin::noise3(Number vec[3])
 	Number rx0, rx1, ry0, ry1, rz0, rz1, *q, sy, sz, a, b, c, d, t, u, v;
 	int i, j;
 
-	if (mStart)
-  {
-    srand(mSeed);
-		mStart = false;
-		init();
-	}
-
 	setup(0, bx0,bx1, rx0,rx1);
 	setup(1, by0,by1, ry0,ry1);
 	setup(2, bz0,bz1, rz0,rz1);
@@ -196,19 +195,19 @@ void Perlin::init(void)
 	for (i = 0 ; i < B ; i++)
   {
 		p[i] = i;
-		g1[i] = (Number)((rand() % (B + B)) - B) / B;
+		g1[i] = (Number)((nextRandom() % (B + B)) - B) / B;
 		for (j = 0 ; j < 2 ; j++)
-			g2[i][j] = (Number)((rand() % (B + B)) - B) / B;
+			g2[i][j] = (Number)((nextRandom() % (B + B)) - B) / B;
 		normalize2(g2[i]);
 		for (j = 0 ; j < 3 ; j++)
-			g3[i][j] = (Number)((rand() % (B + B)) - B) / B;
+			g3[i][j] = (Number)((nextRandom() % (B + B)) - B) / B;
 		normalize3(g3[i]);
 	}
 
 	while (--i)
   {
 		k = p[i];
-		p[i] = p[j = rand() % B];
+		p[i] = p[j = nextRandom() % B];
 		p[j] = k;
 	}
 
@@ -237,7 +236,7 @@ Number Perlin::perlin_noise_2D(Number vec[2])
 
 	for( int i=0; i<terms; i++ )
 	{
-		result += noise2(vec)*amp;
+		result += octaveValue(noise2(vec))*amp;
 		vec[0] *= 2.0f;
 		vec[1] *= 2.0f;
     amp*=0.5f;
@@ -249,11 +248,175 @@ Number Perlin::perlin_noise_2D(Number vec[2])
 
 
 
+int Perlin::nextRandom()
+{
+	// seed-local linear congruential generator, so the tables do not depend on the global rand() state
+	mRandomState = mRandomState * 1103515245 + 12345;
+	return (mRandomState >> 16) & 0x7fff;
+}
+
+Number Perlin::octaveValue(Number n)
+{
+	switch(mFractalType) {
+		case FRACTAL_TURBULENCE:
+			return fabs(n);
+		case FRACTAL_RIDGED:
+			n = 1.0f - fabs(n);
+			return n * n;
+		default:
+			return n;
+	}
+}
+
+void Perlin::setFractalType(int type)
+{
+	mFractalType = type;
+}
+
+int Perlin::getFractalType()
+{
+	return mFractalType;
+}
+
+Number Perlin::Get1D(Number x)
+{
+	Number result = 0.0f;
+	Number amp = mAmplitude;
+	x *= mFrequency;
+	for(int i=0; i < mOctaves; i++) {
+		result += octaveValue(noise1(x))*amp;
+		x *= 2.0f;
+		amp *= 0.5f;
+	}
+	return result;
+}
+
+Number Perlin::Get3D(Number x, Number y, Number z)
+{
+	Number vec[3];
+	Number result = 0.0f;
+	Number amp = mAmplitude;
+	vec[0] = x * mFrequency;
+	vec[1] = y * mFrequency;
+	vec[2] = z * mFrequency;
+	for(int i=0; i < mOctaves; i++) {
+		result += octaveValue(noise3(vec))*amp;
+		vec[0] *= 2.0f;
+		vec[1] *= 2.0f;
+		vec[2] *= 2.0f;
+		amp *= 0.5f;
+	}
+	return result;
+}
+
+void Perlin::fillArray1D(Number *values, unsigned int count, Number x, Number stepX)
+{
+	for(unsigned int i=0; i < count; i++) {
+		values[i] = Get1D(x + stepX * i);
+	}
+}
+
+void Perlin::fillPoints2D(const Number *x, const Number *y, Number *values, unsigned int count)
+{
+	for(unsigned int i=0; i < count; i++) {
+		values[i] = Get(x[i], y[i]);
+	}
+}
+
+void Perlin::fillPoints3D(const Number *x, const Number *y, const Number *z, Number *values, unsigned int count)
+{
+	for(unsigned int i=0; i < count; i++) {
+		values[i] = Get3D(x[i], y[i], z[i]);
+	}
+}
+
+void Perlin::fillGrid3D(Number *values, int width, int height, int depth, Number x, Number y, Number z, Number step)
+{
+	for(int k=0; k < depth; k++) {
+		for(int j=0; j < height; j++) {
+			Number *row = values + (k * height + j) * width;
+			for(int i=0; i < width; i++) {
+				row[i] = Get3D(x + step * i, y + step * j, z + step * k);
+			}
+		}
+	}
+}
+
+void Perlin::fillGrid2D(Number *values, int width, int height, Number x, Number y, Number stepX, Number stepY)
+{
+	fillGridOctaves(values, width, height, x, y, stepX, stepY, 0);
+}
+
+void Perlin::fillTileableGrid2D(Number *values, int width, int height, int startRow, int numRows)
+{
+	int period = (int)(mFrequency + 0.5);
+	if(period < 1)
+		period = 1;
+	fillGridOctaves(values, width, numRows, 0, ((Number)startRow)/((Number)height), 1.0f/((Number)width), 1.0f/((Number)height), period);
+}
+
+void Perlin::fillGridOctaves(Number *values, int width, int height, Number x, Number y, Number stepX, Number stepY, int period)
+{
+	int bx0, bx1, by0, by1, b00, b10, b01, b11;
+	Number rx0, rx1, ry0, ry1, *q, sx, sy, a, b, u, v;
+	int i, j;
+
+	for(int k=0; k < width*height; k++) {
+		values[k] = 0;
+	}
+	
+	Number scale = mFrequency;
+	Number amp = mAmplitude;
+	
+	// octaves outermost so the row setup is done once per row instead of once per sample
+	for(int octave=0; octave < mOctaves; octave++) {
+		for(int row=0; row < height; row++) {
+			latticeSetup((y + stepY * row) * scale, period, by0, by1, ry0, ry1);
+			sy = s_curve(ry0);
+			
+			Number *rowValues = values + row * width;
+			for(int col=0; col < width; col++) {
+				latticeSetup((x + stepX * col) * scale, period, bx0, bx1, rx0, rx1);
+				
+				i = p[bx0];
+				j = p[bx1];
+
+				b00 = p[i + by0];
+				b10 = p[j + by0];
+				b01 = p[i + by1];
+				b11 = p[j + by1];
+
+				sx = s_curve(rx0);
+
+				q = g2[b00];
+				u = at2(rx0,ry0);
+				q = g2[b10];
+				v = at2(rx1,ry0);
+				a = lerp(sx, u, v);
+
+				q = g2[b01];
+				u = at2(rx0,ry1);
+				q = g2[b11];
+				v = at2(rx1,ry1);
+				b = lerp(sx, u, v);
+
+				rowValues[col] += octaveValue(lerp(sy, a, b)) * amp;
+			}
+		}
+		scale *= 2.0f;
+		amp *= 0.5f;
+		if(period)
+			period *= 2;
+	}
+}
+
 Perlin::Perlin(int octaves,Number freq,Number amp,int seed)
 {
   mOctaves = octaves;
   mFrequency = freq;
   mAmplitude = amp;
   mSeed = seed;
-  mStart = true;
+  mFractalType = FRACTAL_FBM;
+  mRandomState = seed;
+  init();
 }
@@ -0,0 +1,276 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyProfiler.h"
+#include "PolyCoreServices.h"
+#include "PolyCore.h"
+#include <stdio.h>
+
+#if defined(_MSC_VER)
+	#include <windows.h>
+	#define PROFILER_THREAD_LOCAL __declspec(thread)
+	static inline void memoryBarrier() { MemoryBarrier(); }
+#else
+	#define PROFILER_THREAD_LOCAL __thread
+	static inline void memoryBarrier() { __sync_synchronize(); }
+#endif
+
+using namespace Polycode;
+
+bool Profiler::enabled = false;
+
+static PROFILER_THREAD_LOCAL ProfilerThreadBuffer *threadBuffer = NULL;
+
+ProfilerThreadBuffer::ProfilerThreadBuffer(long threadID, int index) {
+	this->threadID = threadID;
+	this->index = index;
+	depth = 0;
+	writeCount = 0;
+	numEvents = 0;
+}
+
+void ProfilerThreadBuffer::addEvent(const char *name, unsigned long long start, unsigned long long end, int depth) {
+	unsigned int count = writeCount;
+	ProfilerEvent &event = events[count % EVENT_BUFFER_SIZE];
+	event.name = name;
+	event.start = start;
+	event.end = end;
+	event.depth = depth;
+	
+	// publish the event before counting it
+	memoryBarrier();
+	writeCount = count + 1;
+	if(numEvents < EVENT_BUFFER_SIZE)
+		numEvents = numEvents + 1;
+}
+
+void ProfilerThreadBuffer::getEvents(vector<ProfilerEvent> &target) {
+	// numEvents is only raised after writeCount, so at least that many
+	// events end at the writeCount read after it
+	unsigned int count = numEvents;
+	memoryBarrier();
+	unsigned int end = writeCount;
+	memoryBarrier();
+	
+	unsigned int firstTarget = target.size();
+	unsigned int first = end - count;
+	for(unsigned int i=0; i < count; i++) {
+		target.push_back(events[(first + i) % EVENT_BUFFER_SIZE]);
+	}
+	
+	// the owner may have written over the oldest events while they were
+	// copied. The event it is writing now replaces the one
+	// EVENT_BUFFER_SIZE before it, so everything up to that one is dropped.
+	memoryBarrier();
+	unsigned int advanced = writeCount - end;
+	unsigned int torn = count;
+	if(advanced < EVENT_BUFFER_SIZE) {
+		int overlap = (int)(advanced + count + 1) - EVENT_BUFFER_SIZE;
+		torn = overlap > 0 ? overlap : 0;
+	}
+	if(torn > 0)
+		target.erase(target.begin() + firstTarget, target.begin() + firstTarget + torn);
+}
+
+Profiler::Profiler() {
+	core = NULL;
+	buffersMutex = NULL;
+	mainThreadID = 0;
+	frameStart = 0;
+	lastFrameStart = 0;
+	lastFrameEnd = 0;
+}
+
+Profiler *Profiler::getInstance() {
+	static Profiler *instance = NULL;
+	if(!instance)
+		instance = new Profiler();
+	return instance;
+}
+
+void Profiler::setEnabled(bool enabled) {
+	if(enabled && !core) {
+		core = CoreServices::getInstance()->getCore();
+		buffersMutex = core->createMutex();
+		mainThreadID = getThreadID();
+	}
+	Profiler::enabled = enabled;
+	frameStart = 0;
+	lastFrameStart = 0;
+	lastFrameEnd = 0;
+}
+
+bool Profiler::isEnabled() {
+	return enabled;
+}
+
+unsigned long long Profiler::getTime() {
+	if(!core)
+		return 0;
+	return core->getTicksNanoseconds();
+}
+
+ProfilerThreadBuffer *Profiler::getThreadBuffer() {
+	if(threadBuffer)
+		return threadBuffer;
+	
+	core->lockMutex(buffersMutex);
+	threadBuffer = new ProfilerThreadBuffer(getThreadID(), buffers.size());
+	buffers.push_back(threadBuffer);
+	core->unlockMutex(buffersMutex);
+	return threadBuffer;
+}
+
+void Profiler::beginFrame() {
+	if(!enabled)
+		return;
+	unsigned long long now = getTime();
+	if(frameStart > 0) {
+		lastFrameStart = frameStart;
+		lastFrameEnd = now;
+	}
+	frameStart = now;
+}
+
+Number Profiler::getLastFrameTime() {
+	return ((Number)(lastFrameEnd - lastFrameStart)) / 1000000000.0;
+}
+
+vector<ProfilerMarkerStats> Profiler::getLastFrameMarkers() {
+	vector<ProfilerMarkerStats> markers;
+	if(!core || lastFrameEnd == 0)
+		return markers;
+	
+	ProfilerThreadBuffer *mainBuffer = NULL;
+	core->lockMutex(buffersMutex);
+	for(int i=0; i < buffers.size(); i++) {
+		if(buffers[i]->threadID == mainThreadID)
+			mainBuffer = buffers[i];
+	}
+	core->unlockMutex(buffersMutex);
+	if(!mainBuffer)
+		return markers;
+	
+	vector<ProfilerEvent> events;
+	mainBuffer->getEvents(events);
+	
+	// events are recorded when they end, so sort them by start time to
+	// list parents before their children
+	vector<unsigned long long> firstStarts;
+	for(int i=0; i < events.size(); i++) {
+		ProfilerEvent &event = events[i];
+		if(event.start < lastFrameStart || event.end > lastFrameEnd)
+			continue;
+		
+		int index = -1;
+		for(int j=0; j < markers.size(); j++) {
+			if(markers[j].name == event.name && markers[j].depth == event.depth) {
+				index = j;
+				break;
+			}
+		}
+		if(index == -1) {
+			ProfilerMarkerStats stats;
+			stats.name = event.name;
+			stats.depth = event.depth;
+			stats.time = 0;
+			stats.calls = 0;
+			
+			index = 0;
+			while(index < markers.size() && firstStarts[index] <= event.start)
+				index++;
+			markers.insert(markers.begin() + index, stats);
+			firstStarts.insert(firstStarts.begin() + index, event.start);
+		} else if(event.start < firstStarts[index]) {
+			firstStarts[index] = event.start;
+		}
+		markers[index].time += ((Number)(event.end - event.start)) / 1000000000.0;
+		markers[index].calls++;
+	}
+	return markers;
+}
+
+static void writeTraceString(FILE *file, const char *str) {
+	fputc('"', file);
+	for(const char *c = str; *c; c++) {
+		if(*c == '"' || *c == '\\')
+			fputc('\\', file);
+		fputc(*c, file);
+	}
+	fputc('"', file);
+}
+
+bool Profiler::writeChromeTrace(const String &fileName) {
+	FILE *file = fopen(String(fileName).c_str(), "w");
+	if(!file) {
+		Logger::log("Error writing profiler trace to %s\n", String(fileName).c_str());
+		return false;
+	}
+	
+	vector<ProfilerThreadBuffer*> threadBuffers;
+	if(core) {
+		core->lockMutex(buffersMutex);
+		threadBuffers = buffers;
+		core->unlockMutex(buffersMutex);
+	}
+	
+	fprintf(file, "{\"traceEvents\":[\n");
+	bool first = true;
+	vector<ProfilerEvent> events;
+	for(int i=0; i < threadBuffers.size(); i++) {
+		ProfilerThreadBuffer *buffer = threadBuffers[i];
+		
+		fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", buffer->index);
+		if(buffer->threadID == mainThreadID) {
+			writeTraceString(file, "Main");
+		} else {
+			fprintf(file, "\"Thread %d\"", buffer->index);
+		}
+		fprintf(file, "}}");
+		first = false;
+		
+		events.clear();
+		buffer->getEvents(events);
+		for(int j=0; j < events.size(); j++) {
+			fprintf(file, ",\n{\"name\":");
+			writeTraceString(file, events[j].name);
+			fprintf(file, ",\"cat\":\"polycode\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}", ((double)events[j].start) / 1000.0, ((double)(events[j].end - events[j].start)) / 1000.0, buffer->index);
+		}
+	}
+	fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(file);
+	return true;
+}
+
+void ProfilerScope::begin(const char *name) {
+	buffer = Profiler::getInstance()->getThreadBuffer();
+	this->name = name;
+	depth = buffer->depth;
+	buffer->depth++;
+	start = Profiler::getInstance()->getTime();
+}
+
+void ProfilerScope::end() {
+	unsigned long long endTime = Profiler::getInstance()->getTime();
+	buffer->depth--;
+	buffer->addEvent(name, start, endTime, depth);
+}
@@ -0,0 +1,115 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyProfilerOverlay.h"
+#include "PolyCoreServices.h"
+#include "PolyCore.h"
+#include <stdio.h>
+
+using namespace Polycode;
+
+ProfilerOverlay::ProfilerOverlay(int fontSize, String fontName) : Screen() {
+	this->fontSize = fontSize;
+	this->fontName = fontName;
+	refreshInterval = 0.5;
+	timeSinceRefresh = refreshInterval;
+	numLines = 0;
+	
+	background = new ScreenShape(ScreenShape::SHAPE_RECT, 1, 1);
+	background->setPositionMode(ScreenEntity::POSITION_TOPLEFT);
+	background->setColor(0.0, 0.0, 0.0, 0.6);
+	addChild(background);
+	
+	Profiler::getInstance()->setEnabled(true);
+}
+
+ProfilerOverlay::~ProfilerOverlay() {
+	for(int i=0; i < lines.size(); i++) {
+		removeChild(lines[i]);
+		delete lines[i];
+	}
+	removeChild(background);
+	delete background;
+}
+
+void ProfilerOverlay::setRefreshInterval(Number interval) {
+	refreshInterval = interval;
+}
+
+void ProfilerOverlay::Update() {
+	timeSinceRefresh += CoreServices::getInstance()->getCore()->getElapsed();
+	if(timeSinceRefresh < refreshInterval)
+		return;
+	timeSinceRefresh = 0;
+	refresh();
+}
+
+void ProfilerOverlay::setLine(int index, const String &text) {
+	if(index >= lines.size()) {
+		ScreenLabel *label = new ScreenLabel(text, fontSize, fontName);
+		label->setPosition(4, 4 + index * (fontSize + 2));
+		addChild(label);
+		lines.push_back(label);
+		return;
+	}
+	if(lines[index]->getText() != text)
+		lines[index]->setText(text);
+	lines[index]->visible = true;
+}
+
+void ProfilerOverlay::refresh() {
+	Profiler *profiler = Profiler::getInstance();
+	char buffer[256];
+	int line = 0;
+	
+	if(!profiler->isEnabled()) {
+		setLine(line++, "Profiler disabled");
+	} else {
+		Number frameTime = profiler->getLastFrameTime();
+		sprintf(buffer, "Frame %.2f ms", frameTime * 1000.0);
+		setLine(line++, buffer);
+		
+		vector<ProfilerMarkerStats> markers = profiler->getLastFrameMarkers();
+		for(int i=0; i < markers.size() && line < MAX_LINES; i++) {
+			String indent;
+			for(int j=0; j <= markers[i].depth; j++)
+				indent += "  ";
+			if(markers[i].calls > 1)
+				sprintf(buffer, "%s %.2f ms (%d)", markers[i].name, markers[i].time * 1000.0, markers[i].calls);
+			else
+				sprintf(buffer, "%s %.2f ms", markers[i].name, markers[i].time * 1000.0);
+			setLine(line++, indent + String(buffer));
+		}
+	}
+	
+	for(int i=line; i < lines.size(); i++) {
+		lines[i]->visible = false;
+	}
+	numLines = line;
+	
+	Number width = 0;
+	for(int i=0; i < numLines; i++) {
+		if(lines[i]->getWidth() > width)
+			width = lines[i]->getWidth();
+	}
+	background->setShapeSize(width + 8, numLines * (fontSize + 2) + 8);
+}
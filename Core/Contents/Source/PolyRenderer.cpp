@@ -24,6 +24,24 @@
 
 using namespace Polycode;
 
+RendererFrameStats::RendererFrameStats() {
+	reset();
+}
+
+void RendererFrameStats::reset() {
+	numDrawCalls = 0;
+	numPrimitives = 0;
+	numVertices = 0;
+	numBufferUploads = 0;
+	numTextureBinds = 0;
+	numShaderSwitches = 0;
+	numRedundantStateSets = 0;
+	gpuTimersAvailable = false;
+	gpuSceneTime = 0;
+	gpuScreenTime = 0;
+	gpuFilterTime = 0;
+}
+
 Renderer::Renderer() : currentTexture(NULL), xRes(0), yRes(0), renderMode(0), orthoMode(false), lightingEnabled(false), clearColor(0.2f, 0.2f, 0.2f, 0.0) {
 	textureFilteringMode = TEX_FILTERING_LINEAR;
 	currentMaterial = NULL;
@@ -44,15 +62,169 @@ Renderer::Renderer() : currentTexture(NULL), xRes(0), yRes(0), renderMode(0), or
 	fov = 45.0;
 	setAmbientColor(0.0,0.0,0.0);
 	cullingFrontFaces = false;
+	currentBlendingMode = -1;
 }
 
 Renderer::~Renderer() {
 }
 
+RendererFrameStats Renderer::getFrameStats() {
+	return lastFrameStats;
+}
+
+void Renderer::beginFrameStats() {
+	lastFrameStats = currentFrameStats;
+	currentFrameStats.reset();
+}
+
+void Renderer::countDrawCall(int drawType, unsigned int numVertices) {
+	currentFrameStats.numDrawCalls++;
+	currentFrameStats.numVertices += numVertices;
+	switch(drawType) {
+		case Mesh::TRI_MESH:
+			currentFrameStats.numPrimitives += numVertices / 3;
+		break;
+		case Mesh::TRIFAN_MESH:
+		case Mesh::TRISTRIP_MESH:
+			if(numVertices > 2)
+				currentFrameStats.numPrimitives += numVertices - 2;
+		break;
+		case Mesh::QUAD_MESH:
+			currentFrameStats.numPrimitives += (numVertices / 4) * 2;
+		break;
+		case Mesh::LINE_MESH:
+			currentFrameStats.numPrimitives += numVertices / 2;
+		break;
+		case Mesh::POINT_MESH:
+			currentFrameStats.numPrimitives += numVertices;
+		break;
+	}
+}
+
+RenderDataArray *Renderer::createRenderDataArrayForMesh(Mesh *mesh, int arrayType) {
+	RenderDataArray *newArray = createRenderDataArray(arrayType);
+		
+	newArray->count = 0;
+	long bufferSize = 0;
+	long newBufferSize = 0;		
+	float* buffer = NULL;
+	
+	switch (arrayType) {
+		case RenderDataArray::VERTEX_DATA_ARRAY:
+		{		
+			buffer = (float*)malloc(1);							
+			for(int i=0; i < mesh->getPolygonCount(); i++) {
+				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
+					newArray->count++;			
+					newBufferSize = bufferSize + 3;
+					buffer = (float*)realloc(buffer, newBufferSize * sizeof(float));
+					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->x;
+					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->y;
+					buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->z;			
+					bufferSize = newBufferSize;	
+				}		   
+			}
+		}
+		break;
+		case RenderDataArray::COLOR_DATA_ARRAY:
+		{
+			buffer = (float*)malloc(1);			
+			for(int i=0; i < mesh->getPolygonCount(); i++) {
+				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
+					newBufferSize = bufferSize + 4;			
+					buffer = (float*)realloc(buffer, newBufferSize * sizeof(float));
+					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->vertexColor.r;
+					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->vertexColor.g;
+					buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->vertexColor.b;
+					buffer[bufferSize+3] = mesh->getPolygon(i)->getVertex(j)->vertexColor.a;			
+					bufferSize = newBufferSize;					
+				}		   
+			}
+		}
+		break;
+		case RenderDataArray::NORMAL_DATA_ARRAY:
+		{
+			buffer = (float*)malloc(1);	
+			
+			for(int i=0; i < mesh->getPolygonCount(); i++) {
+				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
+					newBufferSize = bufferSize + 3;			
+					buffer = (float*)realloc(buffer, newBufferSize * sizeof(float));		
+					if(mesh->getPolygon(i)->useVertexNormals) {
+						buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->normal.x;
+						buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->normal.y;
+						buffer[bufferSize+2] = mesh->getPolygon(i)->getVertex(j)->normal.z;				
+					} else {
+						buffer[bufferSize+0] = mesh->getPolygon(i)->getFaceNormal().x;
+						buffer[bufferSize+1] = mesh->getPolygon(i)->getFaceNormal().y;
+						buffer[bufferSize+2] = mesh->getPolygon(i)->getFaceNormal().z;
+					}
+					bufferSize = newBufferSize;					
+				}		   
+			}			
+		}
+		break;
+		case RenderDataArray::TEXCOORD_DATA_ARRAY:
+		{
+			buffer = (float*)malloc(1);				
+			for(int i=0; i < mesh->getPolygonCount(); i++) {
+				for(int j=0; j < mesh->getPolygon(i)->getVertexCount(); j++) {
+					newBufferSize = bufferSize + 2;			
+					buffer = (float*)realloc(buffer, newBufferSize * sizeof(float));		
+					buffer[bufferSize+0] = mesh->getPolygon(i)->getVertex(j)->getTexCoord().x;											
+					buffer[bufferSize+1] = mesh->getPolygon(i)->getVertex(j)->getTexCoord().y;							
+					bufferSize = newBufferSize;					
+				}		   
+			}			
+		}
+		break;
+		default:
+		break;
+	}
+	
+	if(buffer != NULL) {
+		free(newArray->arrayPtr);
+		newArray->arrayPtr = buffer;		
+	}
+	
+	return newArray;
+}
+
+RenderDataArray *Renderer::createRenderDataArray(int arrayType) {
+	RenderDataArray *newArray = new RenderDataArray();
+	newArray->arrayType = arrayType;
+	newArray->arrayPtr = malloc(1);
+	newArray->stride = 0;
+	newArray->count = 0;
+	
+	switch (arrayType) {
+		case RenderDataArray::VERTEX_DATA_ARRAY:
+			newArray->size = 3;
+			break;
+		case RenderDataArray::COLOR_DATA_ARRAY:
+			newArray->size = 4;
+			break;			
+		case RenderDataArray::NORMAL_DATA_ARRAY:
+			newArray->size = 3;
+			break;						
+		case RenderDataArray::TEXCOORD_DATA_ARRAY:
+			newArray->size = 2;
+			break;									
+		default:
+			break;
+	}
+	
+	return newArray;
+}
+
 void Renderer::enableShaders(bool flag) {
 	shadersEnabled = flag;
 }
 
+bool Renderer::areShadersEnabled() {
+	return shadersEnabled;
+}
+
 void Renderer::setCameraMatrix(Matrix4 matrix) {
 	cameraMatrix = matrix;
 }
@@ -36,12 +36,17 @@ String Resource::getResourceName() {
 	return name;
 }
 
+unsigned int Resource::getResourceNameSymbol() {
+	return name.getSymbol();
+}
+
 int Resource::getResourceType() {
 	return type;
 }
 
 void Resource::setResourceName(String newName) {
 	name = newName;
+	name.getSymbol();
 }
 
 void Resource::setResourcePath(String path) {
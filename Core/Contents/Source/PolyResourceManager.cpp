@@ -167,6 +167,15 @@ void ResourceManager::addResource(Resource *resource) {
 	resources.push_back(resource);
 }
 
+void ResourceManager::removeResource(Resource *resource) {
+	for(int i=0; i < resources.size(); i++) {
+		if(resources[i] == resource) {
+			resources.erase(resources.begin()+i);
+			return;
+		}
+	}
+}
+
 void ResourceManager::parseTextures(String dirPath, bool recursive) {
 	vector<OSFileEntry> resourceDir;
 	resourceDir = OSBasics::parseFolder(dirPath, false);
@@ -223,14 +232,21 @@ void ResourceManager::addDirResource(String dirPath, bool recursive) {
 }
 
 Resource *ResourceManager::getResource(int resourceType, String resourceName) {
-	Logger::log("requested %s\n", resourceName.c_str());
+	POLYCODE_LOG_DEBUG(("requested %s\n", resourceName.c_str()));
+	// resource names are interned when they are set, a name that was
+	// never interned cannot belong to any resource
+	unsigned int symbol = resourceName.findSymbol();
+	if(symbol == 0) {
+		Logger::debug("return NULL\n");
+		return NULL;
+	}
 	for(int i =0; i < resources.size(); i++) {
 //		Logger::log("is it %s?\n", resources[i]->getResourceName().c_str());		
-		if(resources[i]->getResourceName() == resourceName && resources[i]->getResourceType() == resourceType) {
+		if(resources[i]->getResourceType() == resourceType && resources[i]->getResourceNameSymbol() == symbol) {
 			return resources[i];
 		}
 	}
-	Logger::log("return NULL\n");
+	Logger::debug("return NULL\n");
 	// need to add some sort of default resource for each type
 	return NULL;
 }
\ No newline at end of file
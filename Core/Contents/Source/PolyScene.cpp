@@ -21,6 +21,7 @@
 */
 
 #include "PolyScene.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
@@ -130,7 +131,14 @@ Camera *Scene::getDefaultCamera() {
 	return defaultCamera;
 }
 
+void Scene::updateEntities() {
+	for(int i=0; i<entities.size();i++) {
+		entities[i]->doUpdates();
+	}
+}
+
 void Scene::Render(Camera *targetCamera) {
+	PROFILE_SCOPE("Scene::Render");
 	
 	if(!targetCamera && !defaultCamera)
 		return;
@@ -138,9 +146,12 @@ void Scene::Render(Camera *targetCamera) {
 	if(!targetCamera)
 		targetCamera = defaultCamera;
 	
+	// with a fixed time step, the scene manager updates entities separately
+	if(!CoreServices::getInstance()->getCore()->isFixedTimeStepEnabled())
+		updateEntities();
+	
 	// prepare lights...
 	for(int i=0; i<entities.size();i++) {
-		entities[i]->doUpdates();		
 		entities[i]->updateEntityMatrix();
 	}	
 	
@@ -344,7 +355,7 @@ void Scene::loadScene(String fileName) {
 				memset(buffer, 0, 1024);
 				OSBasics::read(buffer, 1, namelen, inFile);
 				
-				Logger::log("adding mesh (texture: %s)\n", buffer);
+				POLYCODE_LOG_DEBUG(("adding mesh (texture: %s)\n", buffer));
 				
 				OSBasics::read(&r, sizeof(Number), 1, inFile);
 				OSBasics::read(&g, sizeof(Number), 1, inFile);
@@ -366,7 +377,7 @@ void Scene::loadScene(String fileName) {
 				
 				break;
 			case ENTITY_ENTITY: {
-				Logger::log("loading entity\n");
+				Logger::debug("loading entity\n");
 				String entityType = readString(inFile);					
 				SceneEntity *newCustomEntity = new SceneEntity();
 				newCustomEntity->custEntityType = entityType;					
@@ -526,7 +537,7 @@ void Scene::writeEntityMatrix(SceneEntity *entity, OSFILE *outFile) {
 	
 }
 
-void Scene::saveScene(String fileName) {
+void Scene::saveScene(String fileName, bool packedMeshes) {
 	OSFILE *outFile = OSBasics::open(fileName.c_str(), "wb");
 	if(!outFile) {
 		Logger::log("Error opening scene file for writing\n");
@@ -561,7 +572,10 @@ void Scene::saveScene(String fileName) {
 		OSBasics::write(&stLen, sizeof(unsigned int), 1, outFile);
 		OSBasics::write(mesh->getMaterial()->getName().c_str(), 1, stLen, outFile);
 		
-		mesh->getMesh()->saveToFile(outFile);		
+		if(packedMeshes)
+			mesh->getMesh()->savePackedToFile(outFile);
+		else
+			mesh->getMesh()->saveToFile(outFile);
 	}
 	
 	/*
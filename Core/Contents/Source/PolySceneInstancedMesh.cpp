@@ -0,0 +1,398 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolySceneInstancedMesh.h"
+#include "PolyCoreServices.h"
+#include "PolyRenderer.h"
+#include "PolyPolygon.h"
+#include "PolyVertex.h"
+#include "PolyCamera.h"
+#include <math.h>
+#include <stdlib.h>
+
+using namespace Polycode;
+
+InstanceStream::InstanceStream() {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	vertexArray = renderer->createRenderDataArray(RenderDataArray::VERTEX_DATA_ARRAY);
+	normalArray = renderer->createRenderDataArray(RenderDataArray::NORMAL_DATA_ARRAY);
+	texCoordArray = renderer->createRenderDataArray(RenderDataArray::TEXCOORD_DATA_ARRAY);
+	colorArray = renderer->createRenderDataArray(RenderDataArray::COLOR_DATA_ARRAY);
+	dirty = true;
+}
+
+InstanceStream::~InstanceStream() {
+	RenderDataArray *arrays[4] = {vertexArray, normalArray, texCoordArray, colorArray};
+	for(int i=0; i < 4; i++) {
+		free(arrays[i]->arrayPtr);
+		delete arrays[i];
+	}
+}
+
+SceneInstancedMesh::SceneInstancedMesh(Mesh *mesh) : SceneMesh(mesh) {
+	meshRadius = mesh->getRadius();
+	bBoxRadius = 0;
+	cullInstances = true;
+	sourceDirty = true;
+	
+	cameraStream = new InstanceStream();
+	depthStream = new InstanceStream();
+}
+
+SceneInstancedMesh::~SceneInstancedMesh() {
+	delete cameraStream;
+	delete depthStream;
+}
+
+void SceneInstancedMesh::invalidateStreams() {
+	cameraStream->dirty = true;
+	depthStream->dirty = true;
+}
+
+unsigned int SceneInstancedMesh::addInstance(const Matrix4 &transform, Color color) {
+	MeshInstance instance;
+	instance.transform = transform;
+	instance.color = color;
+	instances.push_back(instance);
+	updateInstanceRadius(instances.size()-1);
+	invalidateStreams();
+	return instances.size()-1;
+}
+
+unsigned int SceneInstancedMesh::addInstance(const Vector3 &position) {
+	Matrix4 transform;
+	transform.identity();
+	transform.setPosition(position.x, position.y, position.z);
+	return addInstance(transform);
+}
+
+void SceneInstancedMesh::removeInstance(unsigned int index) {
+	if(index >= instances.size())
+		return;
+	instances[index] = instances[instances.size()-1];
+	instances.pop_back();
+	updateBBoxRadius();
+	invalidateStreams();
+}
+
+void SceneInstancedMesh::clearInstances() {
+	instances.clear();
+	cameraStream->visibleInstances.clear();
+	depthStream->visibleInstances.clear();
+	bBoxRadius = 0;
+	invalidateStreams();
+}
+
+void SceneInstancedMesh::setInstanceTransform(unsigned int index, const Matrix4 &transform) {
+	if(index >= instances.size())
+		return;
+	instances[index].transform = transform;
+	updateInstanceRadius(index);
+	invalidateStreams();
+}
+
+void SceneInstancedMesh::setInstanceColor(unsigned int index, Color color) {
+	if(index >= instances.size())
+		return;
+	instances[index].color = color;
+	invalidateStreams();
+}
+
+MeshInstance *SceneInstancedMesh::getInstance(unsigned int index) {
+	if(index >= instances.size())
+		return NULL;
+	return &instances[index];
+}
+
+unsigned int SceneInstancedMesh::getNumInstances() {
+	return instances.size();
+}
+
+unsigned int SceneInstancedMesh::getNumVisibleInstances() {
+	return cameraStream->visibleInstances.size();
+}
+
+void SceneInstancedMesh::rebuildInstances() {
+	meshRadius = mesh->getRadius();
+	updateBBoxRadius();
+	sourceDirty = true;
+	invalidateStreams();
+}
+
+void SceneInstancedMesh::updateInstanceRadius(unsigned int index) {
+	MeshInstance *instance = &instances[index];
+	Matrix4 *m = &instance->transform;
+	
+	// the largest axis scale bounds how far the mesh can reach from the instance origin
+	Number maxScale = 0;
+	for(int i=0; i < 3; i++) {
+		Number scale = sqrt(m->m[i][0]*m->m[i][0] + m->m[i][1]*m->m[i][1] + m->m[i][2]*m->m[i][2]);
+		if(scale > maxScale)
+			maxScale = scale;
+	}
+	instance->radius = meshRadius * maxScale;
+	
+	Number reach = instance->transform.getPosition().length() + instance->radius;
+	if(reach > bBoxRadius)
+		bBoxRadius = reach;
+}
+
+void SceneInstancedMesh::updateBBoxRadius() {
+	bBoxRadius = 0;
+	for(int i=0; i < instances.size(); i++) {
+		updateInstanceRadius(i);
+	}
+}
+
+bool SceneInstancedMesh::canBatchInstances() {
+	if(skeleton || useVertexBuffer)
+		return false;
+	
+	switch(mesh->getMeshType()) {
+		case Mesh::TRI_MESH:
+		case Mesh::QUAD_MESH:
+		case Mesh::LINE_MESH:
+		case Mesh::POINT_MESH:
+			return true;
+	}
+	return false;
+}
+
+void SceneInstancedMesh::cullInstancesToFrustum(InstanceStream *stream) {
+	vector<unsigned int> &culled = stream->culledInstances;
+	culled.clear();
+	
+	if(!cullInstances) {
+		for(int i=0; i < instances.size(); i++) {
+			culled.push_back(i);
+		}
+	} else {
+		Number planes[6][4];
+		Camera::getRendererFrustumPlanes(planes);
+		
+		for(int i=0; i < instances.size(); i++) {
+			Number *pos = instances[i].transform.m[3];
+			Number radius = instances[i].radius;
+			bool visible = true;
+			for(int p=0; p < 6; p++) {
+				if(planes[p][0]*pos[0] + planes[p][1]*pos[1] + planes[p][2]*pos[2] + planes[p][3] <= -radius) {
+					visible = false;
+					break;
+				}
+			}
+			if(visible)
+				culled.push_back(i);
+		}
+	}
+	
+	if(culled != stream->visibleInstances) {
+		stream->visibleInstances.swap(culled);
+		stream->dirty = true;
+	}
+}
+
+void SceneInstancedMesh::buildSourceArrays() {
+	sourcePositions.clear();
+	sourceNormals.clear();
+	sourceTexCoords.clear();
+	sourceColors.clear();
+	
+	for(int i=0; i < mesh->getPolygonCount(); i++) {
+		Polygon *polygon = mesh->getPolygon(i);
+		unsigned int vCount = polygon->getVertexCount();
+		Vector3 faceNormal = polygon->getFaceNormal();
+		for(int j=0; j < vCount; j++) {
+			Vertex *vert = polygon->getVertex(j);
+			sourcePositions.push_back(vert->x);
+			sourcePositions.push_back(vert->y);
+			sourcePositions.push_back(vert->z);
+			
+			Vector3 normal = polygon->useVertexNormals ? vert->normal : faceNormal;
+			sourceNormals.push_back(normal.x);
+			sourceNormals.push_back(normal.y);
+			sourceNormals.push_back(normal.z);
+			
+			Vector2 texCoord = vert->getTexCoord();
+			sourceTexCoords.push_back(texCoord.x);
+			sourceTexCoords.push_back(texCoord.y);
+			
+			sourceColors.push_back(vert->vertexColor.r);
+			sourceColors.push_back(vert->vertexColor.g);
+			sourceColors.push_back(vert->vertexColor.b);
+			sourceColors.push_back(vert->vertexColor.a);
+		}
+	}
+	sourceDirty = false;
+}
+
+void SceneInstancedMesh::buildInstanceArrays(InstanceStream *stream) {
+	vector<unsigned int> &visibleInstances = stream->visibleInstances;
+	RenderDataArray *vertexArray = stream->vertexArray;
+	RenderDataArray *normalArray = stream->normalArray;
+	RenderDataArray *texCoordArray = stream->texCoordArray;
+	RenderDataArray *colorArray = stream->colorArray;
+	
+	unsigned int meshVertexCount = sourcePositions.size() / 3;
+	unsigned int totalCount = meshVertexCount * visibleInstances.size();
+	
+	vertexArray->arrayPtr = realloc(vertexArray->arrayPtr, sizeof(float) * 3 * totalCount + 1);
+	normalArray->arrayPtr = realloc(normalArray->arrayPtr, sizeof(float) * 3 * totalCount + 1);
+	texCoordArray->arrayPtr = realloc(texCoordArray->arrayPtr, sizeof(float) * 2 * totalCount + 1);
+	colorArray->arrayPtr = realloc(colorArray->arrayPtr, sizeof(float) * 4 * totalCount + 1);
+	
+	float *positions = (float*)vertexArray->arrayPtr;
+	float *normals = (float*)normalArray->arrayPtr;
+	float *texCoords = (float*)texCoordArray->arrayPtr;
+	float *colors = (float*)colorArray->arrayPtr;
+	
+	for(int i=0; i < visibleInstances.size(); i++) {
+		MeshInstance *instance = &instances[visibleInstances[i]];
+		const Number (*m)[4] = instance->transform.m;
+		
+		Color color = stream->color * instance->color;
+		
+		for(int v=0; v < meshVertexCount; v++) {
+			const float *p = &sourcePositions[v*3];
+			positions[0] = p[0]*m[0][0] + p[1]*m[1][0] + p[2]*m[2][0] + m[3][0];
+			positions[1] = p[0]*m[0][1] + p[1]*m[1][1] + p[2]*m[2][1] + m[3][1];
+			positions[2] = p[0]*m[0][2] + p[1]*m[1][2] + p[2]*m[2][2] + m[3][2];
+			positions += 3;
+			
+			const float *n = &sourceNormals[v*3];
+			Number nx = n[0]*m[0][0] + n[1]*m[1][0] + n[2]*m[2][0];
+			Number ny = n[0]*m[0][1] + n[1]*m[1][1] + n[2]*m[2][1];
+			Number nz = n[0]*m[0][2] + n[1]*m[1][2] + n[2]*m[2][2];
+			Number len = sqrt(nx*nx + ny*ny + nz*nz);
+			if(len > 0) {
+				nx /= len;
+				ny /= len;
+				nz /= len;
+			}
+			normals[0] = nx;
+			normals[1] = ny;
+			normals[2] = nz;
+			normals += 3;
+			
+			texCoords[0] = sourceTexCoords[v*2];
+			texCoords[1] = sourceTexCoords[v*2+1];
+			texCoords += 2;
+			
+			if(mesh->useVertexColors) {
+				const float *c = &sourceColors[v*4];
+				colors[0] = color.r * c[0];
+				colors[1] = color.g * c[1];
+				colors[2] = color.b * c[2];
+				colors[3] = color.a * c[3];
+			} else {
+				colors[0] = color.r;
+				colors[1] = color.g;
+				colors[2] = color.b;
+				colors[3] = color.a;
+			}
+			colors += 4;
+		}
+	}
+	
+	vertexArray->count = totalCount;
+	normalArray->count = totalCount;
+	texCoordArray->count = totalCount;
+	colorArray->count = totalCount;
+	
+	stream->dirty = false;
+}
+
+void SceneInstancedMesh::renderBatched(InstanceStream *stream) {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	Color combinedColor = getCombinedColor();
+	if(combinedColor.r != stream->color.r || combinedColor.g != stream->color.g || combinedColor.b != stream->color.b || combinedColor.a != stream->color.a) {
+		stream->color = combinedColor;
+		stream->dirty = true;
+	}
+	
+	if(sourceDirty) {
+		buildSourceArrays();
+		invalidateStreams();
+	}
+	
+	if(stream->dirty)
+		buildInstanceArrays(stream);
+	
+	if(stream->vertexArray->count == 0)
+		return;
+	
+	renderer->pushRenderDataArray(stream->colorArray);
+	renderer->pushRenderDataArray(stream->vertexArray);
+	renderer->pushRenderDataArray(stream->normalArray);
+	renderer->pushRenderDataArray(stream->texCoordArray);
+	
+	renderer->drawArrays(mesh->getMeshType());
+}
+
+void SceneInstancedMesh::renderEachInstance(InstanceStream *stream) {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	Color combinedColor = getCombinedColor();
+	
+	for(int i=0; i < stream->visibleInstances.size(); i++) {
+		MeshInstance *instance = &instances[stream->visibleInstances[i]];
+		renderer->pushMatrix();
+		renderer->multModelviewMatrix(instance->transform);
+		renderer->setVertexColor(combinedColor.r * instance->color.r, combinedColor.g * instance->color.g, combinedColor.b * instance->color.b, combinedColor.a * instance->color.a);
+		if(useVertexBuffer) {
+			renderer->drawVertexBuffer(mesh->getVertexBuffer());
+		} else {
+			renderMeshLocally();
+		}
+		renderer->popMatrix();
+	}
+	renderer->setVertexColor(combinedColor.r, combinedColor.g, combinedColor.b, combinedColor.a);
+}
+
+void SceneInstancedMesh::Render() {
+	
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	// shadow maps are rendered with shaders disabled
+	InstanceStream *stream = renderer->areShadersEnabled() ? cameraStream : depthStream;
+	
+	cullInstancesToFrustum(stream);
+	if(stream->visibleInstances.size() == 0)
+		return;
+	
+	if(material) {
+		renderer->applyMaterial(material, localShaderOptions,0);
+	} else {
+		if(texture)
+			renderer->setTexture(texture);
+		else
+			renderer->setTexture(NULL);
+	}
+	
+	if(canBatchInstances()) {
+		renderBatched(stream);
+	} else {
+		renderEachInstance(stream);
+	}
+	
+	if(material) 
+		renderer->clearShader();
+}
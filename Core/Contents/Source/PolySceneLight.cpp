@@ -44,6 +44,9 @@ SceneLight::SceneLight(int type, Scene *parentScene, Number intensity, Number co
 	spotCamera = NULL;
 	this->parentScene = parentScene;
 	shadowsEnabled = false;
+	shadowMapCaching = true;
+	shadowMapDirty = true;
+	shadowMapRendered = false;
 	lightColor.setColor(1.0f,1.0f,1.0f,1.0f);
 	setSpotlightProperties(40,0.1);
 	
@@ -86,6 +89,7 @@ void SceneLight::enableShadows(bool val, Number resolution) {
 		}
 		shadowMapRes = resolution;
 		shadowsEnabled = true;
+		shadowMapDirty = true;
 	} else {
 		shadowsEnabled = false;
 	}
@@ -108,6 +112,76 @@ void SceneLight::setIntensity(Number newIntensity) {
 
 void SceneLight::setShadowMapFOV(Number fov) {
 	shadowMapFOV = fov;
+	shadowMapDirty = true;
+}
+
+void SceneLight::setShadowMapCaching(bool val) {
+	shadowMapCaching = val;
+	shadowMapDirty = true;
+}
+
+void SceneLight::invalidateShadowMap() {
+	shadowMapDirty = true;
+}
+
+bool SceneLight::shadowMapNeedsUpdate(Scene *scene) {
+	if(!shadowMapCaching || shadowMapDirty)
+		return true;
+	
+	Matrix4 lightMatrix = getConcatenatedMatrix();
+	for(int i=0; i < 16; i++) {
+		if(lightMatrix.ml[i] != shadowLightMatrix.ml[i])
+			return true;
+	}
+	
+	int numCasters = 0;
+	for(int i=0; i < scene->getNumEntities(); i++) {
+		SceneEntity *entity = scene->getEntity(i);
+		if(!entity->castShadows)
+			continue;
+		
+		if(numCasters >= shadowCasters.size() || shadowCasters[numCasters].entity != entity)
+			return true;
+		
+		ShadowCasterState *caster = &shadowCasters[numCasters];
+		numCasters++;
+		
+		if(caster->hierarchyVersion != entity->getHierarchyVersion())
+			return true;
+		
+		if(caster->changeRevision == entity->getChangeRevision())
+			continue;
+		
+		// the light has not moved, so the frustum planes of the last
+		// depth render are still valid
+		bool inFrustum = entity->getBBoxRadius() <= 0 || spotCamera->isSphereInFrustrum(entity->getPosition(), entity->getBBoxRadius());
+		if(caster->inFrustum || inFrustum)
+			return true;
+		
+		// moved, but stayed outside of the light
+		caster->changeRevision = entity->getChangeRevision();
+	}
+	
+	return numCasters != shadowCasters.size();
+}
+
+void SceneLight::storeShadowCasters(Scene *scene) {
+	shadowCasters.clear();
+	for(int i=0; i < scene->getNumEntities(); i++) {
+		SceneEntity *entity = scene->getEntity(i);
+		if(!entity->castShadows)
+			continue;
+		
+		ShadowCasterState caster;
+		caster.entity = entity;
+		caster.changeRevision = entity->getChangeRevision();
+		caster.hierarchyVersion = entity->getHierarchyVersion();
+		caster.inFrustum = entity->getBBoxRadius() <= 0 || spotCamera->isSphereInFrustrum(entity->getPosition(), entity->getBBoxRadius());
+		shadowCasters.push_back(caster);
+	}
+	
+	shadowLightMatrix = getConcatenatedMatrix();
+	shadowMapDirty = false;
 }
 
 SceneLight::~SceneLight() {
@@ -115,6 +189,10 @@ SceneLight::~SceneLight() {
 }
 
 void SceneLight::renderDepthMap(Scene *scene) {
+	shadowMapRendered = shadowMapNeedsUpdate(scene);
+	if(!shadowMapRendered)
+		return;
+	
 	CoreServices::getInstance()->getRenderer()->clearScreen();
 	CoreServices::getInstance()->getRenderer()->pushMatrix();
 	CoreServices::getInstance()->getRenderer()->loadIdentity();
@@ -123,6 +201,7 @@ void SceneLight::renderDepthMap(Scene *scene) {
 	CoreServices::getInstance()->getRenderer()->bindFrameBufferTexture(zBufferTexture);	
 
 	scene->RenderDepthOnly(spotCamera);
+	storeShadowCasters(scene);
 		
 	lightViewMatrix = CoreServices::getInstance()->getRenderer()->getModelviewMatrix() *  CoreServices::getInstance()->getRenderer()->getProjectionMatrix();
 	CoreServices::getInstance()->getRenderer()->unbindFramebuffers();
@@ -21,6 +21,7 @@
 */
 
 #include "PolySceneManager.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
@@ -56,10 +57,35 @@ void SceneManager::updateRenderTextures(Scene *scene) {
 }
 
 void SceneManager::UpdateVirtual() {
+	renderTargets(true);
+}
+
+void SceneManager::RenderVirtual() {
+	renderTargets(false);
+}
+
+void SceneManager::fixedUpdate() {
+	for(int i=0;i<renderTextures.size();i++) {
+		if(renderTextures[i]->getTargetScene()->isVirtual()) {
+			renderTextures[i]->getTargetScene()->Update();
+			renderTextures[i]->getTargetScene()->updateEntities();
+		}
+	}
+	for(int i=0;i<scenes.size();i++) {
+		if(scenes[i]->isEnabled() && !scenes[i]->isVirtual()) {
+			scenes[i]->Update();
+			scenes[i]->updateEntities();
+		}
+	}
+}
+
+void SceneManager::renderTargets(bool updateScenes) {
+	PROFILE_SCOPE("SceneManager::renderTargets");
+	CoreServices::getInstance()->getRenderer()->beginGPUTimer(Renderer::GPU_TIMER_SCENE);
 	for(int i=0;i<renderTextures.size();i++) {
 		CoreServices::getInstance()->getRenderer()->setViewportSize(renderTextures[i]->getTargetTexture()->getWidth(), renderTextures[i]->getTargetTexture()->getHeight());
 		CoreServices::getInstance()->getRenderer()->loadIdentity();
-		if(renderTextures[i]->getTargetScene()->isVirtual())
+		if(updateScenes && renderTextures[i]->getTargetScene()->isVirtual())
 			renderTextures[i]->getTargetScene()->Update();
 			
 	CoreServices::getInstance()->getRenderer()->bindFrameBufferTexture(renderTextures[i]->getTargetTexture());	
@@ -72,15 +98,26 @@ void SceneManager::UpdateVirtual() {
 		CoreServices::getInstance()->getRenderer()->loadIdentity();
 	}
 	CoreServices::getInstance()->getRenderer()->setViewportSize(CoreServices::getInstance()->getRenderer()->getXRes(), CoreServices::getInstance()->getRenderer()->getYRes());
-
+	CoreServices::getInstance()->getRenderer()->endGPUTimer(Renderer::GPU_TIMER_SCENE);
 }
 
 void SceneManager::Update() {
+	renderScenes(true);
+}
+
+void SceneManager::Render() {
+	renderScenes(false);
+}
+
+void SceneManager::renderScenes(bool updateScenes) {
+	PROFILE_SCOPE(updateScenes ? "SceneManager::Update" : "SceneManager::Render");
+	CoreServices::getInstance()->getRenderer()->beginGPUTimer(Renderer::GPU_TIMER_SCENE);
 	for(int i=0;i<scenes.size();i++) {
 		if(scenes[i]->isEnabled() && !scenes[i]->isVirtual()) {
 			CoreServices::getInstance()->getRenderer()->loadIdentity();
 			Scene *scene = scenes[i];
-			scene->Update();
+			if(updateScenes)
+				scene->Update();
 			if(scene->getDefaultCamera()->hasFilterShader()) {
 				scene->getDefaultCamera()->drawFilter();
 			} else {
@@ -88,4 +125,5 @@ void SceneManager::Update() {
 			}
 		}
 	}
+	CoreServices::getInstance()->getRenderer()->endGPUTimer(Renderer::GPU_TIMER_SCENE);
 }
\ No newline at end of file
@@ -26,32 +26,28 @@ using namespace Polycode;
 
 SceneMesh::SceneMesh(String fileName) : SceneEntity(), texture(NULL), material(NULL) {
 	mesh = new Mesh(fileName);
-	bBoxRadius = mesh->getRadius();
-	bBox = mesh->calculateBBox();
-	skeleton = NULL;
-	lightmapIndex=0;
-	showVertexNormals = false;
-	useVertexBuffer = false;
+	initMesh();
 }
 
 SceneMesh::SceneMesh(Mesh *mesh) : SceneEntity(), texture(NULL), material(NULL) {
 	this->mesh = mesh;
-	bBoxRadius = mesh->getRadius();
-	bBox = mesh->calculateBBox();
-	skeleton = NULL;
-	lightmapIndex=0;
-	showVertexNormals = false;	
-	useVertexBuffer = false;	
+	initMesh();
 }
 
-SceneMesh::SceneMesh(int meshType) : texture(NULL), material(NULL) {
+SceneMesh::SceneMesh(int meshType) : SceneEntity(), texture(NULL), material(NULL) {
 	mesh = new Mesh(meshType);
+	initMesh();
+}
+
+void SceneMesh::initMesh() {
 	bBoxRadius = mesh->getRadius();
 	bBox = mesh->calculateBBox();
 	skeleton = NULL;
+	skinnedPoseRevision = 0;
 	lightmapIndex=0;
 	showVertexNormals = false;	
-	useVertexBuffer = false;	
+	useVertexBuffer = false;
+	markChanged();
 }
 
 void SceneMesh::setMesh(Mesh *mesh) {
@@ -60,6 +56,8 @@ void SceneMesh::setMesh(Mesh *mesh) {
 	bBox = mesh->calculateBBox();
 	showVertexNormals = false;	
 	useVertexBuffer = false;	
+	skinnedPoseRevision = 0;
+	markChanged();
 }
 
 
@@ -108,6 +106,7 @@ void SceneMesh::loadSkeleton(String fileName) {
 
 void SceneMesh::setSkeleton(Skeleton *skeleton) {
 	this->skeleton = skeleton;
+	skinnedPoseRevision = 0;
 	for(int i=0; i < mesh->getPolygonCount(); i++) {
 		Polygon *polygon = mesh->getPolygon(i);
 		unsigned int vCount = polygon->getVertexCount();
@@ -128,58 +127,74 @@ Skeleton *SceneMesh::getSkeleton() {
 	return skeleton;
 }
 
-void SceneMesh::renderMeshLocally() {
-	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+unsigned int SceneMesh::getContentRevision() {
+	if(skeleton)
+		return skeleton->getPoseRevision();
+	return 0;
+}
+
+void SceneMesh::skinMesh() {
+	// combine the rest and pose matrices of every bone once, instead of
+	// once for every bone assignment of every vertex
+	int numBones = skeleton->getNumBones();
+	skinPalette.resize(numBones);
+	for(int i=0; i < numBones; i++) {
+		Bone *bone = skeleton->getBone(i);
+		skinPalette[i] = bone->getRestMatrix() * bone->getFinalMatrix();
+	}
 	
-	if(skeleton) {	
-		for(int i=0; i < mesh->getPolygonCount(); i++) {
-			Polygon *polygon = mesh->getPolygon(i);			
-			unsigned int vCount = polygon->getVertexCount();			
-			for(int j=0; j < vCount; j++) {
-				Vertex *vert = polygon->getVertex(j);
-				Vector3 norm;
-				
-					Vector3 aPos = vert->restPosition;
-					Vector3 tPos;
-				
-					Number mult = 0;
-					for(int b =0; b < vert->getNumBoneAssignments(); b++) {
-						BoneAssignment *bas = vert->getBoneAssignment(b);
-						mult += bas->weight;
-					}
-					mult = 1.0f/mult;
-				
-					for(int b =0; b < vert->getNumBoneAssignments(); b++) {
-						BoneAssignment *bas = vert->getBoneAssignment(b);
-						Bone *bone = bas->bone;
-						if(bone) {
-							
-							Matrix4 restMatrix = bone->getRestMatrix();
-							Matrix4 finalMatrix = bone->getFinalMatrix();
-							
-							Vector3 vec = restMatrix * aPos;
-							tPos += finalMatrix * vec * (bas->weight*mult);
-							
-							Vector3 nvec = vert->restNormal;
-							nvec = restMatrix.rotateVector(nvec);
-							nvec = finalMatrix.rotateVector(nvec);
-							
-							norm += nvec * (bas->weight*mult);
-						}
-					}					
-					
-				
-					vert->x = tPos.x;
-					vert->y = tPos.y;
-					vert->z = tPos.z;				
-				
-					norm.Normalize();
-					vert->setNormal(norm.x, norm.y, norm.z);
+	for(int i=0; i < mesh->getPolygonCount(); i++) {
+		Polygon *polygon = mesh->getPolygon(i);			
+		unsigned int vCount = polygon->getVertexCount();			
+		for(int j=0; j < vCount; j++) {
+			Vertex *vert = polygon->getVertex(j);
+			unsigned int numAssignments = vert->getNumBoneAssignments();
+			
+			Number mult = 0;
+			for(int b=0; b < numAssignments; b++) {
+				mult += vert->getBoneAssignment(b)->weight;
+			}
+			if(mult > 0)
+				mult = 1.0f/mult;
+			
+			Vector3 tPos;
+			Vector3 norm;
+			for(int b=0; b < numAssignments; b++) {
+				BoneAssignment *bas = vert->getBoneAssignment(b);
+				if(!bas->bone || (int)bas->boneID >= numBones)
+					continue;
 				
+				Matrix4 *skinMatrix = &skinPalette[bas->boneID];
+				Number weight = bas->weight * mult;
+				tPos += (*skinMatrix) * vert->restPosition * weight;
+				norm += skinMatrix->rotateVector(vert->restNormal) * weight;
 			}
+			
+			vert->x = tPos.x;
+			vert->y = tPos.y;
+			vert->z = tPos.z;
+			
+			norm.Normalize();
+			vert->setNormal(norm.x, norm.y, norm.z);
 		}
-		mesh->arrayDirtyMap[RenderDataArray::VERTEX_DATA_ARRAY] = true;		
-		mesh->arrayDirtyMap[RenderDataArray::NORMAL_DATA_ARRAY] = true;		
+	}
+	mesh->arrayDirtyMap[RenderDataArray::VERTEX_DATA_ARRAY] = true;		
+	mesh->arrayDirtyMap[RenderDataArray::NORMAL_DATA_ARRAY] = true;		
+}
+
+void SceneMesh::renderMeshLocally() {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	if(skeleton) {
+		skeleton->setRendered();
+	}
+	
+	// skin only when the skeleton pose has changed since the last render,
+	// so every pass in a frame (shadow maps, render textures and the main
+	// view) shares one skinning result
+	if(skeleton && skeleton->getPoseRevision() != skinnedPoseRevision) {	
+		skinnedPoseRevision = skeleton->getPoseRevision();
+		skinMesh();
 	}
 
 	if(mesh->useVertexColors) {
@@ -24,6 +24,21 @@
 
 using namespace Polycode;
 
+// orders routed entities like the recursive routing does: screen children
+// from the top down, each subtree depth first
+class ScreenRouteOrder {
+public:
+	ScreenRouteOrder(ScreenSpatialIndex *index) : index(index) {}
+	bool operator()(int a, int b) const {
+		ScreenSpatialIndexEntry *entryA = index->getEntry(a);
+		ScreenSpatialIndexEntry *entryB = index->getEntry(b);
+		if(entryA->topIndex != entryB->topIndex)
+			return entryA->topIndex > entryB->topIndex;
+		return entryA->order < entryB->order;
+	}
+	ScreenSpatialIndex *index;
+};
+
 Screen::Screen() : EventDispatcher() {
 	offset.x = 0;
 	offset.y = 0;
@@ -34,7 +49,11 @@ Screen::Screen() : EventDispatcher() {
 	filterShaderMaterial = NULL;
 	_hasFilterShader = false;
 	useNormalizedCoordinates = false;
+	spatialIndexDirty = true;
+	spatialIndexHierarchyVersion = 0;
+	batchingEnabled = true;
 	rootEntity = new ScreenEntity();
+	rootEntity->setBatchMode(ScreenEntity::RENDER_BATCH_GROUP);
 	addChild(rootEntity);
 }
 
@@ -52,6 +71,11 @@ void Screen::setNormalizedCoordinates(bool newVal, Number yCoordinateSize) {
 
 void Screen::handleInputEvent(InputEvent *inputEvent) {
 	
+	if(inputEvent->getEventCode() == InputEvent::EVENT_MOUSEMOVE) {
+		routeMouseMove(inputEvent->mousePosition.x-offset.x, inputEvent->mousePosition.y-offset.y, inputEvent->timestamp);
+		return;
+	}
+	
 	for(int i=children.size()-1; i >= 0; i--) {
 		switch(inputEvent->getEventCode()) {
 			case InputEvent::EVENT_MOUSEDOWN:
@@ -59,9 +83,6 @@ void Screen::handleInputEvent(InputEvent *inputEvent) {
 				children[i]->blockMouseInput)
 					return;
 			break;
-			case InputEvent::EVENT_MOUSEMOVE:
-				children[i]->_onMouseMove(inputEvent->mousePosition.x-offset.x, inputEvent->mousePosition.y-offset.y, inputEvent->timestamp);
-			break;
 			case InputEvent::EVENT_MOUSEUP:
 				if(children[i]->_onMouseUp(inputEvent->mousePosition.x-offset.x, inputEvent->mousePosition.y-offset.y, inputEvent->mouseButton, inputEvent->timestamp) &&
 				children[i]->blockMouseInput)
@@ -83,10 +104,129 @@ void Screen::handleInputEvent(InputEvent *inputEvent) {
 	}
 }
 
+void Screen::routeMouseMove(Number x, Number y, int timestamp) {
+	InputEvent event(Vector2(x,y), timestamp);
+	
+	updateSpatialIndex();
+	
+	// dragged entities move first, so the hit tests below see them in
+	// their new positions
+	if(draggedEntries.size() > 0) {
+		for(int i=0; i < draggedEntries.size(); i++) {
+			ScreenSpatialIndexEntry *entry = spatialIndex.getEntry(draggedEntries[i]);
+			if(entry->areParentsEnabled())
+				entry->entity->_updateDrag(x - entry->originX, y - entry->originY);
+		}
+		updateSpatialIndex();
+	}
+	
+	routedEntries.clear();
+	spatialIndex.queryPoint(x, y, true, routedEntries);
+	for(int i=0; i < hoveredEntries.size(); i++) {
+		if(spatialIndex.getEntry(hoveredEntries[i])->hovered && std::find(routedEntries.begin(), routedEntries.end(), hoveredEntries[i]) == routedEntries.end())
+			routedEntries.push_back(hoveredEntries[i]);
+	}
+	for(int i=0; i < draggedEntries.size(); i++) {
+		if(std::find(routedEntries.begin(), routedEntries.end(), draggedEntries[i]) == routedEntries.end())
+			routedEntries.push_back(draggedEntries[i]);
+	}
+	std::sort(routedEntries.begin(), routedEntries.end(), ScreenRouteOrder(&spatialIndex));
+	
+	hoveredEntries.clear();
+	for(int i=0; i < routedEntries.size(); i++) {
+		ScreenSpatialIndexEntry *entry = spatialIndex.getEntry(routedEntries[i]);
+		// entities under disabled parents keep their state until they
+		// are enabled again
+		if(!entry->areParentsEnabled()) {
+			if(entry->hovered)
+				hoveredEntries.push_back(routedEntries[i]);
+			continue;
+		}
+		entry->hovered = entry->entity->_handleMouseMove(x - entry->originX, y - entry->originY, timestamp, &event);
+		if(entry->hovered)
+			hoveredEntries.push_back(routedEntries[i]);
+	}
+}
+
+void Screen::updateSpatialIndex() {
+	if(spatialIndexDirty || spatialIndexHierarchyVersion != getHierarchyVersion()) {
+		spatialIndex.beginUpdate();
+		draggedEntries.clear();
+		int order = 0;
+		for(int i=0; i < children.size(); i++) {
+			indexEntity(children[i], 0, 0, i, &order);
+		}
+		spatialIndex.endUpdate();
+		
+		spatialIndexDirty = false;
+		spatialIndexHierarchyVersion = getHierarchyVersion();
+		return;
+	}
+	
+	for(int i=0; i < children.size(); i++) {
+		if(children[i]->hasBoundsChanged() || children[i]->hasChildBoundsChanged())
+			indexChangedEntities(children[i]);
+	}
+}
+
+// the versions of the top level entities only ever go up, so their sum
+// changes whenever an entity is added or removed anywhere below them.
+// Adding or removing a top level entity invalidates the index directly.
+unsigned int Screen::getHierarchyVersion() {
+	unsigned int version = 0;
+	for(int i=0; i < children.size(); i++) {
+		version += children[i]->getHierarchyVersion();
+	}
+	return version;
+}
+
+void Screen::indexEntity(ScreenEntity *entity, Number originX, Number originY, int topIndex, int *order) {
+	int id = spatialIndex.updateEntity(entity, originX, originY, topIndex, *order);
+	(*order)++;
+	entity->clearBoundsChanged();
+	
+	vector<int>::iterator dragged = std::find(draggedEntries.begin(), draggedEntries.end(), id);
+	if(entity->isDragging() && dragged == draggedEntries.end())
+		draggedEntries.push_back(id);
+	else if(!entity->isDragging() && dragged != draggedEntries.end())
+		draggedEntries.erase(dragged);
+	
+	Vector3 position = entity->getPosition();
+	for(int i=0; i < entity->getNumChildren(); i++) {
+		indexEntity((ScreenEntity*)entity->getChildAtIndex(i), originX + position.x, originY + position.y, topIndex, order);
+	}
+}
+
+// without hierarchy changes every entity keeps its entry, origin and
+// order, so a moved entity and its children can be indexed on their own
+void Screen::indexChangedEntities(ScreenEntity *entity) {
+	ScreenSpatialIndexEntry *entry = spatialIndex.getEntry(entity->spatialIndexId);
+	if(entity->hasBoundsChanged()) {
+		int order = entry->order;
+		indexEntity(entity, entry->originX, entry->originY, entry->topIndex, &order);
+		return;
+	}
+	
+	entity->clearBoundsChanged();
+	for(int i=0; i < entity->getNumChildren(); i++) {
+		ScreenEntity *child = (ScreenEntity*)entity->getChildAtIndex(i);
+		if(child->hasBoundsChanged() || child->hasChildBoundsChanged())
+			indexChangedEntities(child);
+	}
+}
+
+void Screen::invalidateSpatialIndex() {
+	spatialIndexDirty = true;
+}
+
 void Screen::setRenderer(Renderer *renderer) {
 	this->renderer = renderer;
 }
 
+void Screen::setBatchingEnabled(bool enabled) {
+	batchingEnabled = enabled;
+}
+
 void Screen::setScreenOffset(Number x, Number y) {
 	offset.x = x;
 	offset.y = y;
@@ -116,6 +256,7 @@ void Screen::sortChildren() {
 		children[i]->zindex = newz;
 		newz++;
 	}
+	invalidateSpatialIndex();
 }
 
 void Screen::handleEvent(Event *event) {
@@ -189,6 +330,7 @@ void Screen::drawFilter() {
 	
 	CoreServices::getInstance()->getRenderer()->unbindFramebuffers();
 	
+	CoreServices::getInstance()->getRenderer()->beginGPUTimer(Renderer::GPU_TIMER_FILTER);
 	ShaderBinding* materialBinding;		
 	for(int i=0; i < filterShaderMaterial->getNumShaders(); i++) {
 		materialBinding = filterShaderMaterial->getShaderBinding(i);
@@ -224,7 +366,7 @@ void Screen::drawFilter() {
 		 CoreServices::getInstance()->getRenderer()->loadIdentity();
 		 */
 	}
-	
+	CoreServices::getInstance()->getRenderer()->endGPUTimer(Renderer::GPU_TIMER_FILTER);
 }
 
 bool Screen::hasFilterShader() {
@@ -242,6 +384,7 @@ ScreenEntity* Screen::addChild(ScreenEntity *newEntity) {
 	newEntity->addEventListener(this, ScreenEvent::ENTITY_MOVE_UP);
 	newEntity->zindex = getHighestZIndex()+1;
 	sortChildren();
+	invalidateSpatialIndex();
 	return newEntity;
 }
 
@@ -258,6 +401,7 @@ ScreenEntity* Screen::removeChild(ScreenEntity *entityToRemove) {
 			children.erase(children.begin()+i);
 		}
 	}
+	invalidateSpatialIndex();
 	return entityToRemove;
 }
 
@@ -270,19 +414,51 @@ void Screen::Update() {
 }
 
 ScreenEntity *Screen::getEntityAt(Number x, Number y) {
-	for(int i=children.size()-1; i >= 0;i--) {
-		if(children[i]->hitTest(x,y))
-			return children[i];
+	updateSpatialIndex();
+	
+	routedEntries.clear();
+	spatialIndex.queryPoint(x, y, false, routedEntries);
+	
+	ScreenSpatialIndexEntry *topEntry = NULL;
+	for(int i=0; i < routedEntries.size(); i++) {
+		ScreenSpatialIndexEntry *entry = spatialIndex.getEntry(routedEntries[i]);
+		if(children[entry->topIndex] != entry->entity)
+			continue;
+		if(!topEntry || entry->topIndex > topEntry->topIndex)
+			topEntry = entry;
 	}
+	
+	if(topEntry)
+		return topEntry->entity;
 	return NULL;
 }
 
+void Screen::updateEntities() {
+	for(int i=0; i<children.size();i++) {
+		children[i]->doUpdates();
+	}
+}
+
 void Screen::Render() {
-	Update();
+	// with a fixed time step, the screen manager updates screens separately
+	if(!CoreServices::getInstance()->getCore()->isFixedTimeStepEnabled()) {
+		Update();
+		updateEntities();
+	}
 	renderer->loadIdentity();
-	renderer->translate2D(offset.x, offset.y);
 	
-	renderer->multModelviewMatrix(rootEntity->getConcatenatedMatrix());
+	// with batching, the modelview stays at identity and the same
+	// transform is built on the CPU
+	Matrix4 screenMatrix;
+	if(batchingEnabled) {
+		Matrix4 offsetMatrix;
+		offsetMatrix.setPosition(offset.x, offset.y, 0.0f);
+		screenMatrix = rootEntity->getConcatenatedMatrix() * offsetMatrix;
+		renderBatch.begin(renderer);
+	} else {
+		renderer->translate2D(offset.x, offset.y);
+		renderer->multModelviewMatrix(rootEntity->getConcatenatedMatrix());
+	}
 	
 	for(int i=0; i<children.size();i++) {
 		if(children[i]->hasFocus && focusChild != children[i] && children[i]->isFocusable()) {
@@ -293,8 +469,13 @@ void Screen::Render() {
 			focusChild = children[i];
 			focusChild->onGainFocus();			
 		}
-		children[i]->doUpdates();
 		children[i]->updateEntityMatrix();
-		children[i]->transformAndRender();
+		if(batchingEnabled)
+			children[i]->transformAndBatch(&renderBatch, screenMatrix);
+		else
+			children[i]->transformAndRender();
 	}
+	
+	if(batchingEnabled)
+		renderBatch.end();
 }
@@ -28,6 +28,7 @@ using namespace Polycode;
 
 ScreenEntity::ScreenEntity() : Entity(), EventDispatcher() {
 	color = new Color(1.0f,1.0f,1.0f,1.0f);
+	batchMode = RENDER_BATCH_NONE;
 	width = 1;
 	height = 1;
 	hitwidth = 1;
@@ -59,6 +60,7 @@ ScreenEntity::ScreenEntity() : Entity(), EventDispatcher() {
 	xmouse = 0;
 	ymouse = 0;
 	
+	spatialIndexId = -1;
 }
 
 void ScreenEntity::focusNextChild() {
@@ -100,14 +102,18 @@ bool ScreenEntity::isFocusable() {
 	return focusable;
 }
 
+// the screen's spatial index keeps track of the dragged entities, so
+// starting or stopping a drag has it look at the entity again
 void ScreenEntity::startDrag(Number xOffset, Number yOffset) {
 	isDragged = true;
 	dragOffsetX = xOffset;
 	dragOffsetY = yOffset;
+	boundsChanged();
 }
 
 void ScreenEntity::stopDrag() {
 	isDragged = false;
+	boundsChanged();
 }
 
 ScreenEntity::~ScreenEntity() {
@@ -122,6 +128,7 @@ void ScreenEntity::setPosition(Number x, Number y) {
 	position.x  = x;
 	position.y  = y;
 	matrixDirty = true;
+	boundsChanged();
 }
 
 void ScreenEntity::setScale(Number x, Number y) {
@@ -138,6 +145,18 @@ Number ScreenEntity::getHeight() {
 	return height;
 }
 
+void ScreenEntity::setHitbox(Number width, Number height) {
+	hitwidth = width;
+	hitheight = height;
+	boundsChanged();
+}
+
+Rectangle ScreenEntity::getHitBounds() {
+	if(positionMode == ScreenEntity::POSITION_CENTER)
+		return Rectangle(position.x - hitwidth/2.0f, position.y - hitheight/2.0f, hitwidth, hitheight);
+	return Rectangle(position.x, position.y, hitwidth, hitheight);
+}
+
 bool ScreenEntity::hitTest(Number x, Number y) {
 	bool retVal = false;
 //			Logger::log("hittest %f,%f in %f %f %f %f\n",x, y, position.x, position.y, hitwidth, hitheight);	
@@ -160,6 +179,7 @@ bool ScreenEntity::hitTest(Number x, Number y) {
 
 void ScreenEntity::setPositionMode(int newPositionMode) {
 	positionMode = newPositionMode;
+	boundsChanged();
 }
 
 void ScreenEntity::_onKeyDown(PolyKEY key, wchar_t charCode) {
@@ -190,8 +210,7 @@ void ScreenEntity::clearDragLimits() {
 	dragLimits = NULL;
 }
 
-void ScreenEntity::_onMouseMove(Number x, Number y, int timestamp) {
-
+void ScreenEntity::_updateDrag(Number x, Number y) {
 	if(isDragged) {
 		setPosition(x-dragOffsetX,y-dragOffsetY);
 		if(dragLimits) {
@@ -205,25 +224,37 @@ void ScreenEntity::_onMouseMove(Number x, Number y, int timestamp) {
 				position.y = dragLimits->y + dragLimits->h;
 		}
 	}
-	
+}
+
+bool ScreenEntity::_handleMouseMove(Number x, Number y, int timestamp, InputEvent *event) {
 	xmouse = x-position.x;
 	ymouse = y-position.y;
 
 	onMouseMove(x,y);
 	if(enabled) {
+		event->mousePosition = Vector2(x,y);
+		event->timestamp = timestamp;
 		if(hitTest(x,y)) {
-			dispatchEvent(new InputEvent(Vector2(x,y), timestamp), InputEvent::EVENT_MOUSEMOVE);
+			dispatchEventNoDelete(event, InputEvent::EVENT_MOUSEMOVE);
 			if(!mouseOver) {
-				dispatchEvent(new InputEvent(Vector2(x,y), timestamp), InputEvent::EVENT_MOUSEOVER);
+				dispatchEventNoDelete(event, InputEvent::EVENT_MOUSEOVER);
 				mouseOver = true;
 			}
 		} else {
 			if(mouseOver) {
-				dispatchEvent(new InputEvent(Vector2(x,y), timestamp), InputEvent::EVENT_MOUSEOUT);
+				dispatchEventNoDelete(event, InputEvent::EVENT_MOUSEOUT);
 				mouseOver = false;
 			}
 		}
 	}
+	return mouseOver;
+}
+
+void ScreenEntity::_onMouseMove(Number x, Number y, int timestamp) {
+	InputEvent event(Vector2(x,y), timestamp);
+	
+	_updateDrag(x, y);
+	_handleMouseMove(x, y, timestamp, &event);
 	
 	if(enabled) {
 		for(int i=0;i<children.size();i++) {
@@ -237,16 +268,16 @@ bool ScreenEntity::_onMouseUp(Number x, Number y, int mouseButton, int timestamp
 	if(hitTest(x,y) && enabled) {
 		onMouseUp(x,y);
 		
-		InputEvent *inputEvent = new InputEvent(Vector2(x,y), timestamp);		
-		inputEvent->mouseButton = mouseButton;		
-		dispatchEvent(inputEvent, InputEvent::EVENT_MOUSEUP);
+		InputEvent inputEvent(Vector2(x,y), timestamp);
+		inputEvent.mouseButton = mouseButton;		
+		dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_MOUSEUP);
 		retVal = true;		
 	} else {
 		
-		InputEvent *inputEvent = new InputEvent(Vector2(x,y), timestamp);		
-		inputEvent->mouseButton = mouseButton;
+		InputEvent inputEvent(Vector2(x,y), timestamp);
+		inputEvent.mouseButton = mouseButton;
 		
-		dispatchEvent(inputEvent, InputEvent::EVENT_MOUSEUP_OUTSIDE);
+		dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_MOUSEUP_OUTSIDE);
 	}
 	
 	if(enabled) {
@@ -269,7 +300,8 @@ void ScreenEntity::_onMouseWheelUp(Number x, Number y, int timestamp) {
 	if(doTest) {
 		if(hitTest(x,y) && enabled) {
 			onMouseWheelUp(x,y);
-			dispatchEvent(new InputEvent(Vector2(x,y), timestamp), InputEvent::EVENT_MOUSEWHEEL_UP);
+			InputEvent inputEvent(Vector2(x,y), timestamp);
+			dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_MOUSEWHEEL_UP);
 		}
 		if(enabled) {
 			for(int i=children.size()-1;i>=0;i--) {				
@@ -295,7 +327,8 @@ void ScreenEntity::_onMouseWheelDown(Number x, Number y, int timestamp) {
 	if(doTest) {
 		if(hitTest(x,y) && enabled) {
 			onMouseWheelDown(x,y);
-			dispatchEvent(new InputEvent(Vector2(x,y), timestamp), InputEvent::EVENT_MOUSEWHEEL_DOWN);
+			InputEvent inputEvent(Vector2(x,y), timestamp);
+			dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_MOUSEWHEEL_DOWN);
 		}
 		if(enabled) {
 			for(int i=children.size()-1;i>=0;i--) {				
@@ -325,14 +358,13 @@ bool ScreenEntity::_onMouseDown(Number x, Number y, int mouseButton, int timesta
 	if(hitTest(x,y) && enabled) {
 		onMouseDown(x,y);
 		
-		InputEvent *inputEvent = new InputEvent(Vector2(x,y), timestamp);		
-		inputEvent->mouseButton = mouseButton;
-		dispatchEvent(inputEvent, InputEvent::EVENT_MOUSEDOWN);
+		InputEvent inputEvent(Vector2(x,y), timestamp);
+		inputEvent.mouseButton = mouseButton;
+		dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_MOUSEDOWN);
 		
 		if(timestamp - lastClickTicks < 400) {
-			InputEvent *inputEvent = new InputEvent(Vector2(x,y), timestamp);
-			inputEvent->mouseButton = mouseButton;			
-			dispatchEvent(inputEvent, InputEvent::EVENT_DOUBLECLICK);
+			inputEvent.mousePosition = Vector2(x,y);
+			dispatchEventNoDelete(&inputEvent, InputEvent::EVENT_DOUBLECLICK);
 		}
 		lastClickTicks = timestamp;		
 		retVal = true;
@@ -388,7 +420,43 @@ Matrix4 ScreenEntity::buildPositionMatrix() {
 
 void ScreenEntity::adjustMatrixForChildren() {
 	if(positionMode == POSITION_TOPLEFT)
-		renderer->translate2D(-floor(width/2.0f), -floor(height/2.0f));	
+		renderer->translate2D(-floor(width/2.0f), -floor(height/2.0f));
+}
+
+void ScreenEntity::setBatchMode(int batchMode) {
+	this->batchMode = batchMode;
+}
+
+void ScreenEntity::transformAndBatch(ScreenRenderBatch *batch, const Matrix4 &parentMatrix) {
+	if(!renderer || !enabled)
+		return;
+
+	int batchMode = getBatchMode();
+	if(batchMode == RENDER_BATCH_NONE || hasMask || depthOnly || ignoreParentMatrix || billboardMode || renderWireframe) {
+		batch->renderUnbatched(this, parentMatrix);
+		return;
+	}
+
+	if(!visible)
+		return;
+
+	Matrix4 matrix = transformMatrix * parentMatrix;
+	if(batchMode == RENDER_BATCH_QUADS)
+		addToBatch(batch, matrix);
+
+	if(children.size() == 0)
+		return;
+
+	// the batched version of adjustMatrixForChildren()
+	if(positionMode == POSITION_TOPLEFT) {
+		Matrix4 adjustMatrix;
+		adjustMatrix.setPosition(-floor(width/2.0f), -floor(height/2.0f), 0.0f);
+		matrix = adjustMatrix * matrix;
+	}
+
+	for(int i=0; i < children.size(); i++) {
+		((ScreenEntity*)children[i])->transformAndBatch(batch, matrix);
+	}
 }
 
 /*
@@ -21,6 +21,7 @@
 */
 
 #include "PolyScreenManager.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
@@ -73,9 +74,20 @@ Screen *ScreenManager::createScreen(int screenType) {
 }
 */
 
+void ScreenManager::fixedUpdate() {
+	for(int i=0;i<screens.size();i++) {
+		if(screens[i]->enabled) {
+			screens[i]->Update();
+			screens[i]->updateEntities();
+		}
+	}
+}
+
 void ScreenManager::Update() {
+	PROFILE_SCOPE("ScreenManager::Update");
 
 	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	renderer->beginGPUTimer(Renderer::GPU_TIMER_SCREEN);
 	for(int i=0;i<screens.size();i++) {
 		if(screens[i]->enabled) {
 			if(!screens[i]->usesNormalizedCoordinates()) {
@@ -93,4 +105,5 @@ void ScreenManager::Update() {
 			}
 		}
 	}
+	renderer->endGPUTimer(Renderer::GPU_TIMER_SCREEN);
 }
\ No newline at end of file
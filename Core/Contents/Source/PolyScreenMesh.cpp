@@ -66,4 +66,19 @@ void ScreenMesh::Render() {
 	renderer->pushDataArrayForMesh(mesh, RenderDataArray::VERTEX_DATA_ARRAY);
 	renderer->pushDataArrayForMesh(mesh, RenderDataArray::TEXCOORD_DATA_ARRAY);	
 	renderer->drawArrays(mesh->getMeshType());
-}
\ No newline at end of file
+}
+
+int ScreenMesh::getBatchMode() {
+	if(mesh->getMeshType() != Mesh::QUAD_MESH)
+		return RENDER_BATCH_NONE;
+	for(int i=0; i < mesh->getPolygonCount(); i++) {
+		if(mesh->getPolygon(i)->getVertexCount() != 4)
+			return RENDER_BATCH_NONE;
+	}
+	return RENDER_BATCH_QUADS;
+}
+
+void ScreenMesh::addToBatch(ScreenRenderBatch *batch, const Matrix4 &matrix) {
+	batch->setState(texture, blendingMode, depthWrite, depthTest, alphaTest, backfaceCulled);
+	batch->addMesh(mesh, matrix, getCombinedColor());
+}
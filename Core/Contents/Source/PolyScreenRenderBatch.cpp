@@ -0,0 +1,201 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyScreenRenderBatch.h"
+#include "PolyScreenEntity.h"
+#include "PolyRenderer.h"
+#include "PolyMesh.h"
+#include "PolyPolygon.h"
+#include "PolyVertex.h"
+#include <stdlib.h>
+
+using namespace Polycode;
+
+ScreenRenderBatch::ScreenRenderBatch() {
+	renderer = NULL;
+	vertexArray = NULL;
+	texCoordArray = NULL;
+	colorArray = NULL;
+	indices = NULL;
+	quadCapacity = 0;
+	quadCount = 0;
+	
+	texture = NULL;
+	blendingMode = Renderer::BLEND_MODE_NORMAL;
+	depthWrite = false;
+	depthTest = false;
+	alphaTest = false;
+	backfaceCulled = false;
+	
+	drawCallCount = 0;
+	totalQuadCount = 0;
+	unbatchedCount = 0;
+}
+
+ScreenRenderBatch::~ScreenRenderBatch() {
+	RenderDataArray *arrays[3] = {vertexArray, texCoordArray, colorArray};
+	for(int i=0; i < 3; i++) {
+		if(arrays[i]) {
+			free(arrays[i]->arrayPtr);
+			delete arrays[i];
+		}
+	}
+	free(indices);
+}
+
+void ScreenRenderBatch::begin(Renderer *renderer) {
+	this->renderer = renderer;
+	if(!vertexArray) {
+		vertexArray = renderer->createRenderDataArray(RenderDataArray::VERTEX_DATA_ARRAY);
+		texCoordArray = renderer->createRenderDataArray(RenderDataArray::TEXCOORD_DATA_ARRAY);
+		colorArray = renderer->createRenderDataArray(RenderDataArray::COLOR_DATA_ARRAY);
+	}
+	quadCount = 0;
+	drawCallCount = 0;
+	totalQuadCount = 0;
+	unbatchedCount = 0;
+}
+
+void ScreenRenderBatch::end() {
+	flush();
+}
+
+void ScreenRenderBatch::reserveQuads(unsigned int count) {
+	if(count <= quadCapacity)
+		return;
+	
+	unsigned int newCapacity = quadCapacity ? quadCapacity : 64;
+	while(newCapacity < count)
+		newCapacity *= 2;
+	if(newCapacity > MAX_QUADS)
+		newCapacity = MAX_QUADS;
+	
+	vertexArray->arrayPtr = realloc(vertexArray->arrayPtr, sizeof(float) * 12 * newCapacity);
+	texCoordArray->arrayPtr = realloc(texCoordArray->arrayPtr, sizeof(float) * 8 * newCapacity);
+	colorArray->arrayPtr = realloc(colorArray->arrayPtr, sizeof(float) * 16 * newCapacity);
+	indices = (unsigned short*)realloc(indices, sizeof(unsigned short) * 6 * newCapacity);
+	
+	// the index pattern never changes, so it is only written when the batch grows
+	for(unsigned int i=quadCapacity; i < newCapacity; i++) {
+		unsigned short base = i * 4;
+		unsigned short *quad = indices + i * 6;
+		quad[0] = base;
+		quad[1] = base + 1;
+		quad[2] = base + 2;
+		quad[3] = base;
+		quad[4] = base + 2;
+		quad[5] = base + 3;
+	}
+	quadCapacity = newCapacity;
+}
+
+void ScreenRenderBatch::setState(Texture *texture, int blendingMode, bool depthWrite, bool depthTest, bool alphaTest, bool backfaceCulled) {
+	if(texture == this->texture && blendingMode == this->blendingMode && depthWrite == this->depthWrite && depthTest == this->depthTest && alphaTest == this->alphaTest && backfaceCulled == this->backfaceCulled)
+		return;
+	
+	flush();
+	this->texture = texture;
+	this->blendingMode = blendingMode;
+	this->depthWrite = depthWrite;
+	this->depthTest = depthTest;
+	this->alphaTest = alphaTest;
+	this->backfaceCulled = backfaceCulled;
+}
+
+void ScreenRenderBatch::addMesh(Mesh *mesh, const Matrix4 &matrix, const Color &color) {
+	unsigned int polygonCount = mesh->getPolygonCount();
+	const Number (*m)[4] = matrix.m;
+	
+	for(unsigned int i=0; i < polygonCount; i++) {
+		if(quadCount == MAX_QUADS)
+			flush();
+		reserveQuads(quadCount + 1);
+		
+		float *positions = (float*)vertexArray->arrayPtr + quadCount * 12;
+		float *texCoords = (float*)texCoordArray->arrayPtr + quadCount * 8;
+		float *colors = (float*)colorArray->arrayPtr + quadCount * 16;
+		
+		Polygon *polygon = mesh->getPolygon(i);
+		for(int j=0; j < 4; j++) {
+			Vertex *vert = polygon->getVertex(j);
+			positions[0] = vert->x*m[0][0] + vert->y*m[1][0] + vert->z*m[2][0] + m[3][0];
+			positions[1] = vert->x*m[0][1] + vert->y*m[1][1] + vert->z*m[2][1] + m[3][1];
+			positions[2] = vert->x*m[0][2] + vert->y*m[1][2] + vert->z*m[2][2] + m[3][2];
+			positions += 3;
+			
+			Vector2 texCoord = vert->getTexCoord();
+			texCoords[0] = texCoord.x;
+			texCoords[1] = texCoord.y;
+			texCoords += 2;
+			
+			// vertex colors replace the entity color, as they do when the color array is pushed
+			const Color &vertexColor = mesh->useVertexColors ? vert->vertexColor : color;
+			colors[0] = vertexColor.r;
+			colors[1] = vertexColor.g;
+			colors[2] = vertexColor.b;
+			colors[3] = vertexColor.a;
+			colors += 4;
+		}
+		quadCount++;
+	}
+}
+
+void ScreenRenderBatch::flush() {
+	if(quadCount == 0)
+		return;
+	
+	int mode = renderer->getRenderMode();
+	renderer->setRenderMode(Renderer::RENDER_MODE_NORMAL);
+	
+	renderer->setTexture(texture);
+	renderer->setBlendingMode(blendingMode);
+	renderer->enableDepthWrite(depthWrite);
+	renderer->enableDepthTest(depthTest);
+	renderer->enableAlphaTest(alphaTest);
+	renderer->enableBackfaceCulling(backfaceCulled);
+	
+	vertexArray->count = quadCount * 4;
+	texCoordArray->count = quadCount * 4;
+	colorArray->count = quadCount * 4;
+	
+	renderer->pushRenderDataArray(colorArray);
+	renderer->pushRenderDataArray(vertexArray);
+	renderer->pushRenderDataArray(texCoordArray);
+	renderer->drawIndexedArrays(Mesh::TRI_MESH, indices, quadCount * 6);
+	
+	renderer->setRenderMode(mode);
+	if(!depthWrite)
+		renderer->enableDepthWrite(true);
+	
+	drawCallCount++;
+	totalQuadCount += quadCount;
+	quadCount = 0;
+}
+
+void ScreenRenderBatch::renderUnbatched(ScreenEntity *entity, const Matrix4 &parentMatrix) {
+	flush();
+	renderer->pushMatrix();
+	renderer->setModelviewMatrix(parentMatrix);
+	entity->transformAndRender();
+	renderer->popMatrix();
+	unbatchedCount++;
+}
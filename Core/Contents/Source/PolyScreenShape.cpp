@@ -89,8 +89,7 @@ void ScreenShape::setShapeSize(Number newWidth, Number newHeight) {
 	width = newWidth;
 	height = newHeight;
 	
-	hitwidth = width;
-	hitheight = height;	
+	setHitbox(width, height);
 	
 	Number whalf = floor(width/2.0f);
 	Number hhalf = floor(height/2.0f);
@@ -187,6 +186,11 @@ void ScreenShape::Render() {
 
 }
 
+int ScreenShape::getBatchMode() {
+	if(strokeEnabled)
+		return RENDER_BATCH_NONE;
+	return ScreenMesh::getBatchMode();
+}
 
 ScreenShape::~ScreenShape() {
 
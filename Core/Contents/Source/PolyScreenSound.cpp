@@ -25,7 +25,7 @@ THE SOFTWARE.
 using namespace Polycode;
 
 ScreenSoundListener::ScreenSoundListener() : ScreenEntity() {
-
+	setBatchMode(RENDER_BATCH_GROUP);
 }
 ScreenSoundListener::~ScreenSoundListener() {
 
@@ -46,6 +46,7 @@ void ScreenSoundListener::Update() {
 
 
 ScreenSound::ScreenSound(String fileName, Number referenceDistance, Number maxDistance) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	sound = new Sound(fileName);
 	sound->setIsPositional(true);
 	sound->setPositionalProperties(referenceDistance, maxDistance);	
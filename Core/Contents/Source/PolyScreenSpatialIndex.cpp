@@ -0,0 +1,239 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyScreenSpatialIndex.h"
+#include <math.h>
+
+using namespace Polycode;
+
+ScreenSpatialIndexEntry::ScreenSpatialIndexEntry() {
+	entity = NULL;
+	originX = 0;
+	originY = 0;
+	minX = 0;
+	minY = 0;
+	maxX = 0;
+	maxY = 0;
+	hovered = false;
+	topIndex = 0;
+	order = 0;
+	cellMode = CELLS_NONE;
+	cellMinX = 0;
+	cellMinY = 0;
+	cellMaxX = 0;
+	cellMaxY = 0;
+	updateStamp = 0;
+	queryStamp = 0;
+}
+
+bool ScreenSpatialIndexEntry::areParentsEnabled() {
+	for(Entity *parent = entity->getParentEntity(); parent; parent = parent->getParentEntity()) {
+		if(!parent->enabled)
+			return false;
+	}
+	return true;
+}
+
+bool ScreenSpatialIndexEntry::isActive() {
+	return entity->enabled && areParentsEnabled();
+}
+
+ScreenSpatialIndex::ScreenSpatialIndex(Number cellSize) {
+	this->cellSize = cellSize;
+	numEntities = 0;
+	updateStamp = 0;
+	queryStamp = 0;
+	buckets.resize(NUM_BUCKETS);
+}
+
+ScreenSpatialIndex::~ScreenSpatialIndex() {
+
+}
+
+int ScreenSpatialIndex::getCell(Number val) {
+	return (int)floor(val / cellSize);
+}
+
+int ScreenSpatialIndex::getBucket(int cellX, int cellY) {
+	unsigned int hash = ((unsigned int)cellX * 73856093u) ^ ((unsigned int)cellY * 19349663u);
+	return hash & (NUM_BUCKETS-1);
+}
+
+void ScreenSpatialIndex::removeFromBucket(int bucket, int id) {
+	vector<int> &ids = buckets[bucket];
+	for(int i=0; i < ids.size(); i++) {
+		if(ids[i] == id) {
+			ids[i] = ids[ids.size()-1];
+			ids.pop_back();
+			return;
+		}
+	}
+}
+
+void ScreenSpatialIndex::insertEntry(int id) {
+	ScreenSpatialIndexEntry &entry = entries[id];
+	
+	// hit tests are exclusive, so empty areas can never be hit
+	if(entry.maxX <= entry.minX || entry.maxY <= entry.minY) {
+		entry.cellMode = ScreenSpatialIndexEntry::CELLS_NONE;
+		return;
+	}
+	
+	entry.cellMinX = getCell(entry.minX);
+	entry.cellMinY = getCell(entry.minY);
+	entry.cellMaxX = getCell(entry.maxX);
+	entry.cellMaxY = getCell(entry.maxY);
+	
+	double numCells = ((double)entry.cellMaxX - entry.cellMinX + 1) * ((double)entry.cellMaxY - entry.cellMinY + 1);
+	if(numCells > MAX_CELLS_PER_ENTITY) {
+		entry.cellMode = ScreenSpatialIndexEntry::CELLS_LARGE;
+		largeEntries.push_back(id);
+		return;
+	}
+	
+	entry.cellMode = ScreenSpatialIndexEntry::CELLS_GRID;
+	for(int cy = entry.cellMinY; cy <= entry.cellMaxY; cy++) {
+		for(int cx = entry.cellMinX; cx <= entry.cellMaxX; cx++) {
+			buckets[getBucket(cx, cy)].push_back(id);
+		}
+	}
+}
+
+void ScreenSpatialIndex::removeEntry(int id) {
+	ScreenSpatialIndexEntry &entry = entries[id];
+	switch(entry.cellMode) {
+		case ScreenSpatialIndexEntry::CELLS_GRID:
+			for(int cy = entry.cellMinY; cy <= entry.cellMaxY; cy++) {
+				for(int cx = entry.cellMinX; cx <= entry.cellMaxX; cx++) {
+					removeFromBucket(getBucket(cx, cy), id);
+				}
+			}
+		break;
+		case ScreenSpatialIndexEntry::CELLS_LARGE:
+			for(int i=0; i < largeEntries.size(); i++) {
+				if(largeEntries[i] == id) {
+					largeEntries.erase(largeEntries.begin()+i);
+					break;
+				}
+			}
+		break;
+	}
+	entry.cellMode = ScreenSpatialIndexEntry::CELLS_NONE;
+}
+
+void ScreenSpatialIndex::beginUpdate() {
+	updateStamp++;
+}
+
+int ScreenSpatialIndex::updateEntity(ScreenEntity *entity, Number originX, Number originY, int topIndex, int order) {
+	int id = entity->spatialIndexId;
+	if(id < 0 || id >= entries.size() || entries[id].entity != entity) {
+		if(freeEntries.size() > 0) {
+			id = freeEntries[freeEntries.size()-1];
+			freeEntries.pop_back();
+		} else {
+			id = entries.size();
+			entries.push_back(ScreenSpatialIndexEntry());
+		}
+		entries[id] = ScreenSpatialIndexEntry();
+		entries[id].entity = entity;
+		entity->spatialIndexId = id;
+		numEntities++;
+	}
+	
+	ScreenSpatialIndexEntry &entry = entries[id];
+	entry.updateStamp = updateStamp;
+	entry.originX = originX;
+	entry.originY = originY;
+	entry.topIndex = topIndex;
+	entry.order = order;
+	
+	Rectangle bounds = entity->getHitBounds();
+	Number minX = originX + bounds.x;
+	Number minY = originY + bounds.y;
+	Number maxX = minX + bounds.w;
+	Number maxY = minY + bounds.h;
+	
+	if(entry.cellMode != ScreenSpatialIndexEntry::CELLS_NONE && minX == entry.minX && minY == entry.minY && maxX == entry.maxX && maxY == entry.maxY)
+		return id;
+	
+	removeEntry(id);
+	entry.minX = minX;
+	entry.minY = minY;
+	entry.maxX = maxX;
+	entry.maxY = maxY;
+	insertEntry(id);
+	return id;
+}
+
+void ScreenSpatialIndex::endUpdate() {
+	for(int i=0; i < entries.size(); i++) {
+		ScreenSpatialIndexEntry &entry = entries[i];
+		if(entry.entity && entry.updateStamp != updateStamp) {
+			// the entity is no longer in the screen and may have been
+			// deleted, so it must not be touched
+			removeEntry(i);
+			entry.entity = NULL;
+			entry.hovered = false;
+			freeEntries.push_back(i);
+			numEntities--;
+		}
+	}
+}
+
+void ScreenSpatialIndex::queryPoint(Number x, Number y, bool activeOnly, vector<int> &result) {
+	queryStamp++;
+	
+	vector<int> &ids = buckets[getBucket(getCell(x), getCell(y))];
+	for(int pass=0; pass < 2; pass++) {
+		vector<int> &candidates = pass == 0 ? ids : largeEntries;
+		for(int i=0; i < candidates.size(); i++) {
+			ScreenSpatialIndexEntry &entry = entries[candidates[i]];
+			// cells that hash to the same bucket can list an entry twice
+			if(entry.queryStamp == queryStamp)
+				continue;
+			entry.queryStamp = queryStamp;
+			if(x > entry.minX && x < entry.maxX && y > entry.minY && y < entry.maxY) {
+				if(!activeOnly || entry.isActive())
+					result.push_back(candidates[i]);
+			}
+		}
+	}
+}
+
+ScreenSpatialIndexEntry *ScreenSpatialIndex::getEntry(int id) {
+	return &entries[id];
+}
+
+unsigned int ScreenSpatialIndex::getNumEntities() {
+	return numEntities;
+}
+
+void ScreenSpatialIndex::clear() {
+	for(int i=0; i < buckets.size(); i++) {
+		buckets[i].clear();
+	}
+	largeEntries.clear();
+	entries.clear();
+	freeEntries.clear();
+	numEntities = 0;
+}
@@ -34,6 +34,29 @@ ScreenSprite::ScreenSprite(String fileName, Number spriteWidth, Number spriteHei
 	
 	currentFrame = 0;
 	currentAnimation = NULL;
+	atlas = NULL;
+	atlasScale = Vector2(1, 1);
+}
+
+ScreenSprite::ScreenSprite(TextureAtlas *atlas, Number spriteWidth, Number spriteHeight) : ScreenShape(ScreenShape::SHAPE_RECT, spriteWidth, spriteHeight) {
+	this->spriteWidth = spriteWidth;
+	this->spriteHeight = spriteHeight;
+	this->atlas = atlas;
+	setTexture(atlas->getTexture());
+	
+	spriteUVWidth = 0;
+	spriteUVHeight = 0;
+	
+	currentFrame = 0;
+	currentAnimation = NULL;
+	atlasScale = Vector2(1, 1);
+	
+	TextureAtlasFrame *frame = atlas->getFrame((unsigned int)0);
+	if(frame) {
+		if(frame->width > 0 && frame->height > 0)
+			atlasScale = Vector2(spriteWidth / frame->width, spriteHeight / frame->height);
+		setFrameCoordinates(frame->uvOffset, frame->uvSize, getAtlasFrameShapeSize(frame));
+	}
 }
 
 ScreenSprite::~ScreenSprite() {
@@ -45,6 +68,27 @@ void ScreenSprite::addAnimation(String name, String frames, Number speed) {
 	
 	vector<String> frameNumbers = frames.split(",");
 	
+	if(atlas) {
+		for(int i=0; i < frameNumbers.size(); i++) {
+			String frameName = frameNumbers[i].replace(" ", "");
+			TextureAtlasFrame *frame = atlas->getFrame(frameName);
+			if(!frame)
+				frame = atlas->getFrame((unsigned int)atoi(frameName.c_str()));
+			if(!frame) {
+				Logger::log("Sprite frame %s not found in texture atlas\n", frameName.c_str());
+				continue;
+			}
+			newAnimation->framesOffsets.push_back(frame->uvOffset);
+			newAnimation->framesSizes.push_back(frame->uvSize);
+			newAnimation->framesShapeSizes.push_back(getAtlasFrameShapeSize(frame));
+		}
+		newAnimation->speed = speed;
+		newAnimation->name = name;
+		newAnimation->numFrames = newAnimation->framesOffsets.size();
+		animations.push_back(newAnimation);
+		return;
+	}
+	
 	int numFramesX = texture->getWidth() / spriteWidth;
 	int numFramesY = texture->getHeight() / spriteHeight;
 	
@@ -57,6 +101,8 @@ void ScreenSprite::addAnimation(String name, String frames, Number speed) {
 		frameX = frameNumber % numFramesX;
 		frameY = frameNumber/numFramesX;
 		newAnimation->framesOffsets.push_back(Vector2(spriteUVWidth * frameX, spriteUVHeight * frameY));		
+		newAnimation->framesSizes.push_back(Vector2(spriteUVWidth, spriteUVHeight));
+		newAnimation->framesShapeSizes.push_back(Vector2(spriteWidth, spriteHeight));
 	}
 	
 	newAnimation->speed = speed;
@@ -95,19 +141,40 @@ void ScreenSprite::Update() {
 			currentFrame = 0;
 	}
 	
-	Number xOffset = currentAnimation->framesOffsets[currentFrame].x;
-	Number yOffset = 1.0f - currentAnimation->framesOffsets[currentFrame].y - spriteUVHeight;
+	setFrameCoordinates(currentAnimation->framesOffsets[currentFrame], currentAnimation->framesSizes[currentFrame], currentAnimation->framesShapeSizes[currentFrame]);
+		
+	lastTick = newTick;
+		
+	}
+}
+
+void ScreenSprite::showAtlasFrame(String name) {
+	if(!atlas)
+		return;
+	TextureAtlasFrame *frame = atlas->getFrame(name);
+	if(!frame)
+		return;
+	currentAnimation = NULL;
+	setFrameCoordinates(frame->uvOffset, frame->uvSize, getAtlasFrameShapeSize(frame));
+}
+
+Vector2 ScreenSprite::getAtlasFrameShapeSize(TextureAtlasFrame *frame) {
+	return Vector2(frame->width * atlasScale.x, frame->height * atlasScale.y);
+}
+
+void ScreenSprite::setFrameCoordinates(Vector2 uvOffset, Vector2 uvSize, Vector2 shapeSize) {
+	if(shapeSize.x != width || shapeSize.y != height)
+		setShapeSize(shapeSize.x, shapeSize.y);
+	
+	Number xOffset = uvOffset.x;
+	Number yOffset = 1.0f - uvOffset.y - uvSize.y;
 	
 	Polygon *imagePolygon = mesh->getPolygon(0);
 		
-	imagePolygon->getVertex(0)->setTexCoord(xOffset, yOffset+spriteUVHeight);	
-	imagePolygon->getVertex(1)->setTexCoord(xOffset+spriteUVWidth, yOffset+spriteUVHeight);
-	imagePolygon->getVertex(2)->setTexCoord(xOffset+spriteUVWidth, yOffset);
+	imagePolygon->getVertex(0)->setTexCoord(xOffset, yOffset+uvSize.y);	
+	imagePolygon->getVertex(1)->setTexCoord(xOffset+uvSize.x, yOffset+uvSize.y);
+	imagePolygon->getVertex(2)->setTexCoord(xOffset+uvSize.x, yOffset);
 	imagePolygon->getVertex(3)->setTexCoord(xOffset, yOffset);	
 		
 	mesh->arrayDirtyMap[RenderDataArray::TEXCOORD_DATA_ARRAY] = true;
-		
-	lastTick = newTick;
-		
-	}
 }
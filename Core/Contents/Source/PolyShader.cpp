@@ -107,9 +107,9 @@ int Shader::getType() {
 }
 
 void Shader::setName(String name) {
-	this->name = name;
+	setResourceName(name);
 }
 
 String Shader::getName() {
-	return name;
+	return getResourceName();
 }
\ No newline at end of file
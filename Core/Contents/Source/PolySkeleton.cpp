@@ -21,16 +21,37 @@
 */
 
 #include "PolySkeleton.h"
+#include "PolyCoreServices.h"
+#include "PolyCore.h"
+#include <math.h>
 
 using namespace Polycode;
 
 Skeleton::Skeleton(String fileName) : SceneEntity() {
-	loadSkeleton(fileName);
 	currentAnimation = NULL;
+	crossfadeTarget = NULL;
+	updateInterval = 1;
+	framesSinceUpdate = 0;
+	lodNearDistance = 0;
+	lodFarDistance = 0;
+	lodMaxInterval = 1;
+	rendered = true;
+	updateWhenCulled = true;
+	poseRevision = 1;
+	loadSkeleton(fileName);
 }
 
 Skeleton::Skeleton() {
 	currentAnimation = NULL;	
+	crossfadeTarget = NULL;
+	updateInterval = 1;
+	framesSinceUpdate = 0;
+	lodNearDistance = 0;
+	lodFarDistance = 0;
+	lodMaxInterval = 1;
+	rendered = true;
+	updateWhenCulled = true;
+	poseRevision = 1;
 }
 
 Skeleton::~Skeleton() {
@@ -73,14 +94,10 @@ void Skeleton::playAnimationByIndex(int index) {
 	if(!anim)
 		return;
 	
-	if(anim == currentAnimation)
+	if(anim == currentAnimation && activeAnimations.size() == 1)
 		return;
 	
-	if(currentAnimation)
-		currentAnimation->Stop();
-	
-	currentAnimation = anim;
-	anim->Play();	
+	startAnimation(anim, 1.0, 0, true);
 }
 
 void Skeleton::playAnimation(String animName) {
@@ -88,16 +105,166 @@ void Skeleton::playAnimation(String animName) {
 	if(!anim)
 		return;
 	
-	if(anim == currentAnimation)
+	if(anim == currentAnimation && activeAnimations.size() == 1)
 		return;
 	
-	if(currentAnimation)
-		currentAnimation->Stop();
-		
-	currentAnimation = anim;
+	startAnimation(anim, 1.0, 0, true);
+}
+
+void Skeleton::crossfadeAnimation(String animName, Number fadeTime) {
+	SkeletonAnimation *anim = getAnimation(animName);
+	if(!anim)
+		return;
+	startAnimation(anim, 1.0, fadeTime, true);
+}
+
+void Skeleton::blendAnimation(String animName, Number weight, Number fadeTime) {
+	SkeletonAnimation *anim = getAnimation(animName);
+	if(!anim)
+		return;
+	startAnimation(anim, weight, fadeTime, false);
+}
+
+void Skeleton::startAnimation(SkeletonAnimation *anim, Number weight, Number fadeTime, bool exclusive) {
+	int index = -1;
+	for(int i=0; i < activeAnimations.size(); i++) {
+		if(activeAnimations[i] == anim)
+			index = i;
+	}
+	
+	if(exclusive) {
+		if(fadeTime > 0) {
+			if(index != -1 && anim->getWeight() > 0) {
+				// the animation is already visible, moving it on top would snap to it,
+				// so it stays in place and the animations blended over it fade out
+				for(int i=index+1; i < activeAnimations.size(); i++) {
+					activeAnimations[i]->fadeTo(0, fadeTime);
+				}
+			} else {
+				// the new animation blends on top of the others, which are stopped when the fade completes
+				if(index != -1) {
+					activeAnimations.erase(activeAnimations.begin()+index);
+				}
+				anim->setWeight(0);
+				activeAnimations.push_back(anim);
+			}
+			crossfadeTarget = anim;
+		} else {
+			for(int i=activeAnimations.size()-1; i >= 0; i--) {
+				if(activeAnimations[i] != anim)
+					removeActiveAnimation(i);
+			}
+			if(index == -1)
+				activeAnimations.push_back(anim);
+			crossfadeTarget = NULL;
+		}
+		currentAnimation = anim;
+	} else {
+		if(index == -1) {
+			if(fadeTime > 0)
+				anim->setWeight(0);
+			activeAnimations.push_back(anim);
+		}
+		if(!currentAnimation)
+			currentAnimation = anim;
+	}
+	
+	anim->fadeTo(weight, fadeTime);
 	anim->Play();
 }
 
+void Skeleton::stopAnimation(String animName, Number fadeTime) {
+	for(int i=0; i < activeAnimations.size(); i++) {
+		if(activeAnimations[i]->getName() == animName) {
+			if(fadeTime > 0) {
+				activeAnimations[i]->fadeTo(0, fadeTime);
+			} else {
+				removeActiveAnimation(i);
+			}
+			return;
+		}
+	}
+}
+
+void Skeleton::stopAllAnimations() {
+	while(activeAnimations.size() > 0) {
+		removeActiveAnimation(activeAnimations.size()-1);
+	}
+}
+
+void Skeleton::removeActiveAnimation(int index) {
+	SkeletonAnimation *anim = activeAnimations[index];
+	anim->Stop();
+	activeAnimations.erase(activeAnimations.begin()+index);
+	
+	if(crossfadeTarget == anim)
+		crossfadeTarget = NULL;
+		
+	if(currentAnimation == anim) {
+		if(activeAnimations.size() > 0)
+			currentAnimation = activeAnimations[activeAnimations.size()-1];
+		else
+			currentAnimation = NULL;
+	}
+}
+
+void Skeleton::setAnimationBoneMask(String animName, String boneName, Number weight, bool includeChildren) {
+	SkeletonAnimation *anim = getAnimation(animName);
+	Bone *bone = getBoneByName(boneName);
+	if(!anim || !bone)
+		return;
+	anim->setBoneMask(bone, weight, includeChildren);
+}
+
+int Skeleton::getNumActiveAnimations() {
+	return activeAnimations.size();
+}
+
+SkeletonAnimation *Skeleton::getActiveAnimation(int index) {
+	if(index < 0 || index >= activeAnimations.size())
+		return NULL;
+	return activeAnimations[index];
+}
+
+void Skeleton::setUpdateInterval(int frames) {
+	if(frames < 1)
+		frames = 1;
+	updateInterval = frames;
+}
+
+void Skeleton::setUpdateLOD(Number nearDistance, Number farDistance, int maxInterval) {
+	lodNearDistance = nearDistance;
+	lodFarDistance = farDistance;
+	lodMaxInterval = maxInterval;
+}
+
+int Skeleton::getUpdateInterval() {
+	if(lodMaxInterval <= 1 || lodFarDistance <= lodNearDistance)
+		return updateInterval;
+		
+	Vector3 cameraPosition = CoreServices::getInstance()->getRenderer()->getCameraMatrix().getPosition();
+	Number distance = getConcatenatedMatrix().getPosition().distance(cameraPosition);
+	if(distance <= lodNearDistance)
+		return updateInterval;
+	
+	Number ratio = (distance - lodNearDistance) / (lodFarDistance - lodNearDistance);
+	if(ratio > 1.0)
+		ratio = 1.0;
+	
+	int interval = 1 + (int)((lodMaxInterval - 1) * ratio + 0.5);
+	if(interval < updateInterval)
+		interval = updateInterval;
+	return interval;
+}
+
+unsigned int Skeleton::getPoseRevision() {
+	return poseRevision;
+}
+
+void Skeleton::setRendered() {
+	rendered = true;
+}
+
 SkeletonAnimation *Skeleton::getAnimation(String name) {
 	for(int i=0; i < animations.size(); i++) {
 		if(animations[i]->getName() == name)
@@ -107,10 +274,74 @@ SkeletonAnimation *Skeleton::getAnimation(String name) {
 }
 
 void Skeleton::Update() {
+	Number elapsed = CoreServices::getInstance()->getCore()->getElapsed();
+	for(int i=0; i < activeAnimations.size(); i++) {
+		activeAnimations[i]->advance(elapsed);
+	}
+	
+	if(crossfadeTarget) {
+		bool fading = false;
+		for(int i=0; i < activeAnimations.size(); i++) {
+			if(activeAnimations[i]->isFading())
+				fading = true;
+		}
+		if(!fading) {
+			for(int i=activeAnimations.size()-1; i >= 0; i--) {
+				if(activeAnimations[i] != crossfadeTarget)
+					removeActiveAnimation(i);
+			}
+			crossfadeTarget = NULL;
+		}
+	}
+	
+	for(int i=activeAnimations.size()-1; i >= 0; i--) {
+		if(activeAnimations[i]->getWeight() <= 0 && !activeAnimations[i]->isFading() && activeAnimations[i] != crossfadeTarget)
+			removeActiveAnimation(i);
+	}
+	
+	bool wasRendered = rendered;
+	rendered = false;
+	
+	framesSinceUpdate++;
+	if(framesSinceUpdate < getUpdateInterval())
+		return;
+	if(!updateWhenCulled && !wasRendered)
+		return;
+	framesSinceUpdate = 0;
+	
+	evaluatePose();
+}
 
-	if(currentAnimation != NULL) {
-		currentAnimation->Update();
+void Skeleton::evaluatePose() {
+	if(activeAnimations.size() > 0 && bones.size() > 0) {
+		lastPose.swap(pose);
+		pose = bindPose;
+		for(int i=0; i < activeAnimations.size(); i++) {
+			activeAnimations[i]->blendPose(&pose[0], bones.size());
+		}
+		
+		// paused or finished animations give the same pose every frame
+		if(pose != lastPose) {
+			for(int i=0; i < bones.size(); i++) {
+				float *key = &pose[i * SkeletonAnimation::KEY_SIZE];
+				bones[i]->setPose(Quaternion(key[3], key[4], key[5], key[6]), Vector3(key[0], key[1], key[2]));
+			}
+		}
 	}
+	
+	updateBoneMatrices();
+}
+
+void Skeleton::updateBoneMatrices() {
+	// bones can also be posed directly through setBoneMatrix(), setPose() or
+	// a BoneTrack, so skinning is redone whenever any final matrix changed
+	bool changed = false;
+	for(int i=0; i < sortedBones.size(); i++) {
+		if(sortedBones[i]->rebuildFinalMatrix())
+			changed = true;
+	}
+	if(changed)
+		poseRevision++;
 }
 
 void Skeleton::loadSkeleton(String fileName) {
@@ -139,6 +370,7 @@ void Skeleton::loadSkeleton(String fileName) {
 		OSBasics::read(buffer, 1, namelen, inFile);
 		
 		Bone *newBone = new Bone(string(buffer));		
+		newBone->boneId = i;
 		
 		OSBasics::read(&hasParent, sizeof(unsigned int), 1, inFile);
 		if(hasParent == 1) {
@@ -198,6 +430,36 @@ void Skeleton::loadSkeleton(String fileName) {
 		}
 	//	bones[i]->visible = false;			
 	}
+	
+	// order bones so that every parent comes before its children
+	sortedBones.clear();
+	for(int i=0; i < bones.size(); i++) {
+		if(bones[i]->getParentBone() == NULL)
+			sortedBones.push_back(bones[i]);
+	}
+	for(int i=0; i < sortedBones.size(); i++) {
+		for(int j=0; j < sortedBones[i]->getNumChildBones(); j++) {
+			sortedBones.push_back(sortedBones[i]->getChildBone(j));
+		}
+	}
+	updateBoneMatrices();
+	
+	// bones not animated by any playing animation are mixed from their base pose
+	bindPose.resize(bones.size() * SkeletonAnimation::KEY_SIZE);
+	for(int i=0; i < bones.size(); i++) {
+		Matrix4 baseMatrix = bones[i]->getBaseMatrix();
+		Quaternion q;
+		q.createFromMatrix(baseMatrix);
+		q.normalize();
+		float *key = &bindPose[i * SkeletonAnimation::KEY_SIZE];
+		key[0] = baseMatrix.m[3][0];
+		key[1] = baseMatrix.m[3][1];
+		key[2] = baseMatrix.m[3][2];
+		key[3] = q.w;
+		key[4] = q.x;
+		key[5] = q.y;
+		key[6] = q.z;
+	}
 	/*
 	unsigned int numAnimations, activeBones,boneIndex,numPoints,numCurves, curveType;
 	OSBasics::read(&numAnimations, sizeof(unsigned int), 1, inFile);
@@ -341,6 +603,7 @@ void Skeleton::addAnimation(String name, String fileName) {
 			
 			newAnimation->addBoneTrack(newTrack);
 		}
+		newAnimation->bake();
 		animations.push_back(newAnimation);
 	
 	
@@ -364,158 +627,318 @@ BoneTrack::BoneTrack(Bone *bone, Number length) {
 	LocX = NULL;			
 	LocY = NULL;
 	LocZ = NULL;
-	initialized = false;
+	quatCurve = NULL;
+	animation = NULL;
+	trackIndex = 0;
+	speed = 1.0;
+	weight = 1.0;
+	playing = true;
 }
 
 BoneTrack::~BoneTrack() {
+	delete quatCurve;
 }
 
-
 void BoneTrack::Stop() {
-	if(initialized) {
-		for(int i=0; i < pathTweens.size(); i++) {
-			pathTweens[i]->Pause(true);
-		}	
-		quatTween->Pause(true);		
-	}
+	playing = false;
 }
 
 void BoneTrack::Play() {
+	playing = true;
+}
+
+bool BoneTrack::isPlaying() {
+	return playing;
+}
+
+Bone *BoneTrack::getBone() {
+	return targetBone;
+}
 
-	if(!initialized ) {
-	// TODO: change it so that you can set the tweens to not manually restart so you can calculate the
-	// time per tween
+void BoneTrack::setAnimation(SkeletonAnimation *animation, unsigned int trackIndex) {
+	this->animation = animation;
+	this->trackIndex = trackIndex;
+}
+
+void BoneTrack::sampleCurves(Number time, float *key) {
+	Number t = 0;
+	if(length > 0)
+		t = time / length;
 	
-		Number durTime = length; //(LocX->getControlPoint(LocX->getNumControlPoints()-1)->p2.x);//25.0f;
-					
-	BezierPathTween *testTween;		
-	if(LocX) {
-		testTween = new BezierPathTween(&LocXVec, LocX, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
-	}
-	if(LocY) {		
-		testTween = new BezierPathTween(&LocYVec, LocY, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
+	// QuaternionCurve::interpolate does not handle the very end of the curve
+	if(t < 0)
+		t = 0;
+	if(t > 0.9999)
+		t = 0.9999;
+
+	Matrix4 baseMatrix = targetBone->getBaseMatrix();
+	key[0] = LocX ? LocX->getPointAt(t).y : baseMatrix.m[3][0];
+	key[1] = LocY ? LocY->getPointAt(t).y : baseMatrix.m[3][1];
+	key[2] = LocZ ? LocZ->getPointAt(t).y : baseMatrix.m[3][2];
+	
+	Quaternion q;
+	if(QuatW && QuatX && QuatY && QuatZ) {
+		if(!quatCurve)
+			quatCurve = new QuaternionCurve(QuatW, QuatX, QuatY, QuatZ);
+		q = quatCurve->interpolate(t, true);
 	}
-		
-	if(LocZ) {
-		testTween = new BezierPathTween(&LocZVec, LocZ, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
-	}
-	testTween = new BezierPathTween(&ScaleXVec, scaleX, Tween::EASE_NONE, durTime, true);
-	pathTweens.push_back(testTween);
-	testTween = new BezierPathTween(&ScaleYVec, scaleY, Tween::EASE_NONE, durTime, true);
-	pathTweens.push_back(testTween);
-	testTween = new BezierPathTween(&ScaleZVec, scaleZ, Tween::EASE_NONE, durTime, true);
-	pathTweens.push_back(testTween);
-		
-		
-	if(QuatW)
-		quatTween = new QuaternionTween(&boneQuat, QuatW, QuatX, QuatY, QuatZ, Tween::EASE_NONE, durTime, true);
+	key[3] = q.w;
+	key[4] = q.x;
+	key[5] = q.y;
+	key[6] = q.z;
+}
 
-	initialized = true;
-	} else {
-		for(int i=0; i < pathTweens.size(); i++) {
-			pathTweens[i]->Pause(false);
-		}	
-		quatTween->Pause(false);
-	}
-/*
-	if(QuatW) {
-		testTween = new BezierPathTween(&QuatWVec, QuatW, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
-	}
+void BoneTrack::applyKey(const float *key) {
+	boneQuat.set(key[3], key[4], key[5], key[6]);
+	LocXVec.y = key[0];
+	LocYVec.y = key[1];
+	LocZVec.y = key[2];
 	
-	if(QuatX) {
-		testTween = new BezierPathTween(&QuatXVec, QuatX, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
-	}
+	// scale curves are not applied
+	targetBone->setPose(boneQuat, Vector3(key[0], key[1], key[2]));
+}
+
+void BoneTrack::Update() {
+	if(animation)
+		animation->evaluateTrack(trackIndex, animation->getTime());
+}
+
+void BoneTrack::setSpeed(Number speed) {
+	this->speed = speed;
+}
+
+Number BoneTrack::getSpeed() {
+	return speed;
+}
+
+void BoneTrack::setWeight(Number weight) {
+	this->weight = weight;
+}
+
+Number BoneTrack::getWeight() {
+	return weight;
+}
+
+// blends key into target by t: lerped position, normalized lerp of the rotation along the shorter arc
+static void blendKey(float *target, const float *key, float t) {
+	target[0] += (key[0] - target[0]) * t;
+	target[1] += (key[1] - target[1]) * t;
+	target[2] += (key[2] - target[2]) * t;
 	
-	if(QuatY) {
-		testTween = new BezierPathTween(&QuatYVec, QuatY, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
+	float dot = target[3]*key[3] + target[4]*key[4] + target[5]*key[5] + target[6]*key[6];
+	float sign = (dot < 0) ? -1.0 : 1.0;
+	float len = 0;
+	for(int c=3; c < 7; c++) {
+		target[c] += (key[c] * sign - target[c]) * t;
+		len += target[c] * target[c];
 	}
-	
-	if(QuatZ) {
-		testTween = new BezierPathTween(&QuatZVec, QuatZ, Tween::EASE_NONE, durTime, true);
-		pathTweens.push_back(testTween);
+	if(len > 0) {
+		len = 1.0 / sqrt(len);
+		for(int c=3; c < 7; c++) {
+			target[c] *= len;
+		}
 	}
-*/
 }
 
+SkeletonAnimation::SkeletonAnimation(String name, Number duration) {
+	this->name = name;
+	this->duration = duration;
+	speed = 1.0;
+	time = 0;
+	playing = false;
+	numSamples = 0;
+	weight = 1.0;
+	targetWeight = 1.0;
+	fadeRate = 0;
+}
 
-void BoneTrack::Update() {
+void SkeletonAnimation::setSpeed(Number speed) {
+	this->speed = speed;
+}
 
-	Matrix4 newMatrix;
-	newMatrix = boneQuat.createMatrix();
+void SkeletonAnimation::bake(int samplesPerSecond) {
+	unsigned int numTracks = boneTracks.size();
+	
+	numSamples = 2;
+	if(duration > 0 && samplesPerSecond > 0)
+		numSamples = (unsigned int)ceil(duration * samplesPerSecond) + 1;
+	if(numSamples < 2)
+		numSamples = 2;
+	
+	bakedKeys.resize(numSamples * numTracks * KEY_SIZE);
+	for(unsigned int s=0; s < numSamples; s++) {
+		Number sampleTime = duration * ((Number)s / (Number)(numSamples-1));
+		for(unsigned int i=0; i < numTracks; i++) {
+			boneTracks[i]->sampleCurves(sampleTime, &bakedKeys[(s * numTracks + i) * KEY_SIZE]);
+		}
+	}
+}
 
+void SkeletonAnimation::interpolateKey(unsigned int index, Number time, float *key) {
+	unsigned int numTracks = boneTracks.size();
+	
+	Number position = 0;
+	if(duration > 0) {
+		time = fmod(time, duration);
+		if(time < 0)
+			time += duration;
+		position = (time / duration) * (numSamples-1);
+	}
 	
-	Matrix4 scaleMatrix;
-	scaleMatrix.m[0][0] *= 1; //ScaleXVec.y;
-	scaleMatrix.m[1][1] *= 1; //ScaleYVec.y;
-	scaleMatrix.m[2][2] *= 1; //ScaleZVec.y;
+	unsigned int sample = (unsigned int)position;
+	if(sample > numSamples-2)
+		sample = numSamples-2;
+	float f = position - sample;
+	if(f > 1.0)
+		f = 1.0;
 	
+	const float *k0 = &bakedKeys[(sample * numTracks + index) * KEY_SIZE];
+	const float *k1 = &bakedKeys[((sample+1) * numTracks + index) * KEY_SIZE];
+	
+	for(int c=0; c < KEY_SIZE; c++) {
+		key[c] = k0[c];
+	}
+	blendKey(key, k1, f);
+}
 
-	Matrix4 posMatrix;
+void SkeletonAnimation::evaluateTrack(unsigned int index, Number time) {
+	if(index >= boneTracks.size())
+		return;
+	if(numSamples == 0)
+		bake();
+		
+	float key[KEY_SIZE];
+	interpolateKey(index, time * boneTracks[index]->getSpeed(), key);
+	boneTracks[index]->applyKey(key);
+}
 
-	if(LocX)
-		posMatrix.m[3][0] = LocXVec.y;		
-	else
-		posMatrix.m[3][0] = targetBone->getBaseMatrix()[3][0];
+void SkeletonAnimation::evaluatePose(Number time) {
+	if(numSamples == 0)
+		bake();
+		
+	float key[KEY_SIZE];
+	for(int i=0; i < boneTracks.size(); i++) {
+		BoneTrack *track = boneTracks[i];
+		if(!track->isPlaying())
+			continue;
+		interpolateKey(i, time * track->getSpeed(), key);
+		track->applyKey(key);
+	}
+}
 
-	if(LocY)
-		posMatrix.m[3][1] = LocYVec.y;		
-	else
-		posMatrix.m[3][1] = targetBone->getBaseMatrix()[3][1];
-	
-	if(LocZ)
-		posMatrix.m[3][2] = LocZVec.y;		
-	else
-		posMatrix.m[3][2] = targetBone->getBaseMatrix()[3][2];
-	
+void SkeletonAnimation::blendPose(float *pose, unsigned int numBones) {
+	if(weight <= 0 || boneTracks.size() == 0)
+		return;
+	if(numSamples == 0)
+		bake();
 	
-	newMatrix = scaleMatrix*newMatrix*posMatrix;	
+	float key[KEY_SIZE];
+	for(int i=0; i < boneTracks.size(); i++) {
+		BoneTrack *track = boneTracks[i];
+		int boneId = track->getBone()->boneId;
+		if(!track->isPlaying() || boneId < 0 || boneId >= numBones)
+			continue;
+			
+		Number w = weight * track->getWeight();
+		if(w <= 0)
+			continue;
+		if(w > 1.0)
+			w = 1.0;
+			
+		interpolateKey(i, time * track->getSpeed(), key);
+		blendKey(pose + boneId * KEY_SIZE, key, w);
+	}
+}
+
+void SkeletonAnimation::advance(Number elapsed) {
+	if(playing) {
+		time += elapsed * speed;
+		if(duration > 0) {
+			time = fmod(time, duration);
+			if(time < 0)
+				time += duration;
+		}
+	}
 	
-	targetBone->setBoneMatrix(newMatrix);
-	targetBone->setTransformByMatrixPure(newMatrix);		
+	if(weight != targetWeight) {
+		Number step = fadeRate * elapsed;
+		if(fabs(targetWeight - weight) <= step) {
+			weight = targetWeight;
+		} else if(targetWeight > weight) {
+			weight += step;
+		} else {
+			weight -= step;
+		}
+	}
+}
 
+void SkeletonAnimation::setWeight(Number weight) {
+	this->weight = weight;
+	targetWeight = weight;
+	fadeRate = 0;
 }
 
-void BoneTrack::setSpeed(Number speed) {
-	for(int i=0; i < pathTweens.size(); i++) {
-		pathTweens[i]->setSpeed(speed);
-	}	
-	quatTween->setSpeed(speed);
+Number SkeletonAnimation::getWeight() {
+	return weight;
 }
 
+void SkeletonAnimation::fadeTo(Number weight, Number fadeTime) {
+	targetWeight = weight;
+	if(fadeTime <= 0) {
+		this->weight = weight;
+		fadeRate = 0;
+	} else {
+		fadeRate = fabs(targetWeight - this->weight) / fadeTime;
+	}
+}
 
-SkeletonAnimation::SkeletonAnimation(String name, Number duration) {
-	this->name = name;
-	this->duration = duration;
+bool SkeletonAnimation::isFading() {
+	return weight != targetWeight;
 }
 
-void SkeletonAnimation::setSpeed(Number speed) {
+void SkeletonAnimation::setBoneMask(Bone *bone, Number weight, bool includeChildren) {
 	for(int i=0; i < boneTracks.size(); i++) {
-		boneTracks[i]->setSpeed(speed);
-	}	
+		if(boneTracks[i]->getBone() == bone)
+			boneTracks[i]->setWeight(weight);
+	}
+	
+	if(includeChildren) {
+		for(int i=0; i < bone->getNumChildBones(); i++) {
+			setBoneMask(bone->getChildBone(i), weight, true);
+		}
+	}
 }
 
 void SkeletonAnimation::Update() {
-	for(int i=0; i < boneTracks.size(); i++) {
-		boneTracks[i]->Update();
-	}
+	if(!playing)
+		return;
+		
+	advance(CoreServices::getInstance()->getCore()->getElapsed());
+	evaluatePose(time);
 }
 
 void SkeletonAnimation::Stop() {
-	for(int i=0; i < boneTracks.size(); i++) {
-		boneTracks[i]->Stop();
-	}
+	playing = false;
 }
 
 void SkeletonAnimation::Play() {
-	for(int i=0; i < boneTracks.size(); i++) {
-		boneTracks[i]->Play();
-	}
+	playing = true;
+}
+
+bool SkeletonAnimation::isPlaying() {
+	return playing;
+}
+
+Number SkeletonAnimation::getTime() {
+	return time;
+}
+
+void SkeletonAnimation::setTime(Number time) {
+	this->time = time;
+}
+
+Number SkeletonAnimation::getDuration() {
+	return duration;
 }
 
 SkeletonAnimation::~SkeletonAnimation() {
@@ -527,5 +950,8 @@ String SkeletonAnimation::getName() {
 }
 
 void SkeletonAnimation::addBoneTrack(BoneTrack *boneTrack) {
+	boneTrack->setAnimation(this, boneTracks.size());
 	boneTracks.push_back(boneTrack);
+	bakedKeys.clear();
+	numSamples = 0;
 }
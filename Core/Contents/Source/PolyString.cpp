@@ -21,36 +21,132 @@
 */
 
 #include "PolyString.h"
+#include <map>
+
+#ifdef MSVC
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
 
 using namespace Polycode;
 
-String::String() {
+// the symbol table is shared by all threads, it is guarded by a spinlock
+// since String has no access to the Core mutexes
+static std::map<wstring, unsigned int> symbols;
+static volatile unsigned int symbolsLock = 0;
+
+static void lockSymbols() {
+#ifdef MSVC
+	while(InterlockedCompareExchange((volatile LONG*)&symbolsLock, 1, 0) != 0) {
+		Sleep(0);
+	}
+#else
+	while(!__sync_bool_compare_and_swap(&symbolsLock, 0, 1)) {
+		sched_yield();
+	}
+#endif
+}
+
+static void unlockSymbols() {
+#ifdef MSVC
+	InterlockedExchange((volatile LONG*)&symbolsLock, 0);
+#else
+	__sync_lock_release(&symbolsLock);
+#endif
+}
+
+String::String() : cacheFlags(0), hash(0), symbol(0) {
 	contents = L"";
 	s_contents = "";
 }
 
-String::String(const wchar_t *str) {
+String::String(const wchar_t *str) : cacheFlags(0), hash(0), symbol(0) {
 	contents = wstring(str);
 }
 
-String::String(const char *str) {
+String::String(const char *str) : cacheFlags(0), hash(0), symbol(0) {
 	string sstr = string(str);
 	utf8toWStr(contents, sstr);	
 //	contents.assign(sstr.begin(), sstr.end());
 }
 
-String::String(const wchar_t *str, size_t n) {
+String::String(const wchar_t *str, size_t n) : cacheFlags(0), hash(0), symbol(0) {
 	contents = wstring(str, n);
 }
 
-String::String(string str) {
+String::String(string str) : cacheFlags(0), hash(0), symbol(0) {
 	contents.assign(str.begin(), str.end());	
 }
 
-String::String(wstring str) {
+String::String(wstring str) : cacheFlags(0), hash(0), symbol(0) {
 	contents = str;
 }
 
+void String::contentsChanged() {
+	cacheFlags = 0;
+}
+
+void String::setContents(const wstring &str) {
+	contents = str;
+	contentsChanged();
+}
+
+void String::copyCaches(const String &str) {
+	cacheFlags = str.cacheFlags;
+	hash = str.hash;
+	symbol = str.symbol;
+	if(cacheFlags & CACHED_NARROW)
+		s_contents = str.s_contents;
+	if(cacheFlags & CACHED_UTF8)
+		utf8Contents = str.utf8Contents;
+}
+
+unsigned int String::getHash() {
+	if(!(cacheFlags & CACHED_HASH)) {
+		// FNV-1a over the characters
+		hash = 2166136261u;
+		for(size_t i=0; i < contents.size(); i++) {
+			hash ^= (unsigned int)contents[i];
+			hash *= 16777619u;
+		}
+		cacheFlags |= CACHED_HASH;
+	}
+	return hash;
+}
+
+unsigned int String::getSymbol() {
+	if(!(cacheFlags & CACHED_SYMBOL)) {
+		lockSymbols();
+		std::map<wstring, unsigned int>::iterator it = symbols.find(contents);
+		if(it == symbols.end()) {
+			symbol = symbols.size() + 1;
+			symbols[contents] = symbol;
+		} else {
+			symbol = it->second;
+		}
+		unlockSymbols();
+		cacheFlags |= CACHED_SYMBOL;
+	}
+	return symbol;
+}
+
+unsigned int String::findSymbol() {
+	if(cacheFlags & CACHED_SYMBOL)
+		return symbol;
+	unsigned int found = 0;
+	lockSymbols();
+	std::map<wstring, unsigned int>::iterator it = symbols.find(contents);
+	if(it != symbols.end())
+		found = it->second;
+	unlockSymbols();
+	if(found) {
+		symbol = found;
+		cacheFlags |= CACHED_SYMBOL;
+	}
+	return found;
+}
+
 String::~String() {
 	
 }
@@ -58,9 +154,8 @@ String::~String() {
 size_t String::getDataSizeWithEncoding(int encoding) {
 	switch(encoding) {
 		case ENCODING_UTF8: {
-			string dest;
-			wstrToUtf8(dest, contents);
-			return dest.size();
+			getDataWithEncoding(encoding);
+			return utf8Contents.size();
 		}
 		default:
 			return NULL;
@@ -70,9 +165,11 @@ size_t String::getDataSizeWithEncoding(int encoding) {
 const char *String::getDataWithEncoding(int encoding) {
 	switch(encoding) {
 		case ENCODING_UTF8: {
-			string dest;
-			wstrToUtf8(dest, contents);
-			return dest.data();
+			if(!(cacheFlags & CACHED_UTF8)) {
+				wstrToUtf8(utf8Contents, contents);
+				cacheFlags |= CACHED_UTF8;
+			}
+			return utf8Contents.c_str();
 		}
 		break;
 		default:
@@ -85,6 +182,7 @@ void String::setDataWithEncoding(char *data, int encoding) {
 		case ENCODING_UTF8: {
 			string str = string(data);
 			utf8toWStr(contents, str);
+			contentsChanged();
 		}
 		default:
 			break;
@@ -155,7 +253,7 @@ String String::NumberToString(Number value) {
 
 
 string String::getSTLString() {
-	s_contents.assign(contents.begin(),contents.end());
+	c_str();
 	return s_contents;
 }
 
@@ -164,7 +262,10 @@ wstring String::getSTLWString() {
 }
 
 const char *String::c_str() {
-	s_contents.assign(contents.begin(),contents.end());	
+	if(!(cacheFlags & CACHED_NARROW)) {
+		s_contents.assign(contents.begin(),contents.end());	
+		cacheFlags |= CACHED_NARROW;
+	}
 	return s_contents.c_str();
 }
 
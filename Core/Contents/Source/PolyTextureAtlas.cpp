@@ -0,0 +1,124 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolyTextureAtlas.h"
+#include "PolyCoreServices.h"
+#include "PolyMaterialManager.h"
+#include "PolyTexture.h"
+#include "PolyObject.h"
+#include "PolyLogger.h"
+
+using namespace Polycode;
+
+TextureAtlas::TextureAtlas(String fileName) {
+	texture = NULL;
+	
+	Object atlasObject;
+	if(!atlasObject.loadFromXML(fileName)) {
+		Logger::log("Error loading texture atlas %s\n", fileName.c_str());
+		return;
+	}
+	
+	ObjectEntry *imageEntry = atlasObject.root["image"];
+	if(!imageEntry) {
+		Logger::log("Texture atlas %s has no image\n", fileName.c_str());
+		return;
+	}
+	
+	String imagePath = imageEntry->stringVal;
+	size_t slash = fileName.rfind("/");
+	if(slash != wstring::npos && imagePath.find("/") != 0)
+		imagePath = fileName.substr(0, slash+1) + imagePath;
+	texture = CoreServices::getInstance()->getMaterialManager()->createTextureFromFile(imagePath);
+	
+	for(int i=0; i < atlasObject.root.children.size(); i++) {
+		ObjectEntry *frameEntry = atlasObject.root.children[i];
+		if(frameEntry->name != "frame")
+			continue;
+		
+		ObjectEntry *nameEntry = (*frameEntry)["name"];
+		ObjectEntry *xEntry = (*frameEntry)["x"];
+		ObjectEntry *yEntry = (*frameEntry)["y"];
+		ObjectEntry *widthEntry = (*frameEntry)["width"];
+		ObjectEntry *heightEntry = (*frameEntry)["height"];
+		if(!nameEntry || !xEntry || !yEntry || !widthEntry || !heightEntry) {
+			Logger::log("Skipping incomplete frame in texture atlas %s\n", fileName.c_str());
+			continue;
+		}
+		addFrame(nameEntry->stringVal, xEntry->NumberVal, yEntry->NumberVal, widthEntry->NumberVal, heightEntry->NumberVal);
+	}
+}
+
+TextureAtlas::TextureAtlas(Texture *texture) {
+	this->texture = texture;
+}
+
+TextureAtlas::~TextureAtlas() {
+	for(int i=0; i < frames.size(); i++) {
+		delete frames[i];
+	}
+}
+
+TextureAtlasFrame *TextureAtlas::addFrame(String name, Number x, Number y, Number width, Number height) {
+	TextureAtlasFrame *frame = new TextureAtlasFrame();
+	frame->name = name;
+	frame->x = x;
+	frame->y = y;
+	frame->width = width;
+	frame->height = height;
+	
+	if(texture && texture->getWidth() > 0 && texture->getHeight() > 0) {
+		Number textureWidth = texture->getWidth();
+		Number textureHeight = texture->getHeight();
+		frame->uvOffset = Vector2(x / textureWidth, y / textureHeight);
+		frame->uvSize = Vector2(width / textureWidth, height / textureHeight);
+	}
+	
+	frames.push_back(frame);
+	return frame;
+}
+
+TextureAtlasFrame *TextureAtlas::getFrame(String name) {
+	for(int i=0; i < frames.size(); i++) {
+		if(frames[i]->name == name)
+			return frames[i];
+	}
+	return NULL;
+}
+
+TextureAtlasFrame *TextureAtlas::getFrame(unsigned int index) {
+	if(index >= frames.size())
+		return NULL;
+	return frames[index];
+}
+
+unsigned int TextureAtlas::getNumFrames() {
+	return frames.size();
+}
+
+Texture *TextureAtlas::getTexture() {
+	return texture;
+}
+
+bool TextureAtlas::isLoaded() {
+	return texture != NULL;
+}
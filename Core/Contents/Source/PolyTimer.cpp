@@ -28,7 +28,13 @@ Timer::Timer(bool triggerMode, int msecs) : EventDispatcher() {
 	this->msecs = msecs;
 	this->triggerMode = triggerMode;
 	paused = false;
-	Reset();
+	wheelNext = NULL;
+	wheelPrev = NULL;
+	wheelHead = NULL;
+	wheelDeadline = 0;
+	ticks = 0;
+	last = 0;
+	elapsed = 0;
 	CoreServices::getInstance()->getTimerManager()->addTimer(this);
 }
 
@@ -37,22 +43,30 @@ Timer::~Timer() {
 }
 
 void Timer::Reset() {
-	ticks = 0;
-	last = 0;
-	elapsed = 0;	
+	TimerManager *timerManager = CoreServices::getInstance()->getTimerManager();
+	ticks = timerManager->getTicks();
+	last = ticks;
+	elapsed = 0;
+	if(triggerMode && !paused)
+		timerManager->scheduleTimer(this, last+msecs+1);
+	else
+		timerManager->unscheduleTimer(this);
 }
 
 unsigned int Timer::getTicks() {
+	ticks = CoreServices::getInstance()->getTimerManager()->getTicks();
 	return ticks;
 }
 
 void Timer::Pause(bool paused) {
-	last = ticks;
-	elapsed = 0;
 	this->paused = paused;
+	Reset();
 }
 
 Number Timer::getElapsedf() {
+	// trigger timers report the interval of their last trigger, counting timers the time since they started
+	if(!triggerMode)
+		elapsed = getTicks()-last;
 	return ((Number)(elapsed))/1000.0f;
 }
 
@@ -61,7 +75,7 @@ bool Timer::isPaused() {
 }
 
 bool Timer::hasElapsed() {
-	if(ticks-last > msecs) {
+	if(getTicks()-last > msecs) {
 		last = ticks;
 		return true;
 	}
@@ -69,25 +83,11 @@ bool Timer::hasElapsed() {
 }
 
 void Timer::Update(unsigned int ticks) {
-	if(last == 0) {
-		last = ticks;
-		return;
-	}
-	
 	this->ticks = ticks;
 	elapsed = ticks-last;
+	last = ticks;
 	
-//	if(elapsed > 10000)
-//		elapsed = 10000;
-	
-	if(paused)
-		return;
-
-	if(triggerMode) {
-		if(elapsed > msecs) {
-			last = ticks;
-			this->dispatchEvent(new Event(), EVENT_TRIGGER); 
-		} else {
-		}
-	}
-}
\ No newline at end of file
+	// schedule before dispatching, so that handlers can pause, reset or delete the timer
+	CoreServices::getInstance()->getTimerManager()->scheduleTimer(this, last+msecs+1);
+	dispatchEventNoDelete(&triggerEvent, EVENT_TRIGGER);
+}
@@ -21,32 +21,167 @@
 */
 
 #include "PolyTimerManager.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
 TimerManager::TimerManager() {
-
+	for(int i=0; i < WHEEL_SIZE; i++) {
+		nearTimers[i] = NULL;
+		farTimers[i] = NULL;
+	}
+	overflowTimers = NULL;
+	pendingTimers = NULL;
+	firingTimers = NULL;
+	currentTicks = 0;
+	frameTicks = 0;
+	started = false;
 }
 
 TimerManager::~TimerManager() {
+}
+
+void TimerManager::linkTimer(Timer *timer, Timer **head) {
+	timer->wheelHead = head;
+	timer->wheelPrev = NULL;
+	timer->wheelNext = *head;
+	if(*head)
+		(*head)->wheelPrev = timer;
+	*head = timer;
+}
+
+void TimerManager::unlinkTimer(Timer *timer) {
+	if(!timer->wheelHead)
+		return;
+	if(timer->wheelPrev)
+		timer->wheelPrev->wheelNext = timer->wheelNext;
+	else
+		*timer->wheelHead = timer->wheelNext;
+	if(timer->wheelNext)
+		timer->wheelNext->wheelPrev = timer->wheelPrev;
+	timer->wheelNext = NULL;
+	timer->wheelPrev = NULL;
+	timer->wheelHead = NULL;
+}
+
+void TimerManager::placeTimer(Timer *timer) {
+	if((int)(timer->wheelDeadline - currentTicks) < 0)
+		timer->wheelDeadline = currentTicks;
+	
+	unsigned int delta = timer->wheelDeadline - currentTicks;
+	if(delta < WHEEL_SIZE) {
+		linkTimer(timer, &nearTimers[timer->wheelDeadline % WHEEL_SIZE]);
+	} else if(delta < (WHEEL_SIZE-1) * WHEEL_SIZE) {
+		linkTimer(timer, &farTimers[(timer->wheelDeadline / WHEEL_SIZE) % WHEEL_SIZE]);
+	} else {
+		linkTimer(timer, &overflowTimers);
+	}
+}
+
+void TimerManager::cascadeTimers(Timer **head) {
+	Timer *timer = *head;
+	*head = NULL;
+	while(timer) {
+		Timer *next = timer->wheelNext;
+		timer->wheelHead = NULL;
+		timer->wheelNext = NULL;
+		timer->wheelPrev = NULL;
+		placeTimer(timer);
+		timer = next;
+	}
+}
+
+void TimerManager::fireTimers(Timer **head, unsigned int ticks) {
+	// move the slot to a separate list, so timers that are removed or rescheduled by handlers unlink cleanly
+	firingTimers = *head;
+	*head = NULL;
+	for(Timer *timer = firingTimers; timer; timer = timer->wheelNext) {
+		timer->wheelHead = &firingTimers;
+	}
+	while(firingTimers) {
+		Timer *timer = firingTimers;
+		unlinkTimer(timer);
+		timer->Update(ticks);
+	}
+}
+
+void TimerManager::scheduleTimer(Timer *timer, unsigned int deadline) {
+	unlinkTimer(timer);
+	timer->wheelDeadline = deadline;
+	if(!started) {
+		linkTimer(timer, &pendingTimers);
+		return;
+	}
+	placeTimer(timer);
+}
 
+void TimerManager::unscheduleTimer(Timer *timer) {
+	unlinkTimer(timer);
 }
 
 void TimerManager::removeTimer(Timer *timer) {
-	for(int i=0;i<timers.size();i++) {
-		if(timers[i] == timer) {
-			timers.erase(timers.begin()+i);
-		}
-	}	
+	unlinkTimer(timer);
 }
 
 void TimerManager::addTimer(Timer *timer) {
-	timers.push_back(timer);		
+	if(!started) {
+		linkTimer(timer, &pendingTimers);
+		return;
+	}
+	timer->Reset();
+}
+
+unsigned int TimerManager::getTicks() {
+	return frameTicks;
 }
 
 void TimerManager::Update() {
-	int ticks = CoreServices::getInstance()->getCore()->getTicks();
-	for(int i=0;i<timers.size();i++) {
-		timers[i]->Update(ticks);
+	PROFILE_SCOPE("TimerManager::Update");
+	unsigned int ticks = CoreServices::getInstance()->getCore()->getTicks();
+	frameTicks = ticks;
+	
+	if(!started) {
+		// timers created before the first update start counting now
+		started = true;
+		currentTicks = ticks;
+		while(pendingTimers) {
+			Timer *timer = pendingTimers;
+			unlinkTimer(timer);
+			timer->Reset();
+		}
+		return;
+	}
+	
+	if((int)(ticks - currentTicks) <= 0)
+		return;
+	
+	if(ticks - currentTicks >= (WHEEL_SIZE-1) * WHEEL_SIZE) {
+		// long stall, rebuild the wheel around the current tick
+		for(int i=0; i < WHEEL_SIZE; i++) {
+			while(nearTimers[i]) {
+				Timer *timer = nearTimers[i];
+				unlinkTimer(timer);
+				linkTimer(timer, &overflowTimers);
+			}
+			while(farTimers[i]) {
+				Timer *timer = farTimers[i];
+				unlinkTimer(timer);
+				linkTimer(timer, &overflowTimers);
+			}
+		}
+		currentTicks = ticks;
+		cascadeTimers(&overflowTimers);
+		fireTimers(&nearTimers[currentTicks % WHEEL_SIZE], ticks);
+		return;
 	}
-}
\ No newline at end of file
+	
+	while(currentTicks != ticks) {
+		currentTicks++;
+		unsigned int slot = currentTicks % WHEEL_SIZE;
+		if(slot == 0) {
+			cascadeTimers(&overflowTimers);
+			cascadeTimers(&farTimers[(currentTicks / WHEEL_SIZE) % WHEEL_SIZE]);
+		}
+		fireTimers(&nearTimers[slot], ticks);
+	}
+}
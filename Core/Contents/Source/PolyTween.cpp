@@ -32,31 +32,28 @@ Tween::	Tween(Number *target, int easeType, Number startVal, Number endVal, Numb
 	this->startVal = startVal;
 	cVal = endVal - startVal;
 	localTargetVal = startVal;
-	this->endTime = time;
-	tweenTime = 0;
 	*targetVal = startVal;
-	tweenTimer = new Timer(true, 1);
-	tweenTimer->addEventListener(this, 0);
 	complete = false;
+	tweenIndex = -1;
 
 	actEndTime = time;
 	CoreServices::getInstance()->getTweenManager()->addTween(this);
+	CoreServices::getInstance()->getTweenManager()->setTweenDuration(tweenIndex, time);
 }
 
 void Tween::Pause(bool pauseVal) {
-	tweenTimer->Pause(pauseVal);
+	CoreServices::getInstance()->getTweenManager()->setTweenPaused(tweenIndex, pauseVal);
 }
 
 void Tween::setSpeed(Number speed) {
 	if(speed <= 0 )		
-		endTime = 0;
+		CoreServices::getInstance()->getTweenManager()->setTweenDuration(tweenIndex, 0);
 	else
-		endTime = actEndTime / speed;
+		CoreServices::getInstance()->getTweenManager()->setTweenDuration(tweenIndex, actEndTime / speed);
 }
 
 Tween::~Tween() {
-	tweenTimer->removeEventListener(this, 0);
-	CoreServices::getInstance()->getTimerManager()->removeTimer(tweenTimer);
+	CoreServices::getInstance()->getTweenManager()->removeTween(this);
 }
 
 bool Tween::isComplete() {
@@ -67,32 +64,36 @@ void Tween::doOnComplete() {
 	dispatchEvent(new Event(), Event::COMPLETE_EVENT);
 }
 
-void Tween::handleEvent(Event *event) {
+void Tween::updateTween(Number &tweenTime, Number endTime) {
 	if(tweenTime >= endTime) {
-		if(repeat){
-			Reset();
-			updateCustomTween();			
+		if(repeat && endTime > 0) {
+			tweenTime = fmod(tweenTime, endTime);
 		} else {
-			*targetVal = endVal;			
+			*targetVal = endVal;
 			complete = true;
+			updateCustomTween();
+			return;
 		}
-		return;
 	}
 	
 	if(targetVal != NULL) {
-		localTargetVal = interpolateTween();
+		localTargetVal = interpolateAt(tweenTime, endTime);
 		*targetVal = localTargetVal;
 	}
-	tweenTime += tweenTimer->getElapsedf();
 	updateCustomTween();
 }
 
 void Tween::Reset() {
-	tweenTime = 0;
+	CoreServices::getInstance()->getTweenManager()->setTweenTime(tweenIndex, 0);
 	complete = false;
 }
 
 Number Tween::interpolateTween() {
+	TweenManager *tweenManager = CoreServices::getInstance()->getTweenManager();
+	return interpolateAt(tweenManager->getTweenTime(tweenIndex), tweenManager->getTweenDuration(tweenIndex));
+}
+
+Number Tween::interpolateAt(Number tweenTime, Number endTime) {
 	Number t = tweenTime;
 	
 	switch(easeType) {
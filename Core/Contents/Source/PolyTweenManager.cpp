@@ -21,35 +21,121 @@
 */
 
 #include "PolyTweenManager.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
 TweenManager::TweenManager() {
-
 }
 
 TweenManager::~TweenManager() {
-
 }
 
 void TweenManager::addTween(Tween *tween) {
+	tween->tweenIndex = tweens.size();
 	tweens.push_back(tween);
+	tweenTimes.push_back(0);
+	tweenDurations.push_back(0);
+	tweenRates.push_back(1.0);
+}
+
+void TweenManager::removeTween(Tween *tween) {
+	// the slot is compacted away during the next update
+	if(tween->tweenIndex >= 0 && tween->tweenIndex < tweens.size() && tweens[tween->tweenIndex] == tween)
+		tweens[tween->tweenIndex] = NULL;
+	tween->tweenIndex = -1;
+}
+
+Number TweenManager::getTweenTime(int index) {
+	if(index < 0 || index >= tweenTimes.size())
+		return 0;
+	return tweenTimes[index];
+}
+
+void TweenManager::setTweenTime(int index, Number time) {
+	if(index < 0 || index >= tweenTimes.size())
+		return;
+	tweenTimes[index] = time;
+}
+
+Number TweenManager::getTweenDuration(int index) {
+	if(index < 0 || index >= tweenDurations.size())
+		return 0;
+	return tweenDurations[index];
+}
+
+void TweenManager::setTweenDuration(int index, Number duration) {
+	if(index < 0 || index >= tweenDurations.size())
+		return;
+	tweenDurations[index] = duration;
+}
+
+void TweenManager::setTweenPaused(int index, bool paused) {
+	if(index < 0 || index >= tweenRates.size())
+		return;
+	tweenRates[index] = paused ? 0.0 : 1.0;
+}
+
+unsigned int TweenManager::getNumTweens() {
+	return tweens.size();
 }
 
 void TweenManager::Update() {
-	Tween *tween;
-	for(int i=0;i<tweens.size();i++) {
-		if(tweens[i]->isComplete()) {
-			if(tweens[i]->repeat) {
-				tweens[i]->Reset();
-				return;
+	PROFILE_SCOPE("TweenManager::Update");
+	updateTweens(CoreServices::getInstance()->getCore()->getElapsed());
+}
+
+void TweenManager::updateTweens(Number elapsed) {
+	unsigned int count = tweens.size();
+	if(count == 0)
+		return;
+	
+	Number *times = &tweenTimes[0];
+	Number *rates = &tweenRates[0];
+	for(int i=0; i < count; i++) {
+		times[i] += elapsed * rates[i];
+	}
+	
+	// tweens added by custom updates are picked up next frame
+	for(int i=0; i < count; i++) {
+		Tween *tween = tweens[i];
+		if(!tween || tweenRates[i] == 0.0 || tween->isComplete())
+			continue;
+		tween->updateTween(tweenTimes[i], tweenDurations[i]);
+	}
+	
+	count = tweens.size();
+	unsigned int kept = 0;
+	for(int i=0; i < count; i++) {
+		Tween *tween = tweens[i];
+		if(!tween)
+			continue;
+		if(tween->isComplete()) {
+			if(tween->repeat) {
+				tween->Reset();
 			} else {
-				tween = tweens[i];
-				tweens.erase(tweens.begin()+i);
-				tween->doOnComplete();
-				delete tween;
-				return;
+				tween->tweenIndex = -1;
+				completedTweens.push_back(tween);
+				continue;
 			}
 		}
+		if(kept != i) {
+			tweens[kept] = tween;
+			tweenTimes[kept] = tweenTimes[i];
+			tweenDurations[kept] = tweenDurations[i];
+			tweenRates[kept] = tweenRates[i];
+			tween->tweenIndex = kept;
+		}
+		kept++;
+	}
+	tweens.resize(kept);
+	tweenTimes.resize(kept);
+	tweenDurations.resize(kept);
+	tweenRates.resize(kept);
+	
+	for(int i=0; i < completedTweens.size(); i++) {
+		completedTweens[i]->doOnComplete();
+		delete completedTweens[i];
 	}
+	completedTweens.clear();
 }
@@ -159,13 +159,9 @@ end
 function PhysicsScreen:getVelocity(ent)
 	local retVal = Physics2D.PhysicsScreen_getVelocity(self.__ptr, ent.__ptr)
 	if retVal == nil then return nil end
-	if Polycore.__ptr_lookup[retVal] ~= nil then
-		return Polycore.__ptr_lookup[retVal]
-	else
-		Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-		Polycore.__ptr_lookup[retVal].__ptr = retVal
-		return Polycore.__ptr_lookup[retVal]
-	end
+	local __c = Vector2("__skip_ptr__")
+	__c.__ptr = retVal
+	return __c
 end
 
 function PhysicsScreen:BeginContact(contact)
@@ -9,31 +9,22 @@ EVENT_END_SHAPE_COLLISION = 1
 function PhysicsScreenEvent:__index__(name)
 	if name == "localCollisionNormal" then
 		retVal = Physics2D.PhysicsScreenEvent_get_localCollisionNormal(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector2("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "worldCollisionNormal" then
 		retVal = Physics2D.PhysicsScreenEvent_get_worldCollisionNormal(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector2("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "localCollisionPoint" then
 		retVal = Physics2D.PhysicsScreenEvent_get_localCollisionPoint(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector2("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector2("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "impactStrength" then
 		return Physics2D.PhysicsScreenEvent_get_impactStrength(self.__ptr)
 	elseif name == "frictionStrength" then
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Polycode2DPhysics.h>
+#include <new>
 
 extern "C" {
 
@@ -9,6 +10,28 @@ extern "C" {
 #include "lualib.h"
 #include "lauxlib.h"
 
+#ifndef POLYCODE_LUA_VALUE_TYPES
+#define POLYCODE_LUA_VALUE_TYPES
+static inline void luaPolycode_checkpointer(lua_State *L, int idx) {
+	if(!lua_isuserdata(L, idx))
+		luaL_typerror(L, idx, "userdata");
+}
+
+static inline void *luaPolycode_checkvalue(lua_State *L, int idx, const char *metatableName) {
+	// light userdata point at value members of engine objects and carry no type
+	if(lua_islightuserdata(L, idx))
+		return (void*)lua_topointer(L, idx);
+	return luaL_checkudata(L, idx, metatableName);
+}
+
+static inline void *luaPolycode_alloc_value(lua_State *L, size_t size, const char *metatableName) {
+	void *mem = lua_newuserdata(L, size);
+	luaL_getmetatable(L, metatableName);
+	lua_setmetatable(L, -2);
+	return mem;
+}
+#endif
+
 static int Physics2D_PhysicsScreen(lua_State *L) {
 	luaL_checktype(L, 1, LUA_TNUMBER);
 	Number worldScale = lua_tonumber(L, 1);
@@ -20,16 +43,16 @@ static int Physics2D_PhysicsScreen(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_addPhysicsChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * newEntity = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int entType = lua_tointeger(L, 3);
@@ -75,18 +98,18 @@ static int Physics2D_PhysicsScreen_addPhysicsChild(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_removePhysicsChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PhysicsScreenEntity * entityToRemove = (PhysicsScreenEntity *)lua_topointer(L, 2);
 	inst->removePhysicsChild(entityToRemove);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_addCollisionChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * newEntity = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int entType = lua_tointeger(L, 3);
@@ -100,20 +123,20 @@ static int Physics2D_PhysicsScreen_addCollisionChild(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_destroyJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	PhysicsJoint * joint = (PhysicsJoint *)lua_topointer(L, 2);
 	inst->destroyJoint(joint);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_createDistanceJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent1 = (ScreenEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	ScreenEntity * ent2 = (ScreenEntity *)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TBOOLEAN);
 	bool collideConnected = lua_toboolean(L, 4);
@@ -127,13 +150,13 @@ static int Physics2D_PhysicsScreen_createDistanceJoint(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_createPrismaticJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent1 = (ScreenEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	ScreenEntity * ent2 = (ScreenEntity *)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Vector2 worldAxis = *(Vector2*)lua_topointer(L, 4);
 	luaL_checktype(L, 5, LUA_TNUMBER);
 	Number ax = lua_tonumber(L, 5);
@@ -191,11 +214,11 @@ static int Physics2D_PhysicsScreen_createPrismaticJoint(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_createRevoluteJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent1 = (ScreenEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	ScreenEntity * ent2 = (ScreenEntity *)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number ax = lua_tonumber(L, 4);
@@ -253,9 +276,9 @@ static int Physics2D_PhysicsScreen_createRevoluteJoint(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_applyForce(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fx = lua_tonumber(L, 3);
@@ -266,9 +289,9 @@ static int Physics2D_PhysicsScreen_applyForce(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_applyImpulse(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fx = lua_tonumber(L, 3);
@@ -279,20 +302,20 @@ static int Physics2D_PhysicsScreen_applyImpulse(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_setGravity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector2 newGravity = *(Vector2*)lua_topointer(L, 2);
 	inst->setGravity(newGravity);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_setTransform(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Vector2 pos = *(Vector2*)lua_topointer(L, 3);
 	luaL_checktype(L, 4, LUA_TNUMBER);
 	Number angle = lua_tonumber(L, 4);
@@ -301,9 +324,9 @@ static int Physics2D_PhysicsScreen_setTransform(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_getPhysicsEntityByShape(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2Shape * shape = (b2Shape *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getPhysicsEntityByShape(shape);
 	if(ptrRetVal == NULL) {
@@ -315,9 +338,9 @@ static int Physics2D_PhysicsScreen_getPhysicsEntityByShape(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_getPhysicsEntityByFixture(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2Fixture * fixture = (b2Fixture *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getPhysicsEntityByFixture(fixture);
 	if(ptrRetVal == NULL) {
@@ -329,9 +352,9 @@ static int Physics2D_PhysicsScreen_getPhysicsEntityByFixture(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_setVelocity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fx = lua_tonumber(L, 3);
@@ -342,9 +365,9 @@ static int Physics2D_PhysicsScreen_setVelocity(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_setVelocityX(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fx = lua_tonumber(L, 3);
@@ -353,9 +376,9 @@ static int Physics2D_PhysicsScreen_setVelocityX(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_setVelocityY(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number fy = lua_tonumber(L, 3);
@@ -364,9 +387,9 @@ static int Physics2D_PhysicsScreen_setVelocityY(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_setSpin(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number spin = lua_tonumber(L, 3);
@@ -375,56 +398,55 @@ static int Physics2D_PhysicsScreen_setSpin(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_getVelocity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
-	Vector2 *retInst = new Vector2();
+	Vector2 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector2), "Polycode.Vector2")) Vector2();
 	*retInst = inst->getVelocity(ent);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreen_BeginContact(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2Contact * contact = (b2Contact *)lua_topointer(L, 2);
 	inst->BeginContact(contact);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_EndContact(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2Contact * contact = (b2Contact *)lua_topointer(L, 2);
 	inst->EndContact(contact);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_PostSolve(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2Contact * contact = (b2Contact *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const b2ContactImpulse * impulse = (const b2ContactImpulse *)lua_topointer(L, 3);
 	inst->PostSolve(contact, impulse);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_wakeUp(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	inst->wakeUp(ent);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_getEntityAtPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 2);
@@ -440,9 +462,9 @@ static int Physics2D_PhysicsScreen_getEntityAtPosition(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_testEntityAtPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 3);
@@ -453,16 +475,16 @@ static int Physics2D_PhysicsScreen_testEntityAtPosition(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_Shutdown(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
 	inst->Shutdown();
 	return 0;
 }
 
 static int Physics2D_PhysicsScreen_getPhysicsByScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	ScreenEntity * ent = (ScreenEntity *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getPhysicsByScreenEntity(ent);
 	if(ptrRetVal == NULL) {
@@ -474,16 +496,16 @@ static int Physics2D_PhysicsScreen_getPhysicsByScreenEntity(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreen_destroyMouseJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2MouseJoint * mJoint = (b2MouseJoint *)lua_topointer(L, 2);
 	inst->destroyMouseJoint(mJoint);
 	return 0;
 }
 
 static int Physics2D_delete_PhysicsScreen(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreen *inst = (PhysicsScreen*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -496,49 +518,49 @@ static int Physics2D_PhysicsJoint(lua_State *L) {
 }
 
 static int Physics2D_delete_PhysicsJoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsJoint *inst = (PhysicsJoint*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics2D_PhysicsScreenEvent_get_localCollisionNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->localCollisionNormal);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEvent_get_worldCollisionNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->worldCollisionNormal);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEvent_get_localCollisionPoint(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->localCollisionPoint);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEvent_get_impactStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->impactStrength);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEvent_get_frictionStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->frictionStrength);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEvent_set_impactStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->impactStrength = param;
@@ -546,7 +568,7 @@ static int Physics2D_PhysicsScreenEvent_set_impactStrength(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEvent_set_frictionStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->frictionStrength = param;
@@ -560,7 +582,7 @@ static int Physics2D_PhysicsScreenEvent(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEvent_getFirstEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getFirstEntity();
 	if(ptrRetVal == NULL) {
@@ -572,7 +594,7 @@ static int Physics2D_PhysicsScreenEvent_getFirstEntity(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEvent_getSecondEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSecondEntity();
 	if(ptrRetVal == NULL) {
@@ -584,21 +606,21 @@ static int Physics2D_PhysicsScreenEvent_getSecondEntity(lua_State *L) {
 }
 
 static int Physics2D_delete_PhysicsScreenEvent(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEvent *inst = (PhysicsScreenEvent*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics2D_PhysicsScreenEntity_get_collisionOnly(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->collisionOnly);
 	return 1;
 }
 
 static int Physics2D_PhysicsScreenEntity_set_collisionOnly(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->collisionOnly = param;
@@ -606,9 +628,9 @@ static int Physics2D_PhysicsScreenEntity_set_collisionOnly(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	ScreenEntity * entity = (ScreenEntity *)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	b2World * world = (b2World *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number worldScale = lua_tonumber(L, 3);
@@ -632,7 +654,7 @@ static int Physics2D_PhysicsScreenEntity(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEntity_getScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getScreenEntity();
 	if(ptrRetVal == NULL) {
@@ -644,7 +666,7 @@ static int Physics2D_PhysicsScreenEntity_getScreenEntity(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEntity_applyTorque(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number torque = lua_tonumber(L, 2);
@@ -653,18 +675,18 @@ static int Physics2D_PhysicsScreenEntity_applyTorque(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEntity_applyForce(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector2 force = *(Vector2*)lua_topointer(L, 2);
 	inst->applyForce(force);
 	return 0;
 }
 
 static int Physics2D_PhysicsScreenEntity_setTransform(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector2 pos = *(Vector2*)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number angle = lua_tonumber(L, 3);
@@ -673,14 +695,14 @@ static int Physics2D_PhysicsScreenEntity_setTransform(lua_State *L) {
 }
 
 static int Physics2D_PhysicsScreenEntity_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics2D_delete_PhysicsScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScreenEntity *inst = (PhysicsScreenEntity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
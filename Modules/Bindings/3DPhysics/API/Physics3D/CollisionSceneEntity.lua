@@ -18,33 +18,24 @@ function CollisionSceneEntity:__index__(name)
 		return Physics3D.CollisionSceneEntity_get_autoCollide(self.__ptr)
 	elseif name == "gravityVector" then
 		retVal = Physics3D.CollisionSceneEntity_get_gravityVector(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "gVelocity" then
 		retVal = Physics3D.CollisionSceneEntity_get_gVelocity(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "gravityStrength" then
 		return Physics3D.CollisionSceneEntity_get_gravityStrength(self.__ptr)
 	elseif name == "lastPosition" then
 		retVal = Physics3D.CollisionSceneEntity_get_lastPosition(self.__ptr)
-		if Polycore.__ptr_lookup[retVal] ~= nil then
-			return Polycore.__ptr_lookup[retVal]
-		else
-			Polycore.__ptr_lookup[retVal] = Vector3("__skip_ptr__")
-			Polycore.__ptr_lookup[retVal].__ptr = retVal
-			return Polycore.__ptr_lookup[retVal]
-		end
+		if retVal == nil then return nil end
+		local __c = Vector3("__skip_ptr__")
+		__c.__ptr = retVal
+		return __c
 	elseif name == "enabled" then
 		return Physics3D.CollisionSceneEntity_get_enabled(self.__ptr)
 	end
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Polycode3DPhysics.h>
+#include <new>
 
 extern "C" {
 
@@ -9,6 +10,28 @@ extern "C" {
 #include "lualib.h"
 #include "lauxlib.h"
 
+#ifndef POLYCODE_LUA_VALUE_TYPES
+#define POLYCODE_LUA_VALUE_TYPES
+static inline void luaPolycode_checkpointer(lua_State *L, int idx) {
+	if(!lua_isuserdata(L, idx))
+		luaL_typerror(L, idx, "userdata");
+}
+
+static inline void *luaPolycode_checkvalue(lua_State *L, int idx, const char *metatableName) {
+	// light userdata point at value members of engine objects and carry no type
+	if(lua_islightuserdata(L, idx))
+		return (void*)lua_topointer(L, idx);
+	return luaL_checkudata(L, idx, metatableName);
+}
+
+static inline void *luaPolycode_alloc_value(lua_State *L, size_t size, const char *metatableName) {
+	void *mem = lua_newuserdata(L, size);
+	luaL_getmetatable(L, metatableName);
+	lua_setmetatable(L, -2);
+	return mem;
+}
+#endif
+
 static int Physics3D_CollisionScene(lua_State *L) {
 	CollisionScene *inst = new CollisionScene();
 	lua_pushlightuserdata(L, (void*)inst);
@@ -16,23 +39,23 @@ static int Physics3D_CollisionScene(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_initCollisionScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
 	inst->initCollisionScene();
 	return 0;
 }
 
 static int Physics3D_CollisionScene_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_CollisionScene_enableCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TBOOLEAN);
 	bool val = lua_toboolean(L, 3);
@@ -41,9 +64,9 @@ static int Physics3D_CollisionScene_enableCollision(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_getCollisionEntityByObject(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	btCollisionObject * collisionObject = (btCollisionObject *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getCollisionEntityByObject(collisionObject);
 	if(ptrRetVal == NULL) {
@@ -55,11 +78,11 @@ static int Physics3D_CollisionScene_getCollisionEntityByObject(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_getFirstEntityInRay(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	const Vector3 & origin = *( Vector3 *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	const Vector3 & dest = *( Vector3 *)lua_topointer(L, 3);
 	RayTestResult *retInst = new RayTestResult();
 	*retInst = inst->getFirstEntityInRay(origin, dest);
@@ -68,9 +91,9 @@ static int Physics3D_CollisionScene_getFirstEntityInRay(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_getCollisionByScreenEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * ent = (SceneEntity *)lua_topointer(L, 2);
 	void *ptrRetVal = (void*)inst->getCollisionByScreenEntity(ent);
 	if(ptrRetVal == NULL) {
@@ -82,11 +105,11 @@ static int Physics3D_CollisionScene_getCollisionByScreenEntity(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_testCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * ent1 = (SceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	SceneEntity * ent2 = (SceneEntity *)lua_topointer(L, 3);
 	CollisionResult *retInst = new CollisionResult();
 	*retInst = inst->testCollision(ent1, ent2);
@@ -95,11 +118,11 @@ static int Physics3D_CollisionScene_testCollision(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_testCollisionOnCollisionChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CollisionSceneEntity * cEnt1 = (CollisionSceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	CollisionSceneEntity * cEnt2 = (CollisionSceneEntity *)lua_topointer(L, 3);
 	CollisionResult *retInst = new CollisionResult();
 	*retInst = inst->testCollisionOnCollisionChild(cEnt1, cEnt2);
@@ -108,11 +131,11 @@ static int Physics3D_CollisionScene_testCollisionOnCollisionChild(lua_State *L)
 }
 
 static int Physics3D_CollisionScene_testCollisionOnCollisionChild_Convex(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CollisionSceneEntity * cEnt1 = (CollisionSceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	CollisionSceneEntity * cEnt2 = (CollisionSceneEntity *)lua_topointer(L, 3);
 	CollisionResult *retInst = new CollisionResult();
 	*retInst = inst->testCollisionOnCollisionChild_Convex(cEnt1, cEnt2);
@@ -121,11 +144,11 @@ static int Physics3D_CollisionScene_testCollisionOnCollisionChild_Convex(lua_Sta
 }
 
 static int Physics3D_CollisionScene_testCollisionOnCollisionChild_RayTest(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CollisionSceneEntity * cEnt1 = (CollisionSceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	CollisionSceneEntity * cEnt2 = (CollisionSceneEntity *)lua_topointer(L, 3);
 	CollisionResult *retInst = new CollisionResult();
 	*retInst = inst->testCollisionOnCollisionChild_RayTest(cEnt1, cEnt2);
@@ -134,35 +157,33 @@ static int Physics3D_CollisionScene_testCollisionOnCollisionChild_RayTest(lua_St
 }
 
 static int Physics3D_CollisionScene_getCollisionNormalFromCollisionEnts(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CollisionSceneEntity * cEnt1 = (CollisionSceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	CollisionSceneEntity * cEnt2 = (CollisionSceneEntity *)lua_topointer(L, 3);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getCollisionNormalFromCollisionEnts(cEnt1, cEnt2);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Physics3D_CollisionScene_getCollisionNormal(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * ent1 = (SceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	SceneEntity * ent2 = (SceneEntity *)lua_topointer(L, 3);
-	Vector3 *retInst = new Vector3();
+	Vector3 *retInst = new (luaPolycode_alloc_value(L, sizeof(Vector3), "Polycode.Vector3")) Vector3();
 	*retInst = inst->getCollisionNormal(ent1, ent2);
-	lua_pushlightuserdata(L, retInst);
 	return 1;
 }
 
 static int Physics3D_CollisionScene_applyVelocity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number x = lua_tonumber(L, 3);
@@ -175,9 +196,9 @@ static int Physics3D_CollisionScene_applyVelocity(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_loadCollisionChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	bool autoCollide;
 	if(lua_isboolean(L, 3)) {
@@ -196,27 +217,27 @@ static int Physics3D_CollisionScene_loadCollisionChild(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_enableGravity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	inst->enableGravity(entity);
 	return 0;
 }
 
 static int Physics3D_CollisionScene_stopTrackingCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	inst->stopTrackingCollision(entity);
 	return 0;
 }
 
 static int Physics3D_CollisionScene_addCollisionChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	bool autoCollide;
 	if(lua_isboolean(L, 3)) {
@@ -246,9 +267,9 @@ static int Physics3D_CollisionScene_addCollisionChild(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_trackCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TBOOLEAN);
 	bool autoCollide = lua_toboolean(L, 3);
@@ -274,72 +295,72 @@ static int Physics3D_CollisionScene_trackCollision(lua_State *L) {
 }
 
 static int Physics3D_CollisionScene_adjustForCollision(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	CollisionSceneEntity * collisionEntity = (CollisionSceneEntity *)lua_topointer(L, 2);
 	inst->adjustForCollision(collisionEntity);
 	return 0;
 }
 
 static int Physics3D_delete_CollisionScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionScene *inst = (CollisionScene*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics3D_CollisionSceneEntity_get_gravityEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->gravityEnabled);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_autoCollide(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->autoCollide);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_gravityVector(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->gravityVector);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_gVelocity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->gVelocity);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_gravityStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushnumber(L, inst->gravityStrength);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_lastPosition(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->lastPosition);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_get_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->enabled);
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_set_gravityEnabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->gravityEnabled = param;
@@ -347,7 +368,7 @@ static int Physics3D_CollisionSceneEntity_set_gravityEnabled(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_set_autoCollide(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->autoCollide = param;
@@ -355,7 +376,7 @@ static int Physics3D_CollisionSceneEntity_set_autoCollide(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_set_gravityStrength(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	Number param = lua_tonumber(L, 2);
 	inst->gravityStrength = param;
@@ -363,7 +384,7 @@ static int Physics3D_CollisionSceneEntity_set_gravityStrength(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_set_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->enabled = param;
@@ -371,7 +392,7 @@ static int Physics3D_CollisionSceneEntity_set_enabled(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TBOOLEAN);
 	bool autoCollide = lua_toboolean(L, 2);
@@ -383,7 +404,7 @@ static int Physics3D_CollisionSceneEntity(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_getSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSceneEntity();
 	if(ptrRetVal == NULL) {
@@ -395,21 +416,21 @@ static int Physics3D_CollisionSceneEntity_getSceneEntity(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_CollisionSceneEntity_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Physics3D_CollisionSceneEntity_getConvexShape(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getConvexShape();
 	if(ptrRetVal == NULL) {
@@ -421,9 +442,9 @@ static int Physics3D_CollisionSceneEntity_getConvexShape(lua_State *L) {
 }
 
 static int Physics3D_CollisionSceneEntity_createCollisionShape(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	int type = lua_tointeger(L, 3);
@@ -437,7 +458,7 @@ static int Physics3D_CollisionSceneEntity_createCollisionShape(lua_State *L) {
 }
 
 static int Physics3D_delete_CollisionSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	CollisionSceneEntity *inst = (CollisionSceneEntity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
@@ -450,16 +471,16 @@ static int Physics3D_PhysicsScene(lua_State *L) {
 }
 
 static int Physics3D_PhysicsScene_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_PhysicsScene_addPhysicsChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	int type;
 	if(lua_isnumber(L, 3)) {
@@ -501,9 +522,9 @@ static int Physics3D_PhysicsScene_addPhysicsChild(lua_State *L) {
 }
 
 static int Physics3D_PhysicsScene_trackPhysicsChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	int type;
 	if(lua_isnumber(L, 3)) {
@@ -545,9 +566,9 @@ static int Physics3D_PhysicsScene_trackPhysicsChild(lua_State *L) {
 }
 
 static int Physics3D_PhysicsScene_addCharacterChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number mass = lua_tonumber(L, 3);
@@ -571,9 +592,9 @@ static int Physics3D_PhysicsScene_addCharacterChild(lua_State *L) {
 }
 
 static int Physics3D_PhysicsScene_addVehicleChild(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * newEntity = (SceneEntity *)lua_topointer(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number mass = lua_tonumber(L, 3);
@@ -595,21 +616,21 @@ static int Physics3D_PhysicsScene_addVehicleChild(lua_State *L) {
 }
 
 static int Physics3D_delete_PhysicsScene(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsScene *inst = (PhysicsScene*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics3D_PhysicsSceneEntity_get_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	lua_pushboolean(L, inst->enabled);
 	return 1;
 }
 
 static int Physics3D_PhysicsSceneEntity_set_enabled(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	bool param = lua_toboolean(L, 2);
 	inst->enabled = param;
@@ -617,7 +638,7 @@ static int Physics3D_PhysicsSceneEntity_set_enabled(lua_State *L) {
 }
 
 static int Physics3D_PhysicsSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	int type = lua_tointeger(L, 2);
@@ -633,7 +654,7 @@ static int Physics3D_PhysicsSceneEntity(lua_State *L) {
 }
 
 static int Physics3D_PhysicsSceneEntity_getSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	void *ptrRetVal = (void*)inst->getSceneEntity();
 	if(ptrRetVal == NULL) {
@@ -645,14 +666,14 @@ static int Physics3D_PhysicsSceneEntity_getSceneEntity(lua_State *L) {
 }
 
 static int Physics3D_PhysicsSceneEntity_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_PhysicsSceneEntity_setFriction(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number friction = lua_tonumber(L, 2);
@@ -661,21 +682,21 @@ static int Physics3D_PhysicsSceneEntity_setFriction(lua_State *L) {
 }
 
 static int Physics3D_PhysicsSceneEntity_getType(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	lua_pushinteger(L, inst->getType());
 	return 1;
 }
 
 static int Physics3D_delete_PhysicsSceneEntity(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsSceneEntity *inst = (PhysicsSceneEntity*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics3D_PhysicsCharacter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number mass = lua_tonumber(L, 2);
@@ -689,50 +710,50 @@ static int Physics3D_PhysicsCharacter(lua_State *L) {
 }
 
 static int Physics3D_PhysicsCharacter_setWalkDirection(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsCharacter *inst = (PhysicsCharacter*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 2);
 	inst->setWalkDirection(direction);
 	return 0;
 }
 
 static int Physics3D_PhysicsCharacter_jump(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsCharacter *inst = (PhysicsCharacter*)lua_topointer(L, 1);
 	inst->jump();
 	return 0;
 }
 
 static int Physics3D_PhysicsCharacter_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsCharacter *inst = (PhysicsCharacter*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_delete_PhysicsCharacter(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsCharacter *inst = (PhysicsCharacter*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
 }
 
 static int Physics3D_PhysicsVehicle_get_tuning(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	lua_pushlightuserdata(L, &inst->tuning);
 	return 1;
 }
 
 static int Physics3D_PhysicsVehicle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number mass = lua_tonumber(L, 2);
 	luaL_checktype(L, 3, LUA_TNUMBER);
 	Number friction = lua_tonumber(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	btDefaultVehicleRaycaster * rayCaster = (btDefaultVehicleRaycaster *)lua_topointer(L, 4);
 	PhysicsVehicle *inst = new PhysicsVehicle(entity, mass, friction, rayCaster);
 	lua_pushlightuserdata(L, (void*)inst);
@@ -740,15 +761,15 @@ static int Physics3D_PhysicsVehicle(lua_State *L) {
 }
 
 static int Physics3D_PhysicsVehicle_addWheel(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
-	luaL_checktype(L, 2, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 2);
 	SceneEntity * entity = (SceneEntity *)lua_topointer(L, 2);
-	luaL_checktype(L, 3, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 3);
 	Vector3 connection = *(Vector3*)lua_topointer(L, 3);
-	luaL_checktype(L, 4, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 4);
 	Vector3 direction = *(Vector3*)lua_topointer(L, 4);
-	luaL_checktype(L, 5, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 5);
 	Vector3 axle = *(Vector3*)lua_topointer(L, 5);
 	luaL_checktype(L, 6, LUA_TNUMBER);
 	Number suspentionRestLength = lua_tonumber(L, 6);
@@ -791,7 +812,7 @@ static int Physics3D_PhysicsVehicle_addWheel(lua_State *L) {
 }
 
 static int Physics3D_PhysicsVehicle_applyEngineForce(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number force = lua_tonumber(L, 2);
@@ -802,7 +823,7 @@ static int Physics3D_PhysicsVehicle_applyEngineForce(lua_State *L) {
 }
 
 static int Physics3D_PhysicsVehicle_setSteeringValue(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number value = lua_tonumber(L, 2);
@@ -813,7 +834,7 @@ static int Physics3D_PhysicsVehicle_setSteeringValue(lua_State *L) {
 }
 
 static int Physics3D_PhysicsVehicle_setBrake(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	luaL_checktype(L, 2, LUA_TNUMBER);
 	Number value = lua_tonumber(L, 2);
@@ -824,21 +845,21 @@ static int Physics3D_PhysicsVehicle_setBrake(lua_State *L) {
 }
 
 static int Physics3D_PhysicsVehicle_ResetVehicle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	inst->ResetVehicle();
 	return 0;
 }
 
 static int Physics3D_PhysicsVehicle_Update(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	inst->Update();
 	return 0;
 }
 
 static int Physics3D_delete_PhysicsVehicle(lua_State *L) {
-	luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+	luaPolycode_checkpointer(L, 1);
 	PhysicsVehicle *inst = (PhysicsVehicle*)lua_topointer(L, 1);
 	delete inst;
 	return 0;
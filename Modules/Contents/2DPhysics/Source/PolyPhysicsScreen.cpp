@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 
 #include "PolyPhysicsScreen.h"
+#include "PolyProfiler.h"
 
 using namespace Polycode;
 
@@ -448,6 +449,7 @@ void PhysicsScreen::handleEvent(Event *event) {
 }
 
 void PhysicsScreen::Update() {
+	PROFILE_SCOPE("PhysicsScreen::Update");
 	for(int i=0; i<physicsChildren.size();i++) {
 		physicsChildren[i]->Update();
 	}
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "PolyPhysicsScene.h"
+#include "PolyProfiler.h"
 
 PhysicsScene::PhysicsScene() : CollisionScene() {
 	initPhysicsScene();	
@@ -56,6 +57,7 @@ void PhysicsScene::initPhysicsScene() {
 }
 
 void PhysicsScene::Update() {
+	PROFILE_SCOPE("PhysicsScene::Update");
 	
 	for(int i=0; i < physicsChildren.size(); i++) {
 //		if(physicsChildren[i]->enabled)
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "PolyGlobals.h"
-#include "PolyUtil.h"
+#include "PolyString.h"
 #include "stdio.h"
 
 #if PLATFORM == PLATFORM_WINDOWS
@@ -13,6 +13,7 @@
 	#include <sys/types.h>
 	#include <netinet/in.h>
 	#include <fcntl.h>
+	#include <unistd.h>
 #endif
 
 #include <string>
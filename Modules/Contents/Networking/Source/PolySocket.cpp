@@ -28,7 +28,7 @@ void Address::setAddress(unsigned int ip, unsigned int port) {
 void Address::setAddress(string ipAsString, unsigned int port) {
 	unsigned int a,b,c,d;
 	
-	vector<string> values = StringUtil::split(ipAsString, ".");
+	vector<String> values = String(ipAsString).split(".");
 	if(values.size() == 4) {
 		a = atoi(values[0].c_str());
 		b = atoi(values[1].c_str());
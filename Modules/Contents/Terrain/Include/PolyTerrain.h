@@ -15,25 +15,127 @@
 #include "PolyCoreServices.h"
 
 #include <string>
+#include <vector>
 using std::string;
+using std::vector;
 
 namespace Polycode {
 	
+	class RenderDataArray;
+	
+	/**
+	* A square block of terrain vertices, including a skirt around its edges. Used internally by Terrain.
+	*/
+	class _PolyExport TerrainChunk {
+	public:
+		TerrainChunk();
+		~TerrainChunk();
+		
+		RenderDataArray *vertexArray;
+		RenderDataArray *normalArray;
+		RenderDataArray *texCoordArray;
+		
+		/**
+		* Center of the bounding sphere of the chunk in terrain space.
+		*/
+		Vector3 center;
+		
+		/**
+		* Radius of the bounding sphere of the chunk.
+		*/
+		Number radius;
+	};
+	
+	/**
+	* Heightmap terrain. The heightmap is read once into a grid of heights, which is used to build the terrain geometry and to answer height queries.
+	
+	BASIC terrain is a single mesh at full resolution. CHUNKED terrain is split into square chunks of CHUNK_SIZE cells that are frustum culled individually and drawn at a level of detail picked by their distance to the camera. All chunks share one index list per level of detail. Each chunk has a skirt hanging down from its edges, which hides the cracks between neighbouring chunks at different levels.
+	*/
 	class _PolyExport Terrain : public SceneMesh {
 	public:
 		
+		/**
+		* Creates a terrain from a heightmap image.
+		* @param type Terrain type. Can be BASIC or CHUNKED.
+		* @param heightmapFile Heightmap image file. Brighter pixels are higher.
+		* @param smooth If false, BASIC terrain uses face normals. CHUNKED terrain is always smooth.
+		* @param tileAmt Number of times the texture repeats across the terrain.
+		* @param xDensity Number of cells along the X axis. Rounded up to a multiple of CHUNK_SIZE for CHUNKED terrain.
+		* @param zDensity Number of cells along the Z axis. Rounded up to a multiple of CHUNK_SIZE for CHUNKED terrain.
+		* @param sx Size of the terrain along the X axis.
+		* @param sz Size of the terrain along the Z axis.
+		* @param height Height of the brightest heightmap pixel.
+		*/
 		Terrain(int type, string heightmapFile, bool smooth, float tileAmt, float xDensity, float zDensity, float sx, float sz, float height);
 		~Terrain();
 		Vector3 getTerrainDataScale() { return terrainDataScale; }		
 		
+		/**
+		* Returns the height of the full resolution terrain surface at a point in terrain space. Points outside of the terrain are clamped to its edge.
+		* @param x X position.
+		* @param z Z position.
+		* @return Height at the specified position.
+		*/
+		Number getHeightAt(Number x, Number z);
+		
+		/**
+		* Sets the camera distance up to which CHUNKED terrain is drawn at full resolution. The resolution halves every time the distance doubles.
+		* @param distance New distance.
+		*/
+		void setLODDistance(Number distance);
+		
+		/**
+		* Returns the full resolution distance.
+		*/
+		Number getLODDistance();
+		
+		/**
+		* Returns the number of chunks of CHUNKED terrain.
+		*/
+		int getNumChunks();
+		
+		/**
+		* Returns the number of chunks drawn in the last frame.
+		*/
+		int getNumVisibleChunks();
+		
+		void Render();
+		
 		static const int BASIC = 0;
+		static const int CHUNKED = 1;
 		
+		/**
+		* Number of cells along each side of a chunk.
+		*/
+		static const int CHUNK_SIZE = 32;
 		
 	private:
 		
-		void createBasic(string heightmapFile, bool smooth, float tileAmt, float xDensity, float zDensity, float sx, float sz, float height);
+		void loadHeights(string heightmapFile, float height);
+		void createBasic(bool smooth, float tileAmt);
+		void createChunks(float tileAmt);
+		void buildLODIndices();
+		
+		inline Number getGridHeight(int i, int j);
+		Vector3 getGridNormal(int i, int j);
 		
 		Vector3 terrainDataScale;
+		
+		int terrainType;
+		int cellsX;
+		int cellsZ;
+		Number cellSizeX;
+		Number cellSizeZ;
+		Number offsetX;
+		Number offsetZ;
+		
+		// (cellsX+1) * (cellsZ+1) vertex heights, row by row along X
+		vector<float> heights;
+		
+		vector<TerrainChunk*> chunks;
+		vector< vector<unsigned short> > lodIndices;
+		int numVisibleChunks;
+		Number lodDistance;
 	};
 	
 	
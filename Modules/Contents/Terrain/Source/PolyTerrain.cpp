@@ -8,52 +8,169 @@
  */
 
 #include "PolyTerrain.h"
+#include "PolyRenderer.h"
+#include "PolyCamera.h"
+#include "PolyImage.h"
+#include <math.h>
 
 using namespace Polycode;
 
+TerrainChunk::TerrainChunk() {
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	vertexArray = renderer->createRenderDataArray(RenderDataArray::VERTEX_DATA_ARRAY);
+	normalArray = renderer->createRenderDataArray(RenderDataArray::NORMAL_DATA_ARRAY);
+	texCoordArray = renderer->createRenderDataArray(RenderDataArray::TEXCOORD_DATA_ARRAY);
+	radius = 0;
+}
+
+TerrainChunk::~TerrainChunk() {
+	free(vertexArray->arrayPtr);
+	free(normalArray->arrayPtr);
+	free(texCoordArray->arrayPtr);
+	delete vertexArray;
+	delete normalArray;
+	delete texCoordArray;
+}
+
 Terrain::Terrain(int type, string heightmapFile, bool smooth, float tileAmt, float xDensity, float zDensity, float sx, float sz, float height) : SceneMesh(Mesh::TRI_MESH) {
 
+	terrainType = type;
+	numVisibleChunks = 0;
+	lodDistance = sx / 8.0f;
+	
+	cellsX = (int)xDensity;
+	cellsZ = (int)zDensity;
+	if(cellsX < 1) cellsX = 1;
+	if(cellsZ < 1) cellsZ = 1;
+	if(type == CHUNKED) {
+		cellsX = ((cellsX + CHUNK_SIZE - 1) / CHUNK_SIZE) * CHUNK_SIZE;
+		cellsZ = ((cellsZ + CHUNK_SIZE - 1) / CHUNK_SIZE) * CHUNK_SIZE;
+	}
+	
+	cellSizeX = sx / (Number)cellsX;
+	cellSizeZ = sz / (Number)cellsZ;
+	offsetX = -sx/2.0f;
+	offsetZ = -sz/2.0f;
+	
+	loadHeights(heightmapFile, height);
+	
 	switch(type) {
 		case BASIC:
-			createBasic(heightmapFile, smooth, tileAmt,xDensity,zDensity,sx,sz,height);
+			createBasic(smooth, tileAmt);
+			break;
+		case CHUNKED:
+			createChunks(tileAmt);
+			bBoxRadius = sqrt(sx*sx + sz*sz + height*height) / 2.0f;
 			break;
 	}
 }
 
-void Terrain::createBasic(string heightmapFile, bool smooth, float tileAmt, float xDensity, float zDensity, float sx, float sz, float height) {
+void Terrain::loadHeights(string heightmapFile, float height) {
+	Image *heightImage = new Image(heightmapFile);
 	
-	float xStep = sx/xDensity;
-	float zStep = sz/zDensity;
+	int imageWidth = heightImage->getWidth();
+	int imageHeight = heightImage->getHeight();
 	
-	float uStep = 1.0f / xDensity * tileAmt;
-	float vStep = 1.0f / zDensity * tileAmt;
+	terrainDataScale.x = (cellSizeX * cellsX) / (float)imageWidth;
+	terrainDataScale.z = (cellSizeZ * cellsZ) / (float)imageHeight;
 	
+	heights.resize((cellsX+1) * (cellsZ+1));
+	if(imageWidth == 0 || imageHeight == 0) {
+		delete heightImage;
+		return;
+	}
 	
-	float xOffset = -sx/2.0f;
-	float zOffset = -sz/2.0f;
+	int imageStepX = floor((float)imageWidth/(float)cellsX);
+	int imageStepY = floor((float)imageHeight/(float)cellsZ);
+	if(imageStepX < 1) imageStepX = 1;
+	if(imageStepY < 1) imageStepY = 1;
 	
-	Image *heightImage = new Image(heightmapFile);
+	// same brightness as Image::getPixel(x, y).getBrightness(), read straight from the pixel data
+	unsigned int *pixels = (unsigned int*)heightImage->getPixels();
+	for(int j=0; j <= cellsZ; j++) {
+		int py = imageStepY * j;
+		if(py > imageHeight-1)
+			py = imageHeight-1;
+		for(int i=0; i <= cellsX; i++) {
+			int px = imageStepX * i;
+			if(px > imageWidth-1)
+				px = imageWidth-1;
+			unsigned int pixel = pixels[px + (py * imageWidth)];
+			Number brightness = (Number)(((pixel >> 24) & 0xFF) + ((pixel >> 16) & 0xFF) + ((pixel >> 8) & 0xFF)) / 765.0f;
+			heights[(j * (cellsX+1)) + i] = height * brightness;
+		}
+	}
+	
+	delete heightImage;
+}
+
+Number Terrain::getGridHeight(int i, int j) {
+	if(i < 0) i = 0;
+	if(i > cellsX) i = cellsX;
+	if(j < 0) j = 0;
+	if(j > cellsZ) j = cellsZ;
+	return heights[(j * (cellsX+1)) + i];
+}
+
+Vector3 Terrain::getGridNormal(int i, int j) {
+	Number dx = (getGridHeight(i+1, j) - getGridHeight(i-1, j)) / (2.0f * cellSizeX);
+	Number dz = (getGridHeight(i, j+1) - getGridHeight(i, j-1)) / (2.0f * cellSizeZ);
+	Vector3 normal(-dx, 1.0f, -dz);
+	normal.Normalize();
+	return normal;
+}
+
+Number Terrain::getHeightAt(Number x, Number z) {
+	Number fx = (x - offsetX) / cellSizeX;
+	Number fz = (z - offsetZ) / cellSizeZ;
+	if(fx < 0) fx = 0;
+	if(fz < 0) fz = 0;
+	if(fx > cellsX) fx = cellsX;
+	if(fz > cellsZ) fz = cellsZ;
+	
+	int i = (int)fx;
+	int j = (int)fz;
+	if(i > cellsX-1) i = cellsX-1;
+	if(j > cellsZ-1) j = cellsZ-1;
+	fx -= i;
+	fz -= j;
+	
+	const float *row0 = &heights[(j * (cellsX+1)) + i];
+	const float *row1 = row0 + (cellsX+1);
 	
-	terrainDataScale.x = sx / (float)heightImage->getWidth();
-	terrainDataScale.z = sz / (float)heightImage->getHeight();
+	// interpolate on the triangle containing the point, split the same way as the geometry
+	if(fx + fz <= 1.0f) {
+		return row0[0] + (row0[1] - row0[0]) * fx + (row1[0] - row0[0]) * fz;
+	} else {
+		return row1[1] + (row1[0] - row1[1]) * (1.0f - fx) + (row0[1] - row1[1]) * (1.0f - fz);
+	}
+}
+
+void Terrain::createBasic(bool smooth, float tileAmt) {
+	
+	float xStep = cellSizeX;
+	float zStep = cellSizeZ;
+	
+	float uStep = 1.0f / cellsX * tileAmt;
+	float vStep = 1.0f / cellsZ * tileAmt;
+	
+	float xOffset = offsetX;
+	float zOffset = offsetZ;
 	
 	Polygon *poly;
 	float hpos;
 	
-	float imageStepX = floor( (float)heightImage->getWidth()/xDensity);
-	float imageStepY = floor((float)heightImage->getHeight()/zDensity);
-	
-	for(float i=0; i < xDensity; i+=1) {
-		for(float j=0; j < zDensity; j+=1) {
+	for(int i=0; i < cellsX; i++) {
+		for(int j=0; j < cellsZ; j++) {
 			poly = new Polygon();
 			
-			hpos = height * heightImage->getPixel((imageStepX*i)+imageStepX, imageStepY*j).getBrightness();
+			hpos = getGridHeight(i+1, j);
 			poly->addVertex((xStep*i)+xStep+xOffset, hpos, (zStep * j)+zOffset, (uStep*i) + uStep, vStep*j)->setNormal(0,1,0);
 			
-			hpos = height * heightImage->getPixel((imageStepX*i), (imageStepY*j)).getBrightness();
+			hpos = getGridHeight(i, j);
 			poly->addVertex((xStep*i)+xOffset, hpos, (zStep * j)+zOffset, uStep*i, vStep*j)->setNormal(0,1,0);
 			
-			hpos = height * heightImage->getPixel(imageStepX*i, (imageStepY*j)+imageStepY).getBrightness();			
+			hpos = getGridHeight(i, j+1);
 			poly->addVertex((xStep*i)+xOffset, hpos, ((zStep*j)+zStep)+zOffset, uStep*i, (vStep*j)+vStep)->setNormal(0,1,0);								
 			
 			mesh->addPolygon(poly);
@@ -64,13 +181,13 @@ void Terrain::createBasic(string heightmapFile, bool smooth, float tileAmt, floa
 			
 			poly = new Polygon();			
 			
-			hpos = height * heightImage->getPixel(imageStepX*i, (imageStepY*j)+imageStepY).getBrightness();			
+			hpos = getGridHeight(i, j+1);
 			poly->addVertex((xStep*i)+xOffset, hpos, (zStep*j)+zStep+zOffset, uStep*i, (vStep*j)+vStep)->setNormal(0,1,0);
 			
-			hpos = height * heightImage->getPixel((imageStepX*i)+imageStepX, (imageStepY*j)+imageStepY).getBrightness();						
+			hpos = getGridHeight(i+1, j+1);
 			poly->addVertex((xStep*i)+xStep+xOffset, hpos, (zStep*j)+zStep+zOffset, (uStep*i) + uStep, (vStep*j)+vStep)->setNormal(0,1,0);			
 			
-			hpos = height * heightImage->getPixel((imageStepX*i)+imageStepX, (imageStepY*j)).getBrightness();			
+			hpos = getGridHeight(i+1, j);
 			poly->addVertex((xStep*i)+xStep+xOffset, hpos, (zStep * j)+zOffset, (uStep*i) + uStep, vStep*j)->setNormal(0,1,0);
 			
 			mesh->addPolygon(poly);
@@ -82,6 +199,225 @@ void Terrain::createBasic(string heightmapFile, bool smooth, float tileAmt, floa
 	}	
 }
 
-Terrain::~Terrain() {
+void Terrain::createChunks(float tileAmt) {
+	const int side = CHUNK_SIZE + 1;
+	const int numVertices = (side * side) + (4 * side);
 	
+	float uStep = 1.0f / cellsX * tileAmt;
+	float vStep = 1.0f / cellsZ * tileAmt;
+	
+	for(int cz=0; cz < cellsZ / CHUNK_SIZE; cz++) {
+		for(int cx=0; cx < cellsX / CHUNK_SIZE; cx++) {
+			TerrainChunk *chunk = new TerrainChunk();
+			chunk->vertexArray->arrayPtr = realloc(chunk->vertexArray->arrayPtr, numVertices * 3 * sizeof(float));
+			chunk->normalArray->arrayPtr = realloc(chunk->normalArray->arrayPtr, numVertices * 3 * sizeof(float));
+			chunk->texCoordArray->arrayPtr = realloc(chunk->texCoordArray->arrayPtr, numVertices * 2 * sizeof(float));
+			chunk->vertexArray->count = numVertices;
+			chunk->normalArray->count = numVertices;
+			chunk->texCoordArray->count = numVertices;
+			
+			float *positions = (float*)chunk->vertexArray->arrayPtr;
+			float *normals = (float*)chunk->normalArray->arrayPtr;
+			float *texCoords = (float*)chunk->texCoordArray->arrayPtr;
+			
+			int startI = cx * CHUNK_SIZE;
+			int startJ = cz * CHUNK_SIZE;
+			
+			Number minHeight = getGridHeight(startI, startJ);
+			Number maxHeight = minHeight;
+			for(int r=0; r < side; r++) {
+				for(int c=0; c < side; c++) {
+					Number h = getGridHeight(startI + c, startJ + r);
+					if(h < minHeight) minHeight = h;
+					if(h > maxHeight) maxHeight = h;
+				}
+			}
+			
+			// a coarser neighbour can deviate from this chunk's edge by at most the height range of the chunk
+			Number skirtDepth = (maxHeight - minHeight) + (cellSizeX + cellSizeZ) * 0.5f;
+			
+			for(int v=0; v < numVertices; v++) {
+				int c, r;
+				Number drop = 0;
+				if(v < side * side) {
+					c = v % side;
+					r = v / side;
+				} else {
+					int edge = (v - (side * side)) / side;
+					int k = (v - (side * side)) % side;
+					switch(edge) {
+						case 0: c = k; r = 0; break;
+						case 1: c = k; r = CHUNK_SIZE; break;
+						case 2: c = 0; r = k; break;
+						default: c = CHUNK_SIZE; r = k; break;
+					}
+					drop = skirtDepth;
+				}
+				
+				int gi = startI + c;
+				int gj = startJ + r;
+				positions[0] = offsetX + (cellSizeX * gi);
+				positions[1] = getGridHeight(gi, gj) - drop;
+				positions[2] = offsetZ + (cellSizeZ * gj);
+				
+				Vector3 normal = getGridNormal(gi, gj);
+				normals[0] = normal.x;
+				normals[1] = normal.y;
+				normals[2] = normal.z;
+				
+				texCoords[0] = uStep * gi;
+				texCoords[1] = vStep * gj;
+				
+				positions += 3;
+				normals += 3;
+				texCoords += 2;
+			}
+			
+			Number halfX = cellSizeX * CHUNK_SIZE * 0.5f;
+			Number halfZ = cellSizeZ * CHUNK_SIZE * 0.5f;
+			Number bottom = minHeight - skirtDepth;
+			Number halfY = (maxHeight - bottom) * 0.5f;
+			chunk->center = Vector3(offsetX + (cellSizeX * startI) + halfX, bottom + halfY, offsetZ + (cellSizeZ * startJ) + halfZ);
+			chunk->radius = sqrt(halfX*halfX + halfY*halfY + halfZ*halfZ);
+			
+			chunks.push_back(chunk);
+		}
+	}
+	
+	buildLODIndices();
+}
+
+void Terrain::buildLODIndices() {
+	const int side = CHUNK_SIZE + 1;
+	const int skirtStart = side * side;
+	
+	lodIndices.clear();
+	for(int step=1; step <= CHUNK_SIZE; step *= 2) {
+		vector<unsigned short> indices;
+		
+		for(int r=0; r < CHUNK_SIZE; r += step) {
+			for(int c=0; c < CHUNK_SIZE; c += step) {
+				unsigned short v00 = (r * side) + c;
+				unsigned short v10 = (r * side) + c + step;
+				unsigned short v01 = ((r + step) * side) + c;
+				unsigned short v11 = ((r + step) * side) + c + step;
+				
+				indices.push_back(v10);
+				indices.push_back(v00);
+				indices.push_back(v01);
+				
+				indices.push_back(v01);
+				indices.push_back(v11);
+				indices.push_back(v10);
+			}
+		}
+		
+		// skirt quads, wound to face away from the chunk
+		for(int k=0; k < CHUNK_SIZE; k += step) {
+			unsigned short top[4][2];
+			unsigned short bottom[4][2];
+			
+			top[0][0] = k; top[0][1] = k + step;
+			bottom[0][0] = skirtStart + k; bottom[0][1] = skirtStart + k + step;
+			
+			top[1][0] = (CHUNK_SIZE * side) + k + step; top[1][1] = (CHUNK_SIZE * side) + k;
+			bottom[1][0] = skirtStart + side + k + step; bottom[1][1] = skirtStart + side + k;
+			
+			top[2][0] = (k + step) * side; top[2][1] = k * side;
+			bottom[2][0] = skirtStart + (2 * side) + k + step; bottom[2][1] = skirtStart + (2 * side) + k;
+			
+			top[3][0] = (k * side) + CHUNK_SIZE; top[3][1] = ((k + step) * side) + CHUNK_SIZE;
+			bottom[3][0] = skirtStart + (3 * side) + k; bottom[3][1] = skirtStart + (3 * side) + k + step;
+			
+			for(int e=0; e < 4; e++) {
+				indices.push_back(top[e][0]);
+				indices.push_back(top[e][1]);
+				indices.push_back(bottom[e][0]);
+				
+				indices.push_back(top[e][1]);
+				indices.push_back(bottom[e][1]);
+				indices.push_back(bottom[e][0]);
+			}
+		}
+		
+		lodIndices.push_back(indices);
+	}
+}
+
+void Terrain::setLODDistance(Number distance) {
+	lodDistance = distance;
+}
+
+Number Terrain::getLODDistance() {
+	return lodDistance;
+}
+
+int Terrain::getNumChunks() {
+	return chunks.size();
+}
+
+int Terrain::getNumVisibleChunks() {
+	return numVisibleChunks;
+}
+
+void Terrain::Render() {
+	if(terrainType != CHUNKED) {
+		SceneMesh::Render();
+		return;
+	}
+	
+	Renderer *renderer = CoreServices::getInstance()->getRenderer();
+	
+	// the planes and the camera position come out in terrain space
+	Vector3 cameraPosition = renderer->getModelviewMatrix().inverse().getPosition();
+	Number planes[6][4];
+	Camera::getRendererFrustumPlanes(planes);
+	
+	if(material) {
+		renderer->applyMaterial(material, localShaderOptions,0);
+	} else {
+		if(texture)
+			renderer->setTexture(texture);
+		else
+			renderer->setTexture(NULL);
+	}
+	
+	numVisibleChunks = 0;
+	int maxLevel = lodIndices.size()-1;
+	for(int i=0; i < chunks.size(); i++) {
+		TerrainChunk *chunk = chunks[i];
+		
+		bool visible = true;
+		for(int p=0; p < 6; p++) {
+			if(planes[p][0]*chunk->center.x + planes[p][1]*chunk->center.y + planes[p][2]*chunk->center.z + planes[p][3] <= -chunk->radius) {
+				visible = false;
+				break;
+			}
+		}
+		if(!visible)
+			continue;
+		
+		Number distance = (chunk->center - cameraPosition).length() - chunk->radius;
+		int level = 0;
+		Number levelDistance = lodDistance;
+		while(level < maxLevel && distance > levelDistance) {
+			level++;
+			levelDistance *= 2.0f;
+		}
+		
+		renderer->pushRenderDataArray(chunk->vertexArray);
+		renderer->pushRenderDataArray(chunk->normalArray);
+		renderer->pushRenderDataArray(chunk->texCoordArray);
+		renderer->drawIndexedArrays(Mesh::TRI_MESH, &lodIndices[level][0], lodIndices[level].size());
+		numVisibleChunks++;
+	}
+	
+	if(material) 
+		renderer->clearShader();
+}
+
+Terrain::~Terrain() {
+	for(int i=0; i < chunks.size(); i++) {
+		delete chunks[i];
+	}
 }
@@ -12,6 +12,7 @@
 using namespace Polycode;
 
 UIBox::UIBox(String imageFile, Number t, Number r, Number b, Number l, Number boxWidth, Number boxHeight) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	
 	setPositionMode(ScreenEntity::POSITION_TOPLEFT);	
 	
@@ -93,8 +94,7 @@ void UIBox::resizeBox(Number newWidth, Number newHeight) {
 	
 	width=newWidth;
 	height = newHeight;
-	hitwidth = newWidth;
-	hitheight = newHeight;
+	setHitbox(newWidth, newHeight);
 	
 	this->rebuildTransformMatrix();
 }
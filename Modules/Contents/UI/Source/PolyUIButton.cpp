@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UIButton::UIButton(String text, Number width, Number height) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 
 	Config *conf = CoreServices::getInstance()->getConfig();	
 	
@@ -12,6 +12,7 @@
 using namespace Polycode;
 
 UICheckBox::UICheckBox(Font *font, String checkImage, String caption, bool checked) {
+	setBatchMode(RENDER_BATCH_GROUP);
 	buttonImage = new ScreenImage(checkImage.c_str());
 	buttonImage->setPosition(2, 3);
 	this->checked = checked;
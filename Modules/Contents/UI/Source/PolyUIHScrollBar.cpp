@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UIHScrollBar::UIHScrollBar(Number width, Number height, Number initialRatio) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	
 	scrollValue = 0;
 	
@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UIHSlider::UIHSlider(Font *font, Number start, Number end, Number width) {
+	setBatchMode(RENDER_BATCH_GROUP);
 	bgRect = new ScreenShape(ScreenShape::SHAPE_RECT, width,8,0,0);
 	bgRect->setPosition(0,6);
 	bgRect->setColor(0.11f, 0.11f, 0.11f, 1.0f);
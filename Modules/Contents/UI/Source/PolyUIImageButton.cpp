@@ -12,6 +12,7 @@
 using namespace Polycode;
 
 UIImageButton::UIImageButton(String imageName) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	setPositionMode(ScreenEntity::POSITION_TOPLEFT);
 	
 	buttonImage = new ScreenImage(imageName.c_str());
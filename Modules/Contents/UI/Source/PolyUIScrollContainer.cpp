@@ -12,6 +12,7 @@
 using namespace Polycode;
 
 UIScrollContainer::UIScrollContainer(ScreenEntity *scrolledEntity, bool hScroll, bool vScroll, Number width, Number height) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	
 	scrolledEntity->setPositionMode(ScreenEntity::POSITION_TOPLEFT);
 	
@@ -66,8 +67,7 @@ UIScrollContainer::UIScrollContainer(ScreenEntity *scrolledEntity, bool hScroll,
 void UIScrollContainer::Resize(int x, int y) {
 	width = x;
 	height = y;
-	hitwidth = width;
-	hitheight = height;
+	setHitbox(width, height);
 	
 	maskShape->setShapeSize(x, y);
 	vScrollBar->Resize(y);
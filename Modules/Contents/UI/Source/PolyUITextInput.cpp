@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UITextInput::UITextInput(bool multiLine, Number width, Number height) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	this->multiLine = multiLine;
 	
 	draggingSelection = false;
@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UITree::UITree(String icon, String text, Number treeWidth, Number treeOffset) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 		
 	
 	Config *conf = CoreServices::getInstance()->getConfig();
@@ -209,8 +210,7 @@ void UITree::refreshTree() {
 	}
 	height = treeHeight + cellHeight;
 	width = treeWidth;
-	hitwidth = width;
-	hitheight = height;
+	setHitbox(width, height);
 	
 	selection->visible = selected;
 }
@@ -12,6 +12,7 @@
 using namespace Polycode;
 
 UITreeContainer::UITreeContainer(String icon, String text, Number treeWidth, Number treeHeight) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	
 	Config *conf = CoreServices::getInstance()->getConfig();
 	
@@ -52,8 +53,7 @@ void UITreeContainer::Resize(int x, int y) {
 
 //	width = x;
 //	height = y;
-	hitwidth = x;
-	hitheight = y;
+	setHitbox(x, y);
 
 }
 
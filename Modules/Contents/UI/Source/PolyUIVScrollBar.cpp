@@ -13,6 +13,7 @@
 using namespace Polycode;
 
 UIVScrollBar::UIVScrollBar(Number width, Number height, Number initialRatio) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 
 	scrollValue = 0;
 	
@@ -74,7 +75,7 @@ UIVScrollBar::UIVScrollBar(Number width, Number height, Number initialRatio) : S
 void UIVScrollBar::Resize(int newHeight) {
 	bgBox->resizeBox(width, newHeight);
 	this->height = newHeight;
-	this->hitheight = newHeight;
+	setHitbox(hitwidth, newHeight);
 	dragRectHeight = height-(padding*2)-scrollHandleHeight;	
 	handleBox->setDragLimits(Rectangle(padding,padding,width-(padding*2)-(width-(padding*2)), dragRectHeight));	
 }
@@ -14,6 +14,7 @@ using namespace Polycode;
 
 
 UIWindow::UIWindow(String windowName, Number width, Number height) : ScreenEntity() {
+	setBatchMode(RENDER_BATCH_GROUP);
 	
 	closeOnEscape = false;
 	
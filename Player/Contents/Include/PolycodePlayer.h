@@ -28,6 +28,8 @@ THE SOFTWARE.
 #include "Polycode.h"
 #include "PolycodeLUA.h"
 #include "PolyGLSLShaderModule.h"
+#include "PolycodeScriptProfiler.h"
+#include "PolycodeScriptCollector.h"
 
 extern "C" {	
 #include <stdio.h>
@@ -77,6 +79,16 @@ public:
 	
 	Core *getCore() { return core; }	
 	
+	/**
+	* Returns the profiler of the script state, or NULL before the script is loaded.
+	*/
+	PolycodeScriptProfiler *getScriptProfiler() { return profiler; }
+	
+	/**
+	* Returns the garbage collection scheduler of the script state, or NULL before the script is loaded.
+	*/
+	PolycodeScriptCollector *getScriptCollector() { return collector; }
+	
 	int xRes;
 	int yRes;
 	int aaLevel;
@@ -84,6 +96,16 @@ public:
 	
 	int frameRate;
 	
+	/**
+	* If true, script profiling starts when the script is loaded. Set from the profileScripts entry in the configuration file.
+	*/
+	bool profileScripts;
+	
+	/**
+	* Time in milliseconds per frame the Lua garbage collector may run in incremental steps. If 0, Lua collects automatically. Set from the scriptGCBudget entry in the configuration file.
+	*/
+	Number scriptGCBudget;
+	
 	void *windowData;	
 	bool doneLoading;
 	
@@ -92,6 +114,8 @@ public:
 protected:
 	
 	lua_State *L;		
+	PolycodeScriptProfiler *profiler;
+	PolycodeScriptCollector *collector;
 	
 	std::vector<String> loadedModules;
 	
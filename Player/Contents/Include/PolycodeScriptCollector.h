@@ -0,0 +1,172 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "Polycode.h"
+
+extern "C" {	
+#include <stdio.h>
+#include "lua.h"
+#include "lualib.h"
+#include "lauxlib.h"
+}
+
+using namespace Polycode;
+
+/**
+* Garbage collection statistics for one frame.
+*/
+class ScriptGCStats {
+public:
+	ScriptGCStats() : stepTime(0), idleTime(0), idleStepTime(0), maxPause(0), steps(0), cycles(0), forcedCycles(0), memoryKB(0), lastCycleMemoryKB(0) {}
+	
+	/**
+	* Time in seconds spent in collection steps during the frame.
+	*/
+	double stepTime;
+	
+	/**
+	* Idle time in seconds the core offered before sleeping.
+	*/
+	double idleTime;
+	
+	/**
+	* Part of stepTime that ran in idle time.
+	*/
+	double idleStepTime;
+	
+	/**
+	* Duration in seconds of the longest single collection step of the frame.
+	*/
+	double maxPause;
+	
+	unsigned int steps;
+	
+	/**
+	* Total number of collection cycles completed since incremental mode was enabled.
+	*/
+	unsigned int cycles;
+	
+	/**
+	* Number of cycles that had to be finished without a time limit because the heap outgrew the budget.
+	*/
+	unsigned int forcedCycles;
+	
+	/**
+	* Lua heap size at the end of the frame.
+	*/
+	int memoryKB;
+	
+	/**
+	* Lua heap size right after the last completed cycle.
+	*/
+	int lastCycleMemoryKB;
+};
+
+/**
+* Runs the garbage collector of the player's Lua state in explicit incremental steps. Automatic collection is stopped and the collector is stepped within a per-frame time budget, preferably in the idle time before the core sleeps, so collection does not show up as periodic long frames. A cycle is started in idle time once the heap has grown half way to the pause threshold and is forced into the frame budget once the threshold is reached. If the heap reaches twice the threshold, the collector is too far behind the allocation rate and the cycle is finished regardless of the budget.
+*/
+class PolycodeScriptCollector : public CoreIdleHandler {
+public:
+	PolycodeScriptCollector(lua_State *L);
+	virtual ~PolycodeScriptCollector();
+	
+	/**
+	* Switches between explicit incremental stepping and the automatic Lua collector. Enabling incremental mode runs a full collection to establish the heap baseline.
+	*/
+	void setIncremental(bool val);
+	bool isIncremental() const;
+	
+	/**
+	* Sets the time collection steps may take out of each frame.
+	* @param budget Time budget in seconds.
+	*/
+	void setFrameBudget(double budget);
+	double getFrameBudget() const;
+	
+	/**
+	* Sets the collector pause, the heap growth in percent after a cycle at which the next cycle is due. Same as collectgarbage("setpause").
+	*/
+	void setPause(int pause);
+	
+	/**
+	* Sets the collector step multiplier, which controls how much work each step does. Same as collectgarbage("setstepmul").
+	*/
+	void setStepMultiplier(int stepMultiplier);
+	
+	/**
+	* Marks the start of a frame and updates the last frame statistics.
+	*/
+	void beginFrame();
+	
+	/**
+	* Called after the per-frame script code. Runs collection steps within the frame budget if a cycle is due.
+	*/
+	void endFrame();
+	
+	/**
+	* Runs collection steps in the idle time before the core sleeps.
+	*/
+	void handleIdle(Number idleTime);
+	
+	/**
+	* Runs collection steps until the time limit is reached or the current cycle completes.
+	* @param timeLimit Time limit in seconds.
+	* @return Time spent collecting in seconds.
+	*/
+	double step(double timeLimit);
+	
+	/**
+	* Returns the statistics of the last completed frame.
+	*/
+	const ScriptGCStats &getLastFrameStats() const;
+	
+	/**
+	* Registers gcFrameStats and gcSetFrameBudget functions in the Lua state.
+	*/
+	void registerScriptFunctions();
+	
+	static const int DEFAULT_PAUSE = 200;
+	static const int DEFAULT_STEP_MULTIPLIER = 200;
+	
+	/**
+	* Time in milliseconds left unused at the end of the idle time, so a step running long does not delay the next frame.
+	*/
+	static const int IDLE_MARGIN_MS = 1;
+	
+protected:
+	
+	double runSteps(double timeLimit, bool finishCycle);
+	int getTriggerKB() const;
+	
+	lua_State *L;
+	bool incremental;
+	bool cycleInProgress;
+	int pause;
+	double frameBudget;
+	double budgetLeft;
+	int lastCycleMemoryKB;
+	
+	ScriptGCStats frameStats;
+	ScriptGCStats lastFrameStats;
+};
@@ -0,0 +1,243 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "Polycode.h"
+#include <map>
+#include <vector>
+#include <string>
+
+extern "C" {	
+#include <stdio.h>
+#include "lua.h"
+#include "lualib.h"
+#include "lauxlib.h"
+}
+
+using namespace Polycode;
+
+#define SCRIPT_PROFILER_MAX_STACK_DEPTH 32
+
+/**
+* Aggregated profile of a single Lua function.
+*/
+class ScriptFunctionStats {
+public:
+	ScriptFunctionStats() : inclusiveTime(0), exclusiveTime(0), samples(0) {}
+	
+	String name;
+	
+	/**
+	* Time in seconds attributed to samples where the function was anywhere on the stack.
+	*/
+	double inclusiveTime;
+	
+	/**
+	* Time in seconds attributed to samples where the function was on top of the stack.
+	*/
+	double exclusiveTime;
+	
+	unsigned int samples;
+};
+
+/**
+* Script statistics for one frame.
+*/
+class ScriptFrameStats {
+public:
+	ScriptFrameStats() : scriptTime(0), samples(0), bindingCalls(0), memoryKB(0), memoryDeltaKB(0), collections(0), profilerTime(0) {}
+
+	/**
+	* Time in seconds spent in the script update call.
+	*/
+	double scriptTime;
+	unsigned int samples;
+	
+	/**
+	* Number of calls from script into the C++ bindings.
+	*/
+	unsigned int bindingCalls;
+	
+	/**
+	* Lua heap size at the end of the frame.
+	*/
+	int memoryKB;
+	int memoryDeltaKB;
+	
+	/**
+	* Number of times the Lua heap was seen shrinking during the frame, i.e. garbage collection cycles that freed memory.
+	*/
+	unsigned int collections;
+	
+	/**
+	* Time in seconds the profiler itself spent taking samples during the frame. This time is not charged to the sampled functions.
+	*/
+	double profilerTime;
+};
+
+/**
+* One sampled Lua call stack, stored as function ids, innermost function first.
+*/
+class ScriptSample {
+public:
+	double weight;
+	int depth;
+	int functions[SCRIPT_PROFILER_MAX_STACK_DEPTH];
+};
+
+/**
+* Identifies a Lua function by the strings Lua already holds for it, so it can be looked up without allocating.
+*/
+class ScriptFunctionKey {
+public:
+	bool operator<(const ScriptFunctionKey &other) const {
+		if(source != other.source)
+			return source < other.source;
+		if(line != other.line)
+			return line < other.line;
+		return name < other.name;
+	}
+	
+	const char *source;
+	const char *name;
+	int line;
+};
+
+/**
+* Sampling profiler for the player's Lua state. A count hook samples the Lua call stack every few thousand VM instructions and charges the time since the previous sample to the sampled stack, so the overhead is independent of how many functions are called. Samples are written to preallocated storage and only folded into stacks when it is full or a profile is written. Calls into the Polycore and module bindings are counted by wrapping the binding functions. Profiles can be written as folded stacks, which can be turned into a flamegraph with flamegraph.pl.
+*/
+class PolycodeScriptProfiler {
+public:
+	PolycodeScriptProfiler(lua_State *L);
+	~PolycodeScriptProfiler();
+	
+	/**
+	* Starts sampling.
+	* @param instructionInterval Number of Lua VM instructions between samples.
+	*/
+	void start(int instructionInterval = DEFAULT_INSTRUCTION_INTERVAL);
+	
+	/**
+	* Stops sampling. Collected data is kept until reset() is called.
+	*/
+	void stop();
+	bool isRunning() const;
+	
+	/**
+	* Clears all collected data.
+	*/
+	void reset();
+	
+	/**
+	* Marks the start of a frame. Call before running the per-frame script code. The sample clock starts here, so time spent outside of script code between frames is not charged to any function.
+	*/
+	void beginFrame();
+	
+	/**
+	* Marks the end of a frame and updates the last frame statistics.
+	*/
+	void endFrame();
+	
+	/**
+	* Returns the statistics of the last completed frame.
+	*/
+	const ScriptFrameStats &getLastFrameStats() const;
+	
+	/**
+	* Returns the per function statistics, sorted by exclusive time, highest first.
+	*/
+	std::vector<ScriptFunctionStats> getFunctionStats() const;
+	
+	/**
+	* Returns how many times a binding function has been called while profiling.
+	* @param name Name of the binding function including its library, for example "Polycore.Vector3_length" or "Physics2D.PhysicsScreen_Update".
+	*/
+	unsigned int getBindingCallCount(const String &name) const;
+	
+	/**
+	* Returns the total time in seconds the profiler spent taking samples since the last reset.
+	*/
+	double getProfilerTime() const;
+	
+	/**
+	* Writes the collected stacks in folded format, one stack per line followed by its time in microseconds.
+	* @param fileName Path of the file to write.
+	* @return True if the file was written.
+	*/
+	bool writeFoldedStacks(const String &fileName);
+	
+	/**
+	* Registers profilerStart, profilerStop, profilerReset and profilerDump functions in the Lua state.
+	*/
+	void registerScriptFunctions();
+	
+	/**
+	* Returns a high resolution timestamp in seconds.
+	*/
+	static double getTime();
+	
+	static const int DEFAULT_INSTRUCTION_INTERVAL = 1000;
+	static const int MAX_STACK_DEPTH = SCRIPT_PROFILER_MAX_STACK_DEPTH;
+	static const int SAMPLE_BUFFER_SIZE = 4096;
+	
+protected:
+	
+	void sample();
+	int getFunctionId(lua_Debug *ar);
+	void flushSamples();
+	void wrapBindings(bool wrap);
+	void wrapLibrary(const char *libraryName, bool wrap);
+	
+	static void hook(lua_State *L, lua_Debug *ar);
+	static int countedBindingCall(lua_State *L);
+	
+	static PolycodeScriptProfiler *instance;
+	
+	lua_State *L;
+	bool running;
+	bool bindingsWrapped;
+	bool inFrame;
+	double lastSampleTime;
+	double outsideFrameWeight;
+	double totalProfilerTime;
+	int lastMemoryKB;
+	
+	double frameStartTime;
+	int frameStartMemoryKB;
+	unsigned int frameSamples;
+	unsigned int frameCollections;
+	unsigned int frameBindingCalls;
+	double frameProfilerTime;
+	unsigned int totalBindingCalls;
+	ScriptFrameStats lastFrameStats;
+	
+	std::vector<ScriptFunctionStats> functions;
+	std::map<ScriptFunctionKey, int> functionIds;
+	
+	std::vector<ScriptSample> samples;
+	int numSamples;
+	std::map<std::vector<int>, double> stacks;
+	
+	std::map<std::string, unsigned int> bindingCalls;
+};
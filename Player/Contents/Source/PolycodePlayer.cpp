@@ -144,6 +144,13 @@ extern "C" {
 		
 		lua_register(L, "debugPrint", debugPrint);			
 		
+		profiler = new PolycodeScriptProfiler(L);
+		profiler->registerScriptFunctions();
+		
+		collector = new PolycodeScriptCollector(L);
+		collector->registerScriptFunctions();
+		core->setIdleHandler(collector);
+		
 		lua_getfield(L, LUA_GLOBALSINDEX, "require");
 		lua_pushstring(L, "class");		
 		lua_call(L, 1, 0);
@@ -187,6 +194,10 @@ extern "C" {
 					
 		}
 
+		if(profileScripts) {
+			profiler->start();
+		}
+
 		String fileData = "";
 
 		OSFILE *inFile = OSBasics::open(fileName, "r");	
@@ -214,8 +225,6 @@ extern "C" {
 		
 		doneLoading = true;
 		
-		//lua_gc(L, LUA_GCSTOP, 0);
-		
 		
 /*
 		lua_pushliteral(L, "debug");
@@ -240,6 +249,11 @@ extern "C" {
 
 			}
 		}
+		
+		if(scriptGCBudget > 0) {
+			collector->setFrameBudget(scriptGCBudget / 1000.0);
+			collector->setIncremental(true);
+		}
 
 	}
 }
@@ -255,6 +269,10 @@ PolycodeDebugEvent::~PolycodeDebugEvent() {
 
 PolycodePlayer::PolycodePlayer(String fileName, bool knownArchive) : EventDispatcher()  {
 	L = NULL;
+	profiler = NULL;
+	profileScripts = false;
+	collector = NULL;
+	scriptGCBudget = 1;
 
 	fileToRun = fileName;
 	core = NULL;
@@ -337,6 +355,12 @@ void PolycodePlayer::loadFile(const char *fileName) {
 		if(configFile.root["fullScreen"]) {
 			fullScreen = configFile.root["fullScreen"]->boolVal;
 		}		
+		if(configFile.root["profileScripts"]) {
+			profileScripts = configFile.root["profileScripts"]->boolVal;
+		}		
+		if(configFile.root["scriptGCBudget"]) {
+			scriptGCBudget = configFile.root["scriptGCBudget"]->NumberVal;
+		}		
 		if(configFile.root["backgroundColor"]) {
 			ObjectEntry *color = configFile.root["backgroundColor"];
 			if((*color)["red"] && (*color)["green"] && (*color)["blue"]) {
@@ -460,6 +484,8 @@ PolycodePlayer::~PolycodePlayer() {
 	delete core;
 	PolycodeDebugEvent *event = new PolycodeDebugEvent();			
 	dispatchEvent(event, PolycodeDebugEvent::EVENT_REMOVE);	
+	delete profiler;
+	delete collector;
 //	lua_close(L);
 }
 
@@ -479,9 +505,16 @@ void PolycodePlayer::handleEvent(Event *event) {
 
 bool PolycodePlayer::Update() {
 	if(L) {
-		lua_getfield(L, LUA_GLOBALSINDEX, "Update");
-		lua_pushnumber(L, core->getElapsed());
-		lua_call(L, 1, 0);
+		collector->beginFrame();
+		profiler->beginFrame();
+		{
+			PROFILE_SCOPE("Lua Update");
+			lua_getfield(L, LUA_GLOBALSINDEX, "Update");
+			lua_pushnumber(L, core->getElapsed());
+			lua_call(L, 1, 0);
+		}
+		profiler->endFrame();
+		collector->endFrame();
 	}
 	return core->Update();
 }
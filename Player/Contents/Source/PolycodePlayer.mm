@@ -144,6 +144,13 @@ extern "C" {
 		
 		lua_register(L, "debugPrint", debugPrint);			
 		
+		profiler = new PolycodeScriptProfiler(L);
+		profiler->registerScriptFunctions();
+		
+		collector = new PolycodeScriptCollector(L);
+		collector->registerScriptFunctions();
+		core->setIdleHandler(collector);
+		
 		lua_getfield(L, LUA_GLOBALSINDEX, "require");
 		lua_pushstring(L, "class");		
 		lua_call(L, 1, 0);
@@ -179,6 +186,10 @@ extern "C" {
 					
 		}
 
+		if(profileScripts) {
+			profiler->start();
+		}
+
 		String fileData = "";
 
 		OSFILE *inFile = OSBasics::open(fileName, "r");	
@@ -206,8 +217,6 @@ extern "C" {
 		
 		doneLoading = true;
 		
-		//lua_gc(L, LUA_GCSTOP, 0);
-		
 		
 /*
 		lua_pushliteral(L, "debug");
@@ -232,6 +241,11 @@ extern "C" {
 
 			}
 		}
+		
+		if(scriptGCBudget > 0) {
+			collector->setFrameBudget(scriptGCBudget / 1000.0);
+			collector->setIncremental(true);
+		}
 
 	}
 }
@@ -246,6 +260,10 @@ PolycodeDebugEvent::~PolycodeDebugEvent() {
 
 
 PolycodePlayer::PolycodePlayer(String fileName, bool knownArchive) : EventDispatcher()  {
+	profiler = NULL;
+	profileScripts = false;
+	collector = NULL;
+	scriptGCBudget = 1;
 	fileToRun = fileName;
 	core = NULL;
 	doneLoading = false;	
@@ -319,6 +337,12 @@ void PolycodePlayer::loadFile(const char *fileName) {
 		if(configFile.root["fullScreen"]) {
 			fullScreen = configFile.root["fullScreen"]->boolVal;
 		}		
+		if(configFile.root["profileScripts"]) {
+			profileScripts = configFile.root["profileScripts"]->boolVal;
+		}		
+		if(configFile.root["scriptGCBudget"]) {
+			scriptGCBudget = configFile.root["scriptGCBudget"]->NumberVal;
+		}		
 		if(configFile.root["backgroundColor"]) {
 			ObjectEntry *color = configFile.root["backgroundColor"];
 			if((*color)["red"] && (*color)["green"] && (*color)["blue"]) {
@@ -428,6 +452,8 @@ PolycodePlayer::~PolycodePlayer() {
 	delete core;
 	PolycodeDebugEvent *event = new PolycodeDebugEvent();			
 	dispatchEvent(event, PolycodeDebugEvent::EVENT_REMOVE);	
+	delete profiler;
+	delete collector;
 //	lua_close(L);
 }
 
@@ -447,9 +473,13 @@ void PolycodePlayer::handleEvent(Event *event) {
 
 bool PolycodePlayer::Update() {
 	
+	collector->beginFrame();
+	profiler->beginFrame();
 	lua_getfield(L, LUA_GLOBALSINDEX, "Update");
 	lua_pushnumber(L, core->getElapsed());
 	lua_call(L, 1, 0);
+	profiler->endFrame();
+	collector->endFrame();
 	
 	return core->Update();
 }
@@ -0,0 +1,206 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolycodeScriptCollector.h"
+#include "PolycodeScriptProfiler.h"
+
+static PolycodeScriptCollector *getCollector(lua_State *L) {
+	return (PolycodeScriptCollector*)lua_touserdata(L, lua_upvalueindex(1));
+}
+
+static int gcFrameStats(lua_State *L) {
+	const ScriptGCStats &stats = getCollector(L)->getLastFrameStats();
+	lua_newtable(L);
+	lua_pushnumber(L, stats.stepTime);
+	lua_setfield(L, -2, "stepTime");
+	lua_pushnumber(L, stats.idleTime);
+	lua_setfield(L, -2, "idleTime");
+	lua_pushnumber(L, stats.idleStepTime);
+	lua_setfield(L, -2, "idleStepTime");
+	lua_pushnumber(L, stats.maxPause);
+	lua_setfield(L, -2, "maxPause");
+	lua_pushinteger(L, stats.steps);
+	lua_setfield(L, -2, "steps");
+	lua_pushinteger(L, stats.cycles);
+	lua_setfield(L, -2, "cycles");
+	lua_pushinteger(L, stats.forcedCycles);
+	lua_setfield(L, -2, "forcedCycles");
+	lua_pushinteger(L, stats.memoryKB);
+	lua_setfield(L, -2, "memoryKB");
+	lua_pushinteger(L, stats.lastCycleMemoryKB);
+	lua_setfield(L, -2, "lastCycleMemoryKB");
+	return 1;
+}
+
+static int gcSetFrameBudget(lua_State *L) {
+	getCollector(L)->setFrameBudget(luaL_checknumber(L, 1));
+	return 0;
+}
+
+PolycodeScriptCollector::PolycodeScriptCollector(lua_State *L) {
+	this->L = L;
+	incremental = false;
+	cycleInProgress = false;
+	frameBudget = 0.001;
+	budgetLeft = frameBudget;
+	lastCycleMemoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	setPause(DEFAULT_PAUSE);
+	setStepMultiplier(DEFAULT_STEP_MULTIPLIER);
+}
+
+PolycodeScriptCollector::~PolycodeScriptCollector() {
+	
+}
+
+void PolycodeScriptCollector::setIncremental(bool val) {
+	if(val) {
+		lua_gc(L, LUA_GCCOLLECT, 0);
+		lua_gc(L, LUA_GCSTOP, 0);
+		lastCycleMemoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+		frameStats.lastCycleMemoryKB = lastCycleMemoryKB;
+		cycleInProgress = false;
+	} else {
+		lua_gc(L, LUA_GCRESTART, 0);
+	}
+	incremental = val;
+}
+
+bool PolycodeScriptCollector::isIncremental() const {
+	return incremental;
+}
+
+void PolycodeScriptCollector::setFrameBudget(double budget) {
+	frameBudget = budget;
+}
+
+double PolycodeScriptCollector::getFrameBudget() const {
+	return frameBudget;
+}
+
+void PolycodeScriptCollector::setPause(int pause) {
+	this->pause = pause;
+	lua_gc(L, LUA_GCSETPAUSE, pause);
+}
+
+void PolycodeScriptCollector::setStepMultiplier(int stepMultiplier) {
+	lua_gc(L, LUA_GCSETSTEPMUL, stepMultiplier);
+}
+
+int PolycodeScriptCollector::getTriggerKB() const {
+	return lastCycleMemoryKB * pause / 100;
+}
+
+double PolycodeScriptCollector::runSteps(double timeLimit, bool finishCycle) {
+	double startTime = PolycodeScriptProfiler::getTime();
+	double now = startTime;
+	do {
+		int cycleDone = lua_gc(L, LUA_GCSTEP, 0);
+		double stepEnd = PolycodeScriptProfiler::getTime();
+		if(stepEnd - now > frameStats.maxPause)
+			frameStats.maxPause = stepEnd - now;
+		frameStats.steps++;
+		now = stepEnd;
+		if(cycleDone) {
+			cycleInProgress = false;
+			lastCycleMemoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+			frameStats.lastCycleMemoryKB = lastCycleMemoryKB;
+			frameStats.cycles++;
+			break;
+		}
+		cycleInProgress = true;
+	} while(finishCycle || now - startTime < timeLimit);
+	
+	// a step moves the collector threshold, which turns automatic
+	// collection back on in Lua 5.1
+	lua_gc(L, LUA_GCSTOP, 0);
+	
+	frameStats.stepTime += now - startTime;
+	return now - startTime;
+}
+
+double PolycodeScriptCollector::step(double timeLimit) {
+	if(timeLimit <= 0)
+		return 0;
+	double spent = runSteps(timeLimit, false);
+	if(!incremental)
+		lua_gc(L, LUA_GCRESTART, 0);
+	return spent;
+}
+
+void PolycodeScriptCollector::beginFrame() {
+	lastFrameStats = frameStats;
+	lastFrameStats.memoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	
+	frameStats.stepTime = 0;
+	frameStats.idleTime = 0;
+	frameStats.idleStepTime = 0;
+	frameStats.maxPause = 0;
+	frameStats.steps = 0;
+	budgetLeft = frameBudget;
+	
+	// scripts can restart the collector with collectgarbage()
+	if(incremental)
+		lua_gc(L, LUA_GCSTOP, 0);
+}
+
+void PolycodeScriptCollector::endFrame() {
+	if(!incremental)
+		return;
+	
+	int memoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	int triggerKB = getTriggerKB();
+	if(memoryKB >= triggerKB * 2) {
+		frameStats.forcedCycles++;
+		budgetLeft -= runSteps(0, true);
+	} else if(memoryKB >= triggerKB && budgetLeft > 0) {
+		budgetLeft -= runSteps(budgetLeft, false);
+	}
+}
+
+void PolycodeScriptCollector::handleIdle(Number idleTime) {
+	if(!incremental)
+		return;
+	
+	frameStats.idleTime += idleTime;
+	double available = idleTime - ((double)IDLE_MARGIN_MS) / 1000.0;
+	if(available <= 0)
+		return;
+	
+	int memoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	if(cycleInProgress || memoryKB >= (lastCycleMemoryKB + getTriggerKB()) / 2) {
+		frameStats.idleStepTime += runSteps(available, false);
+	}
+}
+
+const ScriptGCStats &PolycodeScriptCollector::getLastFrameStats() const {
+	return lastFrameStats;
+}
+
+void PolycodeScriptCollector::registerScriptFunctions() {
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, gcFrameStats, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "gcFrameStats");
+	
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, gcSetFrameBudget, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "gcSetFrameBudget");
+}
@@ -0,0 +1,431 @@
+/*
+Copyright (C) 2011 by Ivan Safrin
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "PolycodeScriptProfiler.h"
+#include <algorithm>
+#include <string.h>
+
+#ifdef _WINDOWS
+#include <windows.h>
+#define snprintf _snprintf
+#else
+#include <sys/time.h>
+#endif
+
+PolycodeScriptProfiler *PolycodeScriptProfiler::instance = NULL;
+
+static bool compareExclusiveTime(const ScriptFunctionStats &a, const ScriptFunctionStats &b) {
+	return a.exclusiveTime > b.exclusiveTime;
+}
+
+static PolycodeScriptProfiler *getProfiler(lua_State *L) {
+	return (PolycodeScriptProfiler*)lua_touserdata(L, lua_upvalueindex(1));
+}
+
+static int profilerStart(lua_State *L) {
+	int interval = PolycodeScriptProfiler::DEFAULT_INSTRUCTION_INTERVAL;
+	if(lua_isnumber(L, 1))
+		interval = lua_tointeger(L, 1);
+	getProfiler(L)->start(interval);
+	return 0;
+}
+
+static int profilerStop(lua_State *L) {
+	getProfiler(L)->stop();
+	return 0;
+}
+
+static int profilerReset(lua_State *L) {
+	getProfiler(L)->reset();
+	return 0;
+}
+
+static int profilerDump(lua_State *L) {
+	luaL_checktype(L, 1, LUA_TSTRING);
+	lua_pushboolean(L, getProfiler(L)->writeFoldedStacks(lua_tostring(L, 1)));
+	return 1;
+}
+
+static int profilerFrameStats(lua_State *L) {
+	const ScriptFrameStats &stats = getProfiler(L)->getLastFrameStats();
+	lua_newtable(L);
+	lua_pushnumber(L, stats.scriptTime);
+	lua_setfield(L, -2, "scriptTime");
+	lua_pushinteger(L, stats.samples);
+	lua_setfield(L, -2, "samples");
+	lua_pushinteger(L, stats.bindingCalls);
+	lua_setfield(L, -2, "bindingCalls");
+	lua_pushinteger(L, stats.memoryKB);
+	lua_setfield(L, -2, "memoryKB");
+	lua_pushinteger(L, stats.memoryDeltaKB);
+	lua_setfield(L, -2, "memoryDeltaKB");
+	lua_pushinteger(L, stats.collections);
+	lua_setfield(L, -2, "collections");
+	lua_pushnumber(L, stats.profilerTime);
+	lua_setfield(L, -2, "profilerTime");
+	return 1;
+}
+
+PolycodeScriptProfiler::PolycodeScriptProfiler(lua_State *L) {
+	this->L = L;
+	running = false;
+	bindingsWrapped = false;
+	inFrame = false;
+	lastSampleTime = getTime();
+	outsideFrameWeight = 0;
+	totalProfilerTime = 0;
+	lastMemoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	frameStartTime = lastSampleTime;
+	frameStartMemoryKB = lastMemoryKB;
+	frameSamples = 0;
+	frameCollections = 0;
+	frameBindingCalls = 0;
+	totalBindingCalls = 0;
+	frameProfilerTime = 0;
+	samples.resize(SAMPLE_BUFFER_SIZE);
+	numSamples = 0;
+	instance = this;
+}
+
+PolycodeScriptProfiler::~PolycodeScriptProfiler() {
+	stop();
+	if(instance == this)
+		instance = NULL;
+}
+
+double PolycodeScriptProfiler::getTime() {
+#ifdef _WINDOWS
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+#endif
+}
+
+void PolycodeScriptProfiler::start(int instructionInterval) {
+	if(instructionInterval < 1)
+		instructionInterval = DEFAULT_INSTRUCTION_INTERVAL;
+	wrapBindings(true);
+	lastSampleTime = getTime();
+	lua_sethook(L, hook, LUA_MASKCOUNT, instructionInterval);
+	running = true;
+}
+
+void PolycodeScriptProfiler::stop() {
+	if(!running)
+		return;
+	lua_sethook(L, NULL, 0, 0);
+	wrapBindings(false);
+	running = false;
+}
+
+bool PolycodeScriptProfiler::isRunning() const {
+	return running;
+}
+
+void PolycodeScriptProfiler::reset() {
+	functions.clear();
+	functionIds.clear();
+	numSamples = 0;
+	stacks.clear();
+	totalProfilerTime = 0;
+	for(std::map<std::string, unsigned int>::iterator it = bindingCalls.begin(); it != bindingCalls.end(); it++) {
+		it->second = 0;
+	}
+}
+
+void PolycodeScriptProfiler::hook(lua_State *L, lua_Debug *ar) {
+	if(instance && ar->event == LUA_HOOKCOUNT)
+		instance->sample();
+}
+
+int PolycodeScriptProfiler::countedBindingCall(lua_State *L) {
+	unsigned int *counter = (unsigned int*)lua_touserdata(L, lua_upvalueindex(2));
+	(*counter)++;
+	if(instance)
+		instance->totalBindingCalls++;
+	lua_CFunction binding = lua_tocfunction(L, lua_upvalueindex(1));
+	return binding(L);
+}
+
+void PolycodeScriptProfiler::wrapBindings(bool wrap) {
+	if(wrap == bindingsWrapped)
+		return;
+	
+	// every library opened with luaL_openlib is in package.loaded, which
+	// covers Polycore as well as the modules loaded by the project
+	static const char *standardLibraries[] = {"_G", "coroutine", "debug", "io", "math", "os", "package", "string", "table", NULL};
+	
+	std::vector<std::string> libraries;
+	lua_getfield(L, LUA_REGISTRYINDEX, "_LOADED");
+	if(lua_istable(L, -1)) {
+		lua_pushnil(L);
+		while(lua_next(L, -2) != 0) {
+			if(lua_type(L, -2) == LUA_TSTRING && lua_istable(L, -1)) {
+				const char *libraryName = lua_tostring(L, -2);
+				bool standard = false;
+				for(int i=0; standardLibraries[i]; i++) {
+					if(strcmp(libraryName, standardLibraries[i]) == 0)
+						standard = true;
+				}
+				if(!standard)
+					libraries.push_back(libraryName);
+			}
+			lua_pop(L, 1);
+		}
+	}
+	lua_pop(L, 1);
+	
+	for(int i=0; i < libraries.size(); i++) {
+		wrapLibrary(libraries[i].c_str(), wrap);
+	}
+	bindingsWrapped = wrap;
+}
+
+void PolycodeScriptProfiler::wrapLibrary(const char *libraryName, bool wrap) {
+	lua_getfield(L, LUA_REGISTRYINDEX, "_LOADED");
+	lua_getfield(L, -1, libraryName);
+	lua_remove(L, -2);
+	if(!lua_istable(L, -1)) {
+		lua_pop(L, 1);
+		return;
+	}
+	
+	std::string prefix = std::string(libraryName) + ".";
+	lua_pushnil(L);
+	while(lua_next(L, -2) != 0) {
+		if(lua_type(L, -2) == LUA_TSTRING && lua_iscfunction(L, -1)) {
+			lua_CFunction func = lua_tocfunction(L, -1);
+			if(wrap && func != countedBindingCall) {
+				// library[name] = closure(binding, counter)
+				lua_pushvalue(L, -2);
+				lua_pushvalue(L, -2);
+				lua_pushlightuserdata(L, &bindingCalls[prefix + lua_tostring(L, -4)]);
+				lua_pushcclosure(L, countedBindingCall, 2);
+				lua_rawset(L, -5);
+			} else if(!wrap && func == countedBindingCall) {
+				lua_pushvalue(L, -2);
+				lua_getupvalue(L, -2, 1);
+				lua_rawset(L, -5);
+			}
+		}
+		lua_pop(L, 1);
+	}
+	lua_pop(L, 1);
+}
+
+int PolycodeScriptProfiler::getFunctionId(lua_Debug *ar) {
+	ScriptFunctionKey key;
+	key.source = ar->source;
+	key.name = ar->name;
+	key.line = ar->linedefined;
+	
+	std::map<ScriptFunctionKey, int>::iterator it = functionIds.find(key);
+	if(it != functionIds.end())
+		return it->second;
+	
+	// only the first sample of a function builds its label
+	char label[256];
+	if(ar->what[0] == 'C') {
+		snprintf(label, sizeof(label), "%s [C]", ar->name ? ar->name : "?");
+	} else if(ar->what[0] == 'm') {
+		snprintf(label, sizeof(label), "main chunk@%s", ar->short_src);
+	} else {
+		snprintf(label, sizeof(label), "%s@%s:%d", ar->name ? ar->name : "?", ar->short_src, ar->linedefined);
+	}
+	// ';' separates frames in the folded format
+	for(char *c = label; *c; c++) {
+		if(*c == ';')
+			*c = ',';
+	}
+	
+	ScriptFunctionStats stats;
+	stats.name = String(label);
+	functions.push_back(stats);
+	functionIds[key] = functions.size() - 1;
+	return functions.size() - 1;
+}
+
+void PolycodeScriptProfiler::sample() {
+	double now = getTime();
+	
+	// inside a frame the sample is charged the time since the previous one.
+	// Script code run outside of frames, such as event handlers, runs at
+	// unknown times, so it is charged the average sample time of the last
+	// frame instead.
+	double weight = inFrame ? now - lastSampleTime : outsideFrameWeight;
+	
+	int memoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	if(memoryKB < lastMemoryKB)
+		frameCollections++;
+	lastMemoryKB = memoryKB;
+	frameSamples++;
+	
+	if(numSamples == SAMPLE_BUFFER_SIZE)
+		flushSamples();
+	
+	ScriptSample &current = samples[numSamples];
+	current.weight = weight;
+	current.depth = 0;
+	lua_Debug ar;
+	for(int level = 0; level < MAX_STACK_DEPTH && lua_getstack(L, level, &ar); level++) {
+		lua_getinfo(L, "Sn", &ar);
+		current.functions[current.depth++] = getFunctionId(&ar);
+	}
+	
+	if(current.depth > 0) {
+		numSamples++;
+		for(int i=0; i < current.depth; i++) {
+			// recursive functions only count once per sample
+			bool seen = false;
+			for(int j=0; j < i; j++) {
+				if(current.functions[j] == current.functions[i]) {
+					seen = true;
+					break;
+				}
+			}
+			if(seen)
+				continue;
+			ScriptFunctionStats &stats = functions[current.functions[i]];
+			stats.inclusiveTime += weight;
+			stats.samples++;
+		}
+		functions[current.functions[0]].exclusiveTime += weight;
+	}
+	
+	// the time spent in here is the profiler's own and is not charged to
+	// the next sample
+	double end = getTime();
+	frameProfilerTime += end - now;
+	totalProfilerTime += end - now;
+	lastSampleTime = end;
+}
+
+void PolycodeScriptProfiler::flushSamples() {
+	std::vector<int> stack;
+	for(int i=0; i < numSamples; i++) {
+		ScriptSample &current = samples[i];
+		stack.clear();
+		for(int j = current.depth - 1; j >= 0; j--) {
+			stack.push_back(current.functions[j]);
+		}
+		stacks[stack] += current.weight;
+	}
+	numSamples = 0;
+}
+
+void PolycodeScriptProfiler::beginFrame() {
+	frameStartTime = getTime();
+	lastSampleTime = frameStartTime;
+	inFrame = true;
+	frameStartMemoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	lastMemoryKB = frameStartMemoryKB;
+	frameSamples = 0;
+	frameCollections = 0;
+	frameBindingCalls = totalBindingCalls;
+	frameProfilerTime = 0;
+}
+
+void PolycodeScriptProfiler::endFrame() {
+	double now = getTime();
+	int memoryKB = lua_gc(L, LUA_GCCOUNT, 0);
+	if(memoryKB < lastMemoryKB)
+		frameCollections++;
+	
+	lastFrameStats.scriptTime = now - frameStartTime;
+	lastFrameStats.samples = frameSamples;
+	lastFrameStats.bindingCalls = totalBindingCalls - frameBindingCalls;
+	lastFrameStats.memoryKB = memoryKB;
+	lastFrameStats.memoryDeltaKB = memoryKB - frameStartMemoryKB;
+	lastFrameStats.collections = frameCollections;
+	lastFrameStats.profilerTime = frameProfilerTime;
+	
+	if(frameSamples > 0)
+		outsideFrameWeight = (lastFrameStats.scriptTime - frameProfilerTime) / frameSamples;
+	inFrame = false;
+	lastMemoryKB = memoryKB;
+}
+
+const ScriptFrameStats &PolycodeScriptProfiler::getLastFrameStats() const {
+	return lastFrameStats;
+}
+
+std::vector<ScriptFunctionStats> PolycodeScriptProfiler::getFunctionStats() const {
+	std::vector<ScriptFunctionStats> result = functions;
+	std::sort(result.begin(), result.end(), compareExclusiveTime);
+	return result;
+}
+
+double PolycodeScriptProfiler::getProfilerTime() const {
+	return totalProfilerTime;
+}
+
+unsigned int PolycodeScriptProfiler::getBindingCallCount(const String &name) const {
+	std::map<std::string, unsigned int>::const_iterator it = bindingCalls.find(String(name).getSTLString());
+	if(it == bindingCalls.end())
+		return 0;
+	return it->second;
+}
+
+bool PolycodeScriptProfiler::writeFoldedStacks(const String &fileName) {
+	FILE *file = fopen(String(fileName).c_str(), "w");
+	if(!file) {
+		Logger::log("Error writing script profile to %s\n", String(fileName).c_str());
+		return false;
+	}
+	flushSamples();
+	for(std::map<std::vector<int>, double>::const_iterator it = stacks.begin(); it != stacks.end(); it++) {
+		const std::vector<int> &stack = it->first;
+		for(int i=0; i < stack.size(); i++) {
+			fprintf(file, "%s%s", functions[stack[i]].name.c_str(), (i < stack.size() - 1) ? ";" : "");
+		}
+		fprintf(file, " %u\n", (unsigned int)(it->second * 1000000.0));
+	}
+	fclose(file);
+	return true;
+}
+
+void PolycodeScriptProfiler::registerScriptFunctions() {
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, profilerStart, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "profilerStart");
+	
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, profilerStop, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "profilerStop");
+
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, profilerReset, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "profilerReset");
+	
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, profilerDump, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "profilerDump");
+	
+	lua_pushlightuserdata(L, this);
+	lua_pushcclosure(L, profilerFrameStats, 1);
+	lua_setfield(L, LUA_GLOBALSINDEX, "profilerFrameStats");
+}
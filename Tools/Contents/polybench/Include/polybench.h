@@ -0,0 +1,101 @@
+#pragma once
+
+#include "stdio.h"
+#include "Polycode.h"
+#include "PolyHeadlessCore.h"
+
+using namespace Polycode;
+
+class BenchArg {
+public:
+	String name;
+	String value;
+};
+
+/**
+* A single microbenchmark. Subclasses set up their data in setUp() and run the measured code in run(). Everything run() computes should end up in benchSink, so the compiler cannot drop the work.
+*/
+class Benchmark {
+public:
+	Benchmark(String name, String group);
+	virtual ~Benchmark();
+
+	virtual void setUp() {}
+	virtual void tearDown() {}
+
+	/**
+	* Runs the measured code.
+	* @param iterations Number of times to run it.
+	*/
+	virtual void run(int iterations) = 0;
+
+	String name;
+	String group;
+
+	/**
+	* Number of items (vertices, events, packets...) one iteration processes. Used to report throughput.
+	*/
+	int itemsPerIteration;
+};
+
+class BenchmarkResult {
+public:
+	String name;
+	String group;
+	int samples;
+	long long iterations;
+	int itemsPerIteration;
+	double meanNs;
+	double minNs;
+	double medianNs;
+	double p99Ns;
+	double stdDevNs;
+};
+
+/**
+* Times benchmarks. Every benchmark is calibrated to an iteration count that takes at least the minimum sample time, then timed over a fixed number of samples. Times are per iteration.
+*/
+class BenchmarkRunner {
+public:
+	BenchmarkRunner(Core *core);
+	~BenchmarkRunner();
+
+	/**
+	* Adds a benchmark. The runner takes ownership of it.
+	*/
+	void addBenchmark(Benchmark *benchmark);
+
+	/**
+	* Only runs benchmarks whose group or name contains the filter.
+	*/
+	void setFilter(String filter);
+	void setNumSamples(int numSamples);
+	void setMinSampleTime(unsigned long long nanoseconds);
+
+	void runAll();
+
+	/**
+	* Writes the results to a JSON file.
+	* @param fileName File to write.
+	* @return True if the file could be written.
+	*/
+	bool writeJSON(String fileName);
+
+	vector<BenchmarkResult> results;
+
+protected:
+
+	unsigned long long timeRun(Benchmark *benchmark, int iterations);
+	BenchmarkResult runBenchmark(Benchmark *benchmark);
+
+	Core *core;
+	vector<Benchmark*> benchmarks;
+	String filter;
+	int numSamples;
+	unsigned long long minSampleTime;
+};
+
+extern volatile Number benchSink;
+
+void addCoreBenchmarks(BenchmarkRunner *runner, Core *core, String assetPath);
+void addModuleBenchmarks(BenchmarkRunner *runner, Core *core, String assetPath);
@@ -0,0 +1,635 @@
+
+#include "polybench.h"
+
+#define BENCH_SEED 1234
+#define BENCH_MATH_COUNT 256
+
+static Number randomNumber(Number min, Number max) {
+	return min + (max - min) * ((Number)rand() / (Number)RAND_MAX);
+}
+
+static Vector3 randomVector(Number range) {
+	return Vector3(randomNumber(-range, range), randomNumber(-range, range), randomNumber(-range, range));
+}
+
+static Quaternion randomQuaternion() {
+	Quaternion q;
+	q.fromAxes(randomNumber(-180, 180), randomNumber(-180, 180), randomNumber(-180, 180));
+	return q;
+}
+
+static Matrix4 randomMatrix() {
+	Matrix4 m = randomQuaternion().createMatrix();
+	Vector3 pos = randomVector(100);
+	m.setPosition(pos.x, pos.y, pos.z);
+	return m;
+}
+
+// ---- math
+
+class Matrix4MultiplyBenchmark : public Benchmark {
+public:
+	Matrix4MultiplyBenchmark() : Benchmark("matrix4_multiply", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			a[i] = randomMatrix();
+			b[i] = randomMatrix();
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				out[i] = a[i] * b[i];
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].m[3][0];
+		}
+	}
+
+	Matrix4 a[BENCH_MATH_COUNT];
+	Matrix4 b[BENCH_MATH_COUNT];
+	Matrix4 out[BENCH_MATH_COUNT];
+};
+
+class Matrix4InverseBenchmark : public Benchmark {
+public:
+	Matrix4InverseBenchmark() : Benchmark("matrix4_inverse", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			a[i] = randomMatrix();
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				out[i] = a[i].inverse();
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].m[3][0];
+		}
+	}
+
+	Matrix4 a[BENCH_MATH_COUNT];
+	Matrix4 out[BENCH_MATH_COUNT];
+};
+
+class Matrix4TransformBenchmark : public Benchmark {
+public:
+	Matrix4TransformBenchmark() : Benchmark("matrix4_transform_vector3", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		matrix = randomMatrix();
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			v[i] = randomVector(10);
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				out[i] = matrix * v[i];
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].x;
+		}
+	}
+
+	Matrix4 matrix;
+	Vector3 v[BENCH_MATH_COUNT];
+	Vector3 out[BENCH_MATH_COUNT];
+};
+
+class Vector3OpsBenchmark : public Benchmark {
+public:
+	Vector3OpsBenchmark() : Benchmark("vector3_cross_normalize", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			a[i] = randomVector(10);
+			b[i] = randomVector(10);
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				out[i] = a[i].crossProduct(b[i]);
+				out[i].Normalize();
+				out[i] += a[i] - b[i];
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].dot(a[0]);
+		}
+	}
+
+	Vector3 a[BENCH_MATH_COUNT];
+	Vector3 b[BENCH_MATH_COUNT];
+	Vector3 out[BENCH_MATH_COUNT];
+};
+
+class QuaternionSlerpBenchmark : public Benchmark {
+public:
+	QuaternionSlerpBenchmark() : Benchmark("quaternion_slerp", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			a[i] = randomQuaternion();
+			b[i] = randomQuaternion();
+			t[i] = randomNumber(0, 1);
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				out[i] = Quaternion::Slerp(t[i], a[i], b[i], true);
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].w;
+		}
+	}
+
+	Quaternion a[BENCH_MATH_COUNT];
+	Quaternion b[BENCH_MATH_COUNT];
+	Number t[BENCH_MATH_COUNT];
+	Quaternion out[BENCH_MATH_COUNT];
+};
+
+class QuaternionMatrixBenchmark : public Benchmark {
+public:
+	QuaternionMatrixBenchmark() : Benchmark("quaternion_multiply_to_matrix", "math") { itemsPerIteration = BENCH_MATH_COUNT; }
+
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_MATH_COUNT; i++) {
+			a[i] = randomQuaternion();
+			b[i] = randomQuaternion();
+		}
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < BENCH_MATH_COUNT; i++) {
+				Quaternion q = a[i] * b[i];
+				out[i] = q.createMatrix();
+			}
+			benchSink += out[n % BENCH_MATH_COUNT].m[0][0];
+		}
+	}
+
+	Quaternion a[BENCH_MATH_COUNT];
+	Quaternion b[BENCH_MATH_COUNT];
+	Matrix4 out[BENCH_MATH_COUNT];
+};
+
+// ---- meshes
+
+class MeshLoadBenchmark : public Benchmark {
+public:
+	MeshLoadBenchmark(String fileName) : Benchmark("mesh_load", "mesh") { this->fileName = fileName; }
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			Mesh *mesh = new Mesh(fileName);
+			benchSink += mesh->getPolygonCount();
+			delete mesh;
+		}
+	}
+
+	String fileName;
+};
+
+class MeshNormalsBenchmark : public Benchmark {
+public:
+	MeshNormalsBenchmark(String fileName, bool smooth) : Benchmark(smooth ? "mesh_calculate_normals_smooth" : "mesh_calculate_normals_flat", "mesh") {
+		this->fileName = fileName;
+		this->smooth = smooth;
+		mesh = NULL;
+	}
+
+	void setUp() {
+		mesh = new Mesh(fileName);
+		itemsPerIteration = mesh->getPolygonCount();
+	}
+
+	void tearDown() {
+		delete mesh;
+		mesh = NULL;
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			mesh->calculateNormals(smooth);
+		}
+		benchSink += mesh->getPolygon(0)->getVertex(0)->normal.x;
+	}
+
+	String fileName;
+	bool smooth;
+	Mesh *mesh;
+};
+
+class RenderDataArrayBenchmark : public Benchmark {
+public:
+	RenderDataArrayBenchmark(String fileName) : Benchmark("renderer_create_data_arrays", "mesh") {
+		this->fileName = fileName;
+		mesh = NULL;
+	}
+
+	void setUp() {
+		mesh = new Mesh(fileName);
+		itemsPerIteration = 0;
+		for(int i=0; i < mesh->getPolygonCount(); i++) {
+			itemsPerIteration += mesh->getPolygon(i)->getVertexCount();
+		}
+	}
+
+	void tearDown() {
+		delete mesh;
+		mesh = NULL;
+	}
+
+	void run(int iterations) {
+		Renderer *renderer = CoreServices::getInstance()->getRenderer();
+		int arrayTypes[3] = { RenderDataArray::VERTEX_DATA_ARRAY, RenderDataArray::NORMAL_DATA_ARRAY, RenderDataArray::TEXCOORD_DATA_ARRAY };
+		for(int n=0; n < iterations; n++) {
+			for(int i=0; i < 3; i++) {
+				RenderDataArray *array = renderer->createRenderDataArrayForMesh(mesh, arrayTypes[i]);
+				benchSink += array->count;
+				free(array->arrayPtr);
+				delete array;
+			}
+		}
+	}
+
+	String fileName;
+	Mesh *mesh;
+};
+
+// ---- skeletal animation
+
+class SkinningBenchmark : public Benchmark {
+public:
+	SkinningBenchmark(String assetPath, bool render) : Benchmark(render ? "scenemesh_skinned_render" : "skeleton_update", "skinning") {
+		this->assetPath = assetPath;
+		this->render = render;
+		sceneMesh = NULL;
+	}
+
+	void setUp() {
+		sceneMesh = new SceneMesh(assetPath + "/ninja.mesh");
+		sceneMesh->loadSkeleton(assetPath + "/ninja.skeleton");
+		sceneMesh->getSkeleton()->addAnimation("Run", assetPath + "/run.anim");
+		sceneMesh->getSkeleton()->playAnimation("Run");
+		itemsPerIteration = sceneMesh->getMesh()->getPolygonCount();
+	}
+
+	void tearDown() {
+		delete sceneMesh;
+		sceneMesh = NULL;
+	}
+
+	// the skeleton only evaluates its pose if the mesh was rendered since
+	// the last update and the mesh only skins if the pose has changed, so
+	// every iteration is one animated frame
+	void run(int iterations) {
+		Skeleton *skeleton = sceneMesh->getSkeleton();
+		for(int n=0; n < iterations; n++) {
+			skeleton->setRendered();
+			skeleton->Update();
+			if(render)
+				sceneMesh->renderMeshLocally();
+		}
+		benchSink += skeleton->getPoseRevision();
+	}
+
+	String assetPath;
+	bool render;
+	SceneMesh *sceneMesh;
+};
+
+// ---- events
+
+class CountingEventHandler : public EventHandler {
+public:
+	CountingEventHandler() : EventHandler() { count = 0; }
+	void handleEvent(Event *event) { count++; }
+	int count;
+};
+
+#define BENCH_EVENT_LISTENERS 8
+
+class EventDispatchBenchmark : public Benchmark {
+public:
+	EventDispatchBenchmark(bool allocate) : Benchmark(allocate ? "event_dispatch_new_event" : "event_dispatch", "events") {
+		this->allocate = allocate;
+		dispatcher = NULL;
+	}
+
+	void setUp() {
+		dispatcher = new EventDispatcher();
+		for(int i=0; i < BENCH_EVENT_LISTENERS; i++) {
+			dispatcher->addEventListener(&handlers[i], Event::COMPLETE_EVENT);
+			dispatcher->addEventListener(&handlers[i], Event::CHANGE_EVENT);
+		}
+	}
+
+	void tearDown() {
+		delete dispatcher;
+		dispatcher = NULL;
+	}
+
+	void run(int iterations) {
+		Event event;
+		for(int n=0; n < iterations; n++) {
+			if(allocate)
+				dispatcher->dispatchEvent(new Event(), Event::COMPLETE_EVENT);
+			else
+				dispatcher->dispatchEventNoDelete(&event, Event::COMPLETE_EVENT);
+		}
+		benchSink += handlers[0].count;
+	}
+
+	bool allocate;
+	EventDispatcher *dispatcher;
+	CountingEventHandler handlers[BENCH_EVENT_LISTENERS];
+};
+
+// ---- resources
+
+#define BENCH_RESOURCE_COUNT 512
+
+class ResourceLookupBenchmark : public Benchmark {
+public:
+	ResourceLookupBenchmark(bool fromCString) : Benchmark(fromCString ? "resource_lookup_cstring" : "resource_lookup", "resources") {
+		this->fromCString = fromCString;
+	}
+
+	void setUp() {
+		ResourceManager *resourceManager = CoreServices::getInstance()->getResourceManager();
+		char name[64];
+		for(int i=0; i < BENCH_RESOURCE_COUNT; i++) {
+			sprintf(name, "bench_%s_%d", fromCString ? "cstring" : "string", i);
+			names.push_back(String(name));
+			Resource *resource = new Resource(Resource::RESOURCE_TEXTURE);
+			resource->setResourceName(names[i]);
+			resourceManager->addResource(resource);
+			resources.push_back(resource);
+		}
+	}
+
+	// both variants have to search the same number of resources
+	void tearDown() {
+		ResourceManager *resourceManager = CoreServices::getInstance()->getResourceManager();
+		for(int i=0; i < resources.size(); i++) {
+			resourceManager->removeResource(resources[i]);
+			delete resources[i];
+		}
+		resources.clear();
+		names.clear();
+	}
+
+	// the C string variant builds the name for every lookup, which is how
+	// most game code calls getResource()
+	void run(int iterations) {
+		ResourceManager *resourceManager = CoreServices::getInstance()->getResourceManager();
+		for(int n=0; n < iterations; n++) {
+			int index = (n * 131) % BENCH_RESOURCE_COUNT;
+			Resource *resource;
+			if(fromCString)
+				resource = resourceManager->getResource(Resource::RESOURCE_TEXTURE, names[index].c_str());
+			else
+				resource = resourceManager->getResource(Resource::RESOURCE_TEXTURE, names[index]);
+			benchSink += resource->getResourceType();
+		}
+	}
+
+	bool fromCString;
+	vector<String> names;
+	vector<Resource*> resources;
+};
+
+// ---- text
+
+#define BENCH_TEXT_COUNT 4
+
+static const char *benchTexts[BENCH_TEXT_COUNT] = {
+	"Score: 1234567",
+	"The quick brown fox jumps over the lazy dog",
+	"Health 100 / Armor 50",
+	"Press any key to continue..."
+};
+
+class LabelBenchmark : public Benchmark {
+public:
+	LabelBenchmark(String fontFile, bool measureOnly) : Benchmark(measureOnly ? "label_measure_text" : "label_set_text", "text") {
+		this->fontFile = fontFile;
+		this->measureOnly = measureOnly;
+		font = NULL;
+		label = NULL;
+	}
+
+	void setUp() {
+		font = new Font(fontFile);
+		label = new Label(font, "", 24, Label::ANTIALIAS_FULL);
+	}
+
+	void tearDown() {
+		delete label;
+		delete font;
+		label = NULL;
+		font = NULL;
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			if(measureOnly) {
+				benchSink += label->getTextWidth(font, benchTexts[n % BENCH_TEXT_COUNT], 24);
+			} else {
+				label->setText(benchTexts[n % BENCH_TEXT_COUNT]);
+				benchSink += label->getWidth();
+			}
+		}
+	}
+
+	String fontFile;
+	bool measureOnly;
+	Font *font;
+	Label *label;
+};
+
+// ---- images
+
+class ImageBlurBenchmark : public Benchmark {
+public:
+	ImageBlurBenchmark(int size, int blurSize) : Benchmark("image_fast_blur", "image") {
+		this->size = size;
+		this->blurSize = blurSize;
+		itemsPerIteration = size * size;
+		image = NULL;
+	}
+
+	void setUp() {
+		image = new Image(size, size);
+		Perlin *noise = new Perlin(4, 8.0, 1.0, BENCH_SEED);
+		image->fillNoise(noise, true, false);
+		delete noise;
+	}
+
+	void tearDown() {
+		delete image;
+		image = NULL;
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			image->fastBlur(blurSize);
+		}
+		benchSink += image->getPixel(0, 0).r;
+	}
+
+	int size;
+	int blurSize;
+	Image *image;
+};
+
+// ---- file io
+
+class FileReadBenchmark : public Benchmark {
+public:
+	FileReadBenchmark(String fileName, bool readAll) : Benchmark(readAll ? "osbasics_read_all" : "osbasics_read_chunked", "io") {
+		this->fileName = fileName;
+		this->readAll = readAll;
+	}
+
+	void setUp() {
+		OSFILE *file = OSBasics::open(fileName, "rb");
+		OSBasics::seek(file, 0, SEEK_END);
+		itemsPerIteration = OSBasics::tell(file);
+		OSBasics::close(file);
+	}
+
+	void run(int iterations) {
+		char chunk[4096];
+		for(int n=0; n < iterations; n++) {
+			OSFILE *file = OSBasics::open(fileName, "rb");
+			if(readAll) {
+				long size;
+				char *data = OSBasics::readAll(file, &size);
+				benchSink += data[size / 2];
+				free(data);
+			} else {
+				size_t read;
+				while((read = OSBasics::read(chunk, 1, sizeof(chunk), file)) > 0) {
+					benchSink += chunk[read - 1];
+				}
+			}
+			OSBasics::close(file);
+		}
+	}
+
+	String fileName;
+	bool readAll;
+};
+
+// ---- job system
+
+#define BENCH_JOB_ITEMS 65536
+
+class VectorParallelForBody : public ParallelForBody {
+public:
+	void run(int begin, int end) {
+		for(int i=begin; i < end; i++) {
+			Vector3 v = in[i].crossProduct(Vector3(0, 1, 0));
+			v.Normalize();
+			out[i] = v + in[i];
+		}
+	}
+
+	Vector3 *in;
+	Vector3 *out;
+};
+
+class ParallelForBenchmark : public Benchmark {
+public:
+	ParallelForBenchmark(Core *core, int numThreads, String name) : Benchmark(name, "jobs") {
+		this->core = core;
+		this->numThreads = numThreads;
+		itemsPerIteration = BENCH_JOB_ITEMS;
+		jobSystem = NULL;
+	}
+
+	// the calling thread takes part in the loop, so it counts as one thread
+	void setUp() {
+		srand(BENCH_SEED);
+		for(int i=0; i < BENCH_JOB_ITEMS; i++) {
+			in[i] = randomVector(10);
+		}
+		body.in = in;
+		body.out = out;
+		jobSystem = new JobSystem(core, numThreads - 1);
+	}
+
+	void tearDown() {
+		delete jobSystem;
+		jobSystem = NULL;
+	}
+
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			jobSystem->parallelFor(0, BENCH_JOB_ITEMS, 0, &body);
+		}
+		benchSink += out[0].x;
+	}
+
+	Core *core;
+	int numThreads;
+	JobSystem *jobSystem;
+	VectorParallelForBody body;
+	Vector3 in[BENCH_JOB_ITEMS];
+	Vector3 out[BENCH_JOB_ITEMS];
+};
+
+void addCoreBenchmarks(BenchmarkRunner *runner, Core *core, String assetPath) {
+	String meshFile = assetPath + "/ninja.mesh";
+
+	runner->addBenchmark(new Matrix4MultiplyBenchmark());
+	runner->addBenchmark(new Matrix4InverseBenchmark());
+	runner->addBenchmark(new Matrix4TransformBenchmark());
+	runner->addBenchmark(new Vector3OpsBenchmark());
+	runner->addBenchmark(new QuaternionSlerpBenchmark());
+	runner->addBenchmark(new QuaternionMatrixBenchmark());
+
+	runner->addBenchmark(new MeshLoadBenchmark(meshFile));
+	runner->addBenchmark(new MeshNormalsBenchmark(meshFile, true));
+	runner->addBenchmark(new MeshNormalsBenchmark(meshFile, false));
+	runner->addBenchmark(new RenderDataArrayBenchmark(meshFile));
+
+	runner->addBenchmark(new SkinningBenchmark(assetPath, false));
+	runner->addBenchmark(new SkinningBenchmark(assetPath, true));
+
+	runner->addBenchmark(new EventDispatchBenchmark(false));
+	runner->addBenchmark(new EventDispatchBenchmark(true));
+
+	runner->addBenchmark(new ResourceLookupBenchmark(false));
+	runner->addBenchmark(new ResourceLookupBenchmark(true));
+
+	runner->addBenchmark(new LabelBenchmark(assetPath + "/LeagueScript.otf", false));
+	runner->addBenchmark(new LabelBenchmark(assetPath + "/LeagueScript.otf", true));
+
+	runner->addBenchmark(new ImageBlurBenchmark(256, 4));
+
+	runner->addBenchmark(new FileReadBenchmark(meshFile, true));
+	runner->addBenchmark(new FileReadBenchmark(meshFile, false));
+
+	int threadCounts[6] = { 1, 2, 4, 8, 16, 32 };
+	for(int i=0; i < 6; i++) {
+		char name[64];
+		sprintf(name, "parallel_for_%d_threads", threadCounts[i]);
+		runner->addBenchmark(new ParallelForBenchmark(core, threadCounts[i], name));
+	}
+}
@@ -0,0 +1,136 @@
+
+#include "polybench.h"
+
+// The 3D physics and networking modules have no Linux build of their own,
+// the polybench_modules target compiles their sources in and defines
+// POLYBENCH_MODULES.
+#ifdef POLYBENCH_MODULES
+
+#include "PolyCollisionScene.h"
+#include "PolyCollisionSceneEntity.h"
+#include "PolyPeer.h"
+
+#define BENCH_SEED 1234
+
+// ---- collision
+
+class CollisionSceneBenchmark : public Benchmark {
+public:
+	CollisionSceneBenchmark(int numEntities) : Benchmark("collision_scene_update", "physics") {
+		this->numEntities = numEntities;
+		itemsPerIteration = numEntities;
+		scene = NULL;
+	}
+
+	void setUp() {
+		srand(BENCH_SEED);
+		scene = new CollisionScene(true);
+		for(int i=0; i < numEntities; i++) {
+			ScenePrimitive *box = new ScenePrimitive(ScenePrimitive::TYPE_BOX, 1, 1, 1);
+			box->setPosition(20.0 * rand() / RAND_MAX - 10.0, 20.0 * rand() / RAND_MAX - 10.0, 20.0 * rand() / RAND_MAX - 10.0);
+			scene->addCollisionChild(box, false, CollisionSceneEntity::SHAPE_BOX);
+			entities.push_back(box);
+		}
+		frame = 0;
+	}
+
+	void tearDown() {
+		delete scene;
+		for(int i=0; i < entities.size(); i++) {
+			delete entities[i];
+		}
+		entities.clear();
+		scene = NULL;
+	}
+
+	// every frame moves the entities a little, so the broadphase has
+	// to update and the set of overlapping pairs changes
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			Number offset = (frame % 2) ? 0.05 : -0.05;
+			for(int i=0; i < entities.size(); i++) {
+				entities[i]->Translate(offset, 0, offset);
+			}
+			scene->Update();
+			frame++;
+		}
+		benchSink += entities[0]->getPosition().x;
+	}
+
+	int numEntities;
+	int frame;
+	CollisionScene *scene;
+	vector<ScenePrimitive*> entities;
+};
+
+// ---- networking
+
+class BenchPeer : public Peer {
+public:
+	BenchPeer() : Peer(0) { packetsHandled = 0; }
+
+	void handlePacket(Packet *packet, PeerConnection *connection) {
+		packetsHandled++;
+	}
+
+	// feeds a packet through the same path as data read from the socket
+	void receive(SocketEvent *event) {
+		socket->dispatchEventNoDelete(event, SocketEvent::EVENT_DATA_RECEIVED);
+	}
+
+	int packetsHandled;
+};
+
+#define BENCH_PEER_CONNECTIONS 16
+
+class PeerPacketBenchmark : public Benchmark {
+public:
+	PeerPacketBenchmark() : Benchmark("peer_handle_packet", "network") {
+		peer = NULL;
+	}
+
+	void setUp() {
+		peer = new BenchPeer();
+		for(int i=0; i < BENCH_PEER_CONNECTIONS; i++) {
+			events[i].fromAddress.setAddress(0x7F000001, 4000 + i);
+			events[i].dataSize = sizeof(PacketHeader) + 64;
+			Packet *packet = (Packet*)events[i].data;
+			memset(packet, 0, events[i].dataSize);
+			packet->header.size = 64;
+		}
+		sequence = 1;
+	}
+
+	void tearDown() {
+		delete peer;
+		peer = NULL;
+	}
+
+	// sequence numbers keep increasing so no packet is dropped as old
+	void run(int iterations) {
+		for(int n=0; n < iterations; n++) {
+			SocketEvent *event = &events[n % BENCH_PEER_CONNECTIONS];
+			Packet *packet = (Packet*)event->data;
+			packet->header.sequence = sequence++;
+			peer->receive(event);
+		}
+		benchSink += peer->packetsHandled;
+	}
+
+	BenchPeer *peer;
+	SocketEvent events[BENCH_PEER_CONNECTIONS];
+	unsigned int sequence;
+};
+
+void addModuleBenchmarks(BenchmarkRunner *runner, Core *core, String assetPath) {
+	runner->addBenchmark(new CollisionSceneBenchmark(128));
+	runner->addBenchmark(new PeerPacketBenchmark());
+}
+
+#else
+
+void addModuleBenchmarks(BenchmarkRunner *runner, Core *core, String assetPath) {
+
+}
+
+#endif
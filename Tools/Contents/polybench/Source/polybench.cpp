@@ -0,0 +1,215 @@
+
+#include "polybench.h"
+#include <algorithm>
+#include <math.h>
+#include <time.h>
+
+vector<BenchArg> args;
+volatile Number benchSink = 0;
+
+String getArg(String argName) {
+	for(int i=0; i < args.size(); i++) {
+		if(args[i].name == argName) {
+			return args[i].value;
+		}
+	}
+	return "";
+}
+
+Benchmark::Benchmark(String name, String group) {
+	this->name = name;
+	this->group = group;
+	itemsPerIteration = 1;
+}
+
+Benchmark::~Benchmark() {
+
+}
+
+BenchmarkRunner::BenchmarkRunner(Core *core) {
+	this->core = core;
+	filter = "";
+	numSamples = 25;
+	minSampleTime = 2000000;
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+	for(int i=0; i < benchmarks.size(); i++) {
+		delete benchmarks[i];
+	}
+}
+
+void BenchmarkRunner::addBenchmark(Benchmark *benchmark) {
+	benchmarks.push_back(benchmark);
+}
+
+void BenchmarkRunner::setFilter(String filter) {
+	this->filter = filter;
+}
+
+void BenchmarkRunner::setNumSamples(int numSamples) {
+	if(numSamples < 1)
+		numSamples = 1;
+	this->numSamples = numSamples;
+}
+
+void BenchmarkRunner::setMinSampleTime(unsigned long long nanoseconds) {
+	minSampleTime = nanoseconds;
+}
+
+unsigned long long BenchmarkRunner::timeRun(Benchmark *benchmark, int iterations) {
+	unsigned long long start = core->getTicksNanoseconds();
+	benchmark->run(iterations);
+	return core->getTicksNanoseconds() - start;
+}
+
+BenchmarkResult BenchmarkRunner::runBenchmark(Benchmark *benchmark) {
+	BenchmarkResult result;
+	result.name = benchmark->name;
+	result.group = benchmark->group;
+	result.itemsPerIteration = benchmark->itemsPerIteration;
+
+	// the calibration runs double as warmup
+	int iterations = 1;
+	while(timeRun(benchmark, iterations) < minSampleTime && iterations < (1 << 28)) {
+		iterations *= 2;
+	}
+
+	vector<double> times;
+	for(int i=0; i < numSamples; i++) {
+		times.push_back((double)timeRun(benchmark, iterations) / (double)iterations);
+	}
+	std::sort(times.begin(), times.end());
+
+	double sum = 0;
+	for(int i=0; i < times.size(); i++) {
+		sum += times[i];
+	}
+	result.meanNs = sum / times.size();
+
+	double variance = 0;
+	for(int i=0; i < times.size(); i++) {
+		variance += (times[i] - result.meanNs) * (times[i] - result.meanNs);
+	}
+	result.stdDevNs = sqrt(variance / times.size());
+
+	result.minNs = times[0];
+	if(times.size() % 2)
+		result.medianNs = times[times.size() / 2];
+	else
+		result.medianNs = (times[times.size() / 2 - 1] + times[times.size() / 2]) * 0.5;
+
+	int p99Index = (int)ceil(0.99 * times.size()) - 1;
+	result.p99Ns = times[p99Index];
+
+	result.samples = times.size();
+	result.iterations = (long long)iterations * times.size();
+	return result;
+}
+
+void BenchmarkRunner::runAll() {
+	printf("%-14s %-36s %14s %14s %14s %16s\n", "group", "benchmark", "median ns", "min ns", "p99 ns", "items/s");
+	for(int i=0; i < benchmarks.size(); i++) {
+		Benchmark *benchmark = benchmarks[i];
+		if(filter != "" && strstr(benchmark->group.c_str(), filter.c_str()) == NULL && strstr(benchmark->name.c_str(), filter.c_str()) == NULL)
+			continue;
+
+		benchmark->setUp();
+		BenchmarkResult result = runBenchmark(benchmark);
+		benchmark->tearDown();
+
+		printf("%-14s %-36s %14.1f %14.1f %14.1f %16.0f\n", result.group.c_str(), result.name.c_str(), result.medianNs, result.minNs, result.p99Ns, result.itemsPerIteration * 1e9 / result.medianNs);
+		fflush(stdout);
+		results.push_back(result);
+	}
+}
+
+static String jsonString(String str) {
+	string out = "\"";
+	const char *c = str.c_str();
+	for(int i=0; c[i] != 0; i++) {
+		if(c[i] == '"' || c[i] == '\\')
+			out += '\\';
+		out += c[i];
+	}
+	out += '"';
+	return String(out);
+}
+
+bool BenchmarkRunner::writeJSON(String fileName) {
+	FILE *f = fopen(fileName.c_str(), "w");
+	if(!f)
+		return false;
+
+	fprintf(f, "{\n");
+	fprintf(f, "\t\"suite\": \"polybench\",\n");
+	fprintf(f, "\t\"version\": 1,\n");
+	fprintf(f, "\t\"timestamp\": %lld,\n", (long long)time(NULL));
+	fprintf(f, "\t\"cpuCores\": %d,\n", JobSystem::getNumCPUCores());
+	fprintf(f, "\t\"samples\": %d,\n", numSamples);
+	fprintf(f, "\t\"results\": [\n");
+	for(int i=0; i < results.size(); i++) {
+		BenchmarkResult &r = results[i];
+		fprintf(f, "\t\t{\"group\": %s, \"name\": %s, \"iterations\": %lld, \"samples\": %d, ", jsonString(r.group).c_str(), jsonString(r.name).c_str(), r.iterations, r.samples);
+		fprintf(f, "\"meanNs\": %.3f, \"medianNs\": %.3f, \"minNs\": %.3f, \"p99Ns\": %.3f, \"stdDevNs\": %.3f, ", r.meanNs, r.medianNs, r.minNs, r.p99Ns, r.stdDevNs);
+		fprintf(f, "\"itemsPerIteration\": %d, \"itemsPerSecond\": %.1f}%s\n", r.itemsPerIteration, r.itemsPerIteration * 1e9 / r.medianNs, (i < results.size() - 1) ? "," : "");
+	}
+	fprintf(f, "\t]\n");
+	fprintf(f, "}\n");
+
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	printf("Polycode benchmark suite v0.1\n");
+
+	for(int i=0; i < argc; i++) {
+		String argString = String(argv[i]);
+		vector<String> bits = argString.split("=");
+		if(bits.size() == 2) {
+			BenchArg arg;
+			arg.name = bits[0];
+			arg.value = bits[1];
+			args.push_back(arg);
+		}
+	}
+
+	String assetPath = getArg("--assets");
+	if(assetPath == "")
+		assetPath = "../../../Examples/C++";
+
+	// benchmarks run without a display, on the null renderer, and every
+	// frame advances the clock by exactly 1/60th of a second
+	HeadlessCore *core = new HeadlessCore(640, 480, 0);
+	core->setSimulatedFrameTime(1.0/60.0);
+	core->Update();
+
+	BenchmarkRunner *runner = new BenchmarkRunner(core);
+	if(getArg("--filter") != "")
+		runner->setFilter(getArg("--filter"));
+	if(getArg("--samples") != "")
+		runner->setNumSamples(atoi(getArg("--samples").c_str()));
+	if(getArg("--sample-time") != "")
+		runner->setMinSampleTime((unsigned long long)(atof(getArg("--sample-time").c_str()) * 1000000.0));
+
+	addCoreBenchmarks(runner, core, assetPath);
+	addModuleBenchmarks(runner, core, assetPath);
+
+	runner->runAll();
+
+	int retVal = 0;
+	if(getArg("--out") != "") {
+		if(runner->writeJSON(getArg("--out"))) {
+			printf("\nWrote %d results to %s\n", (int)runner->results.size(), getArg("--out").c_str());
+		} else {
+			printf("\nCould not write %s\n", getArg("--out").c_str());
+			retVal = 1;
+		}
+	}
+
+	delete runner;
+	delete core;
+	return retVal;
+}
@@ -107,12 +107,15 @@ void addToISkeleton(ISkeleton *skel, IBone *parent, const struct aiScene *sc, co
 	skel->addIBone(bone, getBoneID(bone->name));
 }
 
-int exportToFile(const char *fileName, bool swapZY) {
+int exportToFile(const char *fileName, bool swapZY, bool packed) {
 	String fileNameMesh = String(fileName)+".mesh";
 	OSFILE *outFile = OSBasics::open(fileNameMesh.c_str(), "wb");
 	Polycode::Mesh *mesh = new Polycode::Mesh(Mesh::TRI_MESH);
 	addToMesh(mesh, scene, scene->mRootNode, swapZY);
-	mesh->saveToFile(outFile);
+	if(packed)
+		mesh->savePackedToFile(outFile);
+	else
+		mesh->saveToFile(outFile);
 	OSBasics::close(outFile);
 
 	if(hasWeights) {
@@ -164,11 +167,33 @@ int exportToFile(const char *fileName, bool swapZY) {
 	return 1;
 }
 
+int packMesh(const char *sourceFileName, const char *fileName) {
+	Polycode::Mesh *mesh = new Polycode::Mesh(Mesh::TRI_MESH);
+	OSFILE *inFile = OSBasics::open(sourceFileName, "rb");
+	if(!inFile) {
+		printf("Error opening %s\n", sourceFileName);
+		delete mesh;
+		return 0;
+	}
+	mesh->loadFromFile(inFile);
+	OSBasics::close(inFile);
+
+	printf("Packing %d polygons...\n", mesh->getPolygonCount());
+	mesh->savePackedToFile(String(fileName));
+	delete mesh;
+	return 1;
+}
+
 int main(int argc, char **argv) {
 
-	if(argc != 4) {
+	if(argc == 4 && strcmp(argv[1], "-pack") == 0) {
+		return packMesh(argv[2], argv[3]);
+	}
+
+	if(argc != 4 && argc != 5) {
 		printf("\n\nInvalid arguments!\n");
-		printf("usage: polyimport <source_file> <output_file> (Swap Z/Y:<true>/<false>) \n\n");
+		printf("usage: polyimport <source_file> <output_file> (Swap Z/Y:<true>/<false>) [packed]\n");
+		printf("       polyimport -pack <source_mesh> <output_mesh>\n\n");
 		return 0;
 	}
 	
@@ -179,7 +204,8 @@ int main(int argc, char **argv) {
 	printf("Loading %s...\n", argv[1]);
 	scene = aiImportFile(argv[1],aiProcessPreset_TargetRealtime_Quality);
 
-	exportToFile(argv[2], strcmp(argv[3], "true") == 0);
+	bool packed = (argc == 5 && strcmp(argv[4], "packed") == 0);
+	exportToFile(argv[2], strcmp(argv[3], "true") == 0, packed);
 
 	aiReleaseImport(scene);
 	return 1;
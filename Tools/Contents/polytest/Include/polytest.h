@@ -0,0 +1,63 @@
+#pragma once
+
+#include "stdio.h"
+#include "Polycode.h"
+#include "PolyHeadlessCore.h"
+
+using namespace Polycode;
+
+/**
+* A single unit test. Subclasses implement run() and report their checks with POLYTEST_CHECK.
+*/
+class Test {
+public:
+	Test(String name, String group);
+	virtual ~Test();
+
+	virtual void run() = 0;
+
+	String name;
+	String group;
+};
+
+/**
+* Runs tests and counts the failed checks.
+*/
+class TestRunner {
+public:
+	TestRunner();
+	~TestRunner();
+
+	/**
+	* Adds a test. The runner takes ownership of it.
+	*/
+	void addTest(Test *test);
+
+	/**
+	* Only runs tests whose group or name contains the filter.
+	*/
+	void setFilter(String filter);
+
+	/**
+	* Runs the tests and prints a line for every test and every failed check.
+	* @return Number of tests that failed.
+	*/
+	int runAll();
+
+protected:
+
+	vector<Test*> tests;
+	String filter;
+};
+
+/**
+* Records the result of a check made by the test that is running.
+*/
+void polytestCheck(bool condition, const char *expression, const char *file, int line);
+
+#define POLYTEST_CHECK(condition) polytestCheck((condition), #condition, __FILE__, __LINE__)
+
+void polytestSleep(unsigned int milliseconds);
+
+void addJobSystemTests(TestRunner *runner, Core *core);
+void addResourceTests(TestRunner *runner, Core *core);
@@ -0,0 +1,309 @@
+
+#include "polytest.h"
+
+#define TEST_WORKERS 3
+
+// ---- jobs
+
+// sets a flag and remembers whether it ran on the main thread
+class FlagJob : public Job {
+public:
+	FlagJob() {
+		jobSystem = NULL;
+		done = false;
+		ranOnMainThread = false;
+	}
+
+	void run() {
+		ranOnMainThread = jobSystem->isMainThread();
+		done = true;
+	}
+
+	JobSystem *jobSystem;
+	bool done;
+	bool ranOnMainThread;
+};
+
+// checks that all jobs it depends on were done when it started
+class DependentJob : public Job {
+public:
+	DependentJob() {
+		dependencies = NULL;
+		numDependencies = 0;
+		done = false;
+		dependenciesDone = false;
+	}
+
+	void run() {
+		dependenciesDone = true;
+		for(int i=0; i < numDependencies; i++) {
+			if(!dependencies[i].done)
+				dependenciesDone = false;
+		}
+		done = true;
+	}
+
+	FlagJob *dependencies;
+	int numDependencies;
+	bool done;
+	bool dependenciesDone;
+};
+
+// a worker job that queues a main thread only job with the same counter
+class SpawningJob : public Job {
+public:
+	void run() {
+		child.jobSystem = jobSystem;
+		child.mainThreadOnly = true;
+		jobSystem->submit(&child, counter);
+	}
+
+	JobSystem *jobSystem;
+	FlagJob child;
+};
+
+class CoverageBody : public ParallelForBody {
+public:
+	CoverageBody(int begin, int end) {
+		this->begin = begin;
+		hits.resize(end - begin, 0);
+		outOfRange = false;
+	}
+
+	// ranges do not overlap, so every index is only written by one thread
+	void run(int rangeBegin, int rangeEnd) {
+		if(rangeBegin < begin || rangeEnd > begin + (int)hits.size() || rangeBegin >= rangeEnd) {
+			outOfRange = true;
+			return;
+		}
+		for(int i=rangeBegin; i < rangeEnd; i++) {
+			hits[i - begin]++;
+		}
+	}
+
+	bool allHitOnce() {
+		for(int i=0; i < hits.size(); i++) {
+			if(hits[i] != 1)
+				return false;
+		}
+		return true;
+	}
+
+	int begin;
+	vector<int> hits;
+	bool outOfRange;
+};
+
+class CountingBody : public ParallelForBody {
+public:
+	CountingBody() { calls = 0; }
+	void run(int begin, int end) { calls++; }
+	int calls;
+};
+
+// ---- tests
+
+class JobSystemTest : public Test {
+public:
+	JobSystemTest(String name, Core *core, int numWorkers) : Test(name, "jobs") {
+		this->core = core;
+		this->numWorkers = numWorkers;
+	}
+
+	void run() {
+		JobSystem *jobSystem = new JobSystem(core, numWorkers);
+		runWith(jobSystem);
+		delete jobSystem;
+	}
+
+	virtual void runWith(JobSystem *jobSystem) = 0;
+
+	Core *core;
+	int numWorkers;
+};
+
+class CounterWaitTest : public JobSystemTest {
+public:
+	CounterWaitTest(Core *core, int numWorkers) : JobSystemTest(numWorkers ? "counter_wait" : "counter_wait_no_workers", core, numWorkers) {}
+
+	void runWith(JobSystem *jobSystem) {
+		JobCounter counter;
+		POLYTEST_CHECK(jobSystem->isFinished(&counter));
+
+		// the counter is reused for the second round
+		for(int round=0; round < 2; round++) {
+			vector<FlagJob> jobs(256);
+			for(int i=0; i < jobs.size(); i++) {
+				jobs[i].jobSystem = jobSystem;
+				jobSystem->submit(&jobs[i], &counter);
+			}
+			jobSystem->wait(&counter);
+
+			POLYTEST_CHECK(jobSystem->isFinished(&counter));
+			POLYTEST_CHECK(counter.count == 0);
+			bool allDone = true;
+			for(int i=0; i < jobs.size(); i++) {
+				if(!jobs[i].done)
+					allDone = false;
+			}
+			POLYTEST_CHECK(allDone);
+		}
+	}
+};
+
+class DependencyTest : public JobSystemTest {
+public:
+	DependencyTest(Core *core) : JobSystemTest("dependency_release", core, TEST_WORKERS) {}
+
+	void runWith(JobSystem *jobSystem) {
+		// the first jobs only run on the main thread, so nothing finishes them
+		// before wait() is called and the dependent job has to be parked
+		JobCounter first;
+		FlagJob firstJobs[8];
+		for(int i=0; i < 8; i++) {
+			firstJobs[i].jobSystem = jobSystem;
+			firstJobs[i].mainThreadOnly = true;
+			jobSystem->submit(&firstJobs[i], &first);
+		}
+
+		JobCounter second;
+		DependentJob dependent;
+		dependent.dependencies = firstJobs;
+		dependent.numDependencies = 8;
+		jobSystem->submit(&dependent, &second, &first);
+
+		polytestSleep(20);
+		POLYTEST_CHECK(!dependent.done);
+		POLYTEST_CHECK(!jobSystem->isFinished(&second));
+
+		jobSystem->wait(&second);
+		POLYTEST_CHECK(jobSystem->isFinished(&first));
+		POLYTEST_CHECK(dependent.done);
+		POLYTEST_CHECK(dependent.dependenciesDone);
+
+		// a dependency that already finished does not hold the job back
+		JobCounter third;
+		DependentJob immediate;
+		immediate.dependencies = firstJobs;
+		immediate.numDependencies = 8;
+		jobSystem->submit(&immediate, &third, &first);
+		jobSystem->wait(&third);
+		POLYTEST_CHECK(immediate.done);
+		POLYTEST_CHECK(immediate.dependenciesDone);
+	}
+};
+
+class MainThreadAffinityTest : public JobSystemTest {
+public:
+	MainThreadAffinityTest(Core *core) : JobSystemTest("main_thread_only", core, TEST_WORKERS) {}
+
+	void runWith(JobSystem *jobSystem) {
+		JobCounter counter;
+		vector<FlagJob> mainJobs(64);
+		vector<FlagJob> workerJobs(64);
+		for(int i=0; i < 64; i++) {
+			mainJobs[i].jobSystem = jobSystem;
+			mainJobs[i].mainThreadOnly = true;
+			jobSystem->submit(&mainJobs[i], &counter);
+			workerJobs[i].jobSystem = jobSystem;
+			jobSystem->submit(&workerJobs[i], &counter);
+		}
+
+		// main thread only jobs queued from a worker
+		vector<SpawningJob> spawners(16);
+		for(int i=0; i < spawners.size(); i++) {
+			spawners[i].jobSystem = jobSystem;
+			jobSystem->submit(&spawners[i], &counter);
+		}
+		jobSystem->wait(&counter);
+
+		bool allOnMain = true;
+		for(int i=0; i < mainJobs.size(); i++) {
+			if(!mainJobs[i].done || !mainJobs[i].ranOnMainThread)
+				allOnMain = false;
+		}
+		for(int i=0; i < spawners.size(); i++) {
+			if(!spawners[i].child.done || !spawners[i].child.ranOnMainThread)
+				allOnMain = false;
+		}
+		POLYTEST_CHECK(allOnMain);
+
+		bool allDone = true;
+		for(int i=0; i < workerJobs.size(); i++) {
+			if(!workerJobs[i].done)
+				allDone = false;
+		}
+		POLYTEST_CHECK(allDone);
+
+		// runMainThreadJobs() runs them without waiting
+		FlagJob later;
+		later.jobSystem = jobSystem;
+		later.mainThreadOnly = true;
+		jobSystem->submit(&later);
+		polytestSleep(20);
+		POLYTEST_CHECK(!later.done);
+		jobSystem->runMainThreadJobs();
+		POLYTEST_CHECK(later.done);
+		POLYTEST_CHECK(later.ranOnMainThread);
+	}
+};
+
+class ParallelForTest : public JobSystemTest {
+public:
+	ParallelForTest(Core *core, int numWorkers) : JobSystemTest(numWorkers ? "parallel_for_coverage" : "parallel_for_coverage_no_workers", core, numWorkers) {}
+
+	void runWith(JobSystem *jobSystem) {
+		int grainSizes[] = {0, 1, 7, 64, 1000, 5000};
+		for(int i=0; i < 6; i++) {
+			CoverageBody body(100, 1100);
+			jobSystem->parallelFor(100, 1100, grainSizes[i], &body);
+			POLYTEST_CHECK(!body.outOfRange);
+			POLYTEST_CHECK(body.allHitOnce());
+		}
+
+		// ranges that do not divide evenly by the grain size
+		CoverageBody odd(-13, 990);
+		jobSystem->parallelFor(-13, 990, 10, &odd);
+		POLYTEST_CHECK(!odd.outOfRange);
+		POLYTEST_CHECK(odd.allHitOnce());
+
+		CountingBody empty;
+		jobSystem->parallelFor(10, 10, 1, &empty);
+		jobSystem->parallelFor(10, 5, 1, &empty);
+		POLYTEST_CHECK(empty.calls == 0);
+	}
+};
+
+class IdleWakeupTest : public JobSystemTest {
+public:
+	IdleWakeupTest(Core *core) : JobSystemTest("idle_worker_wakeup", core, TEST_WORKERS) {}
+
+	void runWith(JobSystem *jobSystem) {
+		// long enough for all workers to go to sleep
+		polytestSleep(50);
+
+		// only a worker can run the job, the main thread does not help
+		JobCounter counter;
+		FlagJob job;
+		job.jobSystem = jobSystem;
+		jobSystem->submit(&job, &counter);
+
+		unsigned long long start = core->getTicksNanoseconds();
+		while(!jobSystem->isFinished(&counter) && core->getTicksNanoseconds() - start < 2000000000ULL) {
+			polytestSleep(1);
+		}
+		POLYTEST_CHECK(jobSystem->isFinished(&counter));
+		POLYTEST_CHECK(job.done);
+		POLYTEST_CHECK(!job.ranOnMainThread);
+	}
+};
+
+void addJobSystemTests(TestRunner *runner, Core *core) {
+	runner->addTest(new CounterWaitTest(core, TEST_WORKERS));
+	runner->addTest(new CounterWaitTest(core, 0));
+	runner->addTest(new DependencyTest(core));
+	runner->addTest(new MainThreadAffinityTest(core));
+	runner->addTest(new ParallelForTest(core, TEST_WORKERS));
+	runner->addTest(new ParallelForTest(core, 0));
+	runner->addTest(new IdleWakeupTest(core));
+}
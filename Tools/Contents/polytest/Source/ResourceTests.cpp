@@ -0,0 +1,61 @@
+
+#include "polytest.h"
+
+#define TEST_RESOURCE_FOLDER "polytest_resources"
+#define TEST_MATERIAL_FILE TEST_RESOURCE_FOLDER "/polytest.mat"
+
+// a material loaded from a material file has to be found under the name
+// it has in the file, like SceneMesh::setMaterialByName() looks it up
+class MaterialLookupTest : public Test {
+public:
+	MaterialLookupTest() : Test("material_lookup", "resources") {}
+
+	void run() {
+		OSBasics::createFolder(TEST_RESOURCE_FOLDER);
+		FILE *file = fopen(TEST_MATERIAL_FILE, "w");
+		POLYTEST_CHECK(file != NULL);
+		if(!file)
+			return;
+		fprintf(file, "<polycode>\n\t<materials>\n\t\t<material name=\"PolytestMaterial\">\n\t\t</material>\n\t</materials>\n</polycode>\n");
+		fclose(file);
+
+		ResourceManager *resourceManager = CoreServices::getInstance()->getResourceManager();
+		resourceManager->parseMaterials(TEST_RESOURCE_FOLDER, false);
+
+		Material *material = (Material*)resourceManager->getResource(Resource::RESOURCE_MATERIAL, "PolytestMaterial");
+		POLYTEST_CHECK(material != NULL);
+		if(material) {
+			POLYTEST_CHECK(material->getName() == "PolytestMaterial");
+			POLYTEST_CHECK(material->getResourceName() == "PolytestMaterial");
+			resourceManager->removeResource(material);
+			delete material;
+		}
+
+		OSBasics::removeItem(TEST_MATERIAL_FILE);
+		OSBasics::removeItem(TEST_RESOURCE_FOLDER);
+	}
+};
+
+class ShaderNameTest : public Test {
+public:
+	ShaderNameTest() : Test("shader_name", "resources") {}
+
+	void run() {
+		FixedShader *shader = new FixedShader();
+		shader->setName("PolytestShader");
+		POLYTEST_CHECK(shader->getName() == "PolytestShader");
+
+		// the resource manager names loaded shaders after getName()
+		shader->setResourceName(shader->getName());
+		ResourceManager *resourceManager = CoreServices::getInstance()->getResourceManager();
+		resourceManager->addResource(shader);
+		POLYTEST_CHECK(resourceManager->getResource(Resource::RESOURCE_SHADER, "PolytestShader") == shader);
+		resourceManager->removeResource(shader);
+		delete shader;
+	}
+};
+
+void addResourceTests(TestRunner *runner, Core *core) {
+	runner->addTest(new MaterialLookupTest());
+	runner->addTest(new ShaderNameTest());
+}
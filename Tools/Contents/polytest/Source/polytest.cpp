@@ -0,0 +1,99 @@
+
+#include "polytest.h"
+#if defined(_WINDOWS) || defined(_MINGW)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static int checkFailures = 0;
+
+Test::Test(String name, String group) {
+	this->name = name;
+	this->group = group;
+}
+
+Test::~Test() {
+
+}
+
+TestRunner::TestRunner() {
+	filter = "";
+}
+
+TestRunner::~TestRunner() {
+	for(int i=0; i < tests.size(); i++) {
+		delete tests[i];
+	}
+}
+
+void TestRunner::addTest(Test *test) {
+	tests.push_back(test);
+}
+
+void TestRunner::setFilter(String filter) {
+	this->filter = filter;
+}
+
+int TestRunner::runAll() {
+	int failedTests = 0;
+	int numRun = 0;
+	for(int i=0; i < tests.size(); i++) {
+		Test *test = tests[i];
+		if(filter != "" && strstr(test->group.c_str(), filter.c_str()) == NULL && strstr(test->name.c_str(), filter.c_str()) == NULL)
+			continue;
+
+		checkFailures = 0;
+		test->run();
+		numRun++;
+		if(checkFailures > 0) {
+			failedTests++;
+			printf("FAIL %s/%s\n", test->group.c_str(), test->name.c_str());
+		} else {
+			printf("ok   %s/%s\n", test->group.c_str(), test->name.c_str());
+		}
+		fflush(stdout);
+	}
+	printf("\n%d of %d tests failed\n", failedTests, numRun);
+	return failedTests;
+}
+
+void polytestCheck(bool condition, const char *expression, const char *file, int line) {
+	if(condition)
+		return;
+	checkFailures++;
+	printf("  %s:%d: check failed: %s\n", file, line, expression);
+}
+
+void polytestSleep(unsigned int milliseconds) {
+#if defined(_WINDOWS) || defined(_MINGW)
+	Sleep(milliseconds);
+#else
+	usleep(milliseconds * 1000);
+#endif
+}
+
+int main(int argc, char **argv) {
+
+	printf("Polycode test suite v0.1\n");
+
+	// tests run without a display, on the null renderer
+	HeadlessCore *core = new HeadlessCore(640, 480, 0);
+
+	TestRunner *runner = new TestRunner();
+	for(int i=1; i < argc; i++) {
+		String argString = String(argv[i]);
+		vector<String> bits = argString.split("=");
+		if(bits.size() == 2 && bits[0] == "--filter")
+			runner->setFilter(bits[1]);
+	}
+
+	addJobSystemTests(runner, core);
+	addResourceTests(runner, core);
+
+	int failedTests = runner->runAll();
+
+	delete runner;
+	delete core;
+	return failedTests > 0 ? 1 : 0;
+}